@@ -70,17 +70,26 @@ macro(link_openblas)
     endif ()
 
     set(has_cblas OFF)
+    set(has_lapacke OFF)
 
     foreach (file IN LISTS include_files)
         get_filename_component(inc_file ${file} NAME)
         if (${inc_file} STREQUAL "cblas.h")
             set(has_cblas ON)
+        elseif (${inc_file} STREQUAL "lapacke.h")
+            set(has_lapacke ON)
         endif ()
     endforeach ()
 
     if (${has_cblas})
         target_link_libraries(${module_name} PUBLIC ${LIBRAPID_BLAS})
         set_blas_definition("OPENBLAS")
+
+        # OpenBLAS builds usually include LAPACK, which is used for factorisations
+        if (${has_lapacke})
+            message(STATUS "[ LIBRAPID ] Using LAPACK from OpenBLAS")
+            target_compile_definitions(${module_name} PUBLIC LIBRAPID_HAS_LAPACK)
+        endif ()
     else ()
         message(WARNING "[ LIBRAPID ] OpenBLAS does not contain cblas.h. Consider enabling LIBRAPID_GET_BLAS")
     endif ()
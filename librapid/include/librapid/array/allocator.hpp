@@ -0,0 +1,506 @@
+#ifndef LIBRAPID_ARRAY_ALLOCATOR_HPP
+#define LIBRAPID_ARRAY_ALLOCATOR_HPP
+
+/*
+ * This file defines the allocators used by Storage. Every block of host memory allocated for
+ * a Storage object goes through memory::getAllocator(), which defaults to a pooled allocator.
+ * Freed blocks are kept in per-thread and shared free lists, grouped by size class, so
+ * temporaries of the same size reuse memory instead of going back to the system.
+ */
+
+namespace librapid::memory {
+	/// Allocation statistics reported by an allocator. Counters are updated without
+	/// synchronisation between them, so a snapshot taken while other threads allocate may be
+	/// slightly inconsistent.
+	struct AllocatorStatistics {
+		size_t bytesInUse	 = 0; // Bytes currently handed out to callers
+		size_t bytesCached	 = 0; // Bytes held in free lists, ready for reuse
+		size_t systemBytes	 = 0; // Bytes currently obtained from the upstream allocator
+		size_t allocations	 = 0; // Total number of allocations
+		size_t deallocations = 0; // Total number of deallocations
+		size_t cacheHits	 = 0; // Allocations served from a free list
+	};
+
+	/// Interface for the host memory allocators used by Storage. Implementations must be
+	/// thread-safe.
+	class Allocator {
+	public:
+		virtual ~Allocator() = default;
+
+		/// Allocate \p bytes bytes, aligned to \p alignment. This must never return nullptr
+		/// \param bytes Number of bytes to allocate
+		/// \param alignment Alignment of the block, in bytes. This is a power of two
+		/// \return Pointer to the block
+		virtual void *allocate(size_t bytes, size_t alignment) = 0;
+
+		/// Release a block returned by allocate()
+		/// \param ptr Pointer to the block
+		/// \param bytes The size passed to allocate()
+		/// \param alignment The alignment passed to allocate()
+		virtual void deallocate(void *ptr, size_t bytes, size_t alignment) = 0;
+
+		/// Return any cached memory to the system
+		virtual void trim() {}
+
+		/// Return the current allocation statistics
+		virtual AllocatorStatistics statistics() const { return {}; }
+	};
+
+	/// An allocator which requests memory from the system on every call
+	class SystemAllocator : public Allocator {
+	public:
+		void *allocate(size_t bytes, size_t alignment) override;
+		void deallocate(void *ptr, size_t bytes, size_t alignment) override;
+		AllocatorStatistics statistics() const override;
+
+	private:
+		std::atomic<size_t> m_systemBytes	= 0;
+		std::atomic<size_t> m_allocations	= 0;
+		std::atomic<size_t> m_deallocations = 0;
+	};
+
+	/// Limits for a PoolAllocator
+	struct PoolLimits {
+		/// Blocks larger than this are never cached, and are allocated at exactly the requested
+		/// size instead of being rounded up to a size class
+		size_t maxBlockBytes = size_t(1) << 28;
+
+		/// Maximum number of bytes held in the shared free lists
+		size_t maxCachedBytes = size_t(1) << 30;
+
+		/// Maximum number of bytes held in the free lists of each thread
+		size_t maxThreadCacheBytes = size_t(1) << 26;
+	};
+
+	/// An allocator which rounds requests up to a size class and caches freed blocks for
+	/// reuse. Each thread has its own free lists, which need no locking. When they are full,
+	/// blocks go to a shared, locked pool, and once that is full they are returned to the
+	/// upstream allocator.
+	///
+	/// A PoolAllocator must outlive every thread which has used it. The default instance,
+	/// returned by defaultAllocator(), is never destroyed.
+	class PoolAllocator : public Allocator {
+	public:
+		/// Every pooled block is aligned to this many bytes. Requests for stricter alignment
+		/// bypass the pool
+		static constexpr size_t poolAlignment = 64;
+
+		/// Size classes are spaced four per power of two, from 64 bytes to 2^40 bytes
+		static constexpr size_t minClassShift = 6;
+		static constexpr size_t maxClassShift = 40;
+		static constexpr size_t numClasses	  = 4 * (maxClassShift - minClassShift) + 1;
+
+		explicit PoolAllocator(Allocator &upstream, const PoolLimits &limits = {});
+		PoolAllocator(const PoolAllocator &)			= delete;
+		PoolAllocator &operator=(const PoolAllocator &) = delete;
+		~PoolAllocator() override;
+
+		void *allocate(size_t bytes, size_t alignment) override;
+		void deallocate(void *ptr, size_t bytes, size_t alignment) override;
+
+		/// Release the calling thread's free lists and the shared free lists to the upstream
+		/// allocator. Other threads' free lists are bounded by PoolLimits::maxThreadCacheBytes
+		/// and are released when those threads exit
+		void trim() override;
+
+		AllocatorStatistics statistics() const override;
+
+		/// Change the limits of the pool. Cached memory above the new limits is released the
+		/// next time a block is freed or trim() is called
+		void setLimits(const PoolLimits &limits);
+
+		LIBRAPID_NODISCARD PoolLimits limits() const;
+
+		/// Return the index of the smallest size class which can hold \p bytes bytes
+		LIBRAPID_NODISCARD static size_t sizeClass(size_t bytes);
+
+		/// Return the number of bytes in size class \p index
+		LIBRAPID_NODISCARD static size_t classBytes(size_t index);
+
+	private:
+		using FreeLists = std::array<std::vector<void *>, numClasses>;
+
+		struct ThreadCache {
+			PoolAllocator *owner = nullptr;
+			FreeLists freeLists;
+			size_t bytes = 0;
+
+			~ThreadCache();
+		};
+
+		/// Return the calling thread's cache, or nullptr if the thread's cache belongs to a
+		/// different PoolAllocator
+		ThreadCache *threadCache();
+
+		/// Blocks which are not pooled are passed straight to the upstream allocator. This
+		/// depends only on the request, never on the limits, so allocate() and deallocate()
+		/// always agree
+		static bool pooled(size_t bytes, size_t alignment);
+
+		/// Move every block in \p lists to the shared pool, releasing any which do not fit
+		void releaseToShared(FreeLists &lists);
+
+		void releaseToUpstream(FreeLists &lists);
+
+		Allocator &m_upstream;
+
+		std::atomic<size_t> m_maxBlockBytes;
+		std::atomic<size_t> m_maxCachedBytes;
+		std::atomic<size_t> m_maxThreadCacheBytes;
+
+		std::mutex m_mutex;
+		FreeLists m_shared;
+		size_t m_sharedBytes = 0;
+
+		/// Blocks allocated above maxBlockBytes, which have no size class. They are recorded so
+		/// deallocate() recognises them even if the limits change while they are alive. Guarded
+		/// by m_mutex
+		std::unordered_set<void *> m_uncached;
+
+		/// The smallest block ever added to m_uncached. Smaller blocks skip the lookup
+		std::atomic<size_t> m_minUncachedBytes = std::numeric_limits<size_t>::max();
+
+		std::atomic<size_t> m_bytesInUse	= 0;
+		std::atomic<size_t> m_bytesCached	= 0;
+		std::atomic<size_t> m_systemBytes	= 0;
+		std::atomic<size_t> m_allocations	= 0;
+		std::atomic<size_t> m_deallocations = 0;
+		std::atomic<size_t> m_cacheHits		= 0;
+	};
+
+	LIBRAPID_INLINE void *SystemAllocator::allocate(size_t bytes, size_t alignment) {
+		// Some implementations require the size to be a multiple of the alignment
+		bytes = (bytes + alignment - 1) / alignment * alignment;
+
+#if defined(LIBRAPID_BLAS_MKLBLAS)
+		// MKL has its own memory allocation function
+		void *ptr = mkl_malloc(bytes, static_cast<int>(alignment));
+#elif defined(LIBRAPID_APPLE)
+		// Use posix_memalign
+		void *ptr = nullptr;
+		auto err  = posix_memalign(&ptr, alignment, bytes);
+		LIBRAPID_ASSERT(err == 0, "posix_memalign failed with error code {}", err);
+#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
+		void *ptr = _aligned_malloc(bytes, alignment);
+#else
+		void *ptr = std::aligned_alloc(alignment, bytes);
+#endif
+
+		LIBRAPID_ASSERT(ptr != nullptr, "Failed to allocate {} bytes of memory", bytes);
+		if (ptr == nullptr) LIBRAPID_UNLIKELY { throw std::bad_alloc(); }
+
+		m_systemBytes.fetch_add(bytes, std::memory_order_relaxed);
+		m_allocations.fetch_add(1, std::memory_order_relaxed);
+		return ptr;
+	}
+
+	LIBRAPID_INLINE void SystemAllocator::deallocate(void *ptr, size_t bytes, size_t alignment) {
+		if (!ptr) return;
+		bytes = (bytes + alignment - 1) / alignment * alignment;
+
+#if defined(LIBRAPID_BLAS_MKLBLAS)
+		mkl_free(ptr);
+#elif defined(LIBRAPID_APPLE)
+		free(ptr);
+#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
+		_aligned_free(ptr);
+#else
+		free(ptr);
+#endif
+
+		m_systemBytes.fetch_sub(bytes, std::memory_order_relaxed);
+		m_deallocations.fetch_add(1, std::memory_order_relaxed);
+	}
+
+	LIBRAPID_INLINE AllocatorStatistics SystemAllocator::statistics() const {
+		AllocatorStatistics res;
+		res.bytesInUse	  = m_systemBytes.load(std::memory_order_relaxed);
+		res.systemBytes	  = res.bytesInUse;
+		res.allocations	  = m_allocations.load(std::memory_order_relaxed);
+		res.deallocations = m_deallocations.load(std::memory_order_relaxed);
+		return res;
+	}
+
+	LIBRAPID_INLINE PoolAllocator::PoolAllocator(Allocator &upstream, const PoolLimits &limits) :
+			m_upstream(upstream), m_maxBlockBytes(limits.maxBlockBytes),
+			m_maxCachedBytes(limits.maxCachedBytes),
+			m_maxThreadCacheBytes(limits.maxThreadCacheBytes) {}
+
+	LIBRAPID_INLINE PoolAllocator::~PoolAllocator() {
+		if (ThreadCache *cache = threadCache()) {
+			releaseToUpstream(cache->freeLists);
+			cache->owner = nullptr;
+		}
+		releaseToUpstream(m_shared);
+	}
+
+	LIBRAPID_INLINE size_t PoolAllocator::sizeClass(size_t bytes) {
+		if (bytes <= (size_t(1) << minClassShift)) return 0;
+
+		// Find the leading bit of (bytes - 1), then use the next two bits to pick one of the
+		// four classes between consecutive powers of two
+		const size_t value	= bytes - 1;
+		const size_t shift	= static_cast<size_t>(std::bit_width(value)) - 1;
+		const size_t offset = (value >> (shift - 2)) & 3;
+		return (shift - minClassShift) * 4 + offset + 1;
+	}
+
+	LIBRAPID_INLINE size_t PoolAllocator::classBytes(size_t index) {
+		if (index == 0) return size_t(1) << minClassShift;
+		const size_t shift	= (index - 1) / 4 + minClassShift;
+		const size_t offset = (index - 1) % 4;
+		return (5 + offset) << (shift - 2);
+	}
+
+	LIBRAPID_INLINE auto PoolAllocator::threadCache() -> ThreadCache * {
+		thread_local ThreadCache cache;
+		if (cache.owner == nullptr) cache.owner = this;
+		return cache.owner == this ? &cache : nullptr;
+	}
+
+	LIBRAPID_INLINE bool PoolAllocator::pooled(size_t bytes, size_t alignment) {
+		return alignment <= poolAlignment && bytes <= (size_t(1) << maxClassShift);
+	}
+
+	LIBRAPID_INLINE void *PoolAllocator::allocate(size_t bytes, size_t alignment) {
+		m_allocations.fetch_add(1, std::memory_order_relaxed);
+
+		if (!pooled(bytes, alignment)) LIBRAPID_UNLIKELY {
+			void *ptr = m_upstream.allocate(bytes, alignment);
+			m_bytesInUse.fetch_add(bytes, std::memory_order_relaxed);
+			m_systemBytes.fetch_add(bytes, std::memory_order_relaxed);
+			return ptr;
+		}
+
+		// Blocks above the size limit are never cached, so don't bother searching for one, and
+		// don't round them up either
+		if (bytes > m_maxBlockBytes.load(std::memory_order_relaxed)) {
+			void *ptr = m_upstream.allocate(bytes, poolAlignment);
+
+			size_t minBytes = m_minUncachedBytes.load(std::memory_order_relaxed);
+			while (bytes < minBytes &&
+				   !m_minUncachedBytes.compare_exchange_weak(
+					 minBytes, bytes, std::memory_order_relaxed)) {}
+
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				m_uncached.insert(ptr);
+			}
+
+			m_bytesInUse.fetch_add(bytes, std::memory_order_relaxed);
+			m_systemBytes.fetch_add(bytes, std::memory_order_relaxed);
+			return ptr;
+		}
+
+		const size_t index = sizeClass(bytes);
+		const size_t size  = classBytes(index);
+		m_bytesInUse.fetch_add(size, std::memory_order_relaxed);
+
+		// Fast path -- reuse a block freed by this thread
+		if (ThreadCache *cache = threadCache()) LIBRAPID_LIKELY {
+			auto &list = cache->freeLists[index];
+			if (!list.empty()) {
+				void *ptr = list.back();
+				list.pop_back();
+				cache->bytes -= size;
+				m_bytesCached.fetch_sub(size, std::memory_order_relaxed);
+				m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+				return ptr;
+			}
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(m_mutex);
+			auto &list = m_shared[index];
+			if (!list.empty()) {
+				void *ptr = list.back();
+				list.pop_back();
+				m_sharedBytes -= size;
+				m_bytesCached.fetch_sub(size, std::memory_order_relaxed);
+				m_cacheHits.fetch_add(1, std::memory_order_relaxed);
+				return ptr;
+			}
+		}
+
+		void *ptr = m_upstream.allocate(size, poolAlignment);
+		m_systemBytes.fetch_add(size, std::memory_order_relaxed);
+		return ptr;
+	}
+
+	LIBRAPID_INLINE void PoolAllocator::deallocate(void *ptr, size_t bytes, size_t alignment) {
+		if (!ptr) return;
+		m_deallocations.fetch_add(1, std::memory_order_relaxed);
+
+		if (!pooled(bytes, alignment)) LIBRAPID_UNLIKELY {
+			m_upstream.deallocate(ptr, bytes, alignment);
+			m_bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+			m_systemBytes.fetch_sub(bytes, std::memory_order_relaxed);
+			return;
+		}
+
+		if (bytes >= m_minUncachedBytes.load(std::memory_order_relaxed)) LIBRAPID_UNLIKELY {
+			bool uncached;
+			{
+				std::lock_guard<std::mutex> lock(m_mutex);
+				uncached = m_uncached.erase(ptr) > 0;
+			}
+
+			if (uncached) {
+				m_upstream.deallocate(ptr, bytes, poolAlignment);
+				m_bytesInUse.fetch_sub(bytes, std::memory_order_relaxed);
+				m_systemBytes.fetch_sub(bytes, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		const size_t index = sizeClass(bytes);
+		const size_t size  = classBytes(index);
+		m_bytesInUse.fetch_sub(size, std::memory_order_relaxed);
+
+		if (bytes <= m_maxBlockBytes.load(std::memory_order_relaxed)) {
+			ThreadCache *cache = threadCache();
+			if (cache &&
+				cache->bytes + size <= m_maxThreadCacheBytes.load(std::memory_order_relaxed)) {
+				cache->freeLists[index].push_back(ptr);
+				cache->bytes += size;
+				m_bytesCached.fetch_add(size, std::memory_order_relaxed);
+				return;
+			}
+
+			std::lock_guard<std::mutex> lock(m_mutex);
+			if (m_sharedBytes + size <= m_maxCachedBytes.load(std::memory_order_relaxed)) {
+				m_shared[index].push_back(ptr);
+				m_sharedBytes += size;
+				m_bytesCached.fetch_add(size, std::memory_order_relaxed);
+				return;
+			}
+		}
+
+		// Every other pooled block was allocated with the class size and pool alignment
+		m_upstream.deallocate(ptr, size, poolAlignment);
+		m_systemBytes.fetch_sub(size, std::memory_order_relaxed);
+	}
+
+	LIBRAPID_INLINE void PoolAllocator::releaseToShared(FreeLists &lists) {
+		std::lock_guard<std::mutex> lock(m_mutex);
+		const size_t maxCached = m_maxCachedBytes.load(std::memory_order_relaxed);
+		for (size_t index = 0; index < numClasses; ++index) {
+			const size_t size = classBytes(index);
+			for (void *ptr : lists[index]) {
+				if (m_sharedBytes + size <= maxCached) {
+					m_shared[index].push_back(ptr);
+					m_sharedBytes += size;
+				} else {
+					m_upstream.deallocate(ptr, size, poolAlignment);
+					m_bytesCached.fetch_sub(size, std::memory_order_relaxed);
+					m_systemBytes.fetch_sub(size, std::memory_order_relaxed);
+				}
+			}
+			lists[index].clear();
+		}
+	}
+
+	LIBRAPID_INLINE void PoolAllocator::releaseToUpstream(FreeLists &lists) {
+		for (size_t index = 0; index < numClasses; ++index) {
+			const size_t size = classBytes(index);
+			for (void *ptr : lists[index]) {
+				m_upstream.deallocate(ptr, size, poolAlignment);
+				m_bytesCached.fetch_sub(size, std::memory_order_relaxed);
+				m_systemBytes.fetch_sub(size, std::memory_order_relaxed);
+			}
+			lists[index].clear();
+			lists[index].shrink_to_fit();
+		}
+	}
+
+	LIBRAPID_INLINE PoolAllocator::ThreadCache::~ThreadCache() {
+		// Hand the blocks to the shared pool so other threads can reuse them
+		if (owner) owner->releaseToShared(freeLists);
+	}
+
+	LIBRAPID_INLINE void PoolAllocator::trim() {
+		if (ThreadCache *cache = threadCache()) {
+			releaseToUpstream(cache->freeLists);
+			cache->bytes = 0;
+		}
+
+		std::lock_guard<std::mutex> lock(m_mutex);
+		releaseToUpstream(m_shared);
+		m_sharedBytes = 0;
+	}
+
+	LIBRAPID_INLINE AllocatorStatistics PoolAllocator::statistics() const {
+		AllocatorStatistics res;
+		res.bytesInUse	  = m_bytesInUse.load(std::memory_order_relaxed);
+		res.bytesCached	  = m_bytesCached.load(std::memory_order_relaxed);
+		res.systemBytes	  = m_systemBytes.load(std::memory_order_relaxed);
+		res.allocations	  = m_allocations.load(std::memory_order_relaxed);
+		res.deallocations = m_deallocations.load(std::memory_order_relaxed);
+		res.cacheHits	  = m_cacheHits.load(std::memory_order_relaxed);
+		return res;
+	}
+
+	LIBRAPID_INLINE void PoolAllocator::setLimits(const PoolLimits &limits) {
+		m_maxBlockBytes.store(limits.maxBlockBytes, std::memory_order_relaxed);
+		m_maxCachedBytes.store(limits.maxCachedBytes, std::memory_order_relaxed);
+		m_maxThreadCacheBytes.store(limits.maxThreadCacheBytes, std::memory_order_relaxed);
+	}
+
+	LIBRAPID_INLINE PoolLimits PoolAllocator::limits() const {
+		PoolLimits res;
+		res.maxBlockBytes		= m_maxBlockBytes.load(std::memory_order_relaxed);
+		res.maxCachedBytes		= m_maxCachedBytes.load(std::memory_order_relaxed);
+		res.maxThreadCacheBytes = m_maxThreadCacheBytes.load(std::memory_order_relaxed);
+		return res;
+	}
+
+	/// Return the process-wide system allocator
+	LIBRAPID_INLINE SystemAllocator &systemAllocator() {
+		// Never destroyed, so blocks can still be freed during static destruction
+		static auto *allocator = new SystemAllocator();
+		return *allocator;
+	}
+
+	/// Return the default allocator -- a PoolAllocator backed by systemAllocator()
+	LIBRAPID_INLINE PoolAllocator &defaultAllocator() {
+		// Never destroyed, so threads which exit late can still return their caches
+		static auto *allocator = new PoolAllocator(systemAllocator());
+		return *allocator;
+	}
+
+	namespace detail {
+		LIBRAPID_INLINE std::atomic<Allocator *> &currentAllocator() {
+			static std::atomic<Allocator *> allocator = &defaultAllocator();
+			return allocator;
+		}
+	} // namespace detail
+
+	/// Return the allocator used for new Storage objects
+	LIBRAPID_INLINE Allocator &getAllocator() {
+		return *detail::currentAllocator().load(std::memory_order_acquire);
+	}
+
+	/// Set the allocator used for new Storage objects. Each block remembers the allocator it
+	/// came from, so existing objects are still freed correctly. The allocator must outlive
+	/// every block allocated from it.
+	/// \param allocator The new allocator, or nullptr to restore the default
+	LIBRAPID_INLINE void setAllocator(Allocator *allocator) {
+		detail::currentAllocator().store(allocator ? allocator : &defaultAllocator(),
+										 std::memory_order_release);
+	}
+
+	/// Set the limits of the default pooled allocator
+	LIBRAPID_INLINE void setPoolLimits(const PoolLimits &limits) {
+		defaultAllocator().setLimits(limits);
+	}
+
+	/// Return cached memory held by the current allocator to the system
+	LIBRAPID_INLINE void trim() { getAllocator().trim(); }
+
+	/// Return the statistics of the current allocator
+	LIBRAPID_NODISCARD LIBRAPID_INLINE AllocatorStatistics statistics() {
+		return getAllocator().statistics();
+	}
+} // namespace librapid::memory
+
+#endif // LIBRAPID_ARRAY_ALLOCATOR_HPP
@@ -3,7 +3,9 @@
 
 #include "shape.hpp"
 #include "strideTools.hpp"
+#include "allocator.hpp"
 #include "storage.hpp"
+#include "mmapStorage.hpp"
 
 #if defined(LIBRAPID_HAS_OPENCL)
 #    include "../opencl/openclStorage.hpp"
@@ -25,7 +27,9 @@
 #include "arrayFromData.hpp"
 #include "fill.hpp"
 #include "pseudoConstructors.hpp"
+#include "reductions.hpp"
 #include "fourierTransform.hpp"
+#include "sparseMatrix.hpp"
 
 #include "linalg/linalg.hpp"
 
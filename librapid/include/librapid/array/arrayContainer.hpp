@@ -41,6 +41,15 @@ namespace librapid {
 			using Ref	 = detail::CudaRef<Scalar>;
 		};
 #endif // LIBRAPID_HAS_CUDA
+
+#if defined(LIBRAPID_HAS_MMAP)
+		template<typename T>
+		struct SubscriptType<MmapStorage<T>> {
+			using Scalar = T;
+			using Direct = const Scalar &;
+			using Ref	 = Scalar &;
+		};
+#endif // LIBRAPID_HAS_MMAP
 	}  // namespace detail
 
 	namespace typetraits {
@@ -141,6 +150,12 @@ namespace librapid {
 			/// \param shape The shape of the array container
 			LIBRAPID_ALWAYS_INLINE explicit ArrayContainer(ShapeType &&shape);
 
+			/// Construct an array container from a shape and an existing storage object, which is
+			/// moved into the array container.
+			/// \param shape The shape of the array container
+			/// \param storage The storage object. Must hold exactly ``shape.size()`` elements
+			LIBRAPID_ALWAYS_INLINE ArrayContainer(const ShapeType &shape, StorageType &&storage);
+
 			/// \brief Reference an existing array container
 			///
 			/// This constructor does not copy the data, but instead references the data of the
@@ -283,6 +298,12 @@ namespace librapid {
 			/// \return A Packet object from the array's storage at a specific index
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Return a Packet object from the array's storage at an index which need not be a
+			/// multiple of the packet width.
+			/// \param index The index to get the packet from
+			/// \return A Packet object from the array's storage at a specific index
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetUnaligned(size_t index) const;
+
 			/// Return a Scalar from the array's storage at a specific index.
 			/// \param index The index to get the scalar from
 			/// \return A Scalar from the array's storage at a specific index
@@ -293,6 +314,12 @@ namespace librapid {
 			/// \param value The value to write to the array's storage
 			LIBRAPID_ALWAYS_INLINE void writePacket(size_t index, const Packet &value);
 
+			/// Write a Packet object to the array's storage at an index which need not be a
+			/// multiple of the packet width
+			/// \param index The index to write the packet to
+			/// \param value The value to write to the array's storage
+			LIBRAPID_ALWAYS_INLINE void writePacketUnaligned(size_t index, const Packet &value);
+
 			/// Write a Scalar to the array's storage at a specific index
 			/// \param index The index to write the scalar to
 			/// \param value The value to write to the array's storage
@@ -401,7 +428,8 @@ namespace librapid {
 				m_size(shape.size()), m_storage(m_size, value) {
 			static_assert(typetraits::IsStorage<StorageType_>::value ||
 							typetraits::IsOpenCLStorage<StorageType_>::value ||
-							typetraits::IsCudaStorage<StorageType_>::value,
+							typetraits::IsCudaStorage<StorageType_>::value ||
+							typetraits::IsMmapStorage<StorageType_>::value,
 						  "For a runtime-defined shape, "
 						  "the storage type must be "
 						  "either a Storage or a "
@@ -420,7 +448,8 @@ namespace librapid {
 				m_size(shape.size()), m_storage(m_size, value) {
 			static_assert(typetraits::IsStorage<StorageType_>::value ||
 							typetraits::IsOpenCLStorage<StorageType_>::value ||
-							typetraits::IsCudaStorage<StorageType_>::value,
+							typetraits::IsCudaStorage<StorageType_>::value ||
+							typetraits::IsMmapStorage<StorageType_>::value,
 						  "For a runtime-defined shape, "
 						  "the storage type must be "
 						  "either a Storage or a "
@@ -439,7 +468,8 @@ namespace librapid {
 				m_size(shape.size()), m_storage(m_size, value) {
 			static_assert(typetraits::IsStorage<StorageType_>::value ||
 							typetraits::IsOpenCLStorage<StorageType_>::value ||
-							typetraits::IsCudaStorage<StorageType_>::value,
+							typetraits::IsCudaStorage<StorageType_>::value ||
+							typetraits::IsMmapStorage<StorageType_>::value,
 						  "For a runtime-defined shape, "
 						  "the storage type must be "
 						  "either a Storage or a "
@@ -467,6 +497,19 @@ namespace librapid {
 				m_shape(std::forward<ShapeType_>(shape)),
 				m_size(m_shape.size()), m_storage(m_size) {}
 
+		template<typename ShapeType_, typename StorageType_>
+		LIBRAPID_ALWAYS_INLINE
+		ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(const ShapeType_ &shape,
+																 StorageType_ &&storage) :
+				m_shape(shape),
+				m_size(shape.size()), m_storage(std::move(storage)) {
+			LIBRAPID_ASSERT(m_storage.size() == m_size,
+							"Storage holds {} elements, but the shape {} requires {}",
+							m_storage.size(),
+							m_shape,
+							m_size);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		template<typename TransposeType>
 		LIBRAPID_ALWAYS_INLINE ArrayContainer<ShapeType_, StorageType_>::ArrayContainer(
@@ -789,12 +832,18 @@ namespace librapid {
 			auto ptr = LIBRAPID_ASSUME_ALIGNED(m_storage.begin());
 
 #if defined(LIBRAPID_NATIVE_ARCH)
-			return xsimd::load_aligned(ptr + index);
+			return Packet::load_aligned(ptr + index);
 #else
-			return xsimd::load_unaligned(ptr + index);
+			return Packet::load_unaligned(ptr + index);
 #endif
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		LIBRAPID_ALWAYS_INLINE auto
+		ArrayContainer<ShapeType_, StorageType_>::packetUnaligned(size_t index) const -> Packet {
+			return Packet::load_unaligned(m_storage.begin() + index);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		LIBRAPID_ALWAYS_INLINE auto
 		ArrayContainer<ShapeType_, StorageType_>::scalar(size_t index) const -> Scalar {
@@ -813,6 +862,13 @@ namespace librapid {
 #endif
 		}
 
+		template<typename ShapeType_, typename StorageType_>
+		LIBRAPID_ALWAYS_INLINE void
+		ArrayContainer<ShapeType_, StorageType_>::writePacketUnaligned(size_t index,
+																	   const Packet &value) {
+			value.store_unaligned(m_storage.begin() + index);
+		}
+
 		template<typename ShapeType_, typename StorageType_>
 		LIBRAPID_ALWAYS_INLINE void
 		ArrayContainer<ShapeType_, StorageType_>::write(size_t index, const Scalar &value) {
@@ -900,7 +956,8 @@ namespace librapid {
 		template<typename T>
 		LIBRAPID_ALWAYS_INLINE auto
 		ArrayContainer<ShapeType_, StorageType_>::operator<<=(const T &value) -> ArrayContainer & {
-			*this = *this << value;
+			// ``*this << value`` would start a comma initializer
+			*this = leftShift(*this, value);
 			return *this;
 		}
 
@@ -6,6 +6,186 @@ namespace librapid {
 	// elsewhere. They are defined here.
 
 	namespace detail {
+		/// Returns true if the Function (or array) can be evaluated in aligned packets of
+		/// \p packetWidth elements over its whole linear range. A broadcast Function only allows
+		/// this if no packet spans more than one row of the innermost axis. Assignment does not
+		/// need this check, since broadcast Functions are assigned row by row instead (see
+		/// ``assignBroadcastRows``).
+		/// \tparam Function The function type
+		/// \param function The function to check
+		/// \param packetWidth The number of elements in each packet
+		/// \return True if the function can be vectorised
+		template<typename Function>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool canVectorise(const Function &function,
+																	int64_t packetWidth) {
+			if (!argIsBroadcast(function)) return true;
+			const auto &shape = function.shape();
+			if (shape.ndim() == 0) return false;
+			return static_cast<int64_t>(shape[shape.ndim() - 1]) % packetWidth == 0;
+		}
+
+		/// Evaluate elements [begin, end) of a broadcast \p function into \p lhs, one row of the
+		/// innermost axis at a time. Each row is vectorised from its first element, so no packet
+		/// spans two rows, and the elements which do not fill a whole packet are assigned with
+		/// scalar code.
+		/// \tparam packetWidth The number of elements in each packet
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \param begin The first index to assign
+		/// \param end One past the last index to assign
+		/// \param parallel If true, the rows are divided between multiple threads
+		template<int64_t packetWidth, typename Destination, typename Function>
+		LIBRAPID_ALWAYS_INLINE void assignBroadcastRows(Destination &lhs, const Function &function,
+														int64_t begin, int64_t end,
+														bool parallel) {
+			const auto &shape		= function.shape();
+			const int64_t rowLength = std::max<int64_t>(
+			  1, shape.ndim() == 0 ? 1 : static_cast<int64_t>(shape[shape.ndim() - 1]));
+			const int64_t firstRow = begin / rowLength;
+			const int64_t lastRow  = (end + rowLength - 1) / rowLength;
+
+#pragma omp parallel for shared(lhs, function, begin, end, rowLength, firstRow, lastRow)           \
+  default(none) if (parallel) num_threads(int(global::numThreads))
+			for (int64_t row = firstRow; row < lastRow; ++row) {
+				const int64_t rowBegin	= std::max(begin, row * rowLength);
+				const int64_t rowEnd	= std::min(end, (row + 1) * rowLength);
+				const int64_t vectorEnd = rowEnd - (rowEnd - rowBegin) % packetWidth;
+
+				int64_t index = rowBegin;
+				for (; index < vectorEnd; index += packetWidth) {
+					lhs.writePacketUnaligned(index, function.packetUnaligned(index));
+				}
+
+				for (; index < rowEnd; ++index) { lhs.write(index, function.scalar(index)); }
+			}
+		}
+
+		/// Call \p op with the storage of every memory-mapped array referenced by \p obj,
+		/// recursing into the arguments of Function objects
+		/// \tparam T The type of the object
+		/// \tparam Op The callback type
+		/// \param obj The object to search
+		/// \param op The callback
+		template<typename T, typename Op>
+		LIBRAPID_ALWAYS_INLINE void forEachMmapStorage(const T &obj, Op &op) {
+			if constexpr (typetraits::IsArrayContainer<T>::value) {
+				if constexpr (typetraits::IsMmapStorage<typename T::StorageType>::value) {
+					op(obj.storage());
+				}
+			} else if constexpr (typetraits::ContainsMmapStorage<T>::value) {
+				std::apply([&op](const auto &...args) { (forEachMmapStorage(args, op), ...); },
+						   obj.args());
+			}
+		}
+
+		/// Evaluate elements [begin, end) of \p function into \p lhs. Packets are used if
+		/// \p packetWidth is greater than one, in which case \p begin must be a multiple of it.
+		/// \tparam packetWidth The number of elements in each packet
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \param begin The first index to assign
+		/// \param end One past the last index to assign
+		/// \param parallel If true, the block is evaluated with multiple threads
+		template<int64_t packetWidth, typename Destination, typename Function>
+		LIBRAPID_ALWAYS_INLINE void assignBlock(Destination &lhs, const Function &function,
+												 int64_t begin, int64_t end, bool parallel) {
+			if constexpr (packetWidth > 1) {
+				if (argIsBroadcast(function)) LIBRAPID_UNLIKELY {
+					assignBroadcastRows<packetWidth>(lhs, function, begin, end, parallel);
+					return;
+				}
+
+				const int64_t vectorEnd = end - (end - begin) % packetWidth;
+
+#pragma omp parallel for shared(lhs, function, begin, vectorEnd) default(none) if (parallel)       \
+  num_threads(int(global::numThreads))
+				for (int64_t index = begin; index < vectorEnd; index += packetWidth) {
+					lhs.writePacket(index, function.packet(index));
+				}
+
+				// Assign the remaining elements
+				for (int64_t index = vectorEnd; index < end; ++index) {
+					lhs.write(index, function.scalar(index));
+				}
+			} else {
+#pragma omp parallel for shared(lhs, function, begin, end) default(none) if (parallel)             \
+  num_threads(int(global::numThreads))
+				for (int64_t index = begin; index < end; ++index) {
+					lhs.write(index, function.scalar(index));
+				}
+			}
+		}
+
+		template<int64_t packetWidth, typename Destination, typename Function>
+		LIBRAPID_FLATTEN void assignStreamingImpl(Destination &lhs, const Function &function,
+												  bool parallel) {
+			using Scalar		= typename Destination::Scalar;
+			const int64_t size	= function.size();
+			const int64_t block = std::max<int64_t>(
+			  packetWidth,
+			  static_cast<int64_t>(global::mmapBlockSize / sizeof(Scalar)) / packetWidth *
+				packetWidth);
+
+			// Arrays which are broadcast are not indexed in step with the result, so they are not
+			// advised. They are small enough to remain resident anyway.
+			auto advise = [&](int64_t begin, int64_t end, bool prefetch) {
+				auto op = [&](const auto &storage) {
+					if (static_cast<int64_t>(storage.size()) != size) return;
+					if (prefetch) {
+						storage.prefetch(begin, end);
+					} else {
+						storage.release(begin, end);
+					}
+				};
+				forEachMmapStorage(function, op);
+				forEachMmapStorage(lhs, op);
+			};
+
+			// Read the next block ahead while the current one is evaluated, and drop each block
+			// once it is complete, so only a couple of blocks of each file are ever resident
+			advise(0, std::min(block, size), true);
+			for (int64_t begin = 0; begin < size; begin += block) {
+				const int64_t end = std::min(begin + block, size);
+				advise(end, std::min(end + block, size), true);
+				assignBlock<packetWidth>(lhs, function, begin, end, parallel);
+				advise(begin, end, false);
+			}
+		}
+
+		/// Assignment for expressions which read from or write to memory-mapped arrays. The
+		/// result is evaluated in the same order as the trivial assignment, but in blocks of
+		/// global::mmapBlockSize bytes, with the pages of each block prefetched before it is
+		/// needed and released once it has been evaluated.
+		/// \tparam Destination The array container type to assign to
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \param parallel If true, each block is evaluated with multiple threads
+		template<typename Destination, typename Functor_, typename... Args>
+		LIBRAPID_ALWAYS_INLINE void
+		assignStreaming(Destination &lhs,
+						const detail::Function<descriptor::Trivial, Functor_, Args...> &function,
+						bool parallel) {
+			using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
+			using Scalar   = typename Destination::Scalar;
+			constexpr bool allowVectorisation =
+			  typetraits::TypeInfo<Function>::allowVectorisation && Function::argsAreSameType;
+
+			LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+										   lhs.shape() == function.shape(),
+										   "Shapes must be equal. Expected {}, received {}",
+										   lhs.shape(),
+										   function.shape());
+
+			if constexpr (allowVectorisation) {
+				constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+				assignStreamingImpl<packetWidth>(lhs, function, parallel);
+			} else {
+				assignStreamingImpl<1>(lhs, function, parallel);
+			}
+		}
+
 		/// Trivial array assignment operator -- assignment can be done with a single vectorised
 		/// loop over contiguous data.
 		/// \tparam ShapeType_ The shape type of the array container
@@ -21,6 +201,11 @@ namespace librapid {
 		assign(array::ArrayContainer<ShapeType_, Storage<StorageScalar>> &lhs,
 			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
 			using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
+			if constexpr (typetraits::ContainsMmapStorage<Function>::value) {
+				assignStreaming(lhs, function, false);
+				return;
+			}
+
 			using Scalar =
 			  typename array::ArrayContainer<ShapeType_, Storage<StorageScalar>>::Scalar;
 			constexpr bool allowVectorisation =
@@ -49,6 +234,11 @@ namespace librapid {
 										   function.shape());
 
 			if constexpr (allowVectorisation) {
+				if (argIsBroadcast(function)) LIBRAPID_UNLIKELY {
+					assignBroadcastRows<packetWidth>(lhs, function, 0, size, false);
+					return;
+				}
+
 				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
 					lhs.writePacket(index, function.packet(index));
 				}
@@ -58,7 +248,6 @@ namespace librapid {
 					lhs.write(index, function.scalar(index));
 				}
 			} else {
-				// Assign the remaining elements
 				for (int64_t index = 0; index < size; ++index) {
 					lhs.write(index, function.scalar(index));
 				}
@@ -109,6 +298,11 @@ namespace librapid {
 										   function.shape());
 
 			if constexpr (allowVectorisation) {
+				if (argIsBroadcast(function)) LIBRAPID_UNLIKELY {
+					assignBroadcastRows<packetWidth>(lhs, function, 0, elements, false);
+					return;
+				}
+
 				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
 					lhs.writePacket(index, function.packet(index));
 				}
@@ -118,7 +312,6 @@ namespace librapid {
 					lhs.write(index, function.scalar(index));
 				}
 			} else {
-				// Assign the remaining elements
 				for (int64_t index = 0; index < elements; ++index) {
 					lhs.write(index, function.scalar(index));
 				}
@@ -141,6 +334,11 @@ namespace librapid {
 		assignParallel(array::ArrayContainer<ShapeType_, Storage<StorageScalar>> &lhs,
 					   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
 			using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
+			if constexpr (typetraits::ContainsMmapStorage<Function>::value) {
+				assignStreaming(lhs, function, true);
+				return;
+			}
+
 			using Scalar =
 			  typename array::ArrayContainer<ShapeType_, Storage<StorageScalar>>::Scalar;
 
@@ -172,6 +370,12 @@ namespace librapid {
 										   function.shape());
 
 			if constexpr (allowVectorisation) {
+				if (argIsBroadcast(function)) LIBRAPID_UNLIKELY {
+					assignBroadcastRows<packetWidth>(
+					  lhs, function, 0, static_cast<int64_t>(size), true);
+					return;
+				}
+
 #pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
   num_threads(int(global::numThreads))
 				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
@@ -182,12 +386,13 @@ namespace librapid {
 				for (int64_t index = vectorSize; index < size; ++index) {
 					lhs.write(index, function.scalar(index));
 				}
-			} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
+				return;
+			}
+
+#pragma omp parallel for shared(lhs, function, size) default(none)                                 \
   num_threads(int(global::numThreads))
-				for (int64_t index = 0; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
-				}
+			for (int64_t index = 0; index < size; ++index) {
+				lhs.write(index, function.scalar(index));
 			}
 		}
 
@@ -235,6 +440,12 @@ namespace librapid {
 										   function.shape());
 
 			if constexpr (allowVectorisation) {
+				if (argIsBroadcast(function)) LIBRAPID_UNLIKELY {
+					assignBroadcastRows<packetWidth>(
+					  lhs, function, 0, static_cast<int64_t>(size), true);
+					return;
+				}
+
 #pragma omp parallel for shared(vectorSize, lhs, function) default(none)                           \
   num_threads(int(global::numThreads))
 				for (int64_t index = 0; index < vectorSize; index += packetWidth) {
@@ -245,14 +456,60 @@ namespace librapid {
 				for (int64_t index = vectorSize; index < size; ++index) {
 					lhs.write(index, function.scalar(index));
 				}
-			} else {
-#pragma omp parallel for shared(vectorSize, lhs, function, size) default(none)                     \
+				return;
+			}
+
+#pragma omp parallel for shared(lhs, function, size) default(none)                                 \
   num_threads(int(global::numThreads))
-				for (int64_t index = vectorSize; index < size; ++index) {
-					lhs.write(index, function.scalar(index));
-				}
+			for (int64_t index = 0; index < size; ++index) {
+				lhs.write(index, function.scalar(index));
 			}
 		}
+
+#if defined(LIBRAPID_HAS_MMAP)
+		/// Trivial assignment to a memory-mapped array. The result is always streamed, so the
+		/// destination never needs to be resident in memory all at once.
+		/// \tparam ShapeType_ The shape type of the array container
+		/// \tparam StorageScalar The scalar type of the storage object
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \see assignStreaming
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+			requires(!typetraits::HasCustomEval<
+					 detail::Function<descriptor::Trivial, Functor_, Args...>>::value)
+		LIBRAPID_FLATTEN LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, MmapStorage<StorageScalar>> &lhs,
+			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+			// Writing to a read-only mapping would fault, so this is checked in release builds too
+			if (lhs.storage().mode() == MmapMode::ReadOnly) LIBRAPID_UNLIKELY {
+				throw std::runtime_error("Cannot assign to a read-only memory-mapped array");
+			}
+			assignStreaming(lhs, function, false);
+		}
+
+		/// Trivial assignment to a memory-mapped array with parallel execution
+		/// \tparam ShapeType_ The shape type of the array container
+		/// \tparam StorageScalar The scalar type of the storage object
+		/// \tparam Functor_ The function type
+		/// \tparam Args The argument types of the function
+		/// \param lhs The array container to assign to
+		/// \param function The function to assign
+		/// \see assignStreaming
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+			requires(!typetraits::HasCustomEval<
+					 detail::Function<descriptor::Trivial, Functor_, Args...>>::value)
+		LIBRAPID_FLATTEN LIBRAPID_ALWAYS_INLINE void
+		assignParallel(array::ArrayContainer<ShapeType_, MmapStorage<StorageScalar>> &lhs,
+					   const detail::Function<descriptor::Trivial, Functor_, Args...> &function) {
+			// Writing to a read-only mapping would fault, so this is checked in release builds too
+			if (lhs.storage().mode() == MmapMode::ReadOnly) LIBRAPID_UNLIKELY {
+				throw std::runtime_error("Cannot assign to a read-only memory-mapped array");
+			}
+			assignStreaming(lhs, function, true);
+		}
+#endif // LIBRAPID_HAS_MMAP
 	} // namespace detail
 
 	/*
@@ -339,6 +596,9 @@ namespace librapid {
 			// temporary-free evaluation. Instead, we must recursively evaluate each sub-operation
 			// until a final result is computed
 
+			LIBRAPID_ASSERT(!function.isBroadcast(),
+							"Broadcasting is currently only supported for CPU arrays");
+
 			const char *kernelBase = typetraits::TypeInfo<Functor_>::getKernelName(function.args());
 			using Scalar =
 			  typename array::ArrayContainer<ShapeType_, OpenCLStorage<StorageScalar>>::Scalar;
@@ -528,6 +788,9 @@ namespace librapid {
 			// temporary-free evaluation. Instead, we must recursively evaluate each sub-operation
 			// until a final result is computed
 
+			LIBRAPID_ASSERT(!function.isBroadcast(),
+							"Broadcasting is currently only supported for CPU arrays");
+
 			using Function = detail::Function<descriptor::Trivial, Functor_, Args...>;
 			constexpr const char *filename = typetraits::TypeInfo<Functor_>::filename;
 			const char *kernelName = typetraits::TypeInfo<Functor_>::getKernelName(function.args());
@@ -8,6 +8,9 @@ namespace librapid {
 		dst = array::ArrayContainer<ShapeType, StorageType>(dst.shape(), value);
 	}
 
+	/// Fill an array with uniformly distributed random values in [lower, upper). Values are
+	/// generated from a counter-based stream, so the result depends only on the seed and the
+	/// sequence of calls, not on the number of threads used.
 	template<typename ShapeType, typename StorageScalar, typename Lower = StorageScalar,
 			 typename Upper = StorageScalar>
 	LIBRAPID_ALWAYS_INLINE void
@@ -17,38 +20,26 @@ namespace librapid {
 		auto *data		= dst.storage().begin();
 		bool parallel	= global::numThreads != 1 && shape.size() > global::multithreadThreshold;
 
-		if (parallel) {
-#pragma omp parallel for
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = random<StorageScalar>(static_cast<StorageScalar>(lower),
-												static_cast<StorageScalar>(upper));
-			}
-		} else {
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = random<StorageScalar>(static_cast<StorageScalar>(lower),
-												static_cast<StorageScalar>(upper));
-			}
-		}
+		detail::random::fillUniform(data,
+									static_cast<int64_t>(shape.size()),
+									static_cast<StorageScalar>(lower),
+									static_cast<StorageScalar>(upper),
+									parallel);
 	}
 
-	template<typename ShapeType, typename StorageScalar, typename Lower, typename Upper>
+	/// Fill an array with normally distributed random values with the given mean and standard
+	/// deviation. As with fillRandom, the result does not depend on the number of threads.
+	template<typename ShapeType, typename StorageScalar, typename Mean = StorageScalar,
+			 typename StdDev = StorageScalar>
 	LIBRAPID_ALWAYS_INLINE void
 	fillRandomGaussian(array::ArrayContainer<ShapeType, Storage<StorageScalar>> &dst,
-					   const Lower &lower, const Upper &upper) {
+					   const Mean &mean = 0, const StdDev &stdDev = 1) {
 		ShapeType shape = dst.shape();
 		auto *data		= dst.storage().begin();
 		bool parallel	= global::numThreads != 1 && shape.size() > global::multithreadThreshold;
 
-		if (parallel) {
-#pragma omp parallel for
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = randomGaussian<StorageScalar>();
-			}
-		} else {
-			for (int64_t i = 0; i < shape.size(); ++i) {
-				data[i] = randomGaussian<StorageScalar>();
-			}
-		}
+		detail::random::fillGaussian(data, static_cast<int64_t>(shape.size()), mean, stdDev,
+									 parallel);
 	}
 
 #if defined(LIBRAPID_HAS_OPENCL)
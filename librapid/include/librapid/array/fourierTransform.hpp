@@ -3,122 +3,900 @@
 
 namespace librapid::fft {
     namespace detail {
+        template<typename T>
+        struct FFTTraits {
+            using Real                      = T;
+            static constexpr bool isComplex = false;
+        };
+
+        template<typename T>
+        struct FFTTraits<Complex<T>> {
+            using Real                      = T;
+            static constexpr bool isComplex = true;
+        };
+
+        /// Convert a possibly negative axis index into the range [0, ndim)
+        LIBRAPID_INLINE size_t normaliseAxis(int64_t axis, size_t ndim) {
+            const auto dims = static_cast<int64_t>(ndim);
+            LIBRAPID_ASSERT(axis >= -dims && axis < dims,
+                            "Axis {} is out of range for an array with {} dimensions",
+                            axis,
+                            ndim);
+            return static_cast<size_t>(axis < 0 ? axis + dims : axis);
+        }
+
+        template<typename ShapeType>
+        LIBRAPID_INLINE std::vector<size_t> shapeToVector(const ShapeType &shape) {
+            std::vector<size_t> res(shape.ndim());
+            for (size_t i = 0; i < res.size(); ++i) { res[i] = static_cast<size_t>(shape[i]); }
+            return res;
+        }
+
+        /// Normalise a list of axes, defaulting to every axis of the array
+        LIBRAPID_INLINE std::vector<size_t> normaliseAxes(const std::vector<int64_t> &axes,
+                                                          size_t ndim) {
+            std::vector<size_t> res;
+            if (axes.empty()) {
+                for (size_t i = 0; i < ndim; ++i) res.push_back(i);
+                return res;
+            }
+
+            for (int64_t axis : axes) {
+                const size_t normalised = normaliseAxis(axis, ndim);
+                LIBRAPID_ASSERT(std::find(res.begin(), res.end(), normalised) == res.end(),
+                                "Axis {} appears more than once",
+                                axis);
+                res.push_back(normalised);
+            }
+            return res;
+        }
+
+        /// Row-major strides, in bytes, for an array of \p shape with elements of type \p T
+        template<typename T>
+        LIBRAPID_INLINE pocketfft::stride_t byteStrides(const std::vector<size_t> &shape) {
+            pocketfft::stride_t res(shape.size());
+            ptrdiff_t stride = sizeof(T);
+            for (size_t i = shape.size(); i-- > 0;) {
+                res[i] = stride;
+                stride *= static_cast<ptrdiff_t>(shape[i]);
+            }
+            return res;
+        }
+
+        /// A batch of 1D transforms along one axis of a row-major array is described by the
+        /// product of the dimensions before the axis, the transform length, and the product of
+        /// the dimensions after the axis
+        struct AxisLayout {
+            int64_t outer;
+            int64_t inner;
+        };
+
+        LIBRAPID_INLINE AxisLayout axisLayout(const std::vector<size_t> &shape, size_t axis) {
+            AxisLayout res {1, 1};
+            for (size_t i = 0; i < axis; ++i) res.outer *= static_cast<int64_t>(shape[i]);
+            for (size_t i = axis + 1; i < shape.size(); ++i) {
+                res.inner *= static_cast<int64_t>(shape[i]);
+            }
+            return res;
+        }
+
+        enum class PlanType { RealToComplex, ComplexToReal, ComplexToComplex };
+
+        /// Everything a plan depends on. Plans are created without alignment assumptions, so
+        /// they can be executed on any pointer with the same layout.
+        struct PlanKey {
+            PlanType type;
+            bool forward;
+            size_t precision;
+            int64_t length;
+            int64_t howMany;
+            int64_t inStride, inDist, inLength;
+            int64_t outStride, outDist, outLength;
+            bool inPlace;
+            int64_t threads;
+
+            auto operator<=>(const PlanKey &) const = default;
+        };
+
+        /// Create the key for a batch of transforms along one axis. If the axis is the last
+        /// dimension, a single plan covers the whole array. Otherwise, one plan covers a single
+        /// outer slice and is executed once per slice.
+        LIBRAPID_INLINE PlanKey planKey(PlanType type, bool forward, size_t precision,
+                                        int64_t length, int64_t inLength, int64_t outLength,
+                                        const AxisLayout &layout, bool inPlace,
+                                        int64_t threads) {
+            PlanKey key {type, forward, precision, length, 0, 0, 0, inLength, 0, 0, outLength,
+                         inPlace, threads};
+            if (layout.inner == 1) {
+                key.howMany   = layout.outer;
+                key.inStride  = 1;
+                key.inDist    = inLength;
+                key.outStride = 1;
+                key.outDist   = outLength;
+            } else {
+                key.howMany   = layout.inner;
+                key.inStride  = layout.inner;
+                key.inDist    = 1;
+                key.outStride = layout.inner;
+                key.outDist   = 1;
+            }
+            return key;
+        }
+
+        /// A thread-safe cache of FFT plans. Creating a plan is far more expensive than
+        /// executing it, so plans are created on first use and reused by every later transform
+        /// with the same key. Plans live until clear() is called or the program exits.
+        template<typename Plan>
+        class PlanCache {
+        public:
+            using Destroy = void (*)(Plan);
+
+            explicit PlanCache(Destroy destroy) : m_destroy(destroy) {}
+            PlanCache(const PlanCache &) = delete;
+            PlanCache &operator=(const PlanCache &) = delete;
+            ~PlanCache() { clear(); }
+
+            /// Return the plan for \p key, calling \p create to make it if it is not cached
+            template<typename Create>
+            Plan get(const PlanKey &key, Create &&create) {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                auto it = m_plans.find(key);
+                if (it != m_plans.end()) return it->second;
+                Plan plan = create();
+                m_plans.emplace(key, plan);
+                return plan;
+            }
+
+            /// Destroy every cached plan. This must not be called while a transform is running
+            void clear() {
+                std::lock_guard<std::mutex> lock(m_mutex);
+                for (auto &[key, plan] : m_plans) m_destroy(plan);
+                m_plans.clear();
+            }
+
+        private:
+            std::map<PlanKey, Plan> m_plans;
+            std::mutex m_mutex;
+            Destroy m_destroy;
+        };
+
         namespace cpu {
+            // pocketfft caches its own twiddle factors (see POCKETFFT_CACHE_SIZE), handles
+            // arbitrary strides and axes natively and distributes batches over threads, so
+            // these simply forward to it
+
             template<typename T>
-            void rfft(Complex<T> *output, T *input, size_t n) {
-                pocketfft::shape_t shape      = {n};
-                pocketfft::stride_t strideIn  = {sizeof(T)};
-                pocketfft::stride_t strideOut = {sizeof(Complex<T>)};
-                size_t axis                   = 0;
-                bool forward                  = true;
-                T fct                         = 1.0;
+            void r2c(const T *input, Complex<T> *output, const std::vector<size_t> &shape,
+                     size_t axis) {
+                std::vector<size_t> outShape = shape;
+                outShape[axis]               = shape[axis] / 2 + 1;
                 pocketfft::r2c(shape,
-                               strideIn,
-                               strideOut,
+                               byteStrides<T>(shape),
+                               byteStrides<Complex<T>>(outShape),
                                axis,
-                               forward,
+                               pocketfft::FORWARD,
                                input,
                                reinterpret_cast<std::complex<T> *>(output),
+                               T(1),
+                               global::numThreads);
+            }
+
+            template<typename T>
+            void c2r(const Complex<T> *input, T *output, const std::vector<size_t> &inShape,
+                     const std::vector<size_t> &outShape, size_t axis, T fct) {
+                pocketfft::c2r(outShape,
+                               byteStrides<Complex<T>>(inShape),
+                               byteStrides<T>(outShape),
+                               axis,
+                               pocketfft::BACKWARD,
+                               reinterpret_cast<const std::complex<T> *>(input),
+                               output,
                                fct,
                                global::numThreads);
             }
 
-#if defined(LIBRAPID_HAS_CUDA)
-            LIBRAPID_INLINE void rfft(Complex<double> *output, double *input, size_t n) {
-                unsigned int mode = FFTW_ESTIMATE;
-                fftw_plan plan    = fftw_plan_dft_r2c_1d(
-                  (int)n, input, reinterpret_cast<fftw_complex *>(output), mode);
-                fftw_execute(plan);
-                fftw_destroy_plan(plan);
-            }
-
-            LIBRAPID_INLINE void rfft(Complex<float> *output, float *input, size_t n) {
-                unsigned int mode = FFTW_ESTIMATE;
-                fftwf_plan plan   = fftwf_plan_dft_r2c_1d(
-                  (int)n, input, reinterpret_cast<fftwf_complex *>(output), mode);
-                fftwf_execute(plan);
-                fftwf_destroy_plan(plan);
-            }
-#elif defined(LIBRAPID_HAS_FFTW)
-            LIBRAPID_INLINE void rfft(Complex<double> *output, double *input, size_t n) {
-                unsigned int mode = FFTW_ESTIMATE;
-                fftw_plan_with_nthreads((int)global::numThreads);
-                fftw_plan plan = fftw_plan_dft_r2c_1d(
-                  (int)n, input, reinterpret_cast<fftw_complex *>(output), mode);
-                fftw_execute(plan);
-                fftw_destroy_plan(plan);
-            }
-
-            LIBRAPID_INLINE void rfft(Complex<float> *output, float *input, size_t n) {
-                unsigned int mode = FFTW_ESTIMATE;
-                fftwf_plan_with_nthreads((int)global::numThreads);
-                fftwf_plan plan = fftwf_plan_dft_r2c_1d(
-                  (int)n, input, reinterpret_cast<fftwf_complex *>(output), mode);
-                fftwf_execute(plan);
-                fftwf_destroy_plan(plan);
+            template<typename T>
+            void c2c(const Complex<T> *input, Complex<T> *output, const std::vector<size_t> &shape,
+                     const std::vector<size_t> &axes, bool forward, T fct) {
+                const auto stride = byteStrides<Complex<T>>(shape);
+                pocketfft::c2c(shape,
+                               stride,
+                               stride,
+                               axes,
+                               forward,
+                               reinterpret_cast<const std::complex<T> *>(input),
+                               reinterpret_cast<std::complex<T> *>(output),
+                               fct,
+                               global::numThreads);
             }
-#endif
-        } // namespace cpu
+
+#if defined(LIBRAPID_HAS_FFTW) || defined(LIBRAPID_HAS_CUDA)
+            template<typename T>
+            struct FFTW;
+
+            template<>
+            struct FFTW<double> {
+                using Plan    = fftw_plan;
+                using ComplexType = fftw_complex;
+
+                static void destroy(Plan plan) { fftw_destroy_plan(plan); }
+
+                static Plan plan(const PlanKey &key, void *in, void *out) {
+                    int n         = static_cast<int>(key.length);
+                    int inEmbed   = static_cast<int>(key.inLength);
+                    int outEmbed  = static_cast<int>(key.outLength);
+                    int howMany   = static_cast<int>(key.howMany);
+                    int is        = static_cast<int>(key.inStride);
+                    int id        = static_cast<int>(key.inDist);
+                    int os        = static_cast<int>(key.outStride);
+                    int od        = static_cast<int>(key.outDist);
+                    unsigned flag = FFTW_ESTIMATE | FFTW_UNALIGNED;
+
+                    switch (key.type) {
+                        case PlanType::RealToComplex:
+                            return fftw_plan_many_dft_r2c(1, &n, howMany,
+                                                          static_cast<double *>(in),
+                                                          &inEmbed, is, id,
+                                                          static_cast<ComplexType *>(out),
+                                                          &outEmbed, os, od, flag);
+                        case PlanType::ComplexToReal:
+                            return fftw_plan_many_dft_c2r(1, &n, howMany,
+                                                          static_cast<ComplexType *>(in),
+                                                          &inEmbed, is, id,
+                                                          static_cast<double *>(out),
+                                                          &outEmbed, os, od,
+                                                          flag | FFTW_PRESERVE_INPUT);
+                        default:
+                            return fftw_plan_many_dft(1, &n, howMany,
+                                                      static_cast<ComplexType *>(in),
+                                                      &inEmbed, is, id,
+                                                      static_cast<ComplexType *>(out),
+                                                      &outEmbed, os, od,
+                                                      key.forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                                      flag);
+                    }
+                }
+
+                static void execute(const PlanKey &key, Plan plan, void *in, void *out) {
+                    switch (key.type) {
+                        case PlanType::RealToComplex:
+                            fftw_execute_dft_r2c(
+                              plan, static_cast<double *>(in), static_cast<ComplexType *>(out));
+                            break;
+                        case PlanType::ComplexToReal:
+                            fftw_execute_dft_c2r(
+                              plan, static_cast<ComplexType *>(in), static_cast<double *>(out));
+                            break;
+                        default:
+                            fftw_execute_dft(plan,
+                                             static_cast<ComplexType *>(in),
+                                             static_cast<ComplexType *>(out));
+                            break;
+                    }
+                }
+
+#    if !defined(LIBRAPID_HAS_CUDA)
+                static void planWithThreads(int threads) { fftw_plan_with_nthreads(threads); }
+#    else
+                static void planWithThreads(int) {}
+#    endif
+            };
+
+            template<>
+            struct FFTW<float> {
+                using Plan    = fftwf_plan;
+                using ComplexType = fftwf_complex;
+
+                static void destroy(Plan plan) { fftwf_destroy_plan(plan); }
+
+                static Plan plan(const PlanKey &key, void *in, void *out) {
+                    int n         = static_cast<int>(key.length);
+                    int inEmbed   = static_cast<int>(key.inLength);
+                    int outEmbed  = static_cast<int>(key.outLength);
+                    int howMany   = static_cast<int>(key.howMany);
+                    int is        = static_cast<int>(key.inStride);
+                    int id        = static_cast<int>(key.inDist);
+                    int os        = static_cast<int>(key.outStride);
+                    int od        = static_cast<int>(key.outDist);
+                    unsigned flag = FFTW_ESTIMATE | FFTW_UNALIGNED;
+
+                    switch (key.type) {
+                        case PlanType::RealToComplex:
+                            return fftwf_plan_many_dft_r2c(1, &n, howMany,
+                                                           static_cast<float *>(in),
+                                                           &inEmbed, is, id,
+                                                           static_cast<ComplexType *>(out),
+                                                           &outEmbed, os, od, flag);
+                        case PlanType::ComplexToReal:
+                            return fftwf_plan_many_dft_c2r(1, &n, howMany,
+                                                           static_cast<ComplexType *>(in),
+                                                           &inEmbed, is, id,
+                                                           static_cast<float *>(out),
+                                                           &outEmbed, os, od,
+                                                           flag | FFTW_PRESERVE_INPUT);
+                        default:
+                            return fftwf_plan_many_dft(1, &n, howMany,
+                                                       static_cast<ComplexType *>(in),
+                                                       &inEmbed, is, id,
+                                                       static_cast<ComplexType *>(out),
+                                                       &outEmbed, os, od,
+                                                       key.forward ? FFTW_FORWARD : FFTW_BACKWARD,
+                                                       flag);
+                    }
+                }
+
+                static void execute(const PlanKey &key, Plan plan, void *in, void *out) {
+                    switch (key.type) {
+                        case PlanType::RealToComplex:
+                            fftwf_execute_dft_r2c(
+                              plan, static_cast<float *>(in), static_cast<ComplexType *>(out));
+                            break;
+                        case PlanType::ComplexToReal:
+                            fftwf_execute_dft_c2r(
+                              plan, static_cast<ComplexType *>(in), static_cast<float *>(out));
+                            break;
+                        default:
+                            fftwf_execute_dft(plan,
+                                              static_cast<ComplexType *>(in),
+                                              static_cast<ComplexType *>(out));
+                            break;
+                    }
+                }
+
+#    if !defined(LIBRAPID_HAS_CUDA)
+                static void planWithThreads(int threads) { fftwf_plan_with_nthreads(threads); }
+#    else
+                static void planWithThreads(int) {}
+#    endif
+            };
+
+            template<typename T>
+            LIBRAPID_INLINE PlanCache<typename FFTW<T>::Plan> &fftwPlanCache() {
+                static PlanCache<typename FFTW<T>::Plan> cache(&FFTW<T>::destroy);
+                return cache;
+            }
+
+            /// Run a batch of 1D FFTW transforms along \p axis, reusing a cached plan
+            template<typename T, typename In, typename Out>
+            void fftwAlongAxis(PlanType type, bool forward, In *input, Out *output,
+                               const std::vector<size_t> &shape, size_t axis, int64_t inLength,
+                               int64_t outLength) {
+                const auto layout  = axisLayout(shape, axis);
+                const auto threads = static_cast<int64_t>(global::numThreads);
+                const bool inPlace = static_cast<const void *>(input) == output;
+                const PlanKey key  = planKey(type,
+                                            forward,
+                                            sizeof(T),
+                                            static_cast<int64_t>(shape[axis]),
+                                            inLength,
+                                            outLength,
+                                            layout,
+                                            inPlace,
+                                            threads);
+
+                auto *in  = const_cast<std::remove_const_t<In> *>(input);
+                auto plan = fftwPlanCache<T>().get(key, [&]() {
+                    FFTW<T>::planWithThreads(static_cast<int>(threads));
+                    return FFTW<T>::plan(key, in, output);
+                });
+
+                if (layout.inner == 1) {
+                    FFTW<T>::execute(key, plan, in, output);
+                } else {
+                    const int64_t inSlice  = inLength * layout.inner;
+                    const int64_t outSlice = outLength * layout.inner;
+                    for (int64_t i = 0; i < layout.outer; ++i) {
+                        FFTW<T>::execute(key, plan, in + i * inSlice, output + i * outSlice);
+                    }
+                }
+            }
+
+            template<typename T>
+            LIBRAPID_INLINE void scale(T *data, int64_t elements, T fct) {
+                if (fct == T(1)) return;
+                for (int64_t i = 0; i < elements; ++i) data[i] *= fct;
+            }
+
+            LIBRAPID_INLINE void r2c(const double *input, Complex<double> *output,
+                                     const std::vector<size_t> &shape, size_t axis) {
+                fftwAlongAxis<double>(PlanType::RealToComplex, true, input, output, shape, axis,
+                                      static_cast<int64_t>(shape[axis]),
+                                      static_cast<int64_t>(shape[axis] / 2 + 1));
+            }
+
+            LIBRAPID_INLINE void r2c(const float *input, Complex<float> *output,
+                                     const std::vector<size_t> &shape, size_t axis) {
+                fftwAlongAxis<float>(PlanType::RealToComplex, true, input, output, shape, axis,
+                                     static_cast<int64_t>(shape[axis]),
+                                     static_cast<int64_t>(shape[axis] / 2 + 1));
+            }
+
+            template<typename T>
+            LIBRAPID_INLINE void fftwC2R(const Complex<T> *input, T *output,
+                                         const std::vector<size_t> &inShape,
+                                         const std::vector<size_t> &outShape, size_t axis,
+                                         T fct) {
+                fftwAlongAxis<T>(PlanType::ComplexToReal, false, input, output, outShape, axis,
+                                 static_cast<int64_t>(inShape[axis]),
+                                 static_cast<int64_t>(outShape[axis]));
+                int64_t elements = 1;
+                for (size_t dim : outShape) elements *= static_cast<int64_t>(dim);
+                scale(output, elements, fct);
+            }
+
+            LIBRAPID_INLINE void c2r(const Complex<double> *input, double *output,
+                                     const std::vector<size_t> &inShape,
+                                     const std::vector<size_t> &outShape, size_t axis,
+                                     double fct) {
+                fftwC2R(input, output, inShape, outShape, axis, fct);
+            }
+
+            LIBRAPID_INLINE void c2r(const Complex<float> *input, float *output,
+                                     const std::vector<size_t> &inShape,
+                                     const std::vector<size_t> &outShape, size_t axis,
+                                     float fct) {
+                fftwC2R(input, output, inShape, outShape, axis, fct);
+            }
+
+            template<typename T>
+            LIBRAPID_INLINE void fftwC2C(const Complex<T> *input, Complex<T> *output,
+                                         const std::vector<size_t> &shape,
+                                         const std::vector<size_t> &axes, bool forward, T fct) {
+                // The first axis reads from the input and every later one works in place
+                const Complex<T> *src = input;
+                for (size_t axis : axes) {
+                    const auto length = static_cast<int64_t>(shape[axis]);
+                    fftwAlongAxis<T>(PlanType::ComplexToComplex, forward, src, output, shape,
+                                     axis, length, length);
+                    src = output;
+                }
+
+                int64_t elements = 1;
+                for (size_t dim : shape) elements *= static_cast<int64_t>(dim);
+                scale(reinterpret_cast<T *>(output), 2 * elements, fct);
+            }
+
+            LIBRAPID_INLINE void c2c(const Complex<double> *input, Complex<double> *output,
+                                     const std::vector<size_t> &shape,
+                                     const std::vector<size_t> &axes, bool forward, double fct) {
+                fftwC2C(input, output, shape, axes, forward, fct);
+            }
+
+            LIBRAPID_INLINE void c2c(const Complex<float> *input, Complex<float> *output,
+                                     const std::vector<size_t> &shape,
+                                     const std::vector<size_t> &axes, bool forward, float fct) {
+                fftwC2C(input, output, shape, axes, forward, fct);
+            }
+#endif // LIBRAPID_HAS_FFTW || LIBRAPID_HAS_CUDA
+        }  // namespace cpu
 
 #if defined(LIBRAPID_HAS_CUDA)
         namespace gpu {
-            LIBRAPID_INLINE void rfft(Complex<double> *output, double *input, size_t n) {
-                cufftHandle plan;
-                cufftPlan1d(&plan, (int)n, CUFFT_D2Z, 1);
-                cufftSetStream(plan, global::cudaStream);
-                cufftExecD2Z(plan, input, reinterpret_cast<cufftDoubleComplex *>(output));
-                cufftDestroy(plan);
-            }
-
-            LIBRAPID_INLINE void rfft(Complex<float> *output, float *input, size_t n) {
-                cufftHandle plan;
-                cufftPlan1d(&plan, (int)n, CUFFT_R2C, 1);
-                cufftSetStream(plan, global::cudaStream);
-                cudaStreamSynchronize(global::cudaStream);
-                cufftExecR2C(plan, input, reinterpret_cast<cufftComplex *>(output));
-                cufftDestroy(plan);
+            LIBRAPID_INLINE PlanCache<cufftHandle> &cufftPlanCache() {
+                static PlanCache<cufftHandle> cache([](cufftHandle plan) { cufftDestroy(plan); });
+                return cache;
+            }
+
+            LIBRAPID_INLINE cufftType cufftTransformType(PlanType type, size_t precision) {
+                const bool isDouble = precision == sizeof(double);
+                switch (type) {
+                    case PlanType::RealToComplex: return isDouble ? CUFFT_D2Z : CUFFT_R2C;
+                    case PlanType::ComplexToReal: return isDouble ? CUFFT_Z2D : CUFFT_C2R;
+                    default: return isDouble ? CUFFT_Z2Z : CUFFT_C2C;
+                }
+            }
+
+            /// Run a batch of 1D cuFFT transforms along \p axis, reusing a cached plan
+            template<typename T, typename In, typename Out>
+            void cufftAlongAxis(PlanType type, bool forward, In *input, Out *output,
+                                const std::vector<size_t> &shape, size_t axis, int64_t inLength,
+                                int64_t outLength) {
+                const auto layout  = axisLayout(shape, axis);
+                const bool inPlace = static_cast<const void *>(input) == output;
+                const PlanKey key  = planKey(type,
+                                            forward,
+                                            sizeof(T),
+                                            static_cast<int64_t>(shape[axis]),
+                                            inLength,
+                                            outLength,
+                                            layout,
+                                            inPlace,
+                                            1);
+
+                cufftHandle plan = cufftPlanCache().get(key, [&]() {
+                    cufftHandle res;
+                    int n        = static_cast<int>(key.length);
+                    int inEmbed  = static_cast<int>(key.inLength);
+                    int outEmbed = static_cast<int>(key.outLength);
+                    cufftSafeCall(cufftPlanMany(&res, 1, &n,
+                                                &inEmbed,
+                                                static_cast<int>(key.inStride),
+                                                static_cast<int>(key.inDist),
+                                                &outEmbed,
+                                                static_cast<int>(key.outStride),
+                                                static_cast<int>(key.outDist),
+                                                cufftTransformType(type, sizeof(T)),
+                                                static_cast<int>(key.howMany)));
+                    cufftSafeCall(cufftSetStream(res, global::cudaStream));
+                    return res;
+                });
+
+                auto *in                   = const_cast<std::remove_const_t<In> *>(input);
+                const int direction        = forward ? CUFFT_FORWARD : CUFFT_INVERSE;
+                const int64_t slices       = layout.inner == 1 ? 1 : layout.outer;
+                const int64_t inSlice      = inLength * layout.inner;
+                const int64_t outSlice     = outLength * layout.inner;
+                for (int64_t i = 0; i < slices; ++i) {
+                    auto *src = in + i * inSlice;
+                    auto *dst = output + i * outSlice;
+                    if constexpr (std::is_same_v<T, double>) {
+                        switch (type) {
+                            case PlanType::RealToComplex:
+                                cufftSafeCall(cufftExecD2Z(
+                                  plan, src, reinterpret_cast<cufftDoubleComplex *>(dst)));
+                                break;
+                            case PlanType::ComplexToReal:
+                                cufftSafeCall(cufftExecZ2D(
+                                  plan, reinterpret_cast<cufftDoubleComplex *>(src), dst));
+                                break;
+                            default:
+                                cufftSafeCall(
+                                  cufftExecZ2Z(plan,
+                                               reinterpret_cast<cufftDoubleComplex *>(src),
+                                               reinterpret_cast<cufftDoubleComplex *>(dst),
+                                               direction));
+                                break;
+                        }
+                    } else {
+                        switch (type) {
+                            case PlanType::RealToComplex:
+                                cufftSafeCall(
+                                  cufftExecR2C(plan, src, reinterpret_cast<cufftComplex *>(dst)));
+                                break;
+                            case PlanType::ComplexToReal:
+                                cufftSafeCall(
+                                  cufftExecC2R(plan, reinterpret_cast<cufftComplex *>(src), dst));
+                                break;
+                            default:
+                                cufftSafeCall(cufftExecC2C(plan,
+                                                           reinterpret_cast<cufftComplex *>(src),
+                                                           reinterpret_cast<cufftComplex *>(dst),
+                                                           direction));
+                                break;
+                        }
+                    }
+                }
+            }
+
+            /// Scale \p elements real values (or 2 * elements for complex data) in place
+            template<typename T>
+            LIBRAPID_INLINE void scale(T *data, int64_t elements, T fct) {
+                if (fct == T(1)) return;
+                if constexpr (std::is_same_v<T, double>) {
+                    cublasSafeCall(
+                      cublasDscal_v2(global::cublasHandle, (int)elements, &fct, data, 1));
+                } else {
+                    cublasSafeCall(
+                      cublasSscal_v2(global::cublasHandle, (int)elements, &fct, data, 1));
+                }
+            }
+
+            /// Copy \p elements real values into the real parts of \p dst and zero the imaginary
+            /// parts, without leaving the device
+            template<typename T>
+            LIBRAPID_INLINE void promoteToComplex(const T *src, Complex<T> *dst, int64_t elements) {
+                cudaSafeCall(cudaMemsetAsync(
+                  dst, 0, static_cast<size_t>(elements) * sizeof(Complex<T>), global::cudaStream));
+                cudaSafeCall(cudaMemcpy2DAsync(dst,
+                                               sizeof(Complex<T>),
+                                               src,
+                                               sizeof(T),
+                                               sizeof(T),
+                                               static_cast<size_t>(elements),
+                                               cudaMemcpyDeviceToDevice,
+                                               global::cudaStream));
             }
         } // namespace gpu
 #endif    // LIBRAPID_HAS_CUDA
     }     // namespace detail
 
-    /// \brief Compute the real-valued discrete Fourier transform of a 1D array
+    /// \brief Destroy every cached FFT plan
+    ///
+    /// Plans are cached and reused by every transform with the same size, layout, direction and
+    /// thread count. This releases them. It must not be called while a transform is running.
+    LIBRAPID_INLINE void clearPlanCache() {
+#if defined(LIBRAPID_HAS_FFTW) || defined(LIBRAPID_HAS_CUDA)
+        detail::cpu::fftwPlanCache<double>().clear();
+        detail::cpu::fftwPlanCache<float>().clear();
+#endif
+#if defined(LIBRAPID_HAS_CUDA)
+        detail::gpu::cufftPlanCache().clear();
+#endif
+    }
+
+    /// \brief Compute the real-valued discrete Fourier transform of an array along one axis
     ///
-    /// Given a 1D array of real numbers, compute the discrete Fourier transform of the array. This
-    /// returns an array of length \f$\frac{n}{2} + 1\f$ where \f$n\f$ is the length of the input
-    /// array. The returned array contains the non-redundant half of the resulting transform, since
-    /// the other half can be obtained by taking the complex conjugate of the first half.
+    /// Given an array of real numbers, compute the discrete Fourier transform of every 1D slice
+    /// along \p axis. The result has the same shape as the input, except that the transformed
+    /// axis has length \f$\frac{n}{2} + 1\f$, where \f$n\f$ is its length in the input. It
+    /// contains the non-redundant half of each transform, since the other half can be obtained
+    /// by taking the complex conjugate of the first half.
     ///
     /// \tparam ShapeType The shape type of the input array
     /// \tparam StorageScalar The scalar type of the input array
     /// \param array The input array
+    /// \param axis The axis to transform along. Negative values count from the end
     /// \return The discrete Fourier transform of the input array
     template<typename ShapeType, typename StorageScalar>
-    LIBRAPID_NODISCARD auto rfft(array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array)
+    LIBRAPID_NODISCARD auto
+    rfft(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array, int64_t axis = -1)
       -> Array<Complex<StorageScalar>, backend::CPU> {
-        LIBRAPID_ASSERT(array.ndim() == 1, "RFFT only implemented for 1D arrays");
-        int64_t outSize = array.shape()[0] / 2 + 1;
-        Array<Complex<StorageScalar>, backend::CPU> res(Shape({outSize}));
-        StorageScalar *input           = array.storage().begin();
-        Complex<StorageScalar> *output = res.storage().begin();
-        detail::cpu::rfft(output, input, array.shape()[0]);
+        const auto shape      = detail::shapeToVector(array.shape());
+        const size_t fftAxis  = detail::normaliseAxis(axis, shape.size());
+        std::vector<size_t> outShape = shape;
+        outShape[fftAxis]            = shape[fftAxis] / 2 + 1;
+
+        Array<Complex<StorageScalar>, backend::CPU> res((Shape(outShape)));
+        detail::cpu::r2c(array.storage().data(), res.storage().data(), shape, fftAxis);
+        return res;
+    }
+
+    /// \brief Compute the inverse of rfft along one axis
+    ///
+    /// The input contains the non-redundant half of each transform, as returned by rfft. The
+    /// output has length \p n along \p axis; by default, this is \f$2(m - 1)\f$ where \f$m\f$ is
+    /// the length of the input along the axis. The result is scaled by \f$\frac{1}{n}\f$, so
+    /// `irfft(rfft(x), n)` returns `x`.
+    ///
+    /// \tparam ShapeType The shape type of the input array
+    /// \tparam StorageScalar The real scalar type of the input array
+    /// \param array The input array
+    /// \param n The length of the output along the transformed axis
+    /// \param axis The axis to transform along. Negative values count from the end
+    /// \return The real-valued inverse transform
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    irfft(const array::ArrayContainer<ShapeType, Storage<Complex<StorageScalar>>> &array,
+          int64_t n = -1, int64_t axis = -1) -> Array<StorageScalar, backend::CPU> {
+        const auto shape     = detail::shapeToVector(array.shape());
+        const size_t fftAxis = detail::normaliseAxis(axis, shape.size());
+        const auto length    = n < 0 ? 2 * (static_cast<int64_t>(shape[fftAxis]) - 1) : n;
+        LIBRAPID_ASSERT(length > 0, "Output length must be greater than zero");
+        LIBRAPID_ASSERT(static_cast<int64_t>(shape[fftAxis]) >= length / 2 + 1,
+                        "Input must have at least {} elements along axis {} to produce {} outputs",
+                        length / 2 + 1,
+                        fftAxis,
+                        length);
+
+        std::vector<size_t> outShape = shape;
+        outShape[fftAxis]            = static_cast<size_t>(length);
+
+        Array<StorageScalar, backend::CPU> res((Shape(outShape)));
+        detail::cpu::c2r(array.storage().data(),
+                         res.storage().data(),
+                         shape,
+                         outShape,
+                         fftAxis,
+                         StorageScalar(1) / static_cast<StorageScalar>(length));
         return res;
     }
 
+    /// \brief Compute the complex discrete Fourier transform over several axes
+    ///
+    /// Real inputs are promoted to complex values first. Forward transforms are unscaled and
+    /// inverse transforms are scaled by \f$\frac{1}{N}\f$, where \f$N\f$ is the number of
+    /// elements in each transformed block.
+    ///
+    /// \tparam ShapeType The shape type of the input array
+    /// \tparam StorageScalar The scalar type of the input array (real or complex)
+    /// \param array The input array
+    /// \param axes The axes to transform along. If empty, every axis is transformed
+    /// \param forward True for the forward transform, false for the inverse
+    /// \return The transformed array
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fftn(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array,
+         const std::vector<int64_t> &axes = {}, bool forward = true)
+      -> Array<Complex<typename detail::FFTTraits<StorageScalar>::Real>, backend::CPU> {
+        using Real          = typename detail::FFTTraits<StorageScalar>::Real;
+        const auto shape    = detail::shapeToVector(array.shape());
+        const auto fftAxes  = detail::normaliseAxes(axes, shape.size());
+
+        Real fct = 1;
+        if (!forward) {
+            for (size_t axis : fftAxes) fct /= static_cast<Real>(shape[axis]);
+        }
+
+        Array<Complex<Real>, backend::CPU> res((Shape(shape)));
+        if constexpr (detail::FFTTraits<StorageScalar>::isComplex) {
+            detail::cpu::c2c(
+              array.storage().data(), res.storage().data(), shape, fftAxes, forward, fct);
+        } else {
+            const int64_t elements = array.shape().size();
+            const StorageScalar *src = array.storage().data();
+            Complex<Real> *dst       = res.storage().data();
+            for (int64_t i = 0; i < elements; ++i) dst[i] = Complex<Real>(src[i]);
+            detail::cpu::c2c(dst, dst, shape, fftAxes, forward, fct);
+        }
+        return res;
+    }
+
+    /// \brief Compute the inverse complex discrete Fourier transform over several axes
+    /// \see fftn
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifftn(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array,
+          const std::vector<int64_t> &axes = {}) {
+        return fftn(array, axes, false);
+    }
+
+    /// \brief Compute the complex discrete Fourier transform along one axis
+    /// \see fftn
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fft(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array,
+        int64_t axis = -1) {
+        return fftn(array, {axis}, true);
+    }
+
+    /// \brief Compute the inverse complex discrete Fourier transform along one axis
+    /// \see fftn
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifft(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array,
+         int64_t axis = -1) {
+        return fftn(array, {axis}, false);
+    }
+
+    /// \brief Compute the 2D complex discrete Fourier transform over the last two axes
+    /// \see fftn
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fft2(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array) {
+        return fftn(array, {-2, -1}, true);
+    }
+
+    /// \brief Compute the inverse 2D complex discrete Fourier transform over the last two axes
+    /// \see fftn
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifft2(const array::ArrayContainer<ShapeType, Storage<StorageScalar>> &array) {
+        return fftn(array, {-2, -1}, false);
+    }
+
 #if defined(LIBRAPID_HAS_CUDA)
     template<typename ShapeType, typename StorageScalar>
     LIBRAPID_NODISCARD auto
-    rfft(array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array)
-      -> Array<Complex<StorageScalar>, backend::CUDA> {
-        LIBRAPID_ASSERT(array.ndim() == 1, "RFFT only implemented for 1D arrays");
-        int64_t outSize = array.shape()[0] / 2 + 1;
-        Array<Complex<StorageScalar>, backend::CUDA> res(Shape({outSize}));
-        StorageScalar *input           = array.storage().begin().get();
-        Complex<StorageScalar> *output = res.storage().begin().get();
-        detail::gpu::rfft(output, input, array.shape()[0]);
+    rfft(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array,
+         int64_t axis = -1) -> Array<Complex<StorageScalar>, backend::CUDA> {
+        const auto shape             = detail::shapeToVector(array.shape());
+        const size_t fftAxis         = detail::normaliseAxis(axis, shape.size());
+        std::vector<size_t> outShape = shape;
+        outShape[fftAxis]            = shape[fftAxis] / 2 + 1;
+
+        Array<Complex<StorageScalar>, backend::CUDA> res((Shape(outShape)));
+        detail::gpu::cufftAlongAxis<StorageScalar>(
+          detail::PlanType::RealToComplex,
+          true,
+          array.storage().data(),
+          res.storage().data(),
+          shape,
+          fftAxis,
+          static_cast<int64_t>(shape[fftAxis]),
+          static_cast<int64_t>(outShape[fftAxis]));
+        return res;
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    irfft(const array::ArrayContainer<ShapeType, CudaStorage<Complex<StorageScalar>>> &array,
+          int64_t n = -1, int64_t axis = -1) -> Array<StorageScalar, backend::CUDA> {
+        const auto shape     = detail::shapeToVector(array.shape());
+        const size_t fftAxis = detail::normaliseAxis(axis, shape.size());
+        const auto length    = n < 0 ? 2 * (static_cast<int64_t>(shape[fftAxis]) - 1) : n;
+        LIBRAPID_ASSERT(length > 0, "Output length must be greater than zero");
+        LIBRAPID_ASSERT(static_cast<int64_t>(shape[fftAxis]) >= length / 2 + 1,
+                        "Input must have at least {} elements along axis {} to produce {} outputs",
+                        length / 2 + 1,
+                        fftAxis,
+                        length);
+
+        std::vector<size_t> outShape = shape;
+        outShape[fftAxis]            = static_cast<size_t>(length);
+
+        // cuFFT overwrites the input of complex-to-real transforms
+        auto input = array.copy();
+        Array<StorageScalar, backend::CUDA> res((Shape(outShape)));
+        detail::gpu::cufftAlongAxis<StorageScalar>(detail::PlanType::ComplexToReal,
+                                                   false,
+                                                   input.storage().data(),
+                                                   res.storage().data(),
+                                                   outShape,
+                                                   fftAxis,
+                                                   static_cast<int64_t>(shape[fftAxis]),
+                                                   length);
+        detail::gpu::scale(res.storage().data(),
+                           static_cast<int64_t>(res.shape().size()),
+                           StorageScalar(1) / static_cast<StorageScalar>(length));
+        return res;
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fftn(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array,
+         const std::vector<int64_t> &axes = {}, bool forward = true)
+      -> Array<Complex<typename detail::FFTTraits<StorageScalar>::Real>, backend::CUDA> {
+        using Real         = typename detail::FFTTraits<StorageScalar>::Real;
+        const auto shape   = detail::shapeToVector(array.shape());
+        const auto fftAxes = detail::normaliseAxes(axes, shape.size());
+
+        Real fct = 1;
+        if (!forward) {
+            for (size_t axis : fftAxes) fct /= static_cast<Real>(shape[axis]);
+        }
+
+        Array<Complex<Real>, backend::CUDA> res((Shape(shape)));
+        const Complex<Real> *src;
+        if constexpr (detail::FFTTraits<StorageScalar>::isComplex) {
+            src = array.storage().data();
+        } else {
+            // Promote into the result, then transform it in place
+            detail::gpu::promoteToComplex(array.storage().data(),
+                                          res.storage().data(),
+                                          static_cast<int64_t>(array.shape().size()));
+            src = res.storage().data();
+        }
+        for (size_t axis : fftAxes) {
+            const auto length = static_cast<int64_t>(shape[axis]);
+            detail::gpu::cufftAlongAxis<Real>(detail::PlanType::ComplexToComplex,
+                                              forward,
+                                              src,
+                                              res.storage().data(),
+                                              shape,
+                                              axis,
+                                              length,
+                                              length);
+            src = res.storage().data();
+        }
+        detail::gpu::scale(reinterpret_cast<Real *>(res.storage().data()),
+                           2 * static_cast<int64_t>(res.shape().size()),
+                           fct);
         return res;
     }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifftn(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array,
+          const std::vector<int64_t> &axes = {}) {
+        return fftn(array, axes, false);
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fft(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array,
+        int64_t axis = -1) {
+        return fftn(array, {axis}, true);
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifft(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array,
+         int64_t axis = -1) {
+        return fftn(array, {axis}, false);
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    fft2(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array) {
+        return fftn(array, {-2, -1}, true);
+    }
+
+    template<typename ShapeType, typename StorageScalar>
+    LIBRAPID_NODISCARD auto
+    ifft2(const array::ArrayContainer<ShapeType, CudaStorage<StorageScalar>> &array) {
+        return fftn(array, {-2, -1}, false);
+    }
 #endif // LIBRAPID_HAS_CUDA
 } // namespace librapid::fft
 
-#endif // LIBRAPID_ARRAY_FOURIER_TRANFORM_HPP
\ No newline at end of file
+#endif // LIBRAPID_ARRAY_FOURIER_TRANFORM_HPP
@@ -129,6 +129,114 @@ namespace librapid {
 			}
 		}
 
+		/// Maps linear indices in the output of a Function to linear indices in one of its
+		/// (broadcast) arguments. Broadcast dimensions have a stride of zero, so every output
+		/// element along that axis maps to the same argument element.
+		class BroadcastMap {
+		public:
+			BroadcastMap() = default;
+
+			/// Construct a BroadcastMap for an argument of shape \p arg broadcast to \p output
+			/// \tparam OutputShape The shape type of the Function
+			/// \tparam ArgShape The shape type of the argument
+			/// \param output The (broadcast) output shape
+			/// \param arg The shape of the argument
+			template<typename OutputShape, typename ArgShape>
+			BroadcastMap(const OutputShape &output, const ArgShape &arg) :
+					m_ndim(static_cast<int64_t>(output.ndim())) {
+				const int64_t argDims = static_cast<int64_t>(arg.ndim());
+				m_trivial			  = (argDims == m_ndim);
+
+				int64_t stride = 1;
+				for (int64_t d = m_ndim - 1; d >= 0; --d) {
+					const int64_t argDim = d - (m_ndim - argDims);
+					const int64_t extent = static_cast<int64_t>(output[d]);
+					const int64_t argExtent =
+					  argDim >= 0 ? static_cast<int64_t>(arg[argDim]) : int64_t(1);
+
+					m_extent[d] = extent;
+					m_stride[d] = argExtent == extent ? stride : 0;
+					m_trivial	= m_trivial && argExtent == extent;
+					stride *= argExtent;
+				}
+
+				m_innerBroadcast = !m_trivial && m_ndim > 0 && m_stride[m_ndim - 1] == 0 &&
+								   m_extent[m_ndim - 1] != 1;
+			}
+
+			/// True if the argument has the same shape as the output
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool trivial() const { return m_trivial; }
+
+			/// True if the argument is broadcast along the innermost axis, meaning every element
+			/// of a row in the output maps to the same argument element
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool innerBroadcast() const {
+				return m_innerBroadcast;
+			}
+
+			/// Map an index into the output to an index into the argument
+			/// \param index Linear index into the output
+			/// \return Linear index into the argument
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t operator()(size_t index) const {
+				int64_t remaining = static_cast<int64_t>(index);
+				int64_t res		  = 0;
+				for (int64_t d = m_ndim - 1; d >= 0 && remaining > 0; --d) {
+					res += (remaining % m_extent[d]) * m_stride[d];
+					remaining /= m_extent[d];
+				}
+				return static_cast<size_t>(res);
+			}
+
+		private:
+			int64_t m_ndim		  = 0;
+			bool m_trivial		  = true;
+			bool m_innerBroadcast = false;
+			std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> m_extent {};
+			std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> m_stride {};
+		};
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool argIsBroadcast(const T &obj) {
+			if constexpr (requires { obj.isBroadcast(); }) {
+				return obj.isBroadcast();
+			} else {
+				return false;
+			}
+		}
+
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		unalignedPacketExtractor(const T &obj, size_t index) {
+			if constexpr (detail::IsArrayType<T>::val) {
+				return obj.packetUnaligned(index);
+			} else {
+				return Packet(obj);
+			}
+		}
+
+		/// Broadcast packets are read one row of the innermost axis at a time, starting from
+		/// the first element of the row, so the indices are not multiples of the packet width
+		template<typename Packet, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+		broadcastPacketExtractor(const T &obj, const BroadcastMap &map, size_t index) {
+			if constexpr (detail::IsArrayType<T>::val) {
+				if (map.trivial()) return obj.packetUnaligned(index);
+				if (map.innerBroadcast()) return Packet(obj.scalar(map(index)));
+				return obj.packetUnaligned(map(index));
+			} else {
+				return Packet(obj);
+			}
+		}
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto
+		broadcastScalarExtractor(const T &obj, const BroadcastMap &map, size_t index) {
+			if constexpr (detail::IsArrayType<T>::val) {
+				return obj.scalar(map(index));
+			} else {
+				return obj;
+			}
+		}
+
 		template<typename First, typename... Rest>
 		constexpr auto scalarTypesAreSame() {
 			if constexpr (sizeof...(Rest) == 0) {
@@ -205,11 +313,24 @@ namespace librapid {
 
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator[](int64_t index) const;
 
-			/// Evaluates the function at the given index, returning a Packet result.
+			/// Returns true if any argument (or any argument of a nested Function) is broadcast
+			/// to the shape of this Function.
+			/// \return True if broadcasting is required to evaluate the Function
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isBroadcast() const;
+
+			/// Evaluates the function at the given index, returning a Packet result. If the
+			/// Function is broadcast (see ``isBroadcast()``), the packet must not span more than
+			/// one row of the innermost axis.
 			/// \param index The index to evaluate at.
 			/// \return The result of the function (vectorized).
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(size_t index) const;
 
+			/// Evaluates the function at an index which need not be a multiple of the packet
+			/// width. The same restriction on broadcast Functions applies as for ``packet()``.
+			/// \param index The index to evaluate at.
+			/// \return The result of the function (vectorized).
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetUnaligned(size_t index) const;
+
 			/// Evaluates the function at the given index, returning a Scalar result.
 			/// \param index The index to evaluate at.
 			/// \return The result of the function (scalar).
@@ -232,6 +353,12 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packetImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- evaluates the function at an unaligned index, returning a
+			/// Packet result.
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+			packetUnalignedImpl(std::index_sequence<I...>, size_t index) const;
+
 			/// Implementation detail -- evaluates the function at the given index,
 			/// returning a Scalar result.
 			/// \tparam I The index sequence.
@@ -241,10 +368,29 @@ namespace librapid {
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar scalarImpl(std::index_sequence<I...>,
 																		size_t index) const;
 
+			/// Implementation detail -- evaluates a broadcast function at the given index,
+			/// returning a Packet result.
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet
+			broadcastPacketImpl(std::index_sequence<I...>, size_t index) const;
+
+			/// Implementation detail -- evaluates a broadcast function at the given index,
+			/// returning a Scalar result.
+			template<size_t... I>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar
+			broadcastScalarImpl(std::index_sequence<I...>, size_t index) const;
+
+			/// Implementation detail -- computes the BroadcastMap for each array argument
+			template<size_t... I>
+			LIBRAPID_ALWAYS_INLINE void initBroadcast(std::index_sequence<I...>);
+
 			Functor m_functor;
 			std::tuple<Args...> m_args;
 			ShapeType m_shape;
 			size_t m_size = 0;
+
+			bool m_isBroadcast = false;
+			std::array<BroadcastMap, sizeof...(Args)> m_broadcast;
 		};
 
 		template<typename desc, typename Functor, typename... Args>
@@ -252,7 +398,24 @@ namespace librapid {
 																		  Args &&...args) :
 				m_functor(std::forward<Functor>(functor)),
 				m_args(std::forward<Args>(args)...),
-				m_shape(typetraits::TypeInfo<Functor>::getShape(m_args)), m_size(m_shape.size()) {}
+				m_shape(typetraits::TypeInfo<Functor>::getShape(m_args)), m_size(m_shape.size()) {
+			initBroadcast(std::make_index_sequence<sizeof...(Args)>());
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		LIBRAPID_ALWAYS_INLINE void
+		Function<desc, Functor, Args...>::initBroadcast(std::index_sequence<I...>) {
+			auto init = [this](auto &map, const auto &arg) {
+				using ArgType = std::decay_t<decltype(arg)>;
+				if constexpr (detail::IsArrayType<ArgType>::val) {
+					map			  = BroadcastMap(m_shape, arg.shape());
+					m_isBroadcast = m_isBroadcast || !map.trivial() || argIsBroadcast(arg);
+				}
+			};
+
+			(init(m_broadcast[I], std::get<I>(m_args)), ...);
+		}
 
 		template<typename desc, typename Functor, typename... Args>
 		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::shape() const
@@ -288,9 +451,17 @@ namespace librapid {
 			return res;
 		}
 
+		template<typename desc, typename Functor, typename... Args>
+		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::isBroadcast() const -> bool {
+			return m_isBroadcast;
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		typename Function<desc, Functor, Args...>::Packet LIBRAPID_ALWAYS_INLINE
 		Function<desc, Functor, Args...>::packet(size_t index) const {
+			if (m_isBroadcast) LIBRAPID_UNLIKELY {
+				return broadcastPacketImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+			}
 			return packetImpl(std::make_index_sequence<sizeof...(Args)>(), index);
 		}
 
@@ -302,9 +473,39 @@ namespace librapid {
 			return m_functor.packet(packetExtractor<Packet>(std::get<I>(m_args), index)...);
 		}
 
+		template<typename desc, typename Functor, typename... Args>
+		typename Function<desc, Functor, Args...>::Packet LIBRAPID_ALWAYS_INLINE
+		Function<desc, Functor, Args...>::packetUnaligned(size_t index) const {
+			if (m_isBroadcast) LIBRAPID_UNLIKELY {
+				return broadcastPacketImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+			}
+			return packetUnalignedImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		LIBRAPID_ALWAYS_INLINE auto
+		Function<desc, Functor, Args...>::packetUnalignedImpl(std::index_sequence<I...>,
+															  size_t index) const -> Packet {
+			return m_functor.packet(
+			  unalignedPacketExtractor<Packet>(std::get<I>(m_args), index)...);
+		}
+
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		LIBRAPID_ALWAYS_INLINE auto
+		Function<desc, Functor, Args...>::broadcastPacketImpl(std::index_sequence<I...>,
+															  size_t index) const -> Packet {
+			return m_functor.packet(
+			  broadcastPacketExtractor<Packet>(std::get<I>(m_args), m_broadcast[I], index)...);
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::scalar(size_t index) const
 		  -> Scalar {
+			if (m_isBroadcast) LIBRAPID_UNLIKELY {
+				return broadcastScalarImpl(std::make_index_sequence<sizeof...(Args)>(), index);
+			}
 			return scalarImpl(std::make_index_sequence<sizeof...(Args)>(), index);
 		}
 
@@ -316,6 +517,15 @@ namespace librapid {
 			return m_functor(scalarExtractor(std::get<I>(m_args), index)...);
 		}
 
+		template<typename desc, typename Functor, typename... Args>
+		template<size_t... I>
+		LIBRAPID_ALWAYS_INLINE auto
+		Function<desc, Functor, Args...>::broadcastScalarImpl(std::index_sequence<I...>,
+															  size_t index) const -> Scalar {
+			return m_functor(
+			  broadcastScalarExtractor(std::get<I>(m_args), m_broadcast[I], index)...);
+		}
+
 		template<typename desc, typename Functor, typename... Args>
 		LIBRAPID_ALWAYS_INLINE auto Function<desc, Functor, Args...>::begin() const -> Iterator {
 			return Iterator(*this, 0);
@@ -44,6 +44,11 @@ namespace librapid {
 			using ArrayType		 = array::ArrayContainer<ShapeType, StorageType>;
 			using Iterator		 = detail::ArrayIterator<GeneralArrayView>;
 
+			/// True if the referenced data can be accessed through a raw pointer
+			static constexpr bool directAccess =
+			  std::is_same_v<Backend, backend::CPU> &&
+			  typetraits::TypeInfo<BaseType>::type == detail::LibRapidType::ArrayContainer;
+
 			/// Default constructor should never be used
 			GeneralArrayView() = delete;
 
@@ -182,6 +187,13 @@ namespace librapid {
 					 const char (&formatString)[N], Ctx &ctx) const;
 
 		private:
+			/// Implementation detail -- write the elements of \p source (indexed linearly, in
+			/// row-major order) into the elements referenced by this view
+			/// \tparam T The type of the source object
+			/// \param source The object to copy from
+			template<typename T>
+			LIBRAPID_ALWAYS_INLINE void assignImpl(const T &source);
+
 			ArrayViewType m_ref;
 			ShapeType m_shape;
 			StrideType m_stride;
@@ -200,7 +212,7 @@ namespace librapid {
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::GeneralArrayView(
 		  const GeneralArrayView &other) :
 				m_ref(other.m_ref),
-				m_shape(other.m_shape), m_stride(other.m_stride) {}
+				m_shape(other.m_shape), m_stride(other.m_stride), m_offset(other.m_offset) {}
 
 		template<typename ArrayViewType, typename ArrayViewShapeType>
 		LIBRAPID_ALWAYS_INLINE
@@ -230,25 +242,8 @@ namespace librapid {
 										   m_shape,
 										   other.shape());
 
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				m_ref.storage()[p + m_offset] = other.scalar(d++);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+			// Evaluate the source first, in case the two views overlap
+			assignImpl(other.eval());
 
 			return *this;
 		}
@@ -264,25 +259,7 @@ namespace librapid {
 										   m_shape,
 										   other.shape());
 
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				m_ref.storage()[p + m_offset] = other.scalar(d++);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+			assignImpl(other);
 
 			return *this;
 		}
@@ -297,25 +274,7 @@ namespace librapid {
 										   m_shape,
 										   function.shape());
 
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				m_ref.storage()[p + m_offset] = function.scalar(d++);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+			assignImpl(function);
 
 			return *this;
 		}
@@ -330,25 +289,7 @@ namespace librapid {
 										   m_shape,
 										   transpose.shape());
 
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				m_ref.storage()[p + m_offset] = transpose.scalar(d++);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+			assignImpl(transpose);
 
 			return *this;
 		}
@@ -365,29 +306,71 @@ namespace librapid {
 										   m_shape,
 										   matmul.shape());
 
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				m_ref.storage()[p + m_offset] = matmul.scalar(d++);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+			assignImpl(matmul);
 
 			return *this;
 		}
 
+		template<typename ArrayViewType, typename ArrayViewShapeType>
+		template<typename T>
+		LIBRAPID_ALWAYS_INLINE void
+		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::assignImpl(const T &source) {
+			using SourceInfo   = typetraits::TypeInfo<T>;
+			using SourceScalar = typename SourceInfo::Scalar;
+			constexpr bool cpu =
+			  directAccess && std::is_same_v<typename SourceInfo::Backend, backend::CPU>;
+
+			detail::forEachStridedRun(
+			  m_shape,
+			  m_stride,
+			  m_offset,
+			  [&](int64_t index, int64_t offset, int64_t length, int64_t stride) {
+				  if constexpr (cpu) {
+					  Scalar *dst = m_ref.storage().data() + offset;
+					  int64_t i	  = 0;
+
+					  if constexpr (SourceInfo::type == detail::LibRapidType::ArrayContainer &&
+									std::is_same_v<SourceScalar, Scalar>) {
+						  const Scalar *src = source.storage().data() + index;
+						  if (stride == 1) {
+							  std::copy(src, src + length, dst);
+						  } else {
+							  for (; i < length; ++i) dst[i * stride] = src[i];
+						  }
+						  return;
+					  } else if constexpr (SourceInfo::type ==
+											 detail::LibRapidType::ArrayFunction &&
+										   SourceInfo::allowVectorisation &&
+										   std::is_same_v<SourceScalar, Scalar> &&
+										   typetraits::TypeInfo<Scalar>::packetWidth > 1) {
+						  // Transpose and ArrayMultiply are tagged as Functions too, but never
+						  // allow vectorisation, so only real Functions reach this branch
+						  constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+						  if constexpr (T::argsAreSameType) {
+							  if (stride == 1 && detail::canVectorise(source, packetWidth)) {
+								  // Function packets must be read from aligned indices
+								  for (; i < length && (index + i) % packetWidth != 0; ++i) {
+									  dst[i] = source.scalar(index + i);
+								  }
+								  for (; i + packetWidth <= length; i += packetWidth) {
+									  source.packet(index + i).store_unaligned(dst + i);
+								  }
+							  }
+						  }
+					  }
+
+					  for (; i < length; ++i) {
+						  dst[i * stride] = static_cast<Scalar>(source.scalar(index + i));
+					  }
+				  } else {
+					  for (int64_t i = 0; i < length; ++i) {
+						  m_ref.storage()[offset + i * stride] =
+							static_cast<Scalar>(source.scalar(index + i));
+					  }
+				  }
+			  });
+		}
+
 		template<typename ArrayViewType, typename ArrayViewShapeType>
 		LIBRAPID_ALWAYS_INLINE const auto
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::operator[](int64_t index) const {
@@ -397,14 +380,13 @@ namespace librapid {
 			  "Index {} out of bounds in ArrayContainer::operator[] with leading dimension={}",
 			  index,
 			  m_shape[0]);
-			auto view		  = createGeneralArrayViewShapeModifier<Shape>(m_ref);
-			const auto stride = Stride(m_shape);
+			auto view = createGeneralArrayViewShapeModifier<Shape>(m_ref);
 			view.setShape(m_shape.subshape(1, ndim()));
 			if (ndim() == 1)
 				view.setStride(Stride<Shape>({1}));
 			else
-				view.setStride(stride.substride(1, ndim()));
-			view.setOffset(m_offset + index * stride[0]);
+				view.setStride(m_stride.substride(1, ndim()));
+			view.setOffset(m_offset + index * m_stride[0]);
 			return view;
 		}
 
@@ -417,14 +399,13 @@ namespace librapid {
 			  "Index {} out of bounds in ArrayContainer::operator[] with leading dimension={}",
 			  index,
 			  m_shape[0]);
-			auto view		  = createGeneralArrayViewShapeModifier<Shape>(m_ref);
-			const auto stride = Stride(m_shape);
+			auto view = createGeneralArrayViewShapeModifier<Shape>(m_ref);
 			view.setShape(m_shape.subshape(1, ndim()));
 			if (ndim() == 1)
 				view.setStride(Stride<Shape>({1}));
 			else
-				view.setStride(stride.substride(1, ndim()));
-			view.setOffset(m_offset + index * stride[0]);
+				view.setStride(m_stride.substride(1, ndim()));
+			view.setOffset(m_offset + index * m_stride[0]);
 			return view;
 		}
 
@@ -498,17 +479,13 @@ namespace librapid {
 		template<typename ArrayViewType, typename ArrayViewShapeType>
 		LIBRAPID_ALWAYS_INLINE auto
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::scalar(int64_t index) const -> auto {
-			if (ndim() == 0) return m_ref.scalar(m_offset);
-
-			ShapeType tmp	= ShapeType::zeros(ndim());
-			tmp[ndim() - 1] = index % m_shape[ndim() - 1];
-			for (int64_t i = ndim() - 2; i >= 0; --i) {
-				index /= m_shape[i + 1];
-				tmp[i] = index % m_shape[i];
+			int64_t offset = m_offset;
+			for (int64_t i = ndim() - 1; i >= 0; --i) {
+				const int64_t extent = static_cast<int64_t>(m_shape[i]);
+				offset += (index % extent) * static_cast<int64_t>(m_stride[i]);
+				index /= extent;
 			}
-			int64_t offset = 0;
-			for (int64_t i = 0; i < ndim(); ++i) { offset += tmp[i] * m_stride[i]; }
-			return m_ref.scalar(m_offset + offset);
+			return m_ref.scalar(offset);
 		}
 
 		template<typename ArrayViewType, typename ArrayViewShapeType>
@@ -547,25 +524,26 @@ namespace librapid {
 		LIBRAPID_ALWAYS_INLINE auto
 		GeneralArrayView<ArrayViewType, ArrayViewShapeType>::eval() const -> ArrayType {
 			ArrayType res(m_shape);
-			ShapeType coord = ShapeType::zeros(m_shape.ndim());
-			int64_t d = 0, p = 0;
-			int64_t idim = 0, adim = 0;
-			const int64_t ndim = m_shape.ndim();
-
-			do {
-				res.storage()[d++] = m_ref.scalar(p + m_offset);
-
-				for (idim = 0; idim < ndim; ++idim) {
-					adim = ndim - idim - 1;
-					if (++coord[adim] == m_shape[adim]) {
-						coord[adim] = 0;
-						p			= p - (m_shape[adim] - 1) * m_stride[adim];
-					} else {
-						p = p + m_stride[adim];
-						break;
-					}
-				}
-			} while (idim < ndim);
+
+			detail::forEachStridedRun(
+			  m_shape,
+			  m_stride,
+			  m_offset,
+			  [&](int64_t index, int64_t offset, int64_t length, int64_t stride) {
+				  if constexpr (directAccess) {
+					  const Scalar *src = m_ref.storage().data() + offset;
+					  Scalar *dst		= res.storage().data() + index;
+					  if (stride == 1) {
+						  std::copy(src, src + length, dst);
+					  } else {
+						  for (int64_t i = 0; i < length; ++i) dst[i] = src[i * stride];
+					  }
+				  } else {
+					  for (int64_t i = 0; i < length; ++i) {
+						  res.storage()[index + i] = m_ref.scalar(offset + i * stride);
+					  }
+				  }
+			  });
 
 			return res;
 		}
@@ -23,14 +23,57 @@ namespace librapid {
 		arrayPointerExtractor(std::shared_ptr<T> ptr) {
 			return ptr.get();
 		}
+
+		/// Compute the offset of every matrix in a stack of matrices with shape \p shape, when it
+		/// is broadcast to the leading (batch) dimensions of \p outputShape. Batch dimensions are
+		/// aligned from the right, and any which are missing from \p shape or have an extent of
+		/// one are repeated.
+		/// \tparam ShapeType The shape type
+		/// \param shape Shape of the stack of matrices
+		/// \param outputShape Shape of the broadcast result
+		/// \return Offset (in elements) of each matrix, in row-major order over the batch
+		template<typename ShapeType>
+		LIBRAPID_NODISCARD std::vector<int64_t> batchedMatrixOffsets(const ShapeType &shape,
+																	 const ShapeType &outputShape) {
+			const int64_t ndim		 = shape.ndim();
+			const int64_t outputNdim = outputShape.ndim();
+			const int64_t matrixSize = int64_t(shape[ndim - 2]) * int64_t(shape[ndim - 1]);
+
+			int64_t batchCount = 1;
+			for (int64_t i = 0; i < outputNdim - 2; ++i) batchCount *= outputShape[i];
+
+			std::vector<int64_t> offsets(batchCount);
+			for (int64_t batch = 0; batch < batchCount; ++batch) {
+				int64_t remaining = batch;
+				int64_t stride	  = matrixSize;
+				int64_t offset	  = 0;
+
+				for (int64_t i = 1; i <= outputNdim - 2; ++i) {
+					const int64_t extent = outputShape[outputNdim - 2 - i];
+					const int64_t index	 = remaining % extent;
+					remaining /= extent;
+
+					if (i <= ndim - 2) {
+						const int64_t inputExtent = shape[ndim - 2 - i];
+						if (inputExtent != 1) offset += index * stride;
+						stride *= inputExtent;
+					}
+				}
+
+				offsets[batch] = offset;
+			}
+
+			return offsets;
+		}
 	} // namespace detail
 
 	namespace linalg {
 		enum class MatmulClass {
-			DOT,   // Vector-vector dot product
-			GEMV,  // Matrix-vector product
-			GEMM,  // Matrix-matrix product
-			OUTER, // Outer product
+			DOT,		  // Vector-vector dot product
+			GEMV,		  // Matrix-vector product
+			GEMM,		  // Matrix-matrix product
+			GEMM_BATCHED, // Stacked matrix-matrix products, broadcast over the batch dimensions
+			OUTER,		  // Outer product
 		};
 
 		/// Class to represent an array multiplication (vector-vector, matrix-vector, matrix-matrix)
@@ -72,7 +115,9 @@ namespace librapid {
 			/// \param alpha
 			/// \param b
 			/// \param beta
-			ArrayMultiply(bool transA, bool transB, TypeA &&a, Alpha alpha, TypeB &&b, Beta beta);
+			/// \param outer If true, two vectors form an outer product rather than a dot product
+			ArrayMultiply(bool transA, bool transB, TypeA &&a, Alpha alpha, TypeB &&b, Beta beta,
+						  bool outer = false);
 
 			/// \brief Array multiplication with \f$ \alpha = 1 \f$ and \f$ \beta = 0 \f$
 			/// \param a
@@ -98,11 +143,17 @@ namespace librapid {
 			/// \brief Determine the class of the array multiplication
 			///
 			/// The class of the array multiplication is determined by the shapes of the arrays.
-			/// There are three supported cases:
-			/// - Vector-vector dot product (both arrays are 1-dimensional vectors)
+			/// The supported cases are:
+			/// - Vector-vector dot product (both arrays are 1-dimensional vectors). Transposing a
+			/// vector has no effect
+			/// - Vector-vector outer product (both arrays are 1-dimensional vectors, and the
+			/// operation was created as an outer product -- see ``librapid::outer``)
 			/// - Matrix-vector product (first array is a 2-dimensional matrix, second array is a
 			/// 1-dimensional vector)
 			/// - Matrix-matrix product (both arrays are 2-dimensional matrices)
+			/// - Batched matrix-matrix product (both arrays have at least 2 dimensions, and at
+			/// least one has more than 2). The last two dimensions of each array are treated as a
+			/// matrix, and the leading (batch) dimensions are broadcast against each other
 			/// \return Class of the array multiplication
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE MatmulClass matmulClass() const;
 
@@ -156,6 +207,36 @@ namespace librapid {
 			/// \return Second array
 			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE TypeB &b();
 
+			/// \brief Fuse a bias and an activation function into the multiplication
+			///
+			/// Returns a copy of this operation which computes
+			/// \f$ f(\alpha \mathrm{OP}_A(\mathbf{A}) \mathrm{OP}_B(\mathbf{B}) + \mathbf{b}) \f$,
+			/// where the bias \f$ \mathbf{b} \f$ has one value per row or per column of the result.
+			/// Matrix-matrix products apply the bias and activation to each block of the result
+			/// while it is still in cache, rather than making extra passes over the output. Vector
+			/// results are treated as a single column. Any existing epilogue is replaced. Only
+			/// supported on the CPU.
+			/// \tparam BiasShapeType Shape type of the bias
+			/// \tparam BiasStorageType Storage type of the bias
+			/// \tparam Activation Type of the activation function
+			/// \param bias Bias vector (ignored if \p biasMode is ``GemmBias::NONE``)
+			/// \param biasMode Whether \p bias has a value per row or per column of the result
+			/// \param activation Element-wise activation function (see ``makeGemmEpilogue``)
+			/// \return Array multiplication with the fused epilogue
+			template<typename BiasShapeType, typename BiasStorageType,
+					 typename Activation = detail::GemmIdentity>
+			LIBRAPID_NODISCARD ArrayMultiply
+			withEpilogue(const array::ArrayContainer<BiasShapeType, BiasStorageType> &bias,
+						 GemmBias biasMode, Activation activation = Activation()) const;
+
+			/// \brief Fuse an activation function into the multiplication
+			/// \tparam Activation Type of the activation function
+			/// \param activation Element-wise activation function (see ``makeGemmEpilogue``)
+			/// \return Array multiplication with the fused activation
+			/// \see withEpilogue
+			template<typename Activation>
+			LIBRAPID_NODISCARD ArrayMultiply withEpilogue(Activation activation) const;
+
 			/// \brief Apply the array multiplication to an array container
 			///
 			/// Apply this operation to the provided Array, assuming that the Array has the correct
@@ -173,6 +254,7 @@ namespace librapid {
 		private:
 			bool m_transA;	 // Transpose state of A
 			bool m_transB;	 // Transpose state of B
+			bool m_outer;	 // Whether two vectors form an outer product
 			TypeA m_a;		 // First array
 			ScalarA m_alpha; // Scaling factor for A
 			TypeB m_b;		 // Second array
@@ -180,15 +262,18 @@ namespace librapid {
 
 			ShapeType m_shape;
 			size_t m_size;
+
+			GemmEpilogue<Scalar> m_epilogue; // Bias and activation applied to the result
 		};
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
 				 typename StorageTypeB, typename Alpha, typename Beta>
 		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
 					  Beta>::ArrayMultiply(bool transA, bool transB, TypeA &&a, Alpha alpha,
-										   TypeB &&b, Beta beta) :
+										   TypeB &&b, Beta beta, bool outer) :
 				m_transA(transA),
-				m_transB(transB), m_a(std::forward<TypeA>(a)), m_alpha(static_cast<ScalarA>(alpha)),
+				m_transB(transB), m_outer(outer), m_a(std::forward<TypeA>(a)),
+				m_alpha(static_cast<ScalarA>(alpha)),
 				m_b(std::forward<TypeB>(b)), m_beta(static_cast<ScalarB>(beta)),
 				m_shape(calculateShape()), m_size(m_shape.size()) {}
 
@@ -197,7 +282,7 @@ namespace librapid {
 		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
 					  Beta>::ArrayMultiply(TypeA &&a, TypeB &&b) :
 				m_transA(false),
-				m_transB(false), m_a(std::forward<TypeA>(a)), m_alpha(1),
+				m_transB(false), m_outer(false), m_a(std::forward<TypeA>(a)), m_alpha(1),
 				m_b(std::forward<TypeB>(b)), m_beta(0), m_shape(calculateShape()),
 				m_size(m_shape.size()) {}
 
@@ -206,7 +291,7 @@ namespace librapid {
 		ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha,
 					  Beta>::ArrayMultiply(bool transA, bool transB, TypeA &&a, TypeB &&b) :
 				m_transA(transA),
-				m_transB(transB), m_a(std::forward<TypeA>(a)), m_alpha(1),
+				m_transB(transB), m_outer(false), m_a(std::forward<TypeA>(a)), m_alpha(1),
 				m_b(std::forward<TypeB>(b)), m_beta(0), m_shape(calculateShape()),
 				m_size(m_shape.size()) {}
 
@@ -218,8 +303,12 @@ namespace librapid {
 			const auto &shapeB = m_b.shape();
 
 			if (shapeA.ndim() == 1 && shapeB.ndim() == 1) {
+				// As in NumPy, transposing a vector does nothing, so the product is only an outer
+				// product if it was explicitly created as one
+				if (m_outer) return MatmulClass::OUTER;
+
 				LIBRAPID_ASSERT(shapeA[0] == shapeB[0],
-								"Vector dimensions must. Expected: {} -- Got: {}",
+								"Vector dimensions must match. Expected: {} -- Got: {}",
 								shapeA[0],
 								shapeB[0]);
 
@@ -269,6 +358,25 @@ namespace librapid {
 								m_b.shape()[int(m_transB)]);
 
 				return MatmulClass::GEMM;
+			} else if (shapeA.ndim() >= 2 && shapeB.ndim() >= 2) {
+				const int64_t ndimA = shapeA.ndim();
+				const int64_t ndimB = shapeB.ndim();
+
+				LIBRAPID_ASSERT(
+				  shapeA[ndimA - 1 - int(m_transA)] == shapeB[ndimB - 2 + int(m_transB)],
+				  "Inner dimensions of matrices must match. Expected: {} -- Got: {}",
+				  shapeA[ndimA - 1 - int(m_transA)],
+				  shapeB[ndimB - 2 + int(m_transB)]);
+
+				for (int64_t i = 3; i <= ::librapid::min(ndimA, ndimB); ++i) {
+					LIBRAPID_ASSERT(shapeA[ndimA - i] == shapeB[ndimB - i] ||
+									  shapeA[ndimA - i] == 1 || shapeB[ndimB - i] == 1,
+									"Batch dimensions cannot be broadcast. Got: {} and {}",
+									shapeA,
+									shapeB);
+				}
+
+				return MatmulClass::GEMM_BATCHED;
 			} else {
 				LIBRAPID_NOT_IMPLEMENTED;
 
@@ -294,9 +402,23 @@ namespace librapid {
 				case MatmulClass::GEMM: {
 					return {shapeA[int(m_transA)], shapeB[int(!m_transB)]};
 				}
+				case MatmulClass::GEMM_BATCHED: {
+					const int64_t ndimA = shapeA.ndim();
+					const int64_t ndimB = shapeB.ndim();
+					const int64_t ndim	= ::librapid::max(ndimA, ndimB);
+
+					auto res = ShapeType::zeros(ndim);
+					for (int64_t i = 3; i <= ndim; ++i) {
+						const int64_t extentA = i <= ndimA ? int64_t(shapeA[ndimA - i]) : 1;
+						const int64_t extentB = i <= ndimB ? int64_t(shapeB[ndimB - i]) : 1;
+						res[ndim - i] = extentA == 1 ? extentB : extentA;
+					}
+					res[ndim - 2] = shapeA[ndimA - 2 + int(m_transA)];
+					res[ndim - 1] = shapeB[ndimB - 1 - int(m_transB)];
+					return res;
+				}
 				case MatmulClass::OUTER: {
-					LIBRAPID_NOT_IMPLEMENTED;
-					return {1};
+					return {shapeA[0], shapeB[0]};
 				}
 			}
 
@@ -397,6 +519,53 @@ namespace librapid {
 			return m_b;
 		}
 
+		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
+				 typename StorageTypeB, typename Alpha, typename Beta>
+		template<typename BiasShapeType, typename BiasStorageType, typename Activation>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::
+		  withEpilogue(const array::ArrayContainer<BiasShapeType, BiasStorageType> &bias,
+					   GemmBias biasMode, Activation activation) const -> ArrayMultiply {
+			static_assert(std::is_same_v<Backend, backend::CPU>,
+						  "Fused epilogues are only supported on the CPU");
+
+			const int64_t ndim	   = m_shape.ndim();
+			const int64_t rows	   = ndim >= 2 ? int64_t(m_shape[ndim - 2]) : int64_t(m_shape[0]);
+			const int64_t cols	   = ndim >= 2 ? int64_t(m_shape[ndim - 1]) : 1;
+			const int64_t biasSize = biasMode == GemmBias::ROW ? rows : cols;
+
+			std::vector<Scalar> biasValues;
+			if (biasMode != GemmBias::NONE) {
+				LIBRAPID_ASSERT(bias.ndim() == 1 && int64_t(bias.shape()[0]) == biasSize,
+								"Bias must have one value per {} of the result. Expected: {} -- "
+								"Got: {}",
+								biasMode == GemmBias::ROW ? "row" : "column",
+								biasSize,
+								bias.shape());
+
+				biasValues.resize(biasSize);
+				for (int64_t i = 0; i < biasSize; ++i) {
+					biasValues[i] = static_cast<Scalar>(bias.storage()[i]);
+				}
+			}
+
+			ArrayMultiply result(*this);
+			result.m_epilogue = makeGemmEpilogue(std::move(biasValues), biasMode, activation);
+			return result;
+		}
+
+		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
+				 typename StorageTypeB, typename Alpha, typename Beta>
+		template<typename Activation>
+		auto ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, Alpha, Beta>::
+		  withEpilogue(Activation activation) const -> ArrayMultiply {
+			static_assert(std::is_same_v<Backend, backend::CPU>,
+						  "Fused epilogues are only supported on the CPU");
+
+			ArrayMultiply result(*this);
+			result.m_epilogue = makeGemmEpilogue(std::vector<Scalar>(), GemmBias::NONE, activation);
+			return result;
+		}
+
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
 				 typename StorageTypeB, typename Alpha, typename Beta>
 		template<typename StorageType>
@@ -410,17 +579,29 @@ namespace librapid {
 							out.shape());
 			MatmulClass matmulClass = this->matmulClass();
 
-			auto a = detail::arrayPointerExtractor(m_a.storage().data());
-			auto b = detail::arrayPointerExtractor(m_b.storage().data());
-			auto c = detail::arrayPointerExtractor(out.storage().data());
+			auto a = ::librapid::detail::arrayPointerExtractor(m_a.storage().data());
+			auto b = ::librapid::detail::arrayPointerExtractor(m_b.storage().data());
+			auto c = ::librapid::detail::arrayPointerExtractor(out.storage().data());
 
 			switch (matmulClass) {
 				case MatmulClass::DOT: {
-					LIBRAPID_NOT_IMPLEMENTED;
+					if constexpr (std::is_same_v<Backend, backend::CPU>) {
+						auto n = int64_t(m_a.shape()[0]);
+
+						Scalar result = static_cast<Scalar>(m_alpha) *
+										static_cast<Scalar>(dot(n, a, int64_t(1), b, int64_t(1)));
+						if (m_beta != ScalarB(0)) result += static_cast<Scalar>(m_beta) * c[0];
+						c[0] = result;
+					} else {
+						LIBRAPID_NOT_IMPLEMENTED;
+					}
+
+					break;
 				}
 				case MatmulClass::GEMV: {
-					auto m = int64_t(m_a.shape()[m_transA]);
-					auto n = int64_t(m_a.shape()[1 - m_transA]);
+					// GEMV takes the dimensions of A itself, not of OP(A)
+					auto m = int64_t(m_a.shape()[0]);
+					auto n = int64_t(m_a.shape()[1]);
 
 					auto lda  = int64_t(m_a.shape()[1]);
 					auto incB = int64_t(1);
@@ -450,20 +631,132 @@ namespace librapid {
 					auto ldb = int64_t(m_b.shape()[1]);
 					auto ldc = int64_t(out.shape()[1]);
 
-					gemm(m_transA,
-						 m_transB,
-						 m,
-						 n,
-						 k,
-						 static_cast<Scalar>(m_alpha),
-						 a,
-						 lda,
-						 b,
-						 ldb,
-						 static_cast<Scalar>(m_beta),
-						 c,
-						 ldc,
-						 Backend());
+					if constexpr (std::is_same_v<Backend, backend::CPU>) {
+						// The epilogue is applied to each block of C as it is computed
+						gemm(m_transA,
+							 m_transB,
+							 m,
+							 n,
+							 k,
+							 static_cast<Scalar>(m_alpha),
+							 a,
+							 lda,
+							 b,
+							 ldb,
+							 static_cast<Scalar>(m_beta),
+							 c,
+							 ldc,
+							 m_epilogue,
+							 Backend());
+						return;
+					} else {
+						gemm(m_transA,
+							 m_transB,
+							 m,
+							 n,
+							 k,
+							 static_cast<Scalar>(m_alpha),
+							 a,
+							 lda,
+							 b,
+							 ldb,
+							 static_cast<Scalar>(m_beta),
+							 c,
+							 ldc,
+							 Backend());
+					}
+
+					break;
+				}
+				case MatmulClass::OUTER: {
+					if constexpr (std::is_same_v<Backend, backend::CPU>) {
+						auto m = int64_t(m_a.shape()[0]);
+						auto n = int64_t(m_b.shape()[0]);
+
+						detail::gerNative(m,
+										  n,
+										  static_cast<Scalar>(m_alpha),
+										  a,
+										  int64_t(1),
+										  b,
+										  int64_t(1),
+										  static_cast<Scalar>(m_beta),
+										  c,
+										  n);
+					} else {
+						LIBRAPID_NOT_IMPLEMENTED;
+					}
+
+					break;
+				}
+				case MatmulClass::GEMM_BATCHED: {
+					if constexpr (std::is_same_v<Backend, backend::OpenCL>) {
+						// OpenCL buffers cannot be offset to address each matrix in the batch
+						LIBRAPID_NOT_IMPLEMENTED;
+					} else {
+						const auto &shapeA	= m_a.shape();
+						const auto &shapeB	= m_b.shape();
+						const int64_t ndimA = shapeA.ndim();
+						const int64_t ndimB = shapeB.ndim();
+
+						auto m = int64_t(shapeA[ndimA - 2 + m_transA]);
+						auto n = int64_t(shapeB[ndimB - 1 - m_transB]);
+						auto k = int64_t(shapeA[ndimA - 1 - m_transA]);
+
+						auto lda = int64_t(shapeA[ndimA - 1]);
+						auto ldb = int64_t(shapeB[ndimB - 1]);
+						auto ldc = n;
+
+						using ::librapid::detail::batchedMatrixOffsets;
+						const auto offsetsA	  = batchedMatrixOffsets(shapeA, m_shape);
+						const auto offsetsB	  = batchedMatrixOffsets(shapeB, m_shape);
+						const int64_t batches = offsetsA.size();
+
+						std::vector<decltype(a)> batchA(batches);
+						std::vector<decltype(b)> batchB(batches);
+						std::vector<decltype(c)> batchC(batches);
+						for (int64_t i = 0; i < batches; ++i) {
+							batchA[i] = a + offsetsA[i];
+							batchB[i] = b + offsetsB[i];
+							batchC[i] = c + i * m * n;
+						}
+
+						if constexpr (std::is_same_v<Backend, backend::CPU>) {
+							gemmBatched(m_transA,
+										m_transB,
+										m,
+										n,
+										k,
+										static_cast<Scalar>(m_alpha),
+										batchA.data(),
+										lda,
+										batchB.data(),
+										ldb,
+										static_cast<Scalar>(m_beta),
+										batchC.data(),
+										ldc,
+										batches,
+										m_epilogue,
+										Backend());
+							return;
+						} else {
+							gemmBatched(m_transA,
+										m_transB,
+										m,
+										n,
+										k,
+										static_cast<Scalar>(m_alpha),
+										batchA.data(),
+										lda,
+										batchB.data(),
+										ldb,
+										static_cast<Scalar>(m_beta),
+										batchC.data(),
+										ldc,
+										batches,
+										Backend());
+						}
+					}
 
 					break;
 				}
@@ -471,6 +764,15 @@ namespace librapid {
 					LIBRAPID_NOT_IMPLEMENTED;
 				}
 			}
+
+			// Vector and outer products are not computed in blocks, so any epilogue is applied in a
+			// separate pass over the result
+			if constexpr (std::is_same_v<Backend, backend::CPU>) {
+				const int64_t ndim = m_shape.ndim();
+				const int64_t rows = ndim >= 2 ? int64_t(m_shape[ndim - 2]) : int64_t(m_shape[0]);
+				const int64_t cols = ndim >= 2 ? int64_t(m_shape[ndim - 1]) : 1;
+				detail::gemmApplyEpilogue(m_epilogue, rows, cols, c, cols);
+			}
 		}
 
 		template<typename ShapeTypeA, typename StorageTypeA, typename ShapeTypeB,
@@ -611,6 +913,40 @@ namespace librapid {
 				return std::make_tuple(false, Scalar(1), std::forward<T>(val));
 			}
 		}
+
+		/// Build the ``ArrayMultiply`` object for ``dot`` and ``outer``, extracting any
+		/// transposes and scalar factors from the inputs
+		/// \tparam First The type of the left input
+		/// \tparam Second The type of the right input
+		/// \param a The left input
+		/// \param b The right input
+		/// \param outer If true, two vectors form an outer product
+		/// \return The ``ArrayMultiply`` object
+		template<typename First, typename Second>
+		auto makeArrayMultiply(First &&a, Second &&b, bool outer) {
+			using ScalarA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
+			using ScalarB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
+			using BackendA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Backend;
+			using BackendB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
+			using ArrayA	   = Array<ScalarA, BackendA>;
+			using ArrayB	   = Array<ScalarB, BackendB>;
+			using ShapeTypeA   = typename typetraits::TypeInfo<std::decay_t<First>>::ShapeType;
+			using ShapeTypeB   = typename typetraits::TypeInfo<std::decay_t<Second>>::ShapeType;
+			using StorageTypeA = typename typetraits::TypeInfo<std::decay_t<First>>::StorageType;
+			using StorageTypeB = typename typetraits::TypeInfo<std::decay_t<Second>>::StorageType;
+
+			auto [transA, alpha, arrA] = dotHelper(std::forward<First>(a));
+			auto [transB, beta, arrB]  = dotHelper(std::forward<Second>(b));
+			return linalg::
+			  ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, ScalarA, ScalarB>(
+				transA,
+				transB,
+				std::forward<ArrayA>(arrA),
+				alpha * beta,
+				std::forward<ArrayB>(arrB),
+				ScalarA(0),
+				outer);
+		}
 	} // namespace detail
 
 	/// \brief Computes the dot product of two arrays.
@@ -626,6 +962,9 @@ namespace librapid {
 	/// this function computes the matrix-vector product \f$ y_i = \sum_{j=1}^{n} a_{ij} x_j \f$
 	/// for \f$ i = 1, \ldots, m \f$.
 	///
+	/// As in NumPy, transposing a 1-dimensional vector has no effect, so the product of two
+	/// vectors is always a dot product. Use ``outer`` for the outer product.
+	///
 	/// If both inputs are 2-dimensional matrices, this function computes the matrix-matrix product
 	/// \f$ c_{ij} = \sum_{k=1}^{n} a_{ik} b_{kj} \f$ for \f$ i = 1, \ldots, m \f$ and \f$ j = 1,
 	/// \ldots, p \f$. \tparam StorageTypeA The storage type of the left input array. \tparam
@@ -635,27 +974,24 @@ namespace librapid {
 	template<typename First, typename Second>
 		requires(IsArrayType<First>::value && IsArrayType<Second>::value)
 	auto dot(First &&a, Second &&b) {
-		using ScalarA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
-		using ScalarB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
-		using BackendA	   = typename typetraits::TypeInfo<std::decay_t<First>>::Backend;
-		using BackendB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
-		using ArrayA	   = Array<ScalarA, BackendA>;
-		using ArrayB	   = Array<ScalarB, BackendB>;
-		using ShapeTypeA   = typename typetraits::TypeInfo<std::decay_t<First>>::ShapeType;
-		using ShapeTypeB   = typename typetraits::TypeInfo<std::decay_t<Second>>::ShapeType;
-		using StorageTypeA = typename typetraits::TypeInfo<std::decay_t<First>>::StorageType;
-		using StorageTypeB = typename typetraits::TypeInfo<std::decay_t<Second>>::StorageType;
-
-		auto [transA, alpha, arrA] = detail::dotHelper(std::forward<First>(a));
-		auto [transB, beta, arrB]  = detail::dotHelper(std::forward<Second>(b));
-		return linalg::
-		  ArrayMultiply<ShapeTypeA, StorageTypeA, ShapeTypeB, StorageTypeB, ScalarA, ScalarB>(
-			transA,
-			transB,
-			std::forward<ArrayA>(arrA),
-			alpha * beta,
-			std::forward<ArrayB>(arrB),
-			ScalarA(0));
+		return detail::makeArrayMultiply(std::forward<First>(a), std::forward<Second>(b), false);
+	}
+
+	/// \brief Computes the outer product of two vectors.
+	///
+	/// For vectors \f$ \mathbf{a} \f$ of length \f$ m \f$ and \f$ \mathbf{b} \f$ of length
+	/// \f$ n \f$, this returns the \f$ m \times n \f$ matrix \f$ c_{ij} = a_i b_j \f$.
+	/// \param a The left input vector.
+	/// \param b The right input vector.
+	/// \return The outer product of the two input vectors.
+	template<typename First, typename Second>
+		requires(IsArrayType<First>::value && IsArrayType<Second>::value)
+	auto outer(First &&a, Second &&b) {
+		LIBRAPID_ASSERT(a.ndim() == 1 && b.ndim() == 1,
+						"Outer product requires two vectors. Got: {} and {}",
+						a.shape(),
+						b.shape());
+		return detail::makeArrayMultiply(std::forward<First>(a), std::forward<Second>(b), true);
 	}
 
 	namespace typetraits {
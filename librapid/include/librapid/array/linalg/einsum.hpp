@@ -0,0 +1,711 @@
+#ifndef LIBRAPID_ARRAY_LINALG_EINSUM_HPP
+#define LIBRAPID_ARRAY_LINALG_EINSUM_HPP
+
+namespace librapid::linalg {
+    /// The order in which ``einsum`` contracts its operands. Operands are numbered from zero in
+    /// the order they are passed, and the result of step ``i`` is numbered
+    /// ``numOperands + i``. Each step contracts two operands or intermediate results which have
+    /// not been used by an earlier step.
+    struct EinsumPath {
+        /// The pair of operands contracted at each step
+        std::vector<std::pair<int64_t, int64_t>> steps;
+
+        /// The number of multiply-adds required to evaluate the path
+        double flops = 0;
+
+        /// The number of elements in the largest intermediate result
+        double largestIntermediate = 0;
+    };
+
+    /// Strategies for finding an ``EinsumPath``
+    enum class EinsumStrategy {
+        Auto,    ///< Optimal for a few operands, greedy otherwise
+        Greedy,  ///< Repeatedly contract the cheapest pair of operands
+        Optimal, ///< Search every contraction order
+    };
+
+    namespace detail {
+        /// Number of distinct labels which may appear in ``einsum`` subscripts (A-Z and a-z)
+        constexpr int64_t einsumMaxLabels = 52;
+
+        /// Largest number of operands for which ``EinsumStrategy::Auto`` searches every
+        /// contraction order
+        constexpr int64_t einsumOptimalMaxOperands = 8;
+
+        /// Largest number of operands ``EinsumStrategy::Optimal`` will accept
+        constexpr int64_t einsumOptimalLimit = 16;
+
+        using EinsumExtents = std::array<int64_t, einsumMaxLabels>;
+
+        /// An ``einsum`` problem, with each label stored as an index in
+        /// ``[0, einsumMaxLabels)``, ordered as in ASCII
+        struct EinsumProblem {
+            /// The labels of each operand, as written
+            std::vector<std::vector<int64_t>> inputs;
+
+            /// The labels of the result
+            std::vector<int64_t> output;
+
+            /// The extent of each label
+            EinsumExtents extents;
+
+            /// The labels of each operand which remain after diagonals have been taken and
+            /// labels used nowhere else have been summed over
+            std::vector<uint64_t> masks;
+
+            /// The labels of the result
+            uint64_t outputMask = 0;
+        };
+
+        /// Map an ``einsum`` label to its index
+        inline int64_t einsumLabel(char c) {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            LIBRAPID_ASSERT(c >= 'a' && c <= 'z', "Invalid einsum label '{}'", c);
+            return c - 'a' + 26;
+        }
+
+        /// The set of labels in \p labels, as a bit mask
+        inline uint64_t einsumMask(const std::vector<int64_t> &labels) {
+            uint64_t res = 0;
+            for (int64_t label : labels) res |= uint64_t(1) << label;
+            return res;
+        }
+
+        /// The number of elements spanned by the labels in \p mask
+        inline double einsumSpan(uint64_t mask, const EinsumExtents &extents) {
+            double res = 1;
+            for (int64_t label = 0; label < einsumMaxLabels; ++label) {
+                if ((mask >> label) & 1) res *= static_cast<double>(extents[label]);
+            }
+            return res;
+        }
+
+        /// The number of elements spanned by \p labels
+        inline int64_t einsumSize(const std::vector<int64_t> &labels,
+                                  const EinsumExtents &extents) {
+            int64_t res = 1;
+            for (int64_t label : labels) res *= extents[label];
+            return res;
+        }
+
+        /// Concatenate lists of labels
+        inline std::vector<int64_t> einsumConcat(const std::vector<int64_t> &a,
+                                                 const std::vector<int64_t> &b,
+                                                 const std::vector<int64_t> &c) {
+            std::vector<int64_t> res(a);
+            res.insert(res.end(), b.begin(), b.end());
+            res.insert(res.end(), c.begin(), c.end());
+            return res;
+        }
+
+        /// Parse ``einsum`` subscripts such as ``"bij,bjk->bik"`` and check them against the
+        /// shapes of the operands. If the output is not given, it contains every label which
+        /// appears exactly once, in alphabetical order (upper case first).
+        /// \param subscripts The subscripts
+        /// \param shapes The shape of each operand
+        /// \return The parsed problem
+        inline EinsumProblem einsumProblem(const std::string &subscripts,
+                                           const std::vector<std::vector<int64_t>> &shapes) {
+            EinsumProblem res;
+            const size_t arrow = subscripts.find("->");
+
+            res.inputs.emplace_back();
+            for (char c : subscripts.substr(0, arrow)) {
+                if (c == ' ') continue;
+                if (c == ',') {
+                    res.inputs.emplace_back();
+                } else {
+                    res.inputs.back().push_back(einsumLabel(c));
+                }
+            }
+
+            const int64_t numOperands = static_cast<int64_t>(shapes.size());
+            LIBRAPID_ASSERT(static_cast<int64_t>(res.inputs.size()) == numOperands,
+                            "Einsum subscripts \"{}\" describe {} operands, but {} were given",
+                            subscripts,
+                            res.inputs.size(),
+                            numOperands);
+
+            res.extents.fill(-1);
+            std::array<int64_t, einsumMaxLabels> counts {};
+            for (int64_t i = 0; i < numOperands; ++i) {
+                const auto &labels = res.inputs[i];
+                LIBRAPID_ASSERT(labels.size() == shapes[i].size(),
+                                "Operand {} has {} dimensions, but its subscripts have {} labels",
+                                i,
+                                shapes[i].size(),
+                                labels.size());
+
+                for (size_t d = 0; d < labels.size(); ++d) {
+                    int64_t &extent = res.extents[labels[d]];
+                    LIBRAPID_ASSERT(extent < 0 || extent == shapes[i][d],
+                                    "Dimension {} of operand {} has extent {}, but its label "
+                                    "has extent {} elsewhere",
+                                    d,
+                                    i,
+                                    shapes[i][d],
+                                    extent);
+                    extent = shapes[i][d];
+                    ++counts[labels[d]];
+                }
+            }
+
+            if (arrow == std::string::npos) {
+                for (int64_t label = 0; label < einsumMaxLabels; ++label) {
+                    if (counts[label] == 1) res.output.push_back(label);
+                }
+            } else {
+                for (char c : subscripts.substr(arrow + 2)) {
+                    if (c == ' ') continue;
+                    const int64_t label = einsumLabel(c);
+                    LIBRAPID_ASSERT(counts[label] > 0,
+                                    "Einsum output label '{}' does not appear in any operand",
+                                    c);
+                    LIBRAPID_ASSERT(((res.outputMask >> label) & 1) == 0,
+                                    "Einsum output label '{}' appears more than once",
+                                    c);
+                    res.output.push_back(label);
+                    res.outputMask |= uint64_t(1) << label;
+                }
+            }
+            res.outputMask = einsumMask(res.output);
+            LIBRAPID_ASSERT(static_cast<int64_t>(res.output.size()) <= LIBRAPID_MAX_ARRAY_DIMS,
+                            "Einsum output has too many dimensions");
+
+            // Labels which appear in only one operand, and not in the output, are summed over
+            // before any contractions
+            for (int64_t i = 0; i < numOperands; ++i) {
+                uint64_t others = res.outputMask;
+                for (int64_t j = 0; j < numOperands; ++j) {
+                    if (j != i) others |= einsumMask(res.inputs[j]);
+                }
+                res.masks.push_back(einsumMask(res.inputs[i]) & others);
+            }
+
+            return res;
+        }
+
+        /// Find a contraction path by repeatedly contracting the pair of operands which needs
+        /// the fewest multiply-adds, breaking ties by the size of the result
+        /// \param masks The labels of each operand
+        /// \param outputMask The labels of the result
+        /// \param extents The extent of each label
+        /// \return The contraction path
+        inline EinsumPath einsumPathGreedy(const std::vector<uint64_t> &masks, uint64_t outputMask,
+                                           const EinsumExtents &extents) {
+            EinsumPath path;
+            std::vector<uint64_t> nodes(masks);
+            std::vector<int64_t> live(masks.size());
+            std::iota(live.begin(), live.end(), int64_t(0));
+
+            while (live.size() > 1) {
+                double bestFlops = std::numeric_limits<double>::infinity();
+                double bestSize  = std::numeric_limits<double>::infinity();
+                size_t bestI = 0, bestJ = 1;
+                uint64_t bestMask = 0;
+
+                for (size_t i = 0; i < live.size(); ++i) {
+                    for (size_t j = i + 1; j < live.size(); ++j) {
+                        uint64_t others = outputMask;
+                        for (size_t o = 0; o < live.size(); ++o) {
+                            if (o != i && o != j) others |= nodes[live[o]];
+                        }
+
+                        const uint64_t all = nodes[live[i]] | nodes[live[j]];
+                        const double flops = einsumSpan(all, extents);
+                        const double size  = einsumSpan(all & others, extents);
+                        if (flops < bestFlops || (flops == bestFlops && size < bestSize)) {
+                            bestFlops = flops;
+                            bestSize  = size;
+                            bestI     = i;
+                            bestJ     = j;
+                            bestMask  = all & others;
+                        }
+                    }
+                }
+
+                path.steps.emplace_back(live[bestI], live[bestJ]);
+                path.flops += bestFlops;
+                path.largestIntermediate = std::max(path.largestIntermediate, bestSize);
+
+                nodes.push_back(bestMask);
+                live.erase(live.begin() + static_cast<std::ptrdiff_t>(bestJ));
+                live.erase(live.begin() + static_cast<std::ptrdiff_t>(bestI));
+                live.push_back(static_cast<int64_t>(nodes.size()) - 1);
+            }
+
+            return path;
+        }
+
+        /// Find the contraction path which needs the fewest multiply-adds, breaking ties by the
+        /// size of the largest intermediate result. Every way of splitting every subset of the
+        /// operands is considered, so this takes \f$ O(3^n) \f$ time for \f$ n \f$ operands.
+        /// \param masks The labels of each operand
+        /// \param outputMask The labels of the result
+        /// \param extents The extent of each label
+        /// \return The contraction path
+        inline EinsumPath einsumPathOptimal(const std::vector<uint64_t> &masks,
+                                            uint64_t outputMask, const EinsumExtents &extents) {
+            const int64_t n = static_cast<int64_t>(masks.size());
+            LIBRAPID_ASSERT(n <= einsumOptimalLimit,
+                            "Cannot search every contraction order for {} operands",
+                            n);
+
+            // For each subset of the operands, the labels it spans, the labels which remain
+            // after contracting it, and the cheapest way to split it in two
+            const uint64_t full = (uint64_t(1) << n) - 1;
+            std::vector<uint64_t> inside(full + 1, 0);
+            std::vector<uint64_t> kept(full + 1, 0);
+            std::vector<double> flops(full + 1, 0);
+            std::vector<double> peak(full + 1, 0);
+            std::vector<uint64_t> split(full + 1, 0);
+
+            for (int64_t i = 0; i < n; ++i) inside[uint64_t(1) << i] = masks[i];
+            for (uint64_t set = 1; set <= full; ++set) {
+                inside[set] = inside[set & (set - 1)] | inside[set & (~set + 1)];
+            }
+            for (uint64_t set = 1; set <= full; ++set) {
+                kept[set] = inside[set] & (inside[full & ~set] | outputMask);
+            }
+
+            for (uint64_t set = 1; set <= full; ++set) {
+                if (std::popcount(set) < 2) continue;
+
+                const double size = einsumSpan(kept[set], extents);
+                flops[set]        = std::numeric_limits<double>::infinity();
+                peak[set]         = std::numeric_limits<double>::infinity();
+
+                // Each split is visited twice, so only consider the half containing the lowest
+                // operand in the set
+                const uint64_t lowest = set & (~set + 1);
+                for (uint64_t lhs = (set - 1) & set; lhs > 0; lhs = (lhs - 1) & set) {
+                    if ((lhs & lowest) == 0) continue;
+
+                    const uint64_t rhs = set ^ lhs;
+                    const double cost  = flops[lhs] + flops[rhs] +
+                                        einsumSpan(kept[lhs] | kept[rhs], extents);
+                    const double largest = std::max({peak[lhs], peak[rhs], size});
+                    if (cost < flops[set] || (cost == flops[set] && largest < peak[set])) {
+                        flops[set] = cost;
+                        peak[set]  = largest;
+                        split[set] = lhs;
+                    }
+                }
+            }
+
+            EinsumPath path;
+            path.flops               = flops[full];
+            path.largestIntermediate = peak[full];
+
+            // Emit the steps of each subset after those of its halves
+            std::function<int64_t(uint64_t)> emit = [&](uint64_t set) -> int64_t {
+                if (std::popcount(set) == 1) return std::countr_zero(set);
+                const int64_t lhs = emit(split[set]);
+                const int64_t rhs = emit(set ^ split[set]);
+                path.steps.emplace_back(lhs, rhs);
+                return n + static_cast<int64_t>(path.steps.size()) - 1;
+            };
+            if (n > 1) emit(full);
+
+            return path;
+        }
+
+        /// Find a contraction path for \p problem using the given \p strategy
+        inline EinsumPath einsumPath(const EinsumProblem &problem, EinsumStrategy strategy) {
+            const int64_t n = static_cast<int64_t>(problem.masks.size());
+            if (strategy == EinsumStrategy::Optimal ||
+                (strategy == EinsumStrategy::Auto && n <= einsumOptimalMaxOperands)) {
+                return einsumPathOptimal(problem.masks, problem.outputMask, problem.extents);
+            }
+            return einsumPathGreedy(problem.masks, problem.outputMask, problem.extents);
+        }
+
+        /// An operand or intermediate result of an ``einsum``, stored contiguously with its
+        /// dimensions in the order of \p labels
+        template<typename Scalar>
+        struct EinsumOperand {
+            const Scalar *data = nullptr;
+            std::vector<Scalar> owned;
+            std::vector<int64_t> labels;
+        };
+
+        /// Permute the dimensions of \p in from the order of \p inLabels into the order of
+        /// \p outLabels
+        template<typename Scalar>
+        void einsumPermute(const Scalar *in, const std::vector<int64_t> &inLabels,
+                           const std::vector<int64_t> &outLabels, const EinsumExtents &extents,
+                           Scalar *out) {
+            const int64_t ndim = static_cast<int64_t>(inLabels.size());
+            LIBRAPID_ASSERT(ndim <= LIBRAPID_MAX_ARRAY_DIMS,
+                            "Einsum intermediate has too many dimensions");
+
+            Shape shape = Shape::zeros(ndim);
+            Shape axes  = Shape::zeros(ndim);
+            for (int64_t d = 0; d < ndim; ++d) {
+                shape[d] = static_cast<uint32_t>(extents[inLabels[d]]);
+                axes[d]  = static_cast<uint32_t>(
+                  std::find(inLabels.begin(), inLabels.end(), outLabels[d]) - inLabels.begin());
+            }
+
+            ::librapid::detail::cpu::transposeImpl(out, in, shape, axes, Scalar(1));
+        }
+
+        /// Take the diagonal over any label repeated in \p operand, and sum over any label not
+        /// in \p keep. The remaining labels keep the order in which they first appear.
+        /// \param operand The operand to reduce
+        /// \param keep The labels to keep
+        /// \param extents The extent of each label
+        template<typename Scalar>
+        void einsumReduce(EinsumOperand<Scalar> &operand, uint64_t keep,
+                          const EinsumExtents &extents) {
+            const auto &labels = operand.labels;
+            const int64_t ndim = static_cast<int64_t>(labels.size());
+
+            // A repeated label steps along every dimension it labels at once
+            EinsumExtents strides {};
+            int64_t stride = 1;
+            for (int64_t d = ndim - 1; d >= 0; --d) {
+                strides[labels[d]] += stride;
+                stride *= extents[labels[d]];
+            }
+
+            std::vector<int64_t> kept, summed;
+            uint64_t seen = 0;
+            for (int64_t label : labels) {
+                if ((seen >> label) & 1) continue;
+                seen |= uint64_t(1) << label;
+                ((keep >> label) & 1 ? kept : summed).push_back(label);
+            }
+            if (summed.empty() && static_cast<int64_t>(kept.size()) == ndim) return;
+
+            const int64_t outSize = einsumSize(kept, extents);
+            const int64_t sumSize = einsumSize(summed, extents);
+            std::vector<Scalar> owned(static_cast<size_t>(outSize));
+            const Scalar *in = operand.data;
+            Scalar *out      = owned.data();
+
+            const bool parallel =
+              outSize * sumSize > static_cast<int64_t>(global::multithreadThreshold) &&
+              global::numThreads > 1;
+
+#pragma omp parallel for shared(in, out, kept, summed, strides, extents, outSize, sumSize)         \
+  default(none) if (parallel) num_threads(int(global::numThreads))
+            for (int64_t i = 0; i < outSize; ++i) {
+                int64_t offset = 0;
+                for (int64_t d = static_cast<int64_t>(kept.size()) - 1, index = i; d >= 0; --d) {
+                    const int64_t extent = extents[kept[d]];
+                    offset += (index % extent) * strides[kept[d]];
+                    index /= extent;
+                }
+
+                Scalar sum = 0;
+                for (int64_t j = 0; j < sumSize; ++j) {
+                    int64_t inner = offset;
+                    for (int64_t d = static_cast<int64_t>(summed.size()) - 1, index = j; d >= 0;
+                         --d) {
+                        const int64_t extent = extents[summed[d]];
+                        inner += (index % extent) * strides[summed[d]];
+                        index /= extent;
+                    }
+                    sum += in[inner];
+                }
+                out[i] = sum;
+            }
+
+            operand.owned  = std::move(owned);
+            operand.data   = operand.owned.data();
+            operand.labels = std::move(kept);
+        }
+
+        /// Compute \p batchCount dot products of length \p k between consecutive rows of \p a
+        /// and \p b. This contracts two operands with no free labels, which would otherwise
+        /// take one 1x1 GEMM per batch
+        /// \param a The first operand, with its contracted labels last
+        /// \param b The second operand, with the same layout as \p a
+        /// \param batchCount The number of dot products
+        /// \param k The length of each dot product
+        /// \param out The results
+        template<typename Scalar>
+        void einsumBatchedDot(const Scalar *a, const Scalar *b, int64_t batchCount, int64_t k,
+                              Scalar *out) {
+            if (batchCount == 1) {
+                out[0] = static_cast<Scalar>(dot(k, a, int64_t(1), b, int64_t(1)));
+                return;
+            }
+
+            const bool parallel =
+              batchCount * k > static_cast<int64_t>(global::multithreadThreshold) &&
+              global::numThreads > 1;
+
+            // An element-wise product, as in "ij,ij->ij"
+            if (k == 1) {
+#pragma omp parallel for shared(a, b, out, batchCount) default(none) if (parallel)                 \
+  num_threads(int(global::numThreads))
+                for (int64_t i = 0; i < batchCount; ++i) out[i] = a[i] * b[i];
+                return;
+            }
+
+#pragma omp parallel for shared(a, b, out, batchCount, k) default(none) if (parallel)              \
+  num_threads(int(global::numThreads))
+            for (int64_t i = 0; i < batchCount; ++i) {
+                out[i] = static_cast<Scalar>(dotContiguous(k, a + i * k, b + i * k));
+            }
+        }
+
+        /// Contract two operands with a single (batched) GEMM. Labels shared by both operands
+        /// are batch dimensions if they are in \p keep, and are summed over otherwise. Each
+        /// operand is only transposed if it is not already laid out as a batch of matrices
+        /// with the summed labels along its rows or columns. If neither operand has any free
+        /// labels, the batches are dot products, and are computed by ``einsumBatchedDot``.
+        /// \param a The first operand
+        /// \param b The second operand
+        /// \param keep The labels needed by the result or by later contractions
+        /// \param extents The extent of each label
+        /// \return The result, with labels ordered as (batch, free in \p a, free in \p b)
+        template<typename Scalar>
+        EinsumOperand<Scalar> einsumContract(const EinsumOperand<Scalar> &a,
+                                             const EinsumOperand<Scalar> &b, uint64_t keep,
+                                             const EinsumExtents &extents) {
+            const uint64_t maskA = einsumMask(a.labels);
+            const uint64_t maskB = einsumMask(b.labels);
+
+            std::vector<int64_t> batch, contracted, freeA, freeB;
+            for (int64_t label : a.labels) {
+                if (((maskB >> label) & 1) == 0) {
+                    freeA.push_back(label);
+                } else if ((keep >> label) & 1) {
+                    batch.push_back(label);
+                } else {
+                    contracted.push_back(label);
+                }
+            }
+            for (int64_t label : b.labels) {
+                if (((maskA >> label) & 1) == 0) freeB.push_back(label);
+            }
+
+            const int64_t batchCount = einsumSize(batch, extents);
+            const int64_t m          = einsumSize(freeA, extents);
+            const int64_t n          = einsumSize(freeB, extents);
+            const int64_t k          = einsumSize(contracted, extents);
+
+            EinsumOperand<Scalar> res;
+            res.labels = einsumConcat(batch, freeA, freeB);
+            res.owned.resize(static_cast<size_t>(batchCount * m * n));
+            res.data = res.owned.data();
+            if (res.owned.empty() || k == 0) return res;
+
+            const Scalar *dataA = a.data;
+            const Scalar *dataB = b.data;
+            std::vector<Scalar> bufferA, bufferB;
+            bool transA = false, transB = false;
+
+            const std::vector<int64_t> layoutA = einsumConcat(batch, freeA, contracted);
+            if (a.labels != layoutA) {
+                if (a.labels == einsumConcat(batch, contracted, freeA)) {
+                    transA = true;
+                } else {
+                    bufferA.resize(static_cast<size_t>(batchCount * m * k));
+                    einsumPermute(a.data, a.labels, layoutA, extents, bufferA.data());
+                    dataA = bufferA.data();
+                }
+            }
+
+            const std::vector<int64_t> layoutB = einsumConcat(batch, contracted, freeB);
+            if (b.labels != layoutB) {
+                if (b.labels == einsumConcat(batch, freeB, contracted)) {
+                    transB = true;
+                } else {
+                    bufferB.resize(static_cast<size_t>(batchCount * k * n));
+                    einsumPermute(b.data, b.labels, layoutB, extents, bufferB.data());
+                    dataB = bufferB.data();
+                }
+            }
+
+            // Neither operand has any free labels, so the layouts above are the same
+            if (m == 1 && n == 1) {
+                einsumBatchedDot(dataA, dataB, batchCount, k, res.owned.data());
+                return res;
+            }
+
+            const int64_t lda = transA ? m : k;
+            const int64_t ldb = transB ? k : n;
+
+            if (batchCount == 1) {
+                gemm(transA,
+                     transB,
+                     m,
+                     n,
+                     k,
+                     Scalar(1),
+                     dataA,
+                     lda,
+                     dataB,
+                     ldb,
+                     Scalar(0),
+                     res.owned.data(),
+                     n);
+                return res;
+            }
+
+            std::vector<const Scalar *> pointersA(static_cast<size_t>(batchCount));
+            std::vector<const Scalar *> pointersB(static_cast<size_t>(batchCount));
+            std::vector<Scalar *> pointersC(static_cast<size_t>(batchCount));
+            for (int64_t i = 0; i < batchCount; ++i) {
+                pointersA[i] = dataA + i * m * k;
+                pointersB[i] = dataB + i * k * n;
+                pointersC[i] = res.owned.data() + i * m * n;
+            }
+
+            gemmBatched(transA,
+                        transB,
+                        m,
+                        n,
+                        k,
+                        Scalar(1),
+                        pointersA.data(),
+                        lda,
+                        pointersB.data(),
+                        ldb,
+                        Scalar(0),
+                        pointersC.data(),
+                        n,
+                        batchCount);
+            return res;
+        }
+
+        /// Evaluate \p problem along \p path, writing the result to \p out
+        /// \param problem The problem to evaluate
+        /// \param path The contraction path
+        /// \param data The data of each operand
+        /// \param out The result, with its dimensions ordered as in ``problem.output``
+        template<typename Scalar>
+        void einsumEvaluate(const EinsumProblem &problem, const EinsumPath &path,
+                            const std::vector<const Scalar *> &data, Scalar *out) {
+            const int64_t numOperands = static_cast<int64_t>(data.size());
+
+            std::vector<EinsumOperand<Scalar>> nodes(static_cast<size_t>(numOperands));
+            std::vector<uint64_t> masks(problem.masks);
+            for (int64_t i = 0; i < numOperands; ++i) {
+                nodes[i].data   = data[i];
+                nodes[i].labels = problem.inputs[i];
+                einsumReduce(nodes[i], problem.masks[i], problem.extents);
+            }
+
+            std::vector<bool> used(static_cast<size_t>(numOperands), false);
+            for (const auto &[lhs, rhs] : path.steps) {
+                used[lhs] = true;
+                used[rhs] = true;
+
+                uint64_t keep = problem.outputMask;
+                for (size_t i = 0; i < nodes.size(); ++i) {
+                    if (!used[i]) keep |= masks[i];
+                }
+
+                nodes.push_back(einsumContract(nodes[lhs], nodes[rhs], keep, problem.extents));
+                masks.push_back(einsumMask(nodes.back().labels));
+                used.push_back(false);
+
+                // Free the inputs to this step as soon as possible
+                nodes[lhs].owned = std::vector<Scalar>();
+                nodes[rhs].owned = std::vector<Scalar>();
+            }
+
+            const EinsumOperand<Scalar> &result = nodes.back();
+            const int64_t size                  = einsumSize(problem.output, problem.extents);
+            if (result.labels == problem.output) {
+                std::copy(result.data, result.data + size, out);
+            } else {
+                einsumPermute(result.data, result.labels, problem.output, problem.extents, out);
+            }
+        }
+
+        /// Record the data and shape of an ``einsum`` operand, evaluating it first if it is
+        /// not already an array
+        template<typename Scalar, typename T>
+        void einsumCollect(T &&array, std::vector<Array<Scalar, backend::CPU>> &evaluated,
+                           std::vector<const Scalar *> &data,
+                           std::vector<std::vector<int64_t>> &shapes) {
+            using Type = std::decay_t<T>;
+            static_assert(std::is_same_v<typename typetraits::TypeInfo<Type>::Scalar, Scalar>,
+                          "All einsum operands must have the same scalar type");
+            static_assert(
+              std::is_same_v<typename typetraits::TypeInfo<Type>::Backend, backend::CPU>,
+              "Einsum is only supported on the CPU");
+
+            const auto record = [&](const auto &arr) {
+                data.push_back(arr.storage().data());
+                std::vector<int64_t> &shape = shapes.emplace_back();
+                for (int64_t d = 0; d < static_cast<int64_t>(arr.shape().ndim()); ++d) {
+                    shape.push_back(static_cast<int64_t>(arr.shape()[d]));
+                }
+            };
+
+            if constexpr (typetraits::TypeInfo<Type>::type ==
+                          ::librapid::detail::LibRapidType::ArrayContainer) {
+                record(array);
+            } else {
+                record(evaluated.emplace_back(std::forward<T>(array)));
+            }
+        }
+    } // namespace detail
+
+    /// \brief Find the order in which ``einsum`` would contract its operands
+    ///
+    /// Each step of ``einsum`` contracts two operands with a single (batched) matrix
+    /// multiplication, so the order of the steps decides both the work done and the size of
+    /// the intermediate results. For example, in ``"ij,jk,k->i"`` it is far cheaper to
+    /// contract the matrix with the vector first.
+    /// \param subscripts The einsum subscripts
+    /// \param shapes The shape of each operand
+    /// \param strategy How to search for the path
+    /// \return The contraction path
+    inline EinsumPath einsumPath(const std::string &subscripts,
+                                 const std::vector<std::vector<int64_t>> &shapes,
+                                 EinsumStrategy strategy = EinsumStrategy::Auto) {
+        return detail::einsumPath(detail::einsumProblem(subscripts, shapes), strategy);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Einstein summation
+    ///
+    /// Evaluates a tensor contraction written in Einstein notation. Each operand is labelled
+    /// with one letter per dimension, and labels shared between operands are multiplied
+    /// together and summed over unless they appear in the output. For example,
+    /// ``einsum("bij,bjk->bik", a, b)`` is a batched matrix multiplication, ``einsum("ii", a)``
+    /// is the trace of a matrix and ``einsum("ij->ji", a)`` is its transpose. If ``->`` is
+    /// omitted, the output has every label which appears exactly once, in alphabetical order.
+    ///
+    /// Each pair of operands is contracted by transposing them into batches of matrices and
+    /// calling ``linalg::gemmBatched``, in the order given by ``linalg::einsumPath``. Pairs
+    /// with no free labels, such as in ``"ij,ij->ij"``, are multiplied element-wise instead.
+    /// \param subscripts The einsum subscripts
+    /// \param first The first operand
+    /// \param rest The remaining operands
+    /// \return The result of the contraction. A scalar result has shape ``(1)``
+    template<typename First, typename... Rest>
+        requires(IsArrayType<First>::value && (IsArrayType<Rest>::value && ...))
+    auto einsum(const std::string &subscripts, First &&first, Rest &&...rest) {
+        using Scalar = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
+
+        std::vector<Array<Scalar, backend::CPU>> evaluated;
+        std::vector<const Scalar *> data;
+        std::vector<std::vector<int64_t>> shapes;
+        evaluated.reserve(1 + sizeof...(Rest));
+        linalg::detail::einsumCollect(std::forward<First>(first), evaluated, data, shapes);
+        (linalg::detail::einsumCollect(std::forward<Rest>(rest), evaluated, data, shapes), ...);
+
+        const linalg::detail::EinsumProblem problem =
+          linalg::detail::einsumProblem(subscripts, shapes);
+        const linalg::EinsumPath path =
+          linalg::detail::einsumPath(problem, linalg::EinsumStrategy::Auto);
+
+        std::vector<int64_t> dims;
+        for (int64_t label : problem.output) dims.push_back(problem.extents[label]);
+        Array<Scalar, backend::CPU> res(dims.empty() ? Shape({1}) : Shape(dims));
+        linalg::detail::einsumEvaluate(problem, path, data, res.storage().data());
+        return res;
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_EINSUM_HPP
@@ -0,0 +1,379 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FACTORISATION_CHOLESKY_HPP
+#define LIBRAPID_ARRAY_LINALG_FACTORISATION_CHOLESKY_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Columns factorised together in each step of a blocked Cholesky factorisation.
+        /// Matrices no larger than this are factorised and solved without blocking
+        constexpr int64_t choleskyBlockSize = 64;
+
+        /// \brief Unblocked Cholesky factorisation of a small, row-major matrix
+        ///
+        /// Computes the lower triangular \f$ \mathbf{L} \f$ one row at a time, so every inner
+        /// product is between two contiguous rows of \f$ \mathbf{L} \f$. The strictly upper
+        /// triangle of \f$ \mathbf{A} \f$ is not referenced.
+        /// \return Zero on success, or \f$ i + 1 \f$ if the leading minor of order \f$ i + 1 \f$
+        /// is not positive definite
+        template<typename Scalar>
+        int64_t potrfUnblocked(int64_t n, Scalar *a, int64_t lda) {
+            for (int64_t i = 0; i < n; ++i) {
+                Scalar *rowI = a + i * lda;
+
+                for (int64_t j = 0; j < i; ++j) {
+                    const Scalar *rowJ = a + j * lda;
+                    rowI[j]            = (rowI[j] - dotContiguous(j, rowI, rowJ)) / rowJ[j];
+                }
+
+                const Scalar diag = rowI[i] - dotContiguous(i, rowI, rowI);
+                if (!(diag > Scalar(0))) return i + 1;
+                rowI[i] = static_cast<Scalar>(::librapid::sqrt(diag));
+            }
+
+            return 0;
+        }
+
+        /// \brief Solve \f$ \mathbf{L} \mathbf{L}^T \mathbf{X} = \mathbf{B} \f$ for a small,
+        /// row-major \f$ \mathbf{L} \f$ by forward and back substitution
+        ///
+        /// Both passes update whole rows of \f$ \mathbf{B} \f$ at a time, so every access to
+        /// \f$ \mathbf{B} \f$ is contiguous.
+        template<typename Scalar>
+        void potrsUnblocked(int64_t n, int64_t nrhs, const Scalar *l, int64_t ldl, Scalar *b,
+                            int64_t ldb) {
+            // L Y = B
+            for (int64_t i = 0; i < n; ++i) {
+                Scalar *rowI = b + i * ldb;
+                for (int64_t k = 0; k < i; ++k) {
+                    const Scalar factor = l[i * ldl + k];
+                    const Scalar *rowK  = b + k * ldb;
+                    for (int64_t j = 0; j < nrhs; ++j) rowI[j] -= factor * rowK[j];
+                }
+
+                const Scalar diag = l[i * ldl + i];
+                for (int64_t j = 0; j < nrhs; ++j) rowI[j] /= diag;
+            }
+
+            // L^T X = Y
+            for (int64_t i = n - 1; i >= 0; --i) {
+                Scalar *rowI      = b + i * ldb;
+                const Scalar diag = l[i * ldl + i];
+                for (int64_t j = 0; j < nrhs; ++j) rowI[j] /= diag;
+
+                for (int64_t k = 0; k < i; ++k) {
+                    const Scalar factor = l[i * ldl + k];
+                    Scalar *rowK        = b + k * ldb;
+                    for (int64_t j = 0; j < nrhs; ++j) rowK[j] -= factor * rowI[j];
+                }
+            }
+        }
+
+        /// \brief Decide whether a batch of factorisations or solves should be divided between
+        /// threads, rather than computing each one using every thread
+        /// \param n Order of each matrix
+        /// \param batchCount Number of matrices
+        LIBRAPID_NODISCARD inline bool choleskyBatchParallel(int64_t n, int64_t batchCount) {
+            const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+            return numThreads > 1 && batchCount > 1 &&
+                   batchCount * n * n > static_cast<int64_t>(global::multithreadThreshold) &&
+                   (batchCount >= numThreads || n <= choleskyBlockSize);
+        }
+    } // namespace detail
+
+    /// \brief Cholesky factorisation of a symmetric positive definite matrix
+    ///
+    /// Computes the lower triangular \f$ \mathbf{L} \f$ such that
+    /// \f$ \mathbf{A} = \mathbf{L} \mathbf{L}^T \f$, overwriting the lower triangle of the
+    /// \f$ n \times n \f$ row-major matrix \f$ \mathbf{A} \f$. The strictly upper triangle is
+    /// not referenced.
+    ///
+    /// Small matrices are factorised directly. Larger matrices are factorised in blocks of
+    /// ``choleskyBlockSize`` columns: each diagonal block is factorised directly, the block
+    /// column below it is found with ``cxxblas::trsm``, and the trailing matrix is updated with
+    /// ``cxxblas::syrk`` on its diagonal blocks and ``gemm`` below them.
+    /// \tparam Scalar Scalar type
+    /// \param n Order of \f$ \mathbf{A} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param backend Backend to use for computation
+    /// \return Zero on success, or \f$ i + 1 \f$ if the leading minor of order \f$ i + 1 \f$ is
+    /// not positive definite, in which case the factorisation could not be completed
+    template<typename Scalar>
+    int64_t potrf(int64_t n, Scalar *a, int64_t lda, backend::CPU backend = backend::CPU()) {
+        constexpr int64_t nb = detail::choleskyBlockSize;
+        if (n <= nb) return detail::potrfUnblocked(n, a, lda);
+
+        for (int64_t j = 0; j < n; j += nb) {
+            const int64_t jb = std::min(nb, n - j);
+
+            // L11 L11^T = A11
+            const int64_t info = detail::potrfUnblocked(jb, a + j * lda + j, lda);
+            if (info != 0) return info + j;
+            if (j + jb >= n) break;
+
+            // L21 = A21 L11^-T
+            const int64_t rest = n - j - jb;
+            cxxblas::trsm(cxxblas::StorageOrder::RowMajor,
+                          cxxblas::Side::Right,
+                          cxxblas::StorageUpLo::Lower,
+                          cxxblas::Transpose::Trans,
+                          cxxblas::Diag::NonUnit,
+                          rest,
+                          jb,
+                          Scalar(1),
+                          a + j * lda + j,
+                          lda,
+                          a + (j + jb) * lda + j,
+                          lda);
+
+            // A22 = A22 - L21 L21^T, one block column at a time
+            for (int64_t c = j + jb; c < n; c += nb) {
+                const int64_t cb     = std::min(nb, n - c);
+                const Scalar *panelC = a + c * lda + j;
+                const int64_t below  = n - c - cb;
+
+                cxxblas::syrk(cxxblas::StorageOrder::RowMajor,
+                              cxxblas::StorageUpLo::Lower,
+                              cxxblas::Transpose::NoTrans,
+                              cb,
+                              jb,
+                              Scalar(-1),
+                              panelC,
+                              lda,
+                              Scalar(1),
+                              a + c * lda + c,
+                              lda);
+
+                if (below > 0) {
+                    gemm(false,
+                         true,
+                         below,
+                         cb,
+                         jb,
+                         Scalar(-1),
+                         static_cast<const Scalar *>(a + (c + cb) * lda + j),
+                         lda,
+                         panelC,
+                         lda,
+                         Scalar(1),
+                         a + (c + cb) * lda + c,
+                         lda);
+                }
+            }
+        }
+
+        return 0;
+    }
+
+    /// \brief Solve a symmetric positive definite system using a Cholesky factorisation
+    ///
+    /// Solves \f$ \mathbf{L} \mathbf{L}^T \mathbf{X} = \mathbf{B} \f$ in place, where
+    /// \f$ \mathbf{L} \f$ was computed by ``potrf`` and \f$ \mathbf{B} \f$ is a row-major
+    /// \f$ n \times \mathrm{nrhs} \f$ matrix.
+    /// \tparam Scalar Scalar type
+    /// \param n Order of \f$ \mathbf{L} \f$
+    /// \param nrhs Columns of \f$ \mathbf{B} \f$
+    /// \param l Pointer to \f$ \mathbf{L} \f$
+    /// \param ldl Leading dimension of \f$ \mathbf{L} \f$
+    /// \param b Pointer to \f$ \mathbf{B} \f$, which is overwritten by \f$ \mathbf{X} \f$
+    /// \param ldb Leading dimension of \f$ \mathbf{B} \f$
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void potrs(int64_t n, int64_t nrhs, const Scalar *l, int64_t ldl, Scalar *b, int64_t ldb,
+               backend::CPU backend = backend::CPU()) {
+        if (n <= 0 || nrhs <= 0) return;
+
+        if (n <= detail::choleskyBlockSize) {
+            detail::potrsUnblocked(n, nrhs, l, ldl, b, ldb);
+            return;
+        }
+
+        cxxblas::trsm(cxxblas::StorageOrder::RowMajor,
+                      cxxblas::Side::Left,
+                      cxxblas::StorageUpLo::Lower,
+                      cxxblas::Transpose::NoTrans,
+                      cxxblas::Diag::NonUnit,
+                      n,
+                      nrhs,
+                      Scalar(1),
+                      l,
+                      ldl,
+                      b,
+                      ldb);
+        cxxblas::trsm(cxxblas::StorageOrder::RowMajor,
+                      cxxblas::Side::Left,
+                      cxxblas::StorageUpLo::Lower,
+                      cxxblas::Transpose::Trans,
+                      cxxblas::Diag::NonUnit,
+                      n,
+                      nrhs,
+                      Scalar(1),
+                      l,
+                      ldl,
+                      b,
+                      ldb);
+    }
+
+    /// \brief Batched Cholesky factorisation
+    ///
+    /// Factorises each \f$ \mathbf{A}_i \f$ as described for ``potrf``. When there are enough
+    /// matrices to occupy every thread, or the matrices are small, the factorisations are
+    /// divided between threads and each one is computed serially. This is the fast path for
+    /// large numbers of small systems.
+    /// \tparam Scalar Scalar type
+    /// \param n Order of each \f$ \mathbf{A}_i \f$
+    /// \param a Array of pointers to each \f$ \mathbf{A}_i \f$
+    /// \param lda Leading dimension of each \f$ \mathbf{A}_i \f$
+    /// \param batchCount Number of matrices
+    /// \param info Pointer to ``batchCount`` results, each as returned by ``potrf``
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void potrfBatched(int64_t n, Scalar *const *a, int64_t lda, int64_t batchCount,
+                      int64_t *info, backend::CPU backend = backend::CPU()) {
+        const bool parallel = detail::choleskyBatchParallel(n, batchCount);
+
+#pragma omp parallel for shared(n, a, lda, batchCount, info, backend) default(none)                \
+  if (parallel) num_threads(int(global::numThreads)) schedule(static)
+        for (int64_t i = 0; i < batchCount; ++i) info[i] = potrf(n, a[i], lda, backend);
+    }
+
+    /// \brief Batched Cholesky solve
+    ///
+    /// Solves \f$ \mathbf{L}_i \mathbf{L}_i^T \mathbf{X}_i = \mathbf{B}_i \f$ for each
+    /// \f$ i \f$, dividing the batch between threads in the same way as ``potrfBatched``.
+    /// \tparam Scalar Scalar type
+    /// \param n Order of each \f$ \mathbf{L}_i \f$
+    /// \param nrhs Columns of each \f$ \mathbf{B}_i \f$
+    /// \param l Array of pointers to each \f$ \mathbf{L}_i \f$
+    /// \param ldl Leading dimension of each \f$ \mathbf{L}_i \f$
+    /// \param b Array of pointers to each \f$ \mathbf{B}_i \f$
+    /// \param ldb Leading dimension of each \f$ \mathbf{B}_i \f$
+    /// \param batchCount Number of systems
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void potrsBatched(int64_t n, int64_t nrhs, const Scalar *const *l, int64_t ldl,
+                      Scalar *const *b, int64_t ldb, int64_t batchCount,
+                      backend::CPU backend = backend::CPU()) {
+        const bool parallel = detail::choleskyBatchParallel(n, batchCount);
+
+#pragma omp parallel for shared(n, nrhs, l, ldl, b, ldb, batchCount, backend) default(none)        \
+  if (parallel) num_threads(int(global::numThreads)) schedule(static)
+        for (int64_t i = 0; i < batchCount; ++i) potrs(n, nrhs, l[i], ldl, b[i], ldb, backend);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Cholesky factorisation of a symmetric positive definite matrix
+    ///
+    /// Returns the lower triangular \f$ \mathbf{L} \f$ such that
+    /// \f$ \mathbf{A} = \mathbf{L} \mathbf{L}^T \f$. Only the lower triangle of \p a is read.
+    /// If \p a has more than two dimensions, it is treated as a stack of matrices, which are
+    /// factorised in parallel (see ``linalg::potrfBatched``).
+    /// \param a The matrix, or stack of matrices, to factorise.
+    /// \return \f$ \mathbf{L} \f$, with the same shape as \p a.
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto cholesky(T &&a) {
+        using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+        using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+        static_assert(std::is_same_v<Backend, backend::CPU>,
+                      "Cholesky factorisations are only supported on the CPU");
+
+        Array<Scalar, Backend> result(std::forward<T>(a));
+        const int64_t ndim = result.ndim();
+        LIBRAPID_ASSERT(ndim >= 2 && result.shape()[ndim - 1] == result.shape()[ndim - 2],
+                        "Input must be a square matrix or a stack of square matrices. Got: {}",
+                        result.shape());
+
+        const int64_t n          = result.shape()[ndim - 1];
+        const int64_t batchCount = n == 0 ? 0 : int64_t(result.shape().size()) / (n * n);
+
+        Scalar *data = result.storage().data();
+        std::vector<Scalar *> matrices(batchCount);
+        for (int64_t i = 0; i < batchCount; ++i) matrices[i] = data + i * n * n;
+
+        std::vector<int64_t> info(batchCount);
+        linalg::potrfBatched(n, matrices.data(), n, batchCount, info.data());
+
+        for (int64_t i = 0; i < batchCount; ++i) {
+            LIBRAPID_ASSERT(info[i] == 0,
+                            "Matrix {} is not positive definite. Leading minor {} failed",
+                            i,
+                            info[i]);
+        }
+
+        // Clear the strictly upper triangle, which was not referenced
+        for (int64_t i = 0; i < batchCount * n; ++i) {
+            const int64_t row = i % n;
+            std::fill(data + i * n + row + 1, data + (i + 1) * n, Scalar(0));
+        }
+
+        return result;
+    }
+
+    /// \brief Solve a symmetric positive definite system from its Cholesky factorisation
+    ///
+    /// Returns \f$ \mathbf{X} \f$ such that \f$ \mathbf{L} \mathbf{L}^T \mathbf{X} =
+    /// \mathbf{B} \f$, where \p l was returned by ``cholesky``. Factorising once and solving
+    /// many times avoids repeating the factorisation.
+    ///
+    /// If \p l is a stack of matrices, \p b must be a matching stack of vectors (with one fewer
+    /// dimension than \p l) or matrices (with the same number of dimensions), and the systems
+    /// are solved in parallel (see ``linalg::potrsBatched``).
+    /// \param l The Cholesky factor, or stack of factors.
+    /// \param b The right-hand side, or stack of right-hand sides.
+    /// \return The solution, with the same shape as \p b.
+    template<typename First, typename Second>
+        requires(IsArrayType<First>::value && IsArrayType<Second>::value)
+    auto choleskySolve(First &&l, Second &&b) {
+        using ScalarL  = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
+        using ScalarB  = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
+        using BackendL = typename typetraits::TypeInfo<std::decay_t<First>>::Backend;
+        using BackendB = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
+        static_assert(std::is_same_v<BackendL, backend::CPU> &&
+                        std::is_same_v<BackendB, backend::CPU>,
+                      "Cholesky solves are only supported on the CPU");
+        static_assert(std::is_same_v<ScalarL, ScalarB>, "Scalar types of L and B must match");
+
+        const Array<ScalarL, BackendL> factor(std::forward<First>(l));
+        Array<ScalarB, BackendB> x(std::forward<Second>(b));
+
+        const int64_t ndim = factor.ndim();
+        LIBRAPID_ASSERT(ndim >= 2 && factor.shape()[ndim - 1] == factor.shape()[ndim - 2],
+                        "Factor must be a square matrix or a stack of square matrices. Got: {}",
+                        factor.shape());
+
+        const int64_t n       = factor.shape()[ndim - 1];
+        const int64_t ndimB   = x.ndim();
+        const bool vectors    = ndimB == ndim - 1;
+        const int64_t rowsDim = vectors ? ndimB - 1 : ndimB - 2;
+
+        LIBRAPID_ASSERT((vectors || ndimB == ndim) && rowsDim >= 0 &&
+                          int64_t(x.shape()[rowsDim]) == n,
+                        "Right-hand side must have {} rows. Got: {}",
+                        n,
+                        x.shape());
+        for (int64_t i = 0; i < ndim - 2; ++i) {
+            LIBRAPID_ASSERT(factor.shape()[i] == x.shape()[i],
+                            "Batch dimensions must match. Got: {} and {}",
+                            factor.shape(),
+                            x.shape());
+        }
+
+        const int64_t nrhs       = vectors ? 1 : int64_t(x.shape()[ndimB - 1]);
+        const int64_t batchCount = n == 0 ? 0 : int64_t(factor.shape().size()) / (n * n);
+        const ScalarL *lData     = factor.storage().data();
+        ScalarB *xData           = x.storage().data();
+
+        std::vector<const ScalarL *> factors(batchCount);
+        std::vector<ScalarB *> rhs(batchCount);
+        for (int64_t i = 0; i < batchCount; ++i) {
+            factors[i] = lData + i * n * n;
+            rhs[i]     = xData + i * n * nrhs;
+        }
+
+        linalg::potrsBatched(n, nrhs, factors.data(), n, rhs.data(), nrhs, batchCount);
+        return x;
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FACTORISATION_CHOLESKY_HPP
@@ -0,0 +1,300 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FACTORISATION_EIGH_HPP
+#define LIBRAPID_ARRAY_LINALG_FACTORISATION_EIGH_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Maximum number of implicit QL iterations used to find each eigenvalue of a
+        /// tridiagonal matrix
+        constexpr int64_t steqrMaxIterations = 30;
+
+        /// \brief Reduce a symmetric, row-major matrix to tridiagonal form
+        ///
+        /// Computes \f$ \mathbf{Q}^T \mathbf{A} \mathbf{Q} = \mathbf{T} \f$, where
+        /// \f$ \mathbf{Q} = \mathbf{H}_0 \mathbf{H}_1 \cdots \mathbf{H}_{n-2} \f$. Reflector
+        /// \f$ i \f$ is stored below the subdiagonal in column \f$ i \f$ of \f$ \mathbf{A} \f$, as
+        /// in LAPACK's ``sytrd`` with a lower triangle. Both triangles of \f$ \mathbf{A} \f$ are
+        /// read and updated, so every access is to a contiguous row, and the rank-2 updates are
+        /// split between threads by rows.
+        /// \param d Pointer to \f$ n \f$ values, overwritten by the diagonal of \f$ \mathbf{T} \f$
+        /// \param e Pointer to \f$ n \f$ values, overwritten by the subdiagonal of
+        /// \f$ \mathbf{T} \f$ followed by a zero
+        /// \param tau Pointer to \f$ n - 1 \f$ values, overwritten by the reflector scales
+        template<typename Scalar>
+        void sytrd(int64_t n, Scalar *a, int64_t lda, Scalar *d, Scalar *e, Scalar *tau) {
+            std::vector<Scalar> v(n), p(n);
+            Scalar *vData = v.data();
+            Scalar *pData = p.data();
+
+            for (int64_t i = 0; i + 1 < n; ++i) {
+                Scalar *x = a + (i + 1) * lda + i;
+                tau[i]    = i + 2 < n ? larfg(n - i - 1, *x, x + lda, lda) : Scalar(0);
+                d[i]      = a[i * lda + i];
+                e[i]      = *x;
+                if (tau[i] == Scalar(0)) continue;
+
+                const int64_t len = n - i - 1;
+                Scalar *a22       = a + (i + 1) * lda + i + 1;
+                const Scalar t    = tau[i];
+                vData[0]          = Scalar(1);
+                for (int64_t r = 1; r < len; ++r) vData[r] = x[r * lda];
+
+                const bool parallel =
+                  len * len > static_cast<int64_t>(global::multithreadThreshold) &&
+                  global::numThreads > 1;
+
+                // p = tau A22 v
+#pragma omp parallel for shared(len, a22, lda, t, vData, pData) default(none) if (parallel)        \
+  num_threads(int(global::numThreads))
+                for (int64_t r = 0; r < len; ++r) {
+                    pData[r] = t * dotContiguous(len, a22 + r * lda, vData);
+                }
+
+                // w = p - (tau / 2) (p^T v) v, stored in p
+                const Scalar scale = Scalar(-0.5) * t * dotContiguous(len, pData, vData);
+                for (int64_t r = 0; r < len; ++r) pData[r] += scale * vData[r];
+
+                // A22 = A22 - v w^T - w v^T
+#pragma omp parallel for shared(len, a22, lda, vData, pData) default(none) if (parallel)           \
+  num_threads(int(global::numThreads))
+                for (int64_t r = 0; r < len; ++r) {
+                    Scalar *row     = a22 + r * lda;
+                    const Scalar vr = vData[r];
+                    const Scalar wr = pData[r];
+                    for (int64_t c = 0; c < len; ++c) row[c] -= vr * pData[c] + wr * vData[c];
+                }
+            }
+
+            if (n > 0) {
+                d[n - 1] = a[(n - 1) * lda + n - 1];
+                e[n - 1] = Scalar(0);
+            }
+        }
+
+        /// \brief Eigenvalues and eigenvectors of a symmetric tridiagonal matrix
+        ///
+        /// Uses the implicit QL algorithm with Wilkinson shifts. The eigenvectors are
+        /// accumulated as the rows of \f$ \mathbf{Z}^T \f$, so each Givens rotation updates two
+        /// contiguous rows.
+        /// \param n Order of the matrix
+        /// \param d Pointer to the diagonal, overwritten by the (unsorted) eigenvalues
+        /// \param e Pointer to the subdiagonal (\f$ n \f$ values, the last of which is unused).
+        /// It is destroyed
+        /// \param zt Pointer to an \f$ n \times n \f$ row-major matrix which is multiplied on
+        /// the left by the transpose of the eigenvector matrix, or nullptr if the eigenvectors
+        /// are not needed
+        /// \param ldz Leading dimension of \p zt
+        /// \return Zero on success, or \f$ i + 1 \f$ if eigenvalue \f$ i \f$ did not converge
+        template<typename Scalar>
+        int64_t steqr(int64_t n, Scalar *d, Scalar *e, Scalar *zt, int64_t ldz) {
+            if (n > 0) e[n - 1] = Scalar(0);
+
+            // Subdiagonal elements below this are negligible. An absolute threshold is needed
+            // for clusters of eigenvalues close to zero, such as those of rank-deficient Gram
+            // matrices, where a threshold relative to the diagonal may never be reached
+            Scalar norm(0);
+            for (int64_t i = 0; i < n; ++i) {
+                Scalar row = ::librapid::abs(d[i]) + ::librapid::abs(e[i]);
+                if (i > 0) row += ::librapid::abs(e[i - 1]);
+                norm = std::max(norm, row);
+            }
+            const Scalar tolerance = std::numeric_limits<Scalar>::epsilon() * norm;
+
+            for (int64_t l = 0; l < n; ++l) {
+                int64_t iterations = 0;
+                int64_t m;
+                do {
+                    // Find a negligible subdiagonal element to split the matrix at
+                    for (m = l; m + 1 < n; ++m) {
+                        if (::librapid::abs(e[m]) <= tolerance) break;
+                    }
+                    if (m == l) break;
+                    if (iterations++ == steqrMaxIterations) return l + 1;
+
+                    // Wilkinson shift
+                    Scalar g = (d[l + 1] - d[l]) / (Scalar(2) * e[l]);
+                    Scalar r = static_cast<Scalar>(::librapid::hypot(g, Scalar(1)));
+                    g        = d[m] - d[l] + e[l] / (g + (g >= Scalar(0) ? r : -r));
+
+                    Scalar s(1), c(1), p(0);
+                    int64_t i;
+                    for (i = m - 1; i >= l; --i) {
+                        const Scalar f = s * e[i];
+                        const Scalar b = c * e[i];
+                        r              = static_cast<Scalar>(::librapid::hypot(f, g));
+                        e[i + 1]       = r;
+                        if (r == Scalar(0)) {
+                            // Recover from underflow
+                            d[i + 1] -= p;
+                            e[m] = Scalar(0);
+                            break;
+                        }
+
+                        s        = f / r;
+                        c        = g / r;
+                        g        = d[i + 1] - p;
+                        r        = (d[i] - g) * s + Scalar(2) * c * b;
+                        p        = s * r;
+                        d[i + 1] = g + p;
+                        g        = c * r - b;
+
+                        if (zt != nullptr) {
+                            Scalar *upper = zt + i * ldz;
+                            Scalar *lower = zt + (i + 1) * ldz;
+                            for (int64_t k = 0; k < n; ++k) {
+                                const Scalar z = lower[k];
+                                lower[k]       = s * upper[k] + c * z;
+                                upper[k]       = c * upper[k] - s * z;
+                            }
+                        }
+                    }
+
+                    if (r == Scalar(0) && i >= l) continue;
+                    d[l] -= p;
+                    e[l] = g;
+                    e[m] = Scalar(0);
+                } while (m != l);
+            }
+
+            return 0;
+        }
+
+        /// \brief Native symmetric eigensolver: tridiagonal reduction, then implicit QL
+        template<typename Scalar>
+        int64_t syevNative(bool vectors, int64_t n, Scalar *a, int64_t lda, Scalar *w) {
+            // Only the lower triangle is referenced by the caller
+            for (int64_t i = 0; i < n; ++i) {
+                for (int64_t j = i + 1; j < n; ++j) a[i * lda + j] = a[j * lda + i];
+            }
+
+            std::vector<Scalar> e(n), tau(std::max(n - 1, int64_t(0)));
+            sytrd(n, a, lda, w, e.data(), tau.data());
+
+            // Z^T starts as Q^T. The reflectors of the tridiagonal reduction act on rows
+            // 1 to n - 1, so Q is formed from the matrix below the first row
+            std::vector<Scalar> zt;
+            if (vectors && n > 0) {
+                std::vector<Scalar> q(n * n, Scalar(0));
+                q[0] = Scalar(1);
+                for (int64_t i = 1; i < n; ++i) {
+                    std::copy(a + i * lda, a + i * lda + n - 1, &q[i * n + 1]);
+                }
+                orgqr(n - 1, n - 1, n - 1, q.data() + n + 1, n, tau.data());
+
+                zt.resize(n * n);
+                for (int64_t i = 0; i < n; ++i) {
+                    for (int64_t j = 0; j < n; ++j) zt[j * n + i] = q[i * n + j];
+                }
+            }
+
+            const int64_t info = steqr(n, w, e.data(), vectors ? zt.data() : nullptr, n);
+            if (info != 0) return info;
+
+            // Sort into ascending order, and store the eigenvectors as columns
+            std::vector<int64_t> order(n);
+            std::iota(order.begin(), order.end(), int64_t(0));
+            std::stable_sort(
+              order.begin(), order.end(), [w](int64_t i, int64_t j) { return w[i] < w[j]; });
+
+            const std::vector<Scalar> values(w, w + n);
+            for (int64_t j = 0; j < n; ++j) {
+                w[j] = values[order[j]];
+                if (!vectors) continue;
+
+                const Scalar *column = zt.data() + order[j] * n;
+                for (int64_t i = 0; i < n; ++i) a[i * lda + j] = column[i];
+            }
+
+            return 0;
+        }
+    } // namespace detail
+
+    /// \brief Eigenvalues and eigenvectors of a real symmetric matrix
+    ///
+    /// Computes \f$ \mathbf{A} = \mathbf{V} \mathbf{\Lambda} \mathbf{V}^T \f$ for the
+    /// \f$ n \times n \f$ row-major matrix \f$ \mathbf{A} \f$, of which only the lower triangle
+    /// is referenced. The eigenvalues are returned in ascending order.
+    ///
+    /// If LAPACK is available, its divide-and-conquer solver (``syevd``) is used. Otherwise,
+    /// \f$ \mathbf{A} \f$ is reduced to tridiagonal form with Householder reflectors and the
+    /// tridiagonal matrix is diagonalised with the implicit QL algorithm.
+    /// \tparam Scalar Scalar type
+    /// \param vectors If true, compute the eigenvectors as well as the eigenvalues
+    /// \param n Order of \f$ \mathbf{A} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$. If \p vectors is true, it is overwritten by the
+    /// eigenvectors, stored as columns. Otherwise, it is destroyed
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param w Pointer to \f$ n \f$ values, overwritten by the eigenvalues
+    /// \param backend Backend to use for computation
+    /// \return Zero on success, or a positive value if the algorithm failed to converge
+    template<typename Scalar>
+    int64_t syev(bool vectors, int64_t n, Scalar *a, int64_t lda, Scalar *w,
+                 backend::CPU backend = backend::CPU()) {
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (n <= lapackMax && lda <= lapackMax) {
+                const char job = vectors ? 'V' : 'N';
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_ssyevd(LAPACK_ROW_MAJOR,
+                                          job,
+                                          'L',
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          w);
+                } else {
+                    info = LAPACKE_dsyevd(LAPACK_ROW_MAJOR,
+                                          job,
+                                          'L',
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          w);
+                }
+
+                LIBRAPID_ASSERT(info >= 0, "Invalid argument {} passed to LAPACK syevd", -info);
+                return info;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        return detail::syevNative(vectors, n, a, lda, w);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Eigendecomposition of a real symmetric matrix
+    ///
+    /// Returns the eigenvalues \f$ \lambda_i \f$, in ascending order, and a matrix whose
+    /// columns are the corresponding orthonormal eigenvectors. Only the lower triangle of \p a
+    /// is read. See ``linalg::syev``.
+    /// \param a The symmetric matrix.
+    /// \return A tuple of (eigenvalues, eigenvectors)
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto eigh(T &&a) {
+        using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+        using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+        static_assert(std::is_same_v<Backend, backend::CPU>,
+                      "Eigendecompositions are only supported on the CPU");
+        static_assert(std::is_floating_point_v<Scalar>,
+                      "Eigendecompositions are only supported for real floating point types");
+
+        Array<Scalar, Backend> vectors(std::forward<T>(a));
+        LIBRAPID_ASSERT(vectors.ndim() == 2 && vectors.shape()[0] == vectors.shape()[1],
+                        "Input must be a square matrix. Got: {}",
+                        vectors.shape());
+
+        const int64_t n = vectors.shape()[0];
+        Array<Scalar, Backend> values(Shape({n}));
+        const int64_t info =
+          linalg::syev(true, n, vectors.storage().data(), n, values.storage().data());
+        LIBRAPID_ASSERT(info == 0, "Eigendecomposition failed to converge");
+
+        return std::make_tuple(std::move(values), std::move(vectors));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FACTORISATION_EIGH_HPP
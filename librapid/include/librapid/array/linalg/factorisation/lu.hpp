@@ -0,0 +1,413 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FACTORISATION_LU_HPP
+#define LIBRAPID_ARRAY_LINALG_FACTORISATION_LU_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Columns factorised together in each panel of a blocked LU factorisation
+        constexpr int64_t luBlockSize = 64;
+
+        /// \brief Apply a sequence of row interchanges to a row-major matrix
+        ///
+        /// For each \f$ i \f$ in \f$ [k_1, k_2) \f$, swaps rows \f$ i \f$ and \f$ p_i \f$ of
+        /// \f$ \mathbf{A} \f$, in order. Equivalent to LAPACK's ``laswp``.
+        /// \param n Number of columns to swap
+        /// \param a Pointer to \f$ \mathbf{A} \f$
+        /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+        /// \param k1 First interchange to apply
+        /// \param k2 One past the last interchange to apply
+        /// \param ipiv Row interchanges (zero-based)
+        template<typename Scalar>
+        void laswp(int64_t n, Scalar *a, int64_t lda, int64_t k1, int64_t k2,
+                   const int64_t *ipiv) {
+            if (n <= 0) return;
+
+            for (int64_t i = k1; i < k2; ++i) {
+                if (ipiv[i] != i) {
+                    std::swap_ranges(a + i * lda, a + i * lda + n, a + ipiv[i] * lda);
+                }
+            }
+        }
+
+        /// \brief Unblocked LU factorisation of a tall panel with partial pivoting
+        ///
+        /// Factorises the \f$ m \times n \f$ panel in place, swapping whole rows of the panel
+        /// only. Pivots are stored relative to the first row of the panel.
+        /// \return Zero on success, or \f$ i + 1 \f$ if \f$ u_{ii} \f$ is exactly zero
+        template<typename Scalar>
+        int64_t getrfPanel(int64_t m, int64_t n, Scalar *a, int64_t lda, int64_t *ipiv) {
+            int64_t info = 0;
+
+            for (int64_t j = 0; j < std::min(m, n); ++j) {
+                int64_t pivot = j;
+                auto maxVal   = ::librapid::abs(a[j * lda + j]);
+                for (int64_t i = j + 1; i < m; ++i) {
+                    const auto val = ::librapid::abs(a[i * lda + j]);
+                    if (val > maxVal) {
+                        maxVal = val;
+                        pivot  = i;
+                    }
+                }
+
+                ipiv[j] = pivot;
+                if (pivot != j) std::swap_ranges(a + j * lda, a + j * lda + n, a + pivot * lda);
+
+                const Scalar diag = a[j * lda + j];
+                if (diag == Scalar(0)) {
+                    if (info == 0) info = j + 1;
+                    continue;
+                }
+
+                // Compute the multipliers and update the rest of the panel
+                const Scalar *rowJ = a + j * lda;
+                for (int64_t i = j + 1; i < m; ++i) {
+                    Scalar *rowI      = a + i * lda;
+                    const Scalar mult = rowI[j] / diag;
+                    rowI[j]           = mult;
+                    for (int64_t k = j + 1; k < n; ++k) rowI[k] -= mult * rowJ[k];
+                }
+            }
+
+            return info;
+        }
+
+        /// Columns of the right-hand side solved together by each thread in ``getrsDiagonal``
+        constexpr int64_t luSolveColumns = 256;
+
+        /// \brief Solve with one diagonal block of an LU factorisation by substitution
+        ///
+        /// Solves \f$ \mathbf{T} \mathbf{X} = \mathbf{B} \f$ in place, where
+        /// \f$ \mathbf{T} \f$ is the unit lower triangle of the \f$ n \times n \f$ block
+        /// \f$ \mathbf{A} \f$ if \p upper is false, or its upper triangle otherwise. Whole rows
+        /// of \f$ \mathbf{B} \f$ are updated at a time, and wide right-hand sides are split
+        /// between threads by column.
+        template<typename Scalar>
+        void getrsDiagonal(bool upper, int64_t n, int64_t nrhs, const Scalar *a, int64_t lda,
+                           Scalar *b, int64_t ldb) {
+            const int64_t width  = luSolveColumns;
+            const int64_t panels = (nrhs + width - 1) / width;
+            const bool parallel =
+              panels > 1 && n * n * nrhs > static_cast<int64_t>(global::multithreadThreshold) &&
+              global::numThreads > 1;
+
+#pragma omp parallel for shared(upper, n, nrhs, a, lda, b, ldb, width, panels)                     \
+  default(none) if (parallel) num_threads(int(global::numThreads))
+            for (int64_t panel = 0; panel < panels; ++panel) {
+                const int64_t col  = panel * width;
+                const int64_t cols = std::min(width, nrhs - col);
+
+                for (int64_t step = 0; step < n; ++step) {
+                    const int64_t i = upper ? n - 1 - step : step;
+                    Scalar *rowI    = b + i * ldb + col;
+
+                    const int64_t begin = upper ? i + 1 : 0;
+                    const int64_t end   = upper ? n : i;
+                    for (int64_t k = begin; k < end; ++k) {
+                        const Scalar factor = a[i * lda + k];
+                        const Scalar *rowK  = b + k * ldb + col;
+                        for (int64_t j = 0; j < cols; ++j) rowI[j] -= factor * rowK[j];
+                    }
+
+                    if (upper) {
+                        const Scalar diag = a[i * lda + i];
+                        for (int64_t j = 0; j < cols; ++j) rowI[j] /= diag;
+                    }
+                }
+            }
+        }
+
+        /// \brief Blocked triangular solve with the factors of an LU factorisation
+        ///
+        /// Solves \f$ \mathbf{L} \mathbf{X} = \mathbf{B} \f$ (if \p upper is false) or
+        /// \f$ \mathbf{U} \mathbf{X} = \mathbf{B} \f$ (if \p upper is true) in place. Each
+        /// diagonal block of ``luBlockSize`` rows is solved with ``getrsDiagonal``, and the rows
+        /// which have not been solved yet are updated with a single GEMM, which does almost all
+        /// of the work.
+        /// \param upper Whether to solve with \f$ \mathbf{U} \f$ or \f$ \mathbf{L} \f$
+        /// \param n Order of the factorised matrix
+        /// \param nrhs Columns of \f$ \mathbf{B} \f$
+        /// \param a Pointer to the factorised matrix
+        /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+        /// \param b Pointer to \f$ \mathbf{B} \f$, which is overwritten by \f$ \mathbf{X} \f$
+        /// \param ldb Leading dimension of \f$ \mathbf{B} \f$
+        template<typename Scalar>
+        void getrsTriangular(bool upper, int64_t n, int64_t nrhs, const Scalar *a, int64_t lda,
+                             Scalar *b, int64_t ldb) {
+            const int64_t blocks = (n + luBlockSize - 1) / luBlockSize;
+
+            for (int64_t step = 0; step < blocks; ++step) {
+                const int64_t j  = (upper ? blocks - 1 - step : step) * luBlockSize;
+                const int64_t jb = std::min(luBlockSize, n - j);
+
+                getrsDiagonal(upper, jb, nrhs, a + j * lda + j, lda, b + j * ldb, ldb);
+
+                // Remove the solved rows from the rows above (for U) or below (for L) them
+                const int64_t rows = upper ? j : n - j - jb;
+                const int64_t row  = upper ? 0 : j + jb;
+                if (rows > 0) {
+                    gemm(false,
+                         false,
+                         rows,
+                         nrhs,
+                         jb,
+                         Scalar(-1),
+                         a + row * lda + j,
+                         lda,
+                         static_cast<const Scalar *>(b + j * ldb),
+                         ldb,
+                         Scalar(1),
+                         b + row * ldb,
+                         ldb);
+                }
+            }
+        }
+
+        /// \brief Blocked, right-looking LU factorisation with partial pivoting
+        ///
+        /// Each panel of ``luBlockSize`` columns is factorised with ``getrfPanel``. The row
+        /// interchanges are then applied to the rest of the matrix, the block row of
+        /// \f$ \mathbf{U} \f$ is found with a triangular solve, and the trailing submatrix is
+        /// updated with a single GEMM, which does almost all of the work.
+        /// \see librapid::linalg::getrf
+        template<typename Scalar>
+        int64_t getrfNative(int64_t m, int64_t n, Scalar *a, int64_t lda, int64_t *ipiv) {
+            const int64_t minDim = std::min(m, n);
+            int64_t info         = 0;
+
+            for (int64_t j = 0; j < minDim; j += luBlockSize) {
+                const int64_t jb = std::min(luBlockSize, minDim - j);
+
+                const int64_t panelInfo = getrfPanel(m - j, jb, a + j * lda + j, lda, ipiv + j);
+                if (info == 0 && panelInfo > 0) info = panelInfo + j;
+                for (int64_t i = j; i < j + jb; ++i) ipiv[i] += j;
+
+                // Apply the interchanges to the columns on either side of the panel
+                laswp(j, a, lda, j, j + jb, ipiv);
+                if (j + jb < n) {
+                    laswp(n - j - jb, a + j + jb, lda, j, j + jb, ipiv);
+
+                    // U12 = L11^-1 A12
+                    getrsDiagonal(false,
+                                  jb,
+                                  n - j - jb,
+                                  static_cast<const Scalar *>(a + j * lda + j),
+                                  lda,
+                                  a + j * lda + j + jb,
+                                  lda);
+
+                    // A22 = A22 - L21 U12
+                    if (j + jb < m) {
+                        gemm(false,
+                             false,
+                             m - j - jb,
+                             n - j - jb,
+                             jb,
+                             Scalar(-1),
+                             static_cast<const Scalar *>(a + (j + jb) * lda + j),
+                             lda,
+                             static_cast<const Scalar *>(a + j * lda + j + jb),
+                             lda,
+                             Scalar(1),
+                             a + (j + jb) * lda + j + jb,
+                             lda);
+                    }
+                }
+            }
+
+            return info;
+        }
+    } // namespace detail
+
+    /// \brief LU factorisation with partial pivoting
+    ///
+    /// Factorises the \f$ m \times n \f$ row-major matrix \f$ \mathbf{A} \f$ in place as
+    /// \f$ \mathbf{A} = \mathbf{P} \mathbf{L} \mathbf{U} \f$, where \f$ \mathbf{L} \f$ is
+    /// unit lower triangular (its diagonal is not stored) and \f$ \mathbf{U} \f$ is upper
+    /// triangular. Row \f$ i \f$ was interchanged with row \f$ \mathrm{ipiv}_i \f$.
+    ///
+    /// Real single- and double-precision matrices use LAPACK when LibRapid is linked against
+    /// it, and the matrix is small enough for LAPACK's integer type. Otherwise, a blocked
+    /// implementation built on ``gemm`` is used.
+    /// \tparam Scalar Scalar type
+    /// \param m Rows of \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param ipiv Pointer to \f$ \min(m, n) \f$ zero-based row interchanges
+    /// \param backend Backend to use for computation
+    /// \return Zero on success, or \f$ i + 1 \f$ if \f$ u_{ii} \f$ is exactly zero, in which
+    /// case the factorisation is complete but \f$ \mathbf{U} \f$ is singular
+    template<typename Scalar>
+    int64_t getrf(int64_t m, int64_t n, Scalar *a, int64_t lda, int64_t *ipiv,
+                  backend::CPU backend = backend::CPU()) {
+        if (m <= 0 || n <= 0) return 0;
+
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (m <= lapackMax && n <= lapackMax && lda <= lapackMax) {
+                std::vector<lapack_int> pivots(std::min(m, n));
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_sgetrf(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          pivots.data());
+                } else {
+                    info = LAPACKE_dgetrf(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          pivots.data());
+                }
+
+                LIBRAPID_ASSERT(info >= 0, "Invalid argument {} passed to LAPACK getrf", -info);
+                for (size_t i = 0; i < pivots.size(); ++i) ipiv[i] = pivots[i] - 1;
+                return info;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        return detail::getrfNative(m, n, a, lda, ipiv);
+    }
+
+    /// \brief Solve a system of linear equations using an LU factorisation
+    ///
+    /// Solves \f$ \mathbf{A} \mathbf{X} = \mathbf{B} \f$ in place, where \f$ \mathbf{A} \f$ is
+    /// an \f$ n \times n \f$ matrix which has been factorised by ``getrf``, and
+    /// \f$ \mathbf{B} \f$ is a row-major \f$ n \times \mathrm{nrhs} \f$ matrix.
+    /// \tparam Scalar Scalar type
+    /// \param n Order of \f$ \mathbf{A} \f$
+    /// \param nrhs Columns of \f$ \mathbf{B} \f$
+    /// \param a Pointer to the factorised matrix
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param ipiv Row interchanges returned by ``getrf``
+    /// \param b Pointer to \f$ \mathbf{B} \f$, which is overwritten by \f$ \mathbf{X} \f$
+    /// \param ldb Leading dimension of \f$ \mathbf{B} \f$
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void getrs(int64_t n, int64_t nrhs, const Scalar *a, int64_t lda, const int64_t *ipiv,
+               Scalar *b, int64_t ldb, backend::CPU backend = backend::CPU()) {
+        if (n <= 0 || nrhs <= 0) return;
+
+        detail::laswp(nrhs, b, ldb, 0, n, ipiv);
+
+        // L Y = P^T B, then U X = Y
+        detail::getrsTriangular(false, n, nrhs, a, lda, b, ldb);
+        detail::getrsTriangular(true, n, nrhs, a, lda, b, ldb);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    namespace detail {
+        /// \brief Evaluate an array-like object into a square, CPU matrix and factorise it
+        /// \param a Input matrix
+        /// \param ipiv Vector to store the row interchanges in
+        /// \return A tuple of (factorised matrix, info), where info is the value returned by
+        /// ``linalg::getrf``
+        template<typename T>
+        auto luFactorise(T &&a, std::vector<int64_t> &ipiv) {
+            using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+            using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+            static_assert(std::is_same_v<Backend, backend::CPU>,
+                          "LU factorisations are only supported on the CPU");
+
+            Array<Scalar, Backend> lu(std::forward<T>(a));
+            LIBRAPID_ASSERT(lu.ndim() == 2 && lu.shape()[0] == lu.shape()[1],
+                            "Input must be a square matrix. Got: {}",
+                            lu.shape());
+
+            const int64_t n = lu.shape()[0];
+            ipiv.resize(n);
+            const int64_t info = linalg::getrf(n, n, lu.storage().data(), n, ipiv.data());
+            return std::make_tuple(std::move(lu), info);
+        }
+    } // namespace detail
+
+    /// \brief Solve a system of linear equations
+    ///
+    /// Returns \f$ \mathbf{X} \f$ such that \f$ \mathbf{A} \mathbf{X} = \mathbf{B} \f$, where
+    /// \f$ \mathbf{A} \f$ is a square, non-singular matrix and \f$ \mathbf{B} \f$ is a vector or
+    /// a matrix with the same number of rows as \f$ \mathbf{A} \f$. \f$ \mathbf{A} \f$ is
+    /// factorised with ``linalg::getrf``.
+    /// \param a The coefficient matrix.
+    /// \param b The right-hand side.
+    /// \return The solution, with the same shape as \p b.
+    template<typename First, typename Second>
+        requires(IsArrayType<First>::value && IsArrayType<Second>::value)
+    auto solve(First &&a, Second &&b) {
+        using ScalarB  = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
+        using BackendB = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
+
+        std::vector<int64_t> ipiv;
+        auto [lu, info] = detail::luFactorise(std::forward<First>(a), ipiv);
+        LIBRAPID_ASSERT(info == 0, "Matrix is singular. U({0}, {0}) is zero", info - 1);
+
+        using Scalar = typename decltype(lu)::Scalar;
+        static_assert(std::is_same_v<Scalar, ScalarB>, "Scalar types of A and B must match");
+
+        Array<Scalar, BackendB> x(std::forward<Second>(b));
+        const int64_t n = lu.shape()[0];
+        LIBRAPID_ASSERT((x.ndim() == 1 || x.ndim() == 2) && int64_t(x.shape()[0]) == n,
+                        "Right-hand side must have {} rows. Got: {}",
+                        n,
+                        x.shape());
+
+        const int64_t nrhs = x.ndim() == 1 ? 1 : int64_t(x.shape()[1]);
+        linalg::getrs(n, nrhs, lu.storage().data(), n, ipiv.data(), x.storage().data(), nrhs);
+        return x;
+    }
+
+    /// \brief Compute the inverse of a square matrix
+    ///
+    /// The matrix must be non-singular. Where possible, use ``solve`` instead, which is faster
+    /// and more accurate than multiplying by the inverse.
+    /// \param a The matrix to invert.
+    /// \return \f$ \mathbf{A}^{-1} \f$
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto inv(T &&a) {
+        std::vector<int64_t> ipiv;
+        auto [lu, info] = detail::luFactorise(std::forward<T>(a), ipiv);
+        LIBRAPID_ASSERT(info == 0, "Matrix is singular. U({0}, {0}) is zero", info - 1);
+
+        using Scalar    = typename decltype(lu)::Scalar;
+        const int64_t n = lu.shape()[0];
+
+        Array<Scalar, backend::CPU> result(Shape({n, n}), Scalar(0));
+        Scalar *data = result.storage().data();
+        for (int64_t i = 0; i < n; ++i) data[i * n + i] = Scalar(1);
+
+        linalg::getrs(n, n, lu.storage().data(), n, ipiv.data(), data, n);
+        return result;
+    }
+
+    /// \brief Compute the determinant of a square matrix
+    ///
+    /// Computed from the diagonal of \f$ \mathbf{U} \f$ in an LU factorisation, with its sign
+    /// flipped for every row interchange. Singular matrices give zero.
+    /// \param a The input matrix.
+    /// \return \f$ \det(\mathbf{A}) \f$
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto det(T &&a) {
+        std::vector<int64_t> ipiv;
+        auto [lu, info] = detail::luFactorise(std::forward<T>(a), ipiv);
+
+        using Scalar       = typename decltype(lu)::Scalar;
+        const int64_t n    = lu.shape()[0];
+        const Scalar *data = lu.storage().data();
+        Scalar result(1);
+        for (int64_t i = 0; i < n; ++i) {
+            result *= data[i * n + i];
+            if (ipiv[i] != i) result = -result;
+        }
+
+        return result;
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FACTORISATION_LU_HPP
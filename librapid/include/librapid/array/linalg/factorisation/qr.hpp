@@ -0,0 +1,714 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FACTORISATION_QR_HPP
+#define LIBRAPID_ARRAY_LINALG_FACTORISATION_QR_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Householder reflectors accumulated into each block reflector of a blocked QR
+        /// factorisation
+        constexpr int64_t qrBlockSize = 32;
+
+        /// Minimum rows in each row block of a TSQR factorisation, as a multiple of the number
+        /// of columns
+        constexpr int64_t tsqrRowsPerColumn = 4;
+
+        /// \brief Generate an elementary reflector
+        ///
+        /// Finds \f$ \tau \f$ and \f$ \mathbf{v} \f$ (with \f$ v_0 = 1 \f$) such that
+        /// \f$ (\mathbf{I} - \tau \mathbf{v} \mathbf{v}^T) [\alpha, \mathbf{x}]^T =
+        /// [\beta, \mathbf{0}]^T \f$. \f$ \alpha \f$ is overwritten by \f$ \beta \f$ and
+        /// \f$ \mathbf{x} \f$ by the rest of \f$ \mathbf{v} \f$. The norm of \f$ \mathbf{x} \f$ is
+        /// scaled to avoid overflow.
+        /// \param n Length of \f$ [\alpha, \mathbf{x}] \f$
+        /// \param alpha First element of the vector
+        /// \param x Pointer to the remaining \f$ n - 1 \f$ elements
+        /// \param incx Stride of \f$ \mathbf{x} \f$
+        /// \return \f$ \tau \f$, which is zero if the vector is already in the required form
+        template<typename Scalar>
+        Scalar larfg(int64_t n, Scalar &alpha, Scalar *x, int64_t incx) {
+            Scalar scale(0);
+            for (int64_t i = 0; i < n - 1; ++i) {
+                scale = std::max(scale, static_cast<Scalar>(::librapid::abs(x[i * incx])));
+            }
+            if (scale == Scalar(0)) return Scalar(0);
+
+            Scalar sumSq(0);
+            for (int64_t i = 0; i < n - 1; ++i) {
+                const Scalar scaled = x[i * incx] / scale;
+                sumSq += scaled * scaled;
+            }
+
+            const Scalar xNorm = scale * static_cast<Scalar>(::librapid::sqrt(sumSq));
+            const Scalar norm  = static_cast<Scalar>(::librapid::hypot(alpha, xNorm));
+            const Scalar beta  = alpha >= Scalar(0) ? -norm : norm;
+            const Scalar tau   = (beta - alpha) / beta;
+
+            const Scalar factor = Scalar(1) / (alpha - beta);
+            for (int64_t i = 0; i < n - 1; ++i) x[i * incx] *= factor;
+            alpha = beta;
+            return tau;
+        }
+
+        /// \brief Apply an elementary reflector \f$ \mathbf{I} - \tau \mathbf{v} \mathbf{v}^T \f$
+        /// to an \f$ m \times n \f$ row-major matrix from the left
+        /// \param work Workspace of \f$ n \f$ elements
+        template<typename Scalar>
+        void larf(int64_t m, int64_t n, const Scalar *v, int64_t incv, Scalar tau, Scalar *c,
+                  int64_t ldc, Scalar *work) {
+            std::fill(work, work + n, Scalar(0));
+            for (int64_t i = 0; i < m; ++i) {
+                const Scalar vi   = v[i * incv];
+                const Scalar *row = c + i * ldc;
+                for (int64_t j = 0; j < n; ++j) work[j] += vi * row[j];
+            }
+
+            for (int64_t i = 0; i < m; ++i) {
+                const Scalar scale = tau * v[i * incv];
+                Scalar *row        = c + i * ldc;
+                for (int64_t j = 0; j < n; ++j) row[j] -= scale * work[j];
+            }
+        }
+
+        /// \brief Unblocked Householder QR factorisation of an \f$ m \times n \f$ row-major
+        /// matrix
+        ///
+        /// On exit, \f$ \mathbf{R} \f$ is stored on and above the diagonal, and the reflectors
+        /// (without their unit first elements) below it, as in LAPACK's ``geqr2``.
+        /// \param tau Pointer to \f$ \min(m, n) \f$ reflector scales
+        /// \param work Workspace of \f$ n \f$ elements
+        template<typename Scalar>
+        void geqr2(int64_t m, int64_t n, Scalar *a, int64_t lda, Scalar *tau, Scalar *work) {
+            const int64_t k = std::min(m, n);
+            for (int64_t j = 0; j < k; ++j) {
+                Scalar *ajj = a + j * lda + j;
+                tau[j]      = j + 1 < m ? larfg(m - j, *ajj, ajj + lda, lda) : Scalar(0);
+
+                if (j + 1 < n && tau[j] != Scalar(0)) {
+                    const Scalar diag = *ajj;
+                    *ajj              = Scalar(1);
+                    larf(m - j, n - j - 1, ajj, lda, tau[j], ajj + 1, lda, work);
+                    *ajj = diag;
+                }
+            }
+        }
+
+        /// \brief Form the triangular factor of a block reflector
+        ///
+        /// Computes the \f$ k \times k \f$ upper triangular \f$ \mathbf{T} \f$ such that
+        /// \f$ \mathbf{H}_0 \mathbf{H}_1 \cdots \mathbf{H}_{k-1} = \mathbf{I} - \mathbf{V}
+        /// \mathbf{T} \mathbf{V}^T \f$ (the compact WY representation). \f$ \mathbf{V} \f$ is
+        /// the \f$ m \times k \f$ unit lower trapezoidal matrix of reflectors, of which only the
+        /// strictly lower part is read.
+        template<typename Scalar>
+        void larft(int64_t m, int64_t k, const Scalar *v, int64_t ldv, const Scalar *tau,
+                   Scalar *t, int64_t ldt) {
+            for (int64_t i = 0; i < k; ++i) {
+                for (int64_t r = i + 1; r < k; ++r) t[r * ldt + i] = Scalar(0);
+
+                if (tau[i] == Scalar(0)) {
+                    for (int64_t r = 0; r <= i; ++r) t[r * ldt + i] = Scalar(0);
+                    continue;
+                }
+
+                // T(0:i, i) = -tau_i V(:, 0:i)^T v_i
+                for (int64_t r = 0; r < i; ++r) t[r * ldt + i] = -tau[i] * v[i * ldv + r];
+                for (int64_t row = i + 1; row < m; ++row) {
+                    const Scalar scale = -tau[i] * v[row * ldv + i];
+                    const Scalar *rowV = v + row * ldv;
+                    for (int64_t r = 0; r < i; ++r) t[r * ldt + i] += scale * rowV[r];
+                }
+
+                // T(0:i, i) = T(0:i, 0:i) T(0:i, i)
+                for (int64_t r = 0; r < i; ++r) {
+                    Scalar sum(0);
+                    for (int64_t c = r; c < i; ++c) sum += t[r * ldt + c] * t[c * ldt + i];
+                    t[r * ldt + i] = sum;
+                }
+
+                t[i * ldt + i] = tau[i];
+            }
+        }
+
+        /// \brief Apply a block reflector, or its transpose, to an \f$ m \times n \f$ row-major
+        /// matrix from the left
+        ///
+        /// Computes \f$ \mathbf{C} = (\mathbf{I} - \mathbf{V} \mathrm{op}(\mathbf{T})
+        /// \mathbf{V}^T) \mathbf{C} \f$ with three calls to ``gemm``, where \f$ \mathbf{V} \f$
+        /// and \f$ \mathbf{T} \f$ are as described for ``larft``.
+        /// \param trans If true, apply the transpose of the block reflector
+        template<typename Scalar>
+        void larfb(bool trans, int64_t m, int64_t n, int64_t k, const Scalar *v, int64_t ldv,
+                   const Scalar *t, int64_t ldt, Scalar *c, int64_t ldc) {
+            if (m <= 0 || n <= 0 || k <= 0) return;
+
+            // Expand V with its implicit unit diagonal and zero upper triangle
+            std::vector<Scalar> vFull(m * k);
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < k; ++j) {
+                    vFull[i * k + j] = j < i ? v[i * ldv + j] : (j == i ? Scalar(1) : Scalar(0));
+                }
+            }
+
+            std::vector<Scalar> w(k * n), tw(k * n);
+            gemm(true, false, k, n, m, Scalar(1), vFull.data(), k, c, ldc, Scalar(0), w.data(), n);
+            gemm(trans, false, k, n, k, Scalar(1), t, ldt, w.data(), n, Scalar(0), tw.data(), n);
+            gemm(false,
+                 false,
+                 m,
+                 n,
+                 k,
+                 Scalar(-1),
+                 vFull.data(),
+                 k,
+                 tw.data(),
+                 n,
+                 Scalar(1),
+                 c,
+                 ldc);
+        }
+
+        /// \brief Blocked Householder QR factorisation
+        ///
+        /// Each panel of ``qrBlockSize`` columns is factorised with ``geqr2``, and its
+        /// reflectors are applied to the trailing matrix as a single block reflector, so most
+        /// of the work is done by ``gemm``.
+        template<typename Scalar>
+        void geqrfNative(int64_t m, int64_t n, Scalar *a, int64_t lda, Scalar *tau) {
+            constexpr int64_t nb = qrBlockSize;
+            const int64_t k      = std::min(m, n);
+            std::vector<Scalar> work(n), t(nb * nb);
+
+            for (int64_t j = 0; j < k; j += nb) {
+                const int64_t jb = std::min(nb, k - j);
+                Scalar *panel    = a + j * lda + j;
+                geqr2(m - j, jb, panel, lda, tau + j, work.data());
+
+                if (j + jb < n) {
+                    larft(m - j, jb, panel, lda, tau + j, t.data(), jb);
+                    larfb(true, m - j, n - j - jb, jb, panel, lda, t.data(), jb, panel + jb, lda);
+                }
+            }
+        }
+
+        /// \brief Form \f$ \mathbf{Q} \f$ from the reflectors of a QR factorisation, applying
+        /// the block reflectors in reverse order to the identity
+        template<typename Scalar>
+        void orgqrNative(int64_t m, int64_t n, int64_t k, Scalar *a, int64_t lda,
+                         const Scalar *tau) {
+            constexpr int64_t nb = qrBlockSize;
+
+            std::vector<Scalar> v(m * k);
+            for (int64_t i = 0; i < m; ++i) std::copy(a + i * lda, a + i * lda + k, &v[i * k]);
+
+            for (int64_t i = 0; i < m; ++i) {
+                std::fill(a + i * lda, a + i * lda + n, Scalar(0));
+                if (i < n) a[i * lda + i] = Scalar(1);
+            }
+
+            std::vector<Scalar> t(nb * nb);
+            for (int64_t j = (k - 1) / nb * nb; k > 0 && j >= 0; j -= nb) {
+                const int64_t jb    = std::min(nb, k - j);
+                const Scalar *panel = v.data() + j * k + j;
+                larft(m - j, jb, panel, k, tau + j, t.data(), jb);
+                larfb(false, m - j, n - j, jb, panel, k, t.data(), jb, a + j * lda + j, lda);
+            }
+        }
+
+        /// \brief Apply \f$ \mathbf{Q} \f$ or \f$ \mathbf{Q}^T \f$ from a QR factorisation to a
+        /// matrix from the left, one block reflector at a time
+        template<typename Scalar>
+        void ormqrNative(bool trans, int64_t m, int64_t n, int64_t k, const Scalar *a,
+                         int64_t lda, const Scalar *tau, Scalar *c, int64_t ldc) {
+            constexpr int64_t nb    = qrBlockSize;
+            const int64_t numBlocks = (k + nb - 1) / nb;
+            std::vector<Scalar> t(nb * nb);
+
+            // Q^T = H_{k-1} ... H_0 applies the first block first, and Q the last block first
+            for (int64_t block = 0; block < numBlocks; ++block) {
+                const int64_t j     = (trans ? block : numBlocks - 1 - block) * nb;
+                const int64_t jb    = std::min(nb, k - j);
+                const Scalar *panel = a + j * lda + j;
+                larft(m - j, jb, panel, lda, tau + j, t.data(), jb);
+                larfb(trans, m - j, n, jb, panel, lda, t.data(), jb, c + j * ldc, ldc);
+            }
+        }
+    } // namespace detail
+
+    /// \brief Householder QR factorisation
+    ///
+    /// Factorises the \f$ m \times n \f$ row-major matrix \f$ \mathbf{A} \f$ as
+    /// \f$ \mathbf{Q} \mathbf{R} \f$, where \f$ \mathbf{Q} = \mathbf{H}_0 \mathbf{H}_1 \cdots
+    /// \mathbf{H}_{k-1} \f$ is a product of \f$ k = \min(m, n) \f$ Householder reflectors
+    /// \f$ \mathbf{H}_i = \mathbf{I} - \tau_i \mathbf{v}_i \mathbf{v}_i^T \f$. On exit,
+    /// \f$ \mathbf{R} \f$ is stored on and above the diagonal of \f$ \mathbf{A} \f$ and the
+    /// reflectors below it, using the same layout as LAPACK.
+    ///
+    /// The native implementation is blocked, using the compact WY representation of each block
+    /// of reflectors so that the trailing matrix is updated by ``gemm``.
+    /// \tparam Scalar Scalar type
+    /// \param m Rows of \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param tau Pointer to \f$ k \f$ values, which are overwritten by \f$ \tau_i \f$
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void geqrf(int64_t m, int64_t n, Scalar *a, int64_t lda, Scalar *tau,
+               backend::CPU backend = backend::CPU()) {
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (m <= lapackMax && n <= lapackMax && lda <= lapackMax) {
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_sgeqrf(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau);
+                } else {
+                    info = LAPACKE_dgeqrf(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau);
+                }
+
+                LIBRAPID_ASSERT(info == 0, "Invalid argument {} passed to LAPACK geqrf", -info);
+                return;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        detail::geqrfNative(m, n, a, lda, tau);
+    }
+
+    /// \brief Form the orthonormal matrix from a QR factorisation
+    ///
+    /// Overwrites the \f$ m \times n \f$ matrix \f$ \mathbf{A} \f$, which contains the
+    /// reflectors returned by ``geqrf``, with the first \f$ n \f$ columns of
+    /// \f$ \mathbf{Q} = \mathbf{H}_0 \mathbf{H}_1 \cdots \mathbf{H}_{k-1} \f$.
+    /// \tparam Scalar Scalar type
+    /// \param m Rows of \f$ \mathbf{Q} \f$
+    /// \param n Columns of \f$ \mathbf{Q} \f$ (\f$ n \le m \f$)
+    /// \param k Number of reflectors (\f$ k \le n \f$)
+    /// \param a Pointer to the reflectors, which are overwritten by \f$ \mathbf{Q} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param tau Reflector scales returned by ``geqrf``
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void orgqr(int64_t m, int64_t n, int64_t k, Scalar *a, int64_t lda, const Scalar *tau,
+               backend::CPU backend = backend::CPU()) {
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (m <= lapackMax && n <= lapackMax && k <= lapackMax && lda <= lapackMax) {
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_sorgqr(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          static_cast<lapack_int>(k),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau);
+                } else {
+                    info = LAPACKE_dorgqr(LAPACK_ROW_MAJOR,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          static_cast<lapack_int>(k),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau);
+                }
+
+                LIBRAPID_ASSERT(info == 0, "Invalid argument {} passed to LAPACK orgqr", -info);
+                return;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        detail::orgqrNative(m, n, k, a, lda, tau);
+    }
+
+    /// \brief Multiply a matrix by the orthonormal matrix from a QR factorisation
+    ///
+    /// Overwrites the \f$ m \times n \f$ row-major matrix \f$ \mathbf{C} \f$ with
+    /// \f$ \mathbf{Q}^T \mathbf{C} \f$ (if \p trans is true) or \f$ \mathbf{Q} \mathbf{C} \f$,
+    /// without forming \f$ \mathbf{Q} \f$.
+    /// \tparam Scalar Scalar type
+    /// \param trans If true, multiply by \f$ \mathbf{Q}^T \f$
+    /// \param m Rows of \f$ \mathbf{C} \f$
+    /// \param n Columns of \f$ \mathbf{C} \f$
+    /// \param k Number of reflectors
+    /// \param a Pointer to the reflectors returned by ``geqrf``
+    /// \param lda Leading dimension of \p a
+    /// \param tau Reflector scales returned by ``geqrf``
+    /// \param c Pointer to \f$ \mathbf{C} \f$
+    /// \param ldc Leading dimension of \f$ \mathbf{C} \f$
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void ormqr(bool trans, int64_t m, int64_t n, int64_t k, const Scalar *a, int64_t lda,
+               const Scalar *tau, Scalar *c, int64_t ldc, backend::CPU backend = backend::CPU()) {
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (m <= lapackMax && n <= lapackMax && k <= lapackMax && lda <= lapackMax &&
+                ldc <= lapackMax) {
+                const char op = trans ? 'T' : 'N';
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_sormqr(LAPACK_ROW_MAJOR,
+                                          'L',
+                                          op,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          static_cast<lapack_int>(k),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau,
+                                          c,
+                                          static_cast<lapack_int>(ldc));
+                } else {
+                    info = LAPACKE_dormqr(LAPACK_ROW_MAJOR,
+                                          'L',
+                                          op,
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          static_cast<lapack_int>(k),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          tau,
+                                          c,
+                                          static_cast<lapack_int>(ldc));
+                }
+
+                LIBRAPID_ASSERT(info == 0, "Invalid argument {} passed to LAPACK ormqr", -info);
+                return;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        detail::ormqrNative(trans, m, n, k, a, lda, tau, c, ldc);
+    }
+
+    namespace detail {
+        /// \brief Reflectors of a TSQR factorisation
+        ///
+        /// The rows of \f$ \mathbf{A} \f$ are split into blocks, each of which is factorised in
+        /// place. The \f$ n \times n \f$ \f$ \mathbf{R} \f$ factors of the blocks are stacked
+        /// and factorised again, giving the \f$ \mathbf{R} \f$ factor of \f$ \mathbf{A} \f$.
+        template<typename Scalar>
+        struct TsqrFactorisation {
+            int64_t m     = 0;
+            int64_t n     = 0;
+            int64_t parts = 0;
+            std::vector<int64_t> bounds;  // First row of each block, then m
+            std::vector<Scalar> tau;      // Reflector scales of each block
+            std::vector<Scalar> stack;    // Factorised (parts * n) x n stack of R factors
+            std::vector<Scalar> stackTau; // Reflector scales of the stack
+        };
+
+        /// \brief Choose the number of row blocks for a TSQR factorisation
+        ///
+        /// Every block has at least ``tsqrRowsPerColumn`` times as many rows as columns, and
+        /// there is at most one block per thread.
+        /// \return The number of blocks. If this is one, a TSQR factorisation is not worthwhile
+        LIBRAPID_NODISCARD inline int64_t tsqrParts(int64_t m, int64_t n) {
+            const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+            if (numThreads < 2 || n <= 0 ||
+                m * n <= static_cast<int64_t>(global::multithreadThreshold)) {
+                return 1;
+            }
+
+            return std::max(int64_t(1), std::min(numThreads, m / (tsqrRowsPerColumn * n)));
+        }
+
+        /// \brief Tall-skinny QR factorisation of an \f$ m \times n \f$ row-major matrix
+        ///
+        /// Each block of rows is factorised by a different thread, so the factorisation scales
+        /// with the number of rows. The blocks of \f$ \mathbf{A} \f$ are overwritten by their
+        /// reflectors.
+        /// \param parts Number of row blocks, as returned by ``tsqrParts``
+        template<typename Scalar>
+        TsqrFactorisation<Scalar> tsqrFactorise(int64_t m, int64_t n, Scalar *a, int64_t lda,
+                                                int64_t parts) {
+            TsqrFactorisation<Scalar> result;
+            result.m     = m;
+            result.n     = n;
+            result.parts = parts;
+            result.bounds.resize(parts + 1);
+            for (int64_t i = 0; i <= parts; ++i) result.bounds[i] = m * i / parts;
+            result.tau.resize(parts * n);
+            result.stack.resize(parts * n * n, Scalar(0));
+            result.stackTau.resize(n);
+
+            const int64_t *bounds = result.bounds.data();
+            Scalar *tau           = result.tau.data();
+            Scalar *stack         = result.stack.data();
+
+#pragma omp parallel for shared(n, a, lda, parts, bounds, tau, stack) default(none)                \
+  num_threads(int(global::numThreads)) schedule(static)
+            for (int64_t i = 0; i < parts; ++i) {
+                Scalar *block = a + bounds[i] * lda;
+                geqrf(bounds[i + 1] - bounds[i], n, block, lda, tau + i * n);
+
+                for (int64_t r = 0; r < n; ++r) {
+                    std::copy(
+                      block + r * lda + r, block + r * lda + n, stack + (i * n + r) * n + r);
+                }
+            }
+
+            geqrf(parts * n, n, stack, n, result.stackTau.data());
+            return result;
+        }
+
+        /// \brief Apply \f$ \mathbf{Q}^T \f$ from a TSQR factorisation to an
+        /// \f$ m \times \mathrm{nrhs} \f$ row-major matrix
+        ///
+        /// Only the first \f$ n \f$ rows of \f$ \mathbf{Q}^T \mathbf{C} \f$ are computed. They
+        /// overwrite the first \f$ n \f$ rows of \f$ \mathbf{C} \f$, and the remaining rows are
+        /// left in an unspecified state.
+        template<typename Scalar>
+        void tsqrApplyQt(const TsqrFactorisation<Scalar> &f, const Scalar *a, int64_t lda,
+                         int64_t nrhs, Scalar *c, int64_t ldc) {
+            const int64_t n       = f.n;
+            const int64_t parts   = f.parts;
+            const int64_t *bounds = f.bounds.data();
+            const Scalar *tau     = f.tau.data();
+            std::vector<Scalar> stacked(parts * n * nrhs);
+            Scalar *stackedData = stacked.data();
+
+#pragma omp parallel for shared(n, parts, bounds, tau, a, lda, nrhs, c, ldc, stackedData)          \
+  default(none) num_threads(int(global::numThreads)) schedule(static)
+            for (int64_t i = 0; i < parts; ++i) {
+                Scalar *block = c + bounds[i] * ldc;
+                ormqr(true,
+                      bounds[i + 1] - bounds[i],
+                      nrhs,
+                      n,
+                      a + bounds[i] * lda,
+                      lda,
+                      tau + i * n,
+                      block,
+                      ldc);
+
+                for (int64_t r = 0; r < n; ++r) {
+                    std::copy(
+                      block + r * ldc, block + r * ldc + nrhs, stackedData + (i * n + r) * nrhs);
+                }
+            }
+
+            ormqr(true,
+                  parts * n,
+                  nrhs,
+                  n,
+                  f.stack.data(),
+                  n,
+                  f.stackTau.data(),
+                  stackedData,
+                  nrhs);
+            for (int64_t r = 0; r < n; ++r) {
+                std::copy(stackedData + r * nrhs, stackedData + (r + 1) * nrhs, c + r * ldc);
+            }
+        }
+
+        /// \brief Form the \f$ m \times n \f$ orthonormal matrix from a TSQR factorisation
+        ///
+        /// The \f$ \mathbf{Q} \f$ factor of each block is formed by a different thread and
+        /// multiplied by its part of the \f$ \mathbf{Q} \f$ factor of the stack.
+        template<typename Scalar>
+        void tsqrFormQ(const TsqrFactorisation<Scalar> &f, const Scalar *a, int64_t lda,
+                       Scalar *q, int64_t ldq) {
+            const int64_t n       = f.n;
+            const int64_t parts   = f.parts;
+            const int64_t *bounds = f.bounds.data();
+            const Scalar *tau     = f.tau.data();
+
+            std::vector<Scalar> stackQ(f.stack);
+            orgqr(parts * n, n, n, stackQ.data(), n, f.stackTau.data());
+            const Scalar *stackQData = stackQ.data();
+
+#pragma omp parallel for shared(n, parts, bounds, tau, a, lda, q, ldq, stackQData) default(none)   \
+  num_threads(int(global::numThreads)) schedule(static)
+            for (int64_t i = 0; i < parts; ++i) {
+                const int64_t rows = bounds[i + 1] - bounds[i];
+                std::vector<Scalar> blockQ(rows * n);
+                for (int64_t r = 0; r < rows; ++r) {
+                    const Scalar *row = a + (bounds[i] + r) * lda;
+                    std::copy(row, row + n, &blockQ[r * n]);
+                }
+
+                orgqr(rows, n, n, blockQ.data(), n, tau + i * n);
+                gemm(false,
+                     false,
+                     rows,
+                     n,
+                     n,
+                     Scalar(1),
+                     blockQ.data(),
+                     n,
+                     stackQData + i * n * n,
+                     n,
+                     Scalar(0),
+                     q + bounds[i] * ldq,
+                     ldq);
+            }
+        }
+    } // namespace detail
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief QR factorisation of a matrix
+    ///
+    /// Factorises the \f$ m \times n \f$ matrix \f$ \mathbf{A} \f$ as \f$ \mathbf{Q}
+    /// \mathbf{R} \f$, where \f$ \mathbf{Q} \f$ is an \f$ m \times k \f$ matrix with
+    /// orthonormal columns, \f$ \mathbf{R} \f$ is a \f$ k \times n \f$ upper triangular matrix
+    /// and \f$ k = \min(m, n) \f$.
+    ///
+    /// Tall, skinny matrices are factorised with TSQR, which splits the rows between threads.
+    /// Other matrices use a blocked Householder factorisation (see ``linalg::geqrf``).
+    /// \param a The matrix to factorise.
+    /// \return A tuple of \f$ (\mathbf{Q}, \mathbf{R}) \f$
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto qr(T &&a) {
+        using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+        using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+        static_assert(std::is_same_v<Backend, backend::CPU>,
+                      "QR factorisations are only supported on the CPU");
+        static_assert(std::is_floating_point_v<Scalar>,
+                      "QR factorisations are only supported for real floating point types");
+
+        Array<Scalar, Backend> factor(std::forward<T>(a));
+        LIBRAPID_ASSERT(factor.ndim() == 2, "Input must be a matrix. Got: {}", factor.shape());
+
+        const int64_t m = factor.shape()[0];
+        const int64_t n = factor.shape()[1];
+        const int64_t k = std::min(m, n);
+
+        Array<Scalar, Backend> q(Shape({m, k}));
+        Array<Scalar, Backend> r(Shape({k, n}), Scalar(0));
+        Scalar *f     = factor.storage().data();
+        Scalar *qData = q.storage().data();
+        Scalar *rData = r.storage().data();
+
+        const int64_t parts = linalg::detail::tsqrParts(m, n);
+        if (parts > 1) {
+            auto tsqr = linalg::detail::tsqrFactorise(m, n, f, n, parts);
+            linalg::detail::tsqrFormQ(tsqr, f, n, qData, k);
+            f = tsqr.stack.data();
+
+            for (int64_t i = 0; i < k; ++i) {
+                std::copy(f + i * n + i, f + (i + 1) * n, rData + i * n + i);
+            }
+            return std::make_tuple(std::move(q), std::move(r));
+        }
+
+        std::vector<Scalar> tau(k);
+        linalg::geqrf(m, n, f, n, tau.data());
+
+        for (int64_t i = 0; i < k; ++i) {
+            std::copy(f + i * n + i, f + (i + 1) * n, rData + i * n + i);
+        }
+        for (int64_t i = 0; i < m; ++i) std::copy(f + i * n, f + i * n + k, qData + i * k);
+        linalg::orgqr(m, k, k, qData, k, tau.data());
+
+        return std::make_tuple(std::move(q), std::move(r));
+    }
+
+    /// \brief Solve a linear least-squares problem
+    ///
+    /// Returns \f$ \mathbf{X} \f$ minimising \f$ \| \mathbf{A} \mathbf{X} - \mathbf{B}
+    /// \|_2 \f$, where \f$ \mathbf{A} \f$ is an \f$ m \times n \f$ matrix with
+    /// \f$ m \ge n \f$ and full column rank, and \f$ \mathbf{B} \f$ is a vector or a matrix
+    /// with \f$ m \f$ rows.
+    ///
+    /// \f$ \mathbf{A} \f$ is factorised as described for ``qr``, so tall, skinny problems are
+    /// split between threads by rows. \f$ \mathbf{Q} \f$ is never formed.
+    /// \param a The coefficient matrix.
+    /// \param b The right-hand side.
+    /// \return The solution, with \f$ n \f$ rows and the same number of columns as \p b.
+    template<typename First, typename Second>
+        requires(IsArrayType<First>::value && IsArrayType<Second>::value)
+    auto lstsq(First &&a, Second &&b) {
+        using Scalar   = typename typetraits::TypeInfo<std::decay_t<First>>::Scalar;
+        using ScalarB  = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
+        using BackendA = typename typetraits::TypeInfo<std::decay_t<First>>::Backend;
+        using BackendB = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
+        static_assert(std::is_same_v<BackendA, backend::CPU> &&
+                        std::is_same_v<BackendB, backend::CPU>,
+                      "Least-squares solves are only supported on the CPU");
+        static_assert(std::is_same_v<Scalar, ScalarB>, "Scalar types of A and B must match");
+        static_assert(std::is_floating_point_v<Scalar>,
+                      "Least-squares solves are only supported for real floating point types");
+
+        Array<Scalar, BackendA> factor(std::forward<First>(a));
+        Array<Scalar, BackendB> rhs(std::forward<Second>(b));
+        LIBRAPID_ASSERT(factor.ndim() == 2, "Input must be a matrix. Got: {}", factor.shape());
+
+        const int64_t m = factor.shape()[0];
+        const int64_t n = factor.shape()[1];
+        LIBRAPID_ASSERT(m >= n,
+                        "Least-squares problems must have at least as many rows as columns. "
+                        "Got: {}",
+                        factor.shape());
+        LIBRAPID_ASSERT((rhs.ndim() == 1 || rhs.ndim() == 2) && int64_t(rhs.shape()[0]) == m,
+                        "Right-hand side must have {} rows. Got: {}",
+                        m,
+                        rhs.shape());
+
+        const bool isVector = rhs.ndim() == 1;
+        const int64_t nrhs  = isVector ? 1 : int64_t(rhs.shape()[1]);
+        Scalar *f           = factor.storage().data();
+        Scalar *c           = rhs.storage().data();
+
+        // R is stored in the upper triangle of the first n rows of f, with a leading dimension
+        // of n, whichever factorisation is used
+        linalg::detail::TsqrFactorisation<Scalar> tsqr;
+        std::vector<Scalar> tau;
+        const int64_t parts = linalg::detail::tsqrParts(m, n);
+        if (parts > 1) {
+            tsqr = linalg::detail::tsqrFactorise(m, n, f, n, parts);
+            linalg::detail::tsqrApplyQt(tsqr, f, n, nrhs, c, nrhs);
+            f = tsqr.stack.data();
+        } else {
+            tau.resize(n);
+            linalg::geqrf(m, n, f, n, tau.data());
+            linalg::ormqr(true, m, nrhs, n, f, n, tau.data(), c, nrhs);
+        }
+
+        for (int64_t i = 0; i < n; ++i) {
+            LIBRAPID_ASSERT(f[i * n + i] != Scalar(0),
+                            "Matrix does not have full column rank. R({0}, {0}) is zero",
+                            i);
+        }
+
+        Array<Scalar, BackendB> x(isVector ? Shape({n}) : Shape({n, nrhs}));
+        Scalar *xData = x.storage().data();
+        std::copy(c, c + n * nrhs, xData);
+
+        if (n > 0 && nrhs > 0) {
+            cxxblas::trsm(cxxblas::StorageOrder::RowMajor,
+                          cxxblas::Side::Left,
+                          cxxblas::StorageUpLo::Upper,
+                          cxxblas::Transpose::NoTrans,
+                          cxxblas::Diag::NonUnit,
+                          n,
+                          nrhs,
+                          Scalar(1),
+                          f,
+                          n,
+                          xData,
+                          nrhs);
+        }
+
+        return x;
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FACTORISATION_QR_HPP
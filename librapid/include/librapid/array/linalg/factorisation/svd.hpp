@@ -0,0 +1,362 @@
+#ifndef LIBRAPID_ARRAY_LINALG_FACTORISATION_SVD_HPP
+#define LIBRAPID_ARRAY_LINALG_FACTORISATION_SVD_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief Replace the columns of a tall, row-major matrix with an orthonormal basis for
+        /// their span
+        ///
+        /// Overwrites the \f$ m \times n \f$ matrix \f$ \mathbf{A} \f$ (\f$ m \ge n \f$) with the
+        /// \f$ \mathbf{Q} \f$ factor of its QR factorisation, using TSQR when it is worthwhile.
+        /// \param rDiag If not nullptr, overwritten by the diagonal of \f$ \mathbf{R} \f$
+        template<typename Scalar>
+        void orthonormalise(int64_t m, int64_t n, Scalar *a, int64_t lda, Scalar *rDiag) {
+            const int64_t parts = tsqrParts(m, n);
+            if (parts > 1) {
+                auto tsqr = tsqrFactorise(m, n, a, lda, parts);
+                if (rDiag != nullptr) {
+                    for (int64_t j = 0; j < n; ++j) rDiag[j] = tsqr.stack[j * n + j];
+                }
+
+                // Each thread reads the reflectors of its block before overwriting it
+                tsqrFormQ(tsqr, a, lda, a, lda);
+                return;
+            }
+
+            std::vector<Scalar> tau(n);
+            geqrf(m, n, a, lda, tau.data());
+            if (rDiag != nullptr) {
+                for (int64_t j = 0; j < n; ++j) rDiag[j] = a[j * lda + j];
+            }
+            orgqr(m, n, n, a, lda, tau.data());
+        }
+
+        /// \brief Native reduced SVD of a row-major matrix with at least as many rows as
+        /// columns
+        ///
+        /// The right singular vectors are the eigenvectors of the Gram matrix
+        /// \f$ \mathbf{A}^T \mathbf{A} \f$, which is formed by ``gemm``. The left singular
+        /// vectors are found by orthonormalising \f$ \mathbf{A} \mathbf{V} \f$, and the
+        /// singular values are the magnitudes of the diagonal of its \f$ \mathbf{R} \f$ factor.
+        /// Forming the Gram matrix squares the condition number, so singular values much
+        /// smaller than \f$ \sqrt{\epsilon} \sigma_0 \f$ have little relative accuracy.
+        /// \return Zero on success, or the value returned by ``syev`` if it failed
+        template<typename Scalar>
+        int64_t gesvdGram(int64_t m, int64_t n, const Scalar *a, int64_t lda, Scalar *s,
+                          Scalar *u, int64_t ldu, Scalar *vt, int64_t ldvt) {
+            std::vector<Scalar> gram(n * n), w(n);
+            gemm(true, false, n, n, m, Scalar(1), a, lda, a, lda, Scalar(0), gram.data(), n);
+            const int64_t info = syev(true, n, gram.data(), n, w.data());
+            if (info != 0) return info;
+
+            // Eigenvalues are in ascending order, but singular values are in descending order
+            for (int64_t i = 0; i < n; ++i) {
+                for (int64_t j = 0; j < n; ++j) vt[i * ldvt + j] = gram[j * n + n - 1 - i];
+            }
+
+            gemm(false, true, m, n, n, Scalar(1), a, lda, vt, ldvt, Scalar(0), u, ldu);
+            orthonormalise(m, n, u, ldu, s);
+
+            for (int64_t j = 0; j < n; ++j) {
+                if (s[j] >= Scalar(0)) continue;
+                s[j] = -s[j];
+                for (int64_t i = 0; i < m; ++i) u[i * ldu + j] = -u[i * ldu + j];
+            }
+
+            // Rounding can leave neighbouring singular values out of order
+            std::vector<int64_t> order(n);
+            std::iota(order.begin(), order.end(), int64_t(0));
+            std::stable_sort(
+              order.begin(), order.end(), [s](int64_t i, int64_t j) { return s[i] > s[j]; });
+            if (std::is_sorted(order.begin(), order.end())) return 0;
+
+            const std::vector<Scalar> sCopy(s, s + n);
+            std::vector<Scalar> row(n);
+            for (int64_t i = 0; i < m; ++i) {
+                std::copy(u + i * ldu, u + i * ldu + n, row.begin());
+                for (int64_t j = 0; j < n; ++j) u[i * ldu + j] = row[order[j]];
+            }
+
+            std::vector<Scalar> vtCopy(n * n);
+            for (int64_t i = 0; i < n; ++i) {
+                std::copy(vt + i * ldvt, vt + i * ldvt + n, &vtCopy[i * n]);
+            }
+            for (int64_t j = 0; j < n; ++j) {
+                s[j] = sCopy[order[j]];
+                std::copy(&vtCopy[order[j] * n], &vtCopy[order[j] * n] + n, vt + j * ldvt);
+            }
+
+            return 0;
+        }
+
+        /// \brief Native reduced SVD of any row-major matrix
+        ///
+        /// Wide matrices are transposed, so the Gram matrix is always the smaller of
+        /// \f$ \mathbf{A}^T \mathbf{A} \f$ and \f$ \mathbf{A} \mathbf{A}^T \f$.
+        template<typename Scalar>
+        int64_t gesvdNative(int64_t m, int64_t n, const Scalar *a, int64_t lda, Scalar *s,
+                            Scalar *u, int64_t ldu, Scalar *vt, int64_t ldvt) {
+            if (m >= n) return gesvdGram(m, n, a, lda, s, u, ldu, vt, ldvt);
+
+            // A^T = U' S V'^T, so U = V' and V^T = U'^T
+            std::vector<Scalar> at(n * m), uT(n * m), vtT(m * m);
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < n; ++j) at[j * m + i] = a[i * lda + j];
+            }
+
+            const int64_t info = gesvdGram(n, m, at.data(), m, s, uT.data(), m, vtT.data(), m);
+            if (info != 0) return info;
+
+            for (int64_t i = 0; i < m; ++i) {
+                for (int64_t j = 0; j < m; ++j) u[i * ldu + j] = vtT[j * m + i];
+                for (int64_t j = 0; j < n; ++j) vt[i * ldvt + j] = uT[j * m + i];
+            }
+
+            return 0;
+        }
+    } // namespace detail
+
+    /// \brief Reduced singular value decomposition
+    ///
+    /// Computes \f$ \mathbf{A} = \mathbf{U} \mathbf{\Sigma} \mathbf{V}^T \f$ for the
+    /// \f$ m \times n \f$ row-major matrix \f$ \mathbf{A} \f$, where \f$ \mathbf{U} \f$ is
+    /// \f$ m \times k \f$, \f$ \mathbf{V}^T \f$ is \f$ k \times n \f$ and \f$ k = \min(m, n)
+    /// \f$. The singular values are returned in descending order.
+    ///
+    /// If LAPACK is available, its divide-and-conquer SVD (``gesdd``) is used. Otherwise, the
+    /// SVD is computed from the eigendecomposition of the \f$ k \times k \f$ Gram matrix (see
+    /// ``syev``), which is fast but loses relative accuracy in singular values much smaller
+    /// than \f$ \sqrt{\epsilon} \sigma_0 \f$.
+    /// \tparam Scalar Scalar type
+    /// \param m Rows of \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$, which may be destroyed
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param s Pointer to \f$ k \f$ values, overwritten by the singular values
+    /// \param u Pointer to \f$ \mathbf{U} \f$
+    /// \param ldu Leading dimension of \f$ \mathbf{U} \f$
+    /// \param vt Pointer to \f$ \mathbf{V}^T \f$
+    /// \param ldvt Leading dimension of \f$ \mathbf{V}^T \f$
+    /// \param backend Backend to use for computation
+    /// \return Zero on success, or a positive value if the algorithm failed to converge
+    template<typename Scalar>
+    int64_t gesvd(int64_t m, int64_t n, Scalar *a, int64_t lda, Scalar *s, Scalar *u,
+                  int64_t ldu, Scalar *vt, int64_t ldvt, backend::CPU backend = backend::CPU()) {
+#if defined(LIBRAPID_HAS_LAPACK)
+        if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) {
+            // LAPACK takes its dimensions as lapack_int, which may be only 32 bits wide
+            constexpr int64_t lapackMax = std::numeric_limits<lapack_int>::max();
+            if (m <= lapackMax && n <= lapackMax && lda <= lapackMax && ldu <= lapackMax &&
+                ldvt <= lapackMax) {
+                lapack_int info;
+                if constexpr (std::is_same_v<Scalar, float>) {
+                    info = LAPACKE_sgesdd(LAPACK_ROW_MAJOR,
+                                          'S',
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          s,
+                                          u,
+                                          static_cast<lapack_int>(ldu),
+                                          vt,
+                                          static_cast<lapack_int>(ldvt));
+                } else {
+                    info = LAPACKE_dgesdd(LAPACK_ROW_MAJOR,
+                                          'S',
+                                          static_cast<lapack_int>(m),
+                                          static_cast<lapack_int>(n),
+                                          a,
+                                          static_cast<lapack_int>(lda),
+                                          s,
+                                          u,
+                                          static_cast<lapack_int>(ldu),
+                                          vt,
+                                          static_cast<lapack_int>(ldvt));
+                }
+
+                LIBRAPID_ASSERT(info >= 0, "Invalid argument {} passed to LAPACK gesdd", -info);
+                return info;
+            }
+        }
+#endif // LIBRAPID_HAS_LAPACK
+
+        if (m == 0 || n == 0) return 0;
+        return detail::gesvdNative(m, n, static_cast<const Scalar *>(a), lda, s, u, ldu, vt, ldvt);
+    }
+
+    /// \brief Randomised truncated singular value decomposition
+    ///
+    /// Approximates the \p rank largest singular values of the \f$ m \times n \f$ row-major
+    /// matrix \f$ \mathbf{A} \f$, and their singular vectors, without computing the full SVD.
+    /// The range of \f$ \mathbf{A} \f$ is sampled by multiplying it by a Gaussian
+    /// \f$ n \times l \f$ matrix, where \f$ l = \mathrm{rank} + \mathrm{oversample} \f$,
+    /// sharpened by power iterations and orthonormalised by a QR factorisation (TSQR, for tall
+    /// matrices). \f$ \mathbf{A} \f$ is then projected onto this basis and the small
+    /// \f$ l \times n \f$ projection is decomposed with ``gesvd``.
+    ///
+    /// Every product with \f$ \mathbf{A} \f$ uses ``gemm``, so the cost is
+    /// \f$ O(mnl) \f$ rather than \f$ O(mn \min(m, n)) \f$.
+    /// \tparam Scalar Scalar type
+    /// \param m Rows of \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$
+    /// \param rank Number of singular values to compute
+    /// \param oversample Number of extra samples of the range of \f$ \mathbf{A} \f$
+    /// \param powerIterations Number of power iterations. More iterations improve the accuracy
+    /// when the singular values decay slowly
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param s Pointer to \p rank values, overwritten by the singular values
+    /// \param u Pointer to the \f$ m \times \mathrm{rank} \f$ matrix \f$ \mathbf{U} \f$
+    /// \param ldu Leading dimension of \f$ \mathbf{U} \f$
+    /// \param vt Pointer to the \f$ \mathrm{rank} \times n \f$ matrix \f$ \mathbf{V}^T \f$
+    /// \param ldvt Leading dimension of \f$ \mathbf{V}^T \f$
+    /// \param backend Backend to use for computation
+    /// \return Zero on success, or the value returned by ``gesvd`` if it failed
+    template<typename Scalar>
+    int64_t gesvdRandomised(int64_t m, int64_t n, int64_t rank, int64_t oversample,
+                            int64_t powerIterations, const Scalar *a, int64_t lda, Scalar *s,
+                            Scalar *u, int64_t ldu, Scalar *vt, int64_t ldvt,
+                            backend::CPU backend = backend::CPU()) {
+        LIBRAPID_ASSERT(rank >= 0 && rank <= std::min(m, n),
+                        "Rank must be between 0 and {}. Got: {}",
+                        std::min(m, n),
+                        rank);
+        if (rank == 0) return 0;
+
+        const int64_t l = std::min(rank + std::max(oversample, int64_t(0)), std::min(m, n));
+        const bool parallel =
+          n * l > static_cast<int64_t>(global::multithreadThreshold) && global::numThreads > 1;
+
+        // Y = A Omega, with orthonormal columns
+        std::vector<Scalar> omega(n * l), y(m * l);
+        ::librapid::detail::random::fillGaussian(omega.data(), n * l, 0, 1, parallel);
+        gemm(false, false, m, l, n, Scalar(1), a, lda, omega.data(), l, Scalar(0), y.data(), l);
+        detail::orthonormalise(m, l, y.data(), l, static_cast<Scalar *>(nullptr));
+
+        // Power iterations, orthonormalising after every product to preserve small singular
+        // directions
+        std::vector<Scalar> &z = omega;
+        for (int64_t iteration = 0; iteration < powerIterations; ++iteration) {
+            gemm(true, false, n, l, m, Scalar(1), a, lda, y.data(), l, Scalar(0), z.data(), l);
+            detail::orthonormalise(n, l, z.data(), l, static_cast<Scalar *>(nullptr));
+            gemm(false, false, m, l, n, Scalar(1), a, lda, z.data(), l, Scalar(0), y.data(), l);
+            detail::orthonormalise(m, l, y.data(), l, static_cast<Scalar *>(nullptr));
+        }
+
+        // B = Y^T A = U_B S V^T, so A ~ (Y U_B) S V^T
+        std::vector<Scalar> b(l * n), sB(l), uB(l * l), vtB(l * n);
+        gemm(true, false, l, n, m, Scalar(1), y.data(), l, a, lda, Scalar(0), b.data(), n);
+        const int64_t info = gesvd(l, n, b.data(), n, sB.data(), uB.data(), l, vtB.data(), n);
+        if (info != 0) return info;
+
+        gemm(false, false, m, rank, l, Scalar(1), y.data(), l, uB.data(), l, Scalar(0), u, ldu);
+        std::copy(sB.begin(), sB.begin() + rank, s);
+        for (int64_t i = 0; i < rank; ++i) {
+            std::copy(&vtB[i * n], &vtB[i * n] + n, vt + i * ldvt);
+        }
+
+        return 0;
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Singular value decomposition
+    ///
+    /// Returns the reduced SVD \f$ \mathbf{A} = \mathbf{U} \mathbf{\Sigma} \mathbf{V}^T \f$ of
+    /// an \f$ m \times n \f$ matrix, where \f$ \mathbf{U} \f$ is \f$ m \times k \f$,
+    /// \f$ \mathbf{V}^T \f$ is \f$ k \times n \f$ and \f$ k = \min(m, n) \f$. See
+    /// ``linalg::gesvd``.
+    ///
+    /// If only the largest few singular values are needed, ``svdRandomised`` is much faster.
+    /// \param a The matrix to decompose.
+    /// \return A tuple of \f$ (\mathbf{U}, \mathbf{\sigma}, \mathbf{V}^T) \f$, with the
+    /// singular values \f$ \mathbf{\sigma} \f$ in descending order
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto svd(T &&a) {
+        using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+        using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+        static_assert(std::is_same_v<Backend, backend::CPU>,
+                      "Singular value decompositions are only supported on the CPU");
+        static_assert(std::is_floating_point_v<Scalar>,
+                      "Singular value decompositions are only supported for real floating "
+                      "point types");
+
+        Array<Scalar, Backend> input(std::forward<T>(a));
+        LIBRAPID_ASSERT(input.ndim() == 2, "Input must be a matrix. Got: {}", input.shape());
+
+        const int64_t m = input.shape()[0];
+        const int64_t n = input.shape()[1];
+        const int64_t k = std::min(m, n);
+
+        Array<Scalar, Backend> u(Shape({m, k}));
+        Array<Scalar, Backend> s(Shape({k}));
+        Array<Scalar, Backend> vt(Shape({k, n}));
+        const int64_t info = linalg::gesvd(m,
+                                           n,
+                                           input.storage().data(),
+                                           n,
+                                           s.storage().data(),
+                                           u.storage().data(),
+                                           k,
+                                           vt.storage().data(),
+                                           n);
+        LIBRAPID_ASSERT(info == 0, "Singular value decomposition failed to converge");
+
+        return std::make_tuple(std::move(u), std::move(s), std::move(vt));
+    }
+
+    /// \brief Randomised truncated singular value decomposition
+    ///
+    /// Approximates the \p rank largest singular values of an \f$ m \times n \f$ matrix, and
+    /// their singular vectors. This is much faster than ``svd`` when \p rank is small compared
+    /// to \f$ m \f$ and \f$ n \f$, for example when computing the leading principal components
+    /// of a large data set. See ``linalg::gesvdRandomised``.
+    /// \param a The matrix to decompose.
+    /// \param rank Number of singular values to compute.
+    /// \param oversample Number of extra samples of the range of \p a.
+    /// \param powerIterations Number of power iterations.
+    /// \return A tuple of \f$ (\mathbf{U}, \mathbf{\sigma}, \mathbf{V}^T) \f$, where
+    /// \f$ \mathbf{U} \f$ is \f$ m \times \mathrm{rank} \f$ and \f$ \mathbf{V}^T \f$ is
+    /// \f$ \mathrm{rank} \times n \f$
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    auto svdRandomised(T &&a, int64_t rank, int64_t oversample = 10,
+                       int64_t powerIterations = 2) {
+        using Scalar  = typename typetraits::TypeInfo<std::decay_t<T>>::Scalar;
+        using Backend = typename typetraits::TypeInfo<std::decay_t<T>>::Backend;
+        static_assert(std::is_same_v<Backend, backend::CPU>,
+                      "Singular value decompositions are only supported on the CPU");
+        static_assert(std::is_floating_point_v<Scalar>,
+                      "Singular value decompositions are only supported for real floating "
+                      "point types");
+
+        const Array<Scalar, Backend> input(std::forward<T>(a));
+        LIBRAPID_ASSERT(input.ndim() == 2, "Input must be a matrix. Got: {}", input.shape());
+
+        const int64_t m = input.shape()[0];
+        const int64_t n = input.shape()[1];
+
+        Array<Scalar, Backend> u(Shape({m, rank}));
+        Array<Scalar, Backend> s(Shape({rank}));
+        Array<Scalar, Backend> vt(Shape({rank, n}));
+        const int64_t info = linalg::gesvdRandomised(m,
+                                                     n,
+                                                     rank,
+                                                     oversample,
+                                                     powerIterations,
+                                                     input.storage().data(),
+                                                     n,
+                                                     s.storage().data(),
+                                                     u.storage().data(),
+                                                     rank,
+                                                     vt.storage().data(),
+                                                     n);
+        LIBRAPID_ASSERT(info == 0, "Singular value decomposition failed to converge");
+
+        return std::make_tuple(std::move(u), std::move(s), std::move(vt));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_FACTORISATION_SVD_HPP
@@ -0,0 +1,107 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_ASUM_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_ASUM_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief Sum of the absolute values of a contiguous vector on a single thread
+        ///
+        /// For ``float`` and ``double``, four independent packet accumulators are used so that
+        /// consecutive additions do not wait on each other.
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \return \f$ \sum_{i=0}^{n-1} |x_i| \f$
+        template<typename Scalar>
+        LIBRAPID_NODISCARD Scalar asumContiguous(int64_t n, const Scalar *__restrict x) {
+            Scalar result(0);
+            int64_t i = 0;
+
+            if constexpr (hasLevel1Kernels<Scalar>) {
+                using Packet                  = xsimd::batch<Scalar>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                if (n >= packetWidth) {
+                    Packet acc[4] = {Packet(Scalar(0)), Packet(Scalar(0)), Packet(Scalar(0)),
+                                     Packet(Scalar(0))};
+
+                    for (; i + 4 * packetWidth <= n; i += 4 * packetWidth) {
+                        for (int64_t j = 0; j < 4; ++j) {
+                            acc[j] += xsimd::abs(xsimd::load_unaligned(x + i + j * packetWidth));
+                        }
+                    }
+
+                    for (; i + packetWidth <= n; i += packetWidth) {
+                        acc[0] += xsimd::abs(xsimd::load_unaligned(x + i));
+                    }
+
+                    result = xsimd::reduce_add((acc[0] + acc[1]) + (acc[2] + acc[3]));
+                }
+            }
+
+            for (; i < n; ++i) result += ::librapid::abs(x[i]);
+            return result;
+        }
+    } // namespace detail
+
+    /// \brief Sum of absolute values
+    ///
+    /// Computes \f$ \sum_{i=0}^{n-1} |x_i| \f$. As in BLAS, complex elements contribute
+    /// \f$ |\mathrm{Re}(x_i)| + |\mathrm{Im}(x_i)| \f$.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use a BLAS library when one is available and
+    /// the length fits in BLAS' 32-bit integers, and an xsimd implementation split between
+    /// threads otherwise. All other cases fall back to cxxblas' generic implementation.
+    /// \tparam Int Integer type for the vector length and increment
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \param n Number of elements
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param backend Backend to use for computation
+    /// \return The sum of the absolute values
+    template<typename Int, typename X>
+    LIBRAPID_NODISCARD auto asum(Int n, X *x, Int incX, backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<X>;
+        using Result = detail::AbsType<Scalar>;
+
+        if constexpr (detail::hasLevel1Kernels<Scalar>) {
+            if (incX == 1) {
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                    Scalar result;
+                    cxxblas::asum(static_cast<int32_t>(n), x, 1, result);
+                    return result;
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                return detail::reduceChunks<Scalar>(
+                  static_cast<int64_t>(n),
+                  [x](int64_t begin, int64_t end) {
+                      return detail::asumContiguous(end - begin, x + begin);
+                  },
+                  std::plus<Scalar>());
+            }
+        }
+
+        Result result(0);
+        cxxblas::asum(n, x, incX, result);
+        return result;
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Sum of the absolute values of the elements of an array
+    ///
+    /// The array is treated as a flat vector. See ``linalg::asum``.
+    /// \param array The input
+    /// \return \f$ \sum_i |a_i| \f$
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    LIBRAPID_NODISCARD auto asum(const T &array) {
+        const auto &input = linalg::detail::evaluateArray(array);
+        return linalg::asum(
+          static_cast<int64_t>(input.shape().size()), input.storage().data(), int64_t(1));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_ASUM_HPP
@@ -0,0 +1,187 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_AXPY_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_AXPY_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief \f$ \mathbf{y} \gets \alpha \mathbf{x} + \beta \mathbf{y} \f$ for contiguous
+        /// vectors on a single thread
+        ///
+        /// If \p HasBeta is false, \f$ \beta \f$ is taken to be one. If \f$ \beta \f$ is zero,
+        /// \f$ \mathbf{y} \f$ is not read, so any NaNs it contains are overwritten.
+        /// \tparam HasBeta Whether to scale \f$ \mathbf{y} \f$ by \p beta
+        /// \tparam Scalar Scalar type of the vectors
+        /// \param n Number of elements
+        /// \param alpha Scaling factor for \f$ \mathbf{x} \f$
+        /// \param x Pointer to \f$ \mathbf{x} \f$
+        /// \param beta Scaling factor for \f$ \mathbf{y} \f$
+        /// \param y Pointer to \f$ \mathbf{y} \f$
+        template<bool HasBeta, typename Scalar>
+        void axpbyContiguous(int64_t n, Scalar alpha, const Scalar *x, Scalar beta, Scalar *y) {
+            if (HasBeta && beta == Scalar(0)) {
+                for (int64_t i = 0; i < n; ++i) y[i] = alpha * x[i];
+                return;
+            }
+
+            int64_t i = 0;
+            if constexpr (hasLevel1Kernels<Scalar>) {
+                using Packet                  = xsimd::batch<Scalar>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                const Packet alphaPacket(alpha);
+                const Packet betaPacket(beta);
+                for (; i + packetWidth <= n; i += packetWidth) {
+                    Packet py = xsimd::load_unaligned(y + i);
+                    if constexpr (HasBeta) py *= betaPacket;
+                    py = xsimd::fma(alphaPacket, xsimd::load_unaligned(x + i), py);
+                    py.store_unaligned(y + i);
+                }
+            }
+
+            for (; i < n; ++i) y[i] = alpha * x[i] + (HasBeta ? beta * y[i] : y[i]);
+        }
+    } // namespace detail
+
+    /// \brief Vector-scalar product and sum
+    ///
+    /// Computes \f$ \mathbf{y} \gets \alpha \mathbf{x} + \mathbf{y} \f$ in place.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use a BLAS library when one is available and
+    /// the length fits in BLAS' 32-bit integers, and an xsimd implementation split between
+    /// threads otherwise. All other cases fall back to cxxblas' generic implementation.
+    /// \tparam Int Integer type for the vector length and increments
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \tparam Y Type of \f$ \mathbf{y} \f$
+    /// \param n Number of elements in each vector
+    /// \param alpha Scaling factor for \f$ \mathbf{x} \f$
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$
+    /// \param incY Increment of \f$ \mathbf{y} \f$
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename X, typename Y>
+    void axpy(Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY,
+              backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<Y>;
+
+        if constexpr (detail::hasLevel1Kernels<Scalar> &&
+                      std::is_same_v<std::remove_cv_t<X>, Scalar>) {
+            if (incX == 1 && incY == 1) {
+                const Scalar a = static_cast<Scalar>(alpha);
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                    cxxblas::axpy(static_cast<int32_t>(n), a, x, 1, y, 1);
+                    return;
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                detail::forEachChunk(
+                  static_cast<int64_t>(n), [a, x, y](int64_t begin, int64_t end) {
+                      detail::axpbyContiguous<false>(
+                        end - begin, a, x + begin, Scalar(1), y + begin);
+                  });
+                return;
+            }
+        }
+
+        cxxblas::axpy(n, alpha, x, incX, y, incY);
+    }
+
+    /// \brief Scaled vector sum
+    ///
+    /// Computes \f$ \mathbf{y} \gets \alpha \mathbf{x} + \beta \mathbf{y} \f$ in place, in a
+    /// single pass over the vectors. If \f$ \beta \f$ is zero, \f$ \mathbf{y} \f$ is not read.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use an xsimd implementation split between
+    /// threads. All other cases fall back to cxxblas, which uses the ``axpby`` extension of a
+    /// BLAS library if one is available.
+    /// \tparam Int Integer type for the vector length and increments
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \tparam Beta Type of \f$ \beta \f$
+    /// \tparam Y Type of \f$ \mathbf{y} \f$
+    /// \param n Number of elements in each vector
+    /// \param alpha Scaling factor for \f$ \mathbf{x} \f$
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param beta Scaling factor for \f$ \mathbf{y} \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$
+    /// \param incY Increment of \f$ \mathbf{y} \f$
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename X, typename Beta, typename Y>
+    void axpby(Int n, Alpha alpha, X *x, Int incX, Beta beta, Y *y, Int incY,
+               backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<Y>;
+
+        if constexpr (detail::hasLevel1Kernels<Scalar> &&
+                      std::is_same_v<std::remove_cv_t<X>, Scalar>) {
+            if (incX == 1 && incY == 1) {
+                const Scalar a = static_cast<Scalar>(alpha);
+                const Scalar b = static_cast<Scalar>(beta);
+                detail::forEachChunk(
+                  static_cast<int64_t>(n), [a, x, b, y](int64_t begin, int64_t end) {
+                      detail::axpbyContiguous<true>(end - begin, a, x + begin, b, y + begin);
+                  });
+                return;
+            }
+        }
+
+        cxxblas::axpby(n, alpha, x, incX, beta, y, incY);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Add a multiple of one array to another, in place
+    ///
+    /// Computes \f$ \mathbf{y} \gets \alpha \mathbf{x} + \mathbf{y} \f$ without creating any
+    /// temporary arrays. See ``linalg::axpy``.
+    /// \param alpha Scaling factor for \p x
+    /// \param x The array to add. May be any array type
+    /// \param y The array to update. Must have the same shape as \p x
+    template<typename Alpha, typename T, typename ShapeType, typename StorageType>
+        requires(IsArrayType<T>::value)
+    void axpy(Alpha alpha, const T &x, array::ArrayContainer<ShapeType, StorageType> &y) {
+        linalg::detail::checkLevel1Backend<array::ArrayContainer<ShapeType, StorageType>>();
+        const auto &input = linalg::detail::evaluateArray(x);
+        LIBRAPID_ASSERT(input.shape() == y.shape(),
+                        "Arrays must have the same shape. Got {} and {}",
+                        input.shape(),
+                        y.shape());
+        linalg::axpy(static_cast<int64_t>(y.shape().size()),
+                     alpha,
+                     input.storage().data(),
+                     int64_t(1),
+                     y.storage().data(),
+                     int64_t(1));
+    }
+
+    /// \brief Replace an array with a linear combination of itself and another array, in place
+    ///
+    /// Computes \f$ \mathbf{y} \gets \alpha \mathbf{x} + \beta \mathbf{y} \f$ without creating
+    /// any temporary arrays. See ``linalg::axpby``.
+    /// \param alpha Scaling factor for \p x
+    /// \param x The array to add. May be any array type
+    /// \param beta Scaling factor for \p y
+    /// \param y The array to update. Must have the same shape as \p x
+    template<typename Alpha, typename T, typename Beta, typename ShapeType, typename StorageType>
+        requires(IsArrayType<T>::value)
+    void axpby(Alpha alpha, const T &x, Beta beta,
+               array::ArrayContainer<ShapeType, StorageType> &y) {
+        linalg::detail::checkLevel1Backend<array::ArrayContainer<ShapeType, StorageType>>();
+        const auto &input = linalg::detail::evaluateArray(x);
+        LIBRAPID_ASSERT(input.shape() == y.shape(),
+                        "Arrays must have the same shape. Got {} and {}",
+                        input.shape(),
+                        y.shape());
+        linalg::axpby(static_cast<int64_t>(y.shape().size()),
+                      alpha,
+                      input.storage().data(),
+                      int64_t(1),
+                      beta,
+                      y.storage().data(),
+                      int64_t(1));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_AXPY_HPP
@@ -0,0 +1,115 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_COMMON_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_COMMON_HPP
+
+namespace librapid::linalg::detail {
+    /// The type of the magnitude of a \p Scalar, such as ``float`` for ``Complex<float>``
+    template<typename Scalar>
+    using AbsType = decltype(::librapid::abs(std::declval<Scalar>()));
+
+    /// Whether level 1 operations on contiguous vectors of \p Scalar have native xsimd kernels
+    template<typename Scalar>
+    constexpr bool hasLevel1Kernels =
+      std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>;
+
+    /// \brief Size of the chunks a level 1 operation on \p n elements is split into
+    ///
+    /// The size is rounded up so that every chunk starts on a cache line boundary.
+    /// \param n Number of elements
+    /// \param numThreads Number of threads to split the work between
+    /// \return The number of elements in each chunk (except, perhaps, the last)
+    LIBRAPID_NODISCARD inline int64_t level1ChunkSize(int64_t n, int64_t numThreads) {
+        return ((n + numThreads - 1) / numThreads + 63) / 64 * 64;
+    }
+
+    /// \brief Reduce \p n elements, split between threads if there are more than
+    /// ``global::multithreadThreshold``
+    ///
+    /// The partial results are combined in a pairwise tree, with the earlier chunk always on
+    /// the left, so the result does not depend on the order in which threads finish.
+    /// \tparam Result Type of the result
+    /// \param n Number of elements
+    /// \param kernel Reduces the elements in ``[begin, end)`` on a single thread
+    /// \param combine Combines two partial results
+    /// \param parallel If false, the elements are always reduced on the calling thread. Use
+    /// this inside a parallel region
+    /// \return The reduction of all \p n elements
+    template<typename Result, typename Kernel, typename Combine>
+    LIBRAPID_NODISCARD Result reduceChunks(int64_t n, const Kernel &kernel, const Combine &combine,
+                                           bool parallel = true) {
+        const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+        if (!parallel || numThreads < 2 ||
+            n <= static_cast<int64_t>(global::multithreadThreshold)) {
+            return kernel(int64_t(0), n);
+        }
+
+        const int64_t chunkSize = level1ChunkSize(n, numThreads);
+        const int64_t numChunks = (n + chunkSize - 1) / chunkSize;
+
+        std::vector<Result> partials(numChunks);
+
+#pragma omp parallel for shared(n, kernel, partials, chunkSize, numChunks) default(none)           \
+  num_threads(int(numThreads))
+        for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+            const int64_t begin = chunk * chunkSize;
+            partials[chunk]     = kernel(begin, std::min(n, begin + chunkSize));
+        }
+
+        for (int64_t stride = 1; stride < numChunks; stride *= 2) {
+            for (int64_t i = 0; i + stride < numChunks; i += 2 * stride) {
+                partials[i] = combine(partials[i], partials[i + stride]);
+            }
+        }
+
+        return partials[0];
+    }
+
+    /// \brief Apply \p kernel to \p n elements, split between threads if there are more than
+    /// ``global::multithreadThreshold``
+    /// \param n Number of elements
+    /// \param kernel Processes the elements in ``[begin, end)`` on a single thread
+    template<typename Kernel>
+    void forEachChunk(int64_t n, const Kernel &kernel) {
+        const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+        if (numThreads < 2 || n <= static_cast<int64_t>(global::multithreadThreshold)) {
+            kernel(int64_t(0), n);
+            return;
+        }
+
+        const int64_t chunkSize = level1ChunkSize(n, numThreads);
+        const int64_t numChunks = (n + chunkSize - 1) / chunkSize;
+
+#pragma omp parallel for shared(n, kernel, chunkSize, numChunks) default(none)                     \
+  num_threads(int(numThreads))
+        for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+            const int64_t begin = chunk * chunkSize;
+            kernel(begin, std::min(n, begin + chunkSize));
+        }
+    }
+
+    /// Check at compile time that level 1 operations support arrays of type \p T
+    template<typename T>
+    constexpr void checkLevel1Backend() {
+        static_assert(std::is_same_v<typename typetraits::TypeInfo<T>::Backend, backend::CPU>,
+                      "Level 1 operations are only supported on the CPU");
+    }
+
+    /// \brief Evaluate \p array into an Array, unless it is one already
+    ///
+    /// Level 1 operations work on the contiguous data of an Array, so lazily-evaluated
+    /// Functions and array views are evaluated first.
+    /// \param array The input
+    /// \return A reference to \p array if it is an Array, otherwise a new Array holding its
+    /// values
+    template<typename T>
+    LIBRAPID_NODISCARD decltype(auto) evaluateArray(const T &array) {
+        checkLevel1Backend<T>();
+        if constexpr (typetraits::TypeInfo<T>::type ==
+                      ::librapid::detail::LibRapidType::ArrayContainer) {
+            return (array);
+        } else {
+            return array.eval();
+        }
+    }
+} // namespace librapid::linalg::detail
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_COMMON_HPP
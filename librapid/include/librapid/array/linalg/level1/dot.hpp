@@ -0,0 +1,137 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// The type in which products of \p Scalar values are accumulated. ``bfloat16`` has too
+        /// few significant bits to accumulate in, so it uses ``float``
+        template<typename Scalar>
+        using DotAccumulator = std::conditional_t<std::is_same_v<Scalar, bfloat16>, float, Scalar>;
+
+        /// \brief Dot product of two contiguous vectors on a single thread
+        ///
+        /// For ``float``, ``double`` and ``bfloat16``, four independent packet accumulators are
+        /// used so that consecutive fused multiply-adds do not wait on each other. ``bfloat16``
+        /// values are widened to ``float`` as they are loaded.
+        /// \tparam Scalar Scalar type of the vectors
+        /// \param n Number of elements
+        /// \param x Pointer to the first vector
+        /// \param y Pointer to the second vector
+        /// \return \f$ \sum_{i=0}^{n-1} x_i y_i \f$
+        template<typename Scalar>
+        LIBRAPID_NODISCARD DotAccumulator<Scalar>
+        dotContiguous(int64_t n, const Scalar *__restrict x, const Scalar *__restrict y) {
+            using Accumulator = DotAccumulator<Scalar>;
+
+            Accumulator result(0);
+            int64_t i = 0;
+
+            if constexpr (std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double> ||
+                          std::is_same_v<Scalar, bfloat16>) {
+                using Packet                  = xsimd::batch<Accumulator>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                const auto load = [](const Scalar *ptr) -> Packet {
+                    if constexpr (std::is_same_v<Scalar, bfloat16>) {
+                        return Bfloat16Packet::load_unaligned(ptr).values();
+                    } else {
+                        return xsimd::load_unaligned(ptr);
+                    }
+                };
+
+                if (n >= packetWidth) {
+                    Packet acc[4] = {Packet(Accumulator(0)),
+                                     Packet(Accumulator(0)),
+                                     Packet(Accumulator(0)),
+                                     Packet(Accumulator(0))};
+
+                    for (; i + 4 * packetWidth <= n; i += 4 * packetWidth) {
+                        for (int64_t j = 0; j < 4; ++j) {
+                            const Packet px = load(x + i + j * packetWidth);
+                            const Packet py = load(y + i + j * packetWidth);
+                            acc[j]          = xsimd::fma(px, py, acc[j]);
+                        }
+                    }
+
+                    for (; i + packetWidth <= n; i += packetWidth) {
+                        acc[0] = xsimd::fma(load(x + i), load(y + i), acc[0]);
+                    }
+
+                    result = xsimd::reduce_add((acc[0] + acc[1]) + (acc[2] + acc[3]));
+                }
+            }
+
+            for (; i < n; ++i) {
+                result += static_cast<Accumulator>(x[i]) * static_cast<Accumulator>(y[i]);
+            }
+            return result;
+        }
+
+        /// \brief Dot product of two contiguous vectors, split between threads if the vectors
+        /// are longer than ``global::multithreadThreshold``
+        ///
+        /// The partial results are combined in a pairwise tree, so the result does not depend on
+        /// the order in which threads finish.
+        /// \see dotContiguous
+        template<typename Scalar>
+        LIBRAPID_NODISCARD DotAccumulator<Scalar> dotParallel(int64_t n, const Scalar *x,
+                                                              const Scalar *y) {
+            return reduceChunks<DotAccumulator<Scalar>>(
+              n,
+              [x, y](int64_t begin, int64_t end) {
+                  return dotContiguous(end - begin, x + begin, y + begin);
+              },
+              std::plus<DotAccumulator<Scalar>>());
+        }
+    } // namespace detail
+
+    /// \brief Vector dot product
+    ///
+    /// Computes \f$ \mathbf{x} \cdot \mathbf{y} = \sum_{i=0}^{n-1} x_i y_i \f$. No elements are
+    /// conjugated, even for complex vectors.
+    ///
+    /// Contiguous vectors of the same type use a BLAS library when one is available and the
+    /// length fits in BLAS' 32-bit integers, and an xsimd implementation split between threads
+    /// otherwise. All other cases fall back to cxxblas' generic implementation. Contiguous
+    /// ``bfloat16`` vectors are accumulated in single precision and rounded once at the end.
+    /// \tparam Int Integer type for the vector length and increments
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \tparam Y Type of \f$ \mathbf{y} \f$
+    /// \param n Number of elements in each vector
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$
+    /// \param incY Increment of \f$ \mathbf{y} \f$
+    /// \param backend Backend to use for computation
+    /// \return The dot product
+    template<typename Int, typename X, typename Y>
+    LIBRAPID_NODISCARD auto dot(Int n, X *x, Int incX, Y *y, Int incY,
+                                backend::CPU backend = backend::CPU()) {
+        using ScalarX = std::remove_cv_t<X>;
+        using ScalarY = std::remove_cv_t<Y>;
+        using Result  = decltype(std::declval<ScalarX>() * std::declval<ScalarY>());
+
+        if constexpr (std::is_same_v<ScalarX, ScalarY>) {
+            if (incX == 1 && incY == 1) {
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if constexpr (std::is_same_v<ScalarX, float> || std::is_same_v<ScalarX, double>) {
+                    if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                        ScalarX result;
+                        cxxblas::dot(static_cast<int32_t>(n), x, 1, y, 1, result);
+                        return Result(result);
+                    }
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                return Result(detail::dotParallel<ScalarX>(static_cast<int64_t>(n), x, y));
+            }
+        }
+
+        Result result(0);
+        cxxblas::dotu(n, x, incX, y, incY, result);
+        return result;
+    }
+} // namespace librapid::linalg
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_DOT_HPP
@@ -0,0 +1,201 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_IAMAX_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_IAMAX_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Number of elements ``iamaxContiguous`` searches at a time. Each block is small
+        /// enough to stay in L1 cache, so finding the position of its largest element after
+        /// finding its value does not read memory a second time.
+        constexpr int64_t iamaxBlockSize = 2048;
+
+        /// \brief Largest absolute value in a contiguous vector on a single thread
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \return \f$ \max_i |x_i| \f$, zero if \p n is zero, or NaN if any element is NaN
+        template<typename Scalar>
+        LIBRAPID_NODISCARD AbsType<Scalar> maxAbsContiguous(int64_t n,
+                                                            const Scalar *__restrict x) {
+            AbsType<Scalar> result(0);
+            int64_t i = 0;
+
+            if constexpr (hasLevel1Kernels<Scalar>) {
+                using Packet                  = xsimd::batch<Scalar>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                if (n >= packetWidth) {
+                    Packet acc[4] = {Packet(Scalar(0)), Packet(Scalar(0)), Packet(Scalar(0)),
+                                     Packet(Scalar(0))};
+
+                    // xsimd::max does not propagate NaN, so NaNs are tracked separately
+                    typename Packet::batch_bool_type unordered(false);
+
+                    for (; i + 4 * packetWidth <= n; i += 4 * packetWidth) {
+                        for (int64_t j = 0; j < 4; ++j) {
+                            const Packet value =
+                              xsimd::abs(xsimd::load_unaligned(x + i + j * packetWidth));
+                            acc[j]    = xsimd::max(acc[j], value);
+                            unordered = unordered | xsimd::isnan(value);
+                        }
+                    }
+
+                    for (; i + packetWidth <= n; i += packetWidth) {
+                        const Packet value = xsimd::abs(xsimd::load_unaligned(x + i));
+                        acc[0]             = xsimd::max(acc[0], value);
+                        unordered          = unordered | xsimd::isnan(value);
+                    }
+
+                    if (xsimd::any(unordered)) return std::numeric_limits<Scalar>::quiet_NaN();
+
+                    result = xsimd::reduce_max(
+                      xsimd::max(xsimd::max(acc[0], acc[1]), xsimd::max(acc[2], acc[3])));
+                }
+            }
+
+            for (; i < n; ++i) {
+                const AbsType<Scalar> value = ::librapid::abs(x[i]);
+                if (::librapid::isNaN(value)) return value;
+                result = std::max(result, value);
+            }
+            return result;
+        }
+
+        /// \brief Position and value of the element with the largest absolute value in a
+        /// contiguous vector, on a single thread
+        ///
+        /// The vector is searched in blocks of ``iamaxBlockSize`` elements. The largest
+        /// absolute value in each block is found with packet instructions, and the block is
+        /// only searched again for its position if it beats every earlier block. As in
+        /// reference BLAS, the first NaN is treated as larger than every other element.
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \return The index of the first element with the largest absolute value (or the
+        /// first NaN), and that absolute value. If \p n is zero, the index is zero and the value
+        /// is -1
+        template<typename Scalar>
+        LIBRAPID_NODISCARD std::pair<int64_t, AbsType<Scalar>>
+        iamaxContiguous(int64_t n, const Scalar *__restrict x) {
+            std::pair<int64_t, AbsType<Scalar>> best(0, AbsType<Scalar>(-1));
+            for (int64_t begin = 0; begin < n; begin += iamaxBlockSize) {
+                const int64_t end              = std::min(begin + iamaxBlockSize, n);
+                const AbsType<Scalar> blockMax = maxAbsContiguous(end - begin, x + begin);
+
+                // No earlier block contained a NaN, so the first one in this block is the result
+                if (::librapid::isNaN(blockMax)) {
+                    int64_t i = begin;
+                    while (i + 1 < end && !::librapid::isNaN(::librapid::abs(x[i]))) ++i;
+                    return {i, blockMax};
+                }
+
+                if (blockMax > best.second) {
+                    int64_t i = begin;
+                    while (i + 1 < end && ::librapid::abs(x[i]) != blockMax) ++i;
+                    best = {i, blockMax};
+                }
+            }
+            return best;
+        }
+
+        /// \brief Largest absolute value in a contiguous vector, split between threads if the
+        /// vector is longer than ``global::multithreadThreshold`` and \p parallel is true
+        /// \see maxAbsContiguous
+        template<typename Scalar>
+        LIBRAPID_NODISCARD AbsType<Scalar> maxAbsParallel(int64_t n, const Scalar *x,
+                                                          bool parallel = true) {
+            using Result = AbsType<Scalar>;
+            return reduceChunks<Result>(
+              n,
+              [x](int64_t begin, int64_t end) {
+                  return maxAbsContiguous(end - begin, x + begin);
+              },
+              [](const Result &a, const Result &b) {
+                  if (::librapid::isNaN(a)) return a;
+                  return (::librapid::isNaN(b) || b > a) ? b : a;
+              },
+              parallel);
+        }
+
+        /// \brief Position and value of the element with the largest absolute value in a
+        /// contiguous vector, split between threads if the vector is longer than
+        /// ``global::multithreadThreshold``
+        /// \see iamaxContiguous
+        template<typename Scalar>
+        LIBRAPID_NODISCARD std::pair<int64_t, AbsType<Scalar>> iamaxParallel(int64_t n,
+                                                                             const Scalar *x) {
+            using Result = std::pair<int64_t, AbsType<Scalar>>;
+            return reduceChunks<Result>(
+              n,
+              [x](int64_t begin, int64_t end) {
+                  Result result = iamaxContiguous(end - begin, x + begin);
+                  result.first += begin;
+                  return result;
+              },
+              [](const Result &a, const Result &b) {
+                  if (::librapid::isNaN(a.second)) return a;
+                  return (::librapid::isNaN(b.second) || b.second > a.second) ? b : a;
+              });
+        }
+    } // namespace detail
+
+    /// \brief Index of the element with the largest absolute value
+    ///
+    /// Returns the zero-based index of the first element of \f$ \mathbf{x} \f$ with the
+    /// largest absolute value, or zero if \p n is zero.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use a BLAS library when one is available and
+    /// the length fits in BLAS' 32-bit integers, and an xsimd implementation split between
+    /// threads otherwise. All other cases fall back to cxxblas' generic implementation.
+    /// \tparam Int Integer type for the vector length and increment
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \param n Number of elements
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param backend Backend to use for computation
+    /// \return The index of the element with the largest absolute value
+    template<typename Int, typename X>
+    LIBRAPID_NODISCARD Int iamax(Int n, X *x, Int incX, backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<X>;
+        if (n < 1) return 0;
+
+        if constexpr (detail::hasLevel1Kernels<Scalar>) {
+            if (incX == 1) {
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                    int32_t result;
+                    cxxblas::iamax(static_cast<int32_t>(n), x, 1, result);
+                    return static_cast<Int>(result);
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                return static_cast<Int>(detail::iamaxParallel(static_cast<int64_t>(n), x).first);
+            }
+        }
+
+        Int result = 0;
+        cxxblas::iamax(n, x, incX, result);
+        return result;
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Return the (linear) index of the element of an array with the largest absolute
+    /// value
+    ///
+    /// The array is treated as a flat vector. If the largest absolute value occurs more than
+    /// once, the index of the first occurrence is returned. See ``linalg::iamax``.
+    /// \param array The input to search
+    /// \return The index of the element with the largest absolute value
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    LIBRAPID_NODISCARD int64_t argmaxAbs(const T &array) {
+        const auto &input  = linalg::detail::evaluateArray(array);
+        const int64_t size = static_cast<int64_t>(input.shape().size());
+        LIBRAPID_ASSERT_WITH_EXCEPTION(
+          std::invalid_argument, size > 0, "Cannot compute the argmaxAbs of an empty array");
+        return linalg::iamax(size, input.storage().data(), int64_t(1));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_IAMAX_HPP
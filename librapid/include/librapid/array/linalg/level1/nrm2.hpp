@@ -0,0 +1,280 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_NRM2_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_NRM2_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief Sum of the squares of a contiguous vector on a single thread
+        ///
+        /// For ``float`` and ``double``, four independent packet accumulators are used so that
+        /// consecutive fused multiply-adds do not wait on each other. Each element is divided
+        /// by \p scale before it is squared.
+        /// \tparam Scalar Scalar type of the vector
+        /// \tparam Scaled Whether to divide by \p scale
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \param scale Value to divide each element by
+        /// \return \f$ \sum_{i=0}^{n-1} (x_i / \mathrm{scale})^2 \f$
+        template<bool Scaled, typename Scalar>
+        LIBRAPID_NODISCARD Scalar sumSquaresContiguous(int64_t n, const Scalar *__restrict x,
+                                                       Scalar scale) {
+            Scalar result(0);
+            int64_t i = 0;
+
+            if constexpr (hasLevel1Kernels<Scalar>) {
+                using Packet                  = xsimd::batch<Scalar>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                const auto load = [x, scale](int64_t index) {
+                    if constexpr (Scaled) {
+                        return xsimd::load_unaligned(x + index) / Packet(scale);
+                    } else {
+                        return xsimd::load_unaligned(x + index);
+                    }
+                };
+
+                if (n >= packetWidth) {
+                    Packet acc[4] = {Packet(Scalar(0)), Packet(Scalar(0)), Packet(Scalar(0)),
+                                     Packet(Scalar(0))};
+
+                    for (; i + 4 * packetWidth <= n; i += 4 * packetWidth) {
+                        for (int64_t j = 0; j < 4; ++j) {
+                            const Packet px = load(i + j * packetWidth);
+                            acc[j]          = xsimd::fma(px, px, acc[j]);
+                        }
+                    }
+
+                    for (; i + packetWidth <= n; i += packetWidth) {
+                        const Packet px = load(i);
+                        acc[0]          = xsimd::fma(px, px, acc[0]);
+                    }
+
+                    result = xsimd::reduce_add((acc[0] + acc[1]) + (acc[2] + acc[3]));
+                }
+            }
+
+            for (; i < n; ++i) {
+                const Scalar value = Scaled ? x[i] / scale : x[i];
+                result += value * value;
+            }
+            return result;
+        }
+
+        /// \brief Euclidean norm of a contiguous vector, split between threads if the vector
+        /// is longer than ``global::multithreadThreshold`` and \p parallel is true
+        ///
+        /// The squares are first summed directly, which is accurate unless the sum overflows,
+        /// or is so small that the squares of some elements may have underflowed. Only then
+        /// is the vector read again: once to find its largest absolute value, and once to sum
+        /// the squares of the elements divided by it.
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \param parallel If false, the norm is computed on the calling thread
+        /// \return \f$ \sqrt{\sum_{i=0}^{n-1} x_i^2} \f$
+        template<typename Scalar>
+        LIBRAPID_NODISCARD Scalar nrm2Parallel(int64_t n, const Scalar *x, bool parallel = true) {
+            using Limits = std::numeric_limits<Scalar>;
+
+            const Scalar sumSquares = reduceChunks<Scalar>(
+              n,
+              [x](int64_t begin, int64_t end) {
+                  return sumSquaresContiguous<false>(end - begin, x + begin, Scalar(1));
+              },
+              std::plus<Scalar>(),
+              parallel);
+
+            // This also rejects NaN
+            constexpr Scalar smallest = Limits::min() / Limits::epsilon();
+            if (sumSquares >= smallest && sumSquares <= Limits::max()) {
+                return ::librapid::sqrt(sumSquares);
+            }
+
+            const Scalar scale = maxAbsParallel(n, x, parallel);
+            if (!(scale > 0) || scale > Limits::max()) return scale;
+
+            const Scalar scaledSumSquares = reduceChunks<Scalar>(
+              n,
+              [x, scale](int64_t begin, int64_t end) {
+                  return sumSquaresContiguous<true>(end - begin, x + begin, scale);
+              },
+              std::plus<Scalar>(),
+              parallel);
+            return scale * ::librapid::sqrt(scaledSumSquares);
+        }
+    } // namespace detail
+
+    /// \brief Euclidean norm
+    ///
+    /// Computes \f$ \|\mathbf{x}\|_2 = \sqrt{\sum_{i=0}^{n-1} |x_i|^2} \f$ without overflow or
+    /// underflow in the intermediate sum.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use a BLAS library when one is available and
+    /// the length fits in BLAS' 32-bit integers, and an xsimd implementation split between
+    /// threads otherwise. All other cases fall back to cxxblas' generic implementation.
+    /// \tparam Int Integer type for the vector length and increment
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \param n Number of elements
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param backend Backend to use for computation
+    /// \return The Euclidean norm
+    template<typename Int, typename X>
+    LIBRAPID_NODISCARD auto nrm2(Int n, X *x, Int incX, backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<X>;
+        using Result = detail::AbsType<Scalar>;
+
+        if constexpr (detail::hasLevel1Kernels<Scalar>) {
+            if (incX == 1) {
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                    Scalar result;
+                    cxxblas::nrm2(static_cast<int32_t>(n), x, 1, result);
+                    return result;
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                return detail::nrm2Parallel(static_cast<int64_t>(n), x);
+            }
+        }
+
+        Result result(0);
+        cxxblas::nrm2(n, x, incX, result);
+        return result;
+    }
+
+    namespace detail {
+        /// \brief \f$ p \f$-norm of a contiguous vector
+        ///
+        /// The 2-norm uses ``nrm2`` and the 1-norm of a real vector uses ``asum``. Other orders
+        /// divide each element by the largest absolute value before raising it to the power
+        /// \p ord, so the sum cannot overflow.
+        ///
+        /// If \p parallel is false, the native single-threaded kernels are used instead, so
+        /// that this can be called from inside a parallel region.
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param x Pointer to the vector
+        /// \param ord The order of the norm. Must be positive, and may be infinite
+        /// \param parallel Whether the norm may be split between threads
+        /// \return \f$ (\sum_{i=0}^{n-1} |x_i|^p)^{1/p} \f$
+        template<typename Scalar>
+        LIBRAPID_NODISCARD AbsType<Scalar> vectorNorm(int64_t n, const Scalar *x, double ord,
+                                                      bool parallel = true) {
+            using Real = AbsType<Scalar>;
+            LIBRAPID_ASSERT(ord > 0, "The order of a norm must be positive. Got: {}", ord);
+
+            if (ord == 2) {
+                if constexpr (hasLevel1Kernels<Scalar>) {
+                    if (!parallel) return nrm2Parallel(n, x, false);
+                }
+                return nrm2(n, x, int64_t(1));
+            }
+            if constexpr (std::is_same_v<Real, Scalar>) {
+                if (ord == 1) {
+                    if constexpr (hasLevel1Kernels<Scalar>) {
+                        if (!parallel) return asumContiguous(n, x);
+                    }
+                    return asum(n, x, int64_t(1));
+                }
+            }
+
+            const Real largest = maxAbsParallel(n, x, parallel);
+            if (ord == std::numeric_limits<double>::infinity() || !(largest > Real(0))) {
+                return largest;
+            }
+            if constexpr (std::is_floating_point_v<Real>) {
+                if (std::isinf(largest)) return largest;
+            }
+
+            const Real power(ord);
+            const Real sum = reduceChunks<Real>(
+              n,
+              [x, largest, power](int64_t begin, int64_t end) {
+                  Real result(0);
+                  for (int64_t i = begin; i < end; ++i) {
+                      result += Real(::librapid::pow(::librapid::abs(x[i]) / largest, power));
+                  }
+                  return result;
+              },
+              std::plus<Real>(),
+              parallel);
+            return largest * Real(::librapid::pow(sum, Real(1) / power));
+        }
+    } // namespace detail
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Vector norm of an array
+    ///
+    /// Computes \f$ \|\mathbf{a}\|_p = (\sum_i |a_i|^p)^{1/p} \f$, treating the array as a
+    /// flat vector, so the 2-norm of a matrix is its Frobenius norm. An infinite \p ord gives
+    /// the largest absolute value. See ``linalg::nrm2``.
+    /// \param array The input
+    /// \param ord The order of the norm. Must be positive, and may be infinite
+    /// \return The norm
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    LIBRAPID_NODISCARD auto norm(const T &array, double ord = 2) {
+        const auto &input = linalg::detail::evaluateArray(array);
+        return linalg::detail::vectorNorm(
+          static_cast<int64_t>(input.shape().size()), input.storage().data(), ord);
+    }
+
+    /// \brief Vector norms along an axis of an array
+    ///
+    /// The reduced axis is removed from the shape of the result. A negative axis counts
+    /// backwards from the last axis.
+    /// \param array The input
+    /// \param ord The order of the norm. Must be positive, and may be infinite
+    /// \param axis The axis to compute norms along
+    /// \return An Array containing the norm of each vector along \p axis
+    /// \see norm(const T &, double)
+    template<typename T>
+        requires(IsArrayType<T>::value)
+    LIBRAPID_NODISCARD auto norm(const T &array, double ord, int64_t axis) {
+        using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+        using Real   = linalg::detail::AbsType<Scalar>;
+
+        const auto &input  = linalg::detail::evaluateArray(array);
+        const auto shape   = input.shape();
+        const auto reduced = detail::reduce::axisMask(shape, std::vector<int64_t> {axis});
+        const auto layout  = detail::reduce::axisLayout(shape, reduced);
+
+        Array<Real, backend::CPU> result(detail::reduce::reducedShape(shape, reduced));
+        Real *out = result.storage().data();
+
+        // Move the reduced axis to the end, so that every norm is of a contiguous vector
+        const Scalar *data = input.storage().data();
+        std::vector<Scalar> moved;
+        if (layout.inner > 1) {
+            moved.resize(static_cast<size_t>(shape.size()));
+            ::librapid::detail::cpu::transposeImpl(
+              moved.data(),
+              data,
+              Shape({layout.outer, layout.extent, layout.inner}),
+              Shape({0, 2, 1}),
+              Scalar(1));
+            data = moved.data();
+        }
+
+        // Split the vectors between threads if there are enough of them. Otherwise, each norm
+        // may be split between threads instead. The two are never nested
+        const int64_t rows       = layout.outer * layout.inner;
+        const int64_t extent     = layout.extent;
+        const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+        const bool parallel =
+          numThreads > 1 && rows >= numThreads &&
+          rows * extent > static_cast<int64_t>(global::multithreadThreshold);
+
+#pragma omp parallel for shared(data, out, rows, extent, ord, parallel) default(none)              \
+  if (parallel) num_threads(int(global::numThreads))
+        for (int64_t row = 0; row < rows; ++row) {
+            out[row] = linalg::detail::vectorNorm(extent, data + row * extent, ord, !parallel);
+        }
+
+        return result;
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_NRM2_HPP
@@ -0,0 +1,84 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL1_SCAL_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL1_SCAL_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief \f$ \mathbf{x} \gets \alpha \mathbf{x} \f$ for a contiguous vector on a single
+        /// thread
+        /// \tparam Scalar Scalar type of the vector
+        /// \param n Number of elements
+        /// \param alpha Scaling factor
+        /// \param x Pointer to the vector
+        template<typename Scalar>
+        void scalContiguous(int64_t n, Scalar alpha, Scalar *x) {
+            int64_t i = 0;
+            if constexpr (hasLevel1Kernels<Scalar>) {
+                using Packet                  = xsimd::batch<Scalar>;
+                constexpr int64_t packetWidth = Packet::size;
+
+                const Packet alphaPacket(alpha);
+                for (; i + packetWidth <= n; i += packetWidth) {
+                    (xsimd::load_unaligned(x + i) * alphaPacket).store_unaligned(x + i);
+                }
+            }
+
+            for (; i < n; ++i) x[i] *= alpha;
+        }
+    } // namespace detail
+
+    /// \brief Vector scaling
+    ///
+    /// Computes \f$ \mathbf{x} \gets \alpha \mathbf{x} \f$ in place.
+    ///
+    /// Contiguous ``float`` and ``double`` vectors use a BLAS library when one is available and
+    /// the length fits in BLAS' 32-bit integers, and an xsimd implementation split between
+    /// threads otherwise. All other cases fall back to cxxblas' generic implementation.
+    /// \tparam Int Integer type for the vector length and increment
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \param n Number of elements
+    /// \param alpha Scaling factor
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename X>
+    void scal(Int n, Alpha alpha, X *x, Int incX, backend::CPU backend = backend::CPU()) {
+        if constexpr (detail::hasLevel1Kernels<X>) {
+            if (incX == 1) {
+                const X a = static_cast<X>(alpha);
+#if defined(LIBRAPID_HAS_BLAS)
+                // BLAS takes a 32-bit length, so longer vectors use the native kernel
+                if (static_cast<int64_t>(n) <= std::numeric_limits<int32_t>::max()) {
+                    cxxblas::scal(static_cast<int32_t>(n), a, x, 1);
+                    return;
+                }
+#endif // LIBRAPID_HAS_BLAS
+
+                detail::forEachChunk(static_cast<int64_t>(n),
+                                     [a, x](int64_t begin, int64_t end) {
+                                         detail::scalContiguous(end - begin, a, x + begin);
+                                     });
+                return;
+            }
+        }
+
+        cxxblas::scal(n, alpha, x, incX);
+    }
+} // namespace librapid::linalg
+
+namespace librapid {
+    /// \brief Scale an array in place
+    ///
+    /// Computes \f$ \mathbf{x} \gets \alpha \mathbf{x} \f$ without creating any temporary
+    /// arrays. See ``linalg::scal``.
+    /// \param alpha Scaling factor
+    /// \param x The array to scale
+    template<typename Alpha, typename ShapeType, typename StorageType>
+    void scal(Alpha alpha, array::ArrayContainer<ShapeType, StorageType> &x) {
+        linalg::detail::checkLevel1Backend<array::ArrayContainer<ShapeType, StorageType>>();
+        linalg::scal(
+          static_cast<int64_t>(x.shape().size()), alpha, x.storage().data(), int64_t(1));
+    }
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL1_SCAL_HPP
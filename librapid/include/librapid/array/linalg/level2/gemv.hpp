@@ -5,7 +5,11 @@ namespace librapid::linalg {
     /// \brief General matrix-vector multiplication.
     ///
     /// Computes \f$ y = \alpha \mathrm{op}(\mathbf{A}) \mathbf{x} + \beta \mathbf{y} \f$ for
-    /// matrix \f$ \mathbf{A} \f$ and vectors \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$
+    /// matrix \f$ \mathbf{A} \f$ and vectors \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$.
+    ///
+    /// Without a BLAS library, ``float`` and ``double`` GEMVs with positive increments use
+    /// LibRapid's native kernels (see ``detail::gemvNative``), split between threads when the
+    /// matrix has at least ``global::gemvMultithreadThreshold`` rows or columns.
     /// \tparam Int Integer type
     /// \tparam Alpha Alpha scaling factor
     /// \tparam A Matrix type
@@ -13,7 +17,8 @@ namespace librapid::linalg {
     /// \tparam Beta Beta scaling factor
     /// \tparam Y Second vector type
     /// \param trans If true, \f$ \mathrm{op}(\mathbf{A}) = \mathbf{A}^T \f$, otherwise \f$
-    /// \mathrm{op}(\mathbf{A}) = \mathbf{A} \f$ \param m Number of rows in \f$ \mathbf{A} \f$
+    /// \mathrm{op}(\mathbf{A}) = \mathbf{A} \f$
+    /// \param m Number of rows in \f$ \mathbf{A} \f$
     /// \param n Number of columns in \f$ \mathbf{A} \f$
     /// \param alpha Scaling factor for \f$ \mathrm{op}(\mathbf{A}) \mathbf{x} \f$
     /// \param a Pointer to matrix \f$ \mathbf{A} \f$
@@ -27,6 +32,30 @@ namespace librapid::linalg {
     template<typename Int, typename Alpha, typename A, typename X, typename Beta, typename Y>
     void gemv(bool trans, Int m, Int n, Alpha alpha, A *a, Int lda, X *x, Int incX, Beta beta, Y *y,
               Int incY, backend::CPU backend = backend::CPU()) {
+#if !defined(LIBRAPID_HAS_BLAS)
+        // Without a BLAS library, real single- and double-precision GEMVs use LibRapid's own
+        // SIMD kernels, which also run in parallel for large matrices
+        using ScalarA = std::remove_cv_t<A>;
+        using ScalarX = std::remove_cv_t<X>;
+        if constexpr (std::is_same_v<ScalarA, ScalarX> && std::is_same_v<ScalarA, Y> &&
+                      (std::is_same_v<Y, float> || std::is_same_v<Y, double>)) {
+            if (incX > 0 && incY > 0) {
+                detail::gemvNative<Y>(trans,
+                                      static_cast<int64_t>(m),
+                                      static_cast<int64_t>(n),
+                                      static_cast<Y>(alpha),
+                                      a,
+                                      static_cast<int64_t>(lda),
+                                      x,
+                                      static_cast<int64_t>(incX),
+                                      static_cast<Y>(beta),
+                                      y,
+                                      static_cast<int64_t>(incY));
+                return;
+            }
+        }
+#endif // LIBRAPID_HAS_BLAS
+
         // On the CPU, cxxblas provides a generic implementation for all types along with BLAS
         // implementations where available
 
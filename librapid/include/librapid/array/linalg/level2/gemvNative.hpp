@@ -0,0 +1,327 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL2_GEMV_NATIVE_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL2_GEMV_NATIVE_HPP
+
+/*
+ * A native GEMV implementation used when LibRapid is built without a BLAS library. A GEMV reads
+ * every element of A exactly once, so it is limited by memory bandwidth rather than arithmetic.
+ * Both kernels therefore only ever walk A along its rows, with unit-stride packet loads:
+ *
+ *  - y = alpha A x + beta y computes several row-dot products at once, so each packet of x is
+ *    loaded once for every four rows of A and the accumulators form independent chains
+ *  - y = alpha A^T x + beta y is computed as a sequence of axpys, one per row of A, into a block
+ *    of y small enough to stay in L1 cache. Several rows are applied to each packet of y before
+ *    it is stored again
+ *
+ * Above ``global::gemvMultithreadThreshold``, the rows (or columns) of A are split between
+ * threads so that every core streams its own part of the matrix.
+ */
+
+namespace librapid::linalg::detail {
+    template<typename Scalar>
+    struct GemvKernelInfo {
+        using Packet = xsimd::batch<Scalar>;
+
+        /// Number of elements in a SIMD register
+        static constexpr int64_t packetWidth = Packet::size;
+
+        /// Rows of A processed together by a single kernel invocation
+        static constexpr int64_t rows = 4;
+    };
+
+    /// \brief Number of columns of y updated at a time by the transposed GEMV kernel
+    ///
+    /// Half of L1 holds the block of y. The result is a multiple of the packet width.
+    /// \tparam Scalar Scalar type of the GEMV
+    /// \return Block width
+    template<typename Scalar>
+    LIBRAPID_NODISCARD int64_t gemvColumnBlock() {
+        using Info = GemvKernelInfo<Scalar>;
+
+        int64_t block = static_cast<int64_t>(global::l1CacheSize) / 2 /
+                        static_cast<int64_t>(sizeof(Scalar));
+        return std::clamp<int64_t>(
+          (block / Info::packetWidth) * Info::packetWidth, 4 * Info::packetWidth, 4096);
+    }
+
+    /// \brief Set \f$ \mathbf{y} \gets \beta \mathbf{y} \f$. If \f$ \beta \f$ is zero,
+    /// \f$ \mathbf{y} \f$ is not read
+    template<typename Scalar>
+    void gemvScaleY(int64_t n, Scalar beta, Scalar *y, int64_t incY) {
+        if (beta == Scalar(0)) {
+            for (int64_t i = 0; i < n; ++i) y[i * incY] = Scalar(0);
+        } else if (beta != Scalar(1)) {
+            for (int64_t i = 0; i < n; ++i) y[i * incY] *= beta;
+        }
+    }
+
+    /// \brief Compute \f$ y_i = \alpha \mathbf{A}_{i,:} \mathbf{x} + \beta y_i \f$ for rows
+    /// \f$ i \f$ in [rowBegin, rowEnd)
+    ///
+    /// Rows are processed ``GemvKernelInfo::rows`` at a time, sharing every load of
+    /// \f$ \mathbf{x} \f$. Any remaining rows use ``dotContiguous``.
+    template<typename Scalar>
+    void gemvRowsKernel(int64_t rowBegin, int64_t rowEnd, int64_t n, Scalar alpha,
+                        const Scalar *a, int64_t lda, const Scalar *__restrict x, Scalar beta,
+                        Scalar *y, int64_t incY) {
+        using Info           = GemvKernelInfo<Scalar>;
+        using Packet         = typename Info::Packet;
+        constexpr auto width = Info::packetWidth;
+        constexpr auto rows  = Info::rows;
+
+        const auto update = [alpha, beta, y, incY](int64_t row, Scalar dot) {
+            Scalar &out = y[row * incY];
+            out         = beta == Scalar(0) ? alpha * dot : alpha * dot + beta * out;
+        };
+
+        int64_t row = rowBegin;
+        for (; row + rows <= rowEnd; row += rows) {
+            const Scalar *aRow[rows];
+            for (int64_t r = 0; r < rows; ++r) aRow[r] = a + (row + r) * lda;
+
+            Packet acc[rows];
+            for (int64_t r = 0; r < rows; ++r) acc[r] = Packet(Scalar(0));
+
+            int64_t j = 0;
+            for (; j + width <= n; j += width) {
+                const Packet px = xsimd::load_unaligned(x + j);
+                for (int64_t r = 0; r < rows; ++r) {
+                    acc[r] = xsimd::fma(xsimd::load_unaligned(aRow[r] + j), px, acc[r]);
+                }
+            }
+
+            for (int64_t r = 0; r < rows; ++r) {
+                Scalar dot = xsimd::reduce_add(acc[r]);
+                for (int64_t k = j; k < n; ++k) dot += aRow[r][k] * x[k];
+                update(row + r, dot);
+            }
+        }
+
+        for (; row < rowEnd; ++row) update(row, dotContiguous(n, a + row * lda, x));
+    }
+
+    /// \brief Compute \f$ \mathbf{y}_{b} \gets \alpha \mathbf{A}_{:,b}^T \mathbf{x} + \beta
+    /// \mathbf{y}_{b} \f$ for the columns \f$ b \f$ in [colBegin, colEnd)
+    ///
+    /// \f$ \mathbf{y} \f$ must be contiguous. The columns are split into blocks of
+    /// ``gemvColumnBlock`` elements. Each block of \f$ \mathbf{y} \f$ is scaled by
+    /// \f$ \beta \f$, then has \f$ \alpha x_i \mathbf{A}_{i,b} \f$ added to it for every row
+    /// \f$ i \f$, ``GemvKernelInfo::rows`` rows at a time.
+    template<typename Scalar>
+    void gemvColumnsKernel(int64_t colBegin, int64_t colEnd, int64_t m, Scalar alpha,
+                           const Scalar *a, int64_t lda, const Scalar *__restrict x, Scalar beta,
+                           Scalar *__restrict y) {
+        using Info           = GemvKernelInfo<Scalar>;
+        using Packet         = typename Info::Packet;
+        constexpr auto width = Info::packetWidth;
+        constexpr auto rows  = Info::rows;
+
+        const int64_t blockWidth = gemvColumnBlock<Scalar>();
+
+        for (int64_t block = colBegin; block < colEnd; block += blockWidth) {
+            const int64_t blockEnd = std::min(colEnd, block + blockWidth);
+            gemvScaleY(blockEnd - block, beta, y + block, int64_t(1));
+
+            int64_t i = 0;
+            for (; i + rows <= m; i += rows) {
+                const Scalar *aRow[rows];
+                Scalar coeff[rows];
+                Packet coeffPacket[rows];
+                for (int64_t r = 0; r < rows; ++r) {
+                    aRow[r]        = a + (i + r) * lda;
+                    coeff[r]       = alpha * x[i + r];
+                    coeffPacket[r] = Packet(coeff[r]);
+                }
+
+                int64_t j = block;
+                for (; j + width <= blockEnd; j += width) {
+                    Packet py = xsimd::load_unaligned(y + j);
+                    for (int64_t r = 0; r < rows; ++r) {
+                        py = xsimd::fma(coeffPacket[r], xsimd::load_unaligned(aRow[r] + j), py);
+                    }
+                    py.store_unaligned(y + j);
+                }
+
+                for (; j < blockEnd; ++j) {
+                    Scalar sum = y[j];
+                    for (int64_t r = 0; r < rows; ++r) sum += coeff[r] * aRow[r][j];
+                    y[j] = sum;
+                }
+            }
+
+            for (; i < m; ++i) {
+                const Scalar coeff = alpha * x[i];
+                const Packet coeffPacket(coeff);
+                const Scalar *aRow = a + i * lda;
+
+                int64_t j = block;
+                for (; j + width <= blockEnd; j += width) {
+                    const Packet py = xsimd::load_unaligned(y + j);
+                    xsimd::fma(coeffPacket, xsimd::load_unaligned(aRow + j), py)
+                      .store_unaligned(y + j);
+                }
+                for (; j < blockEnd; ++j) y[j] += coeff * aRow[j];
+            }
+        }
+    }
+
+    /// \brief Number of elements in each chunk when \p n elements are split between
+    /// \p numThreads threads, rounded up to a multiple of \p multiple
+    LIBRAPID_NODISCARD inline int64_t gemvChunkSize(int64_t n, int64_t numThreads,
+                                                    int64_t multiple) {
+        return ((n + numThreads - 1) / numThreads + multiple - 1) / multiple * multiple;
+    }
+
+    /// \brief Compute \f$ \mathbf{y} = \alpha \mathrm{op}(\mathbf{A}) \mathbf{x} + \beta
+    /// \mathbf{y} \f$ for a row-major matrix \f$ \mathbf{A} \f$
+    ///
+    /// If \f$ \beta \f$ is zero, \f$ \mathbf{y} \f$ is not read. \p incX and \p incY must be
+    /// positive.
+    ///
+    /// Without the transpose, the rows of \f$ \mathbf{A} \f$ (and elements of
+    /// \f$ \mathbf{y} \f$) are split between threads. With the transpose, the columns are
+    /// split between threads if each thread gets at least a few cache lines of
+    /// \f$ \mathbf{y} \f$; otherwise, the rows are split, each thread accumulates into its own
+    /// copy of \f$ \mathbf{y} \f$, and the copies are summed at the end.
+    /// \tparam Scalar Scalar type (``float`` or ``double``)
+    /// \param trans If true, \f$ \mathrm{op}(\mathbf{A}) = \mathbf{A}^T \f$
+    /// \param m Rows of \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param beta Scalar \f$ \beta \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$
+    /// \param incY Increment of \f$ \mathbf{y} \f$
+    template<typename Scalar>
+    void gemvNative(bool trans, int64_t m, int64_t n, Scalar alpha, const Scalar *a, int64_t lda,
+                    const Scalar *x, int64_t incX, Scalar beta, Scalar *y, int64_t incY) {
+        using Info = GemvKernelInfo<Scalar>;
+
+        const int64_t lenX = trans ? m : n;
+        const int64_t lenY = trans ? n : m;
+        if (lenY <= 0) return;
+
+        if (lenX <= 0 || alpha == Scalar(0)) {
+            gemvScaleY(lenY, beta, y, incY);
+            return;
+        }
+
+        // Both kernels read x many times, so make sure it is contiguous
+        std::vector<Scalar> xBuffer;
+        if (incX != 1) {
+            xBuffer.resize(static_cast<size_t>(lenX));
+            for (int64_t i = 0; i < lenX; ++i) xBuffer[i] = x[i * incX];
+            x = xBuffer.data();
+        }
+
+#if defined(LIBRAPID_HAS_OMP)
+        const int64_t numThreads = std::max<int64_t>(1, static_cast<int64_t>(global::numThreads));
+        // Stay serial when called from inside a parallel region (e.g. a batched product)
+        const bool parallel =
+          numThreads > 1 && !omp_in_parallel() &&
+          static_cast<size_t>(std::max(m, n)) >= global::gemvMultithreadThreshold;
+#else
+        const int64_t numThreads = 1;
+        const bool parallel      = false;
+#endif // LIBRAPID_HAS_OMP
+
+        if (!trans) {
+            if (!parallel) {
+                gemvRowsKernel(int64_t(0), m, n, alpha, a, lda, x, beta, y, incY);
+                return;
+            }
+
+#if defined(LIBRAPID_HAS_OMP)
+            const int64_t chunkSize = gemvChunkSize(m, numThreads, Info::rows);
+            const int64_t numChunks = (m + chunkSize - 1) / chunkSize;
+
+#    pragma omp parallel for shared(m, n, alpha, a, lda, x, beta, y, incY, chunkSize, numChunks)   \
+      default(none) num_threads(int(numThreads))
+            for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+                const int64_t begin = chunk * chunkSize;
+                gemvRowsKernel(
+                  begin, std::min(m, begin + chunkSize), n, alpha, a, lda, x, beta, y, incY);
+            }
+#endif // LIBRAPID_HAS_OMP
+            return;
+        }
+
+        // The transposed kernel streams packets of y, so it must be contiguous too
+        std::vector<Scalar> yBuffer;
+        Scalar *yContiguous = y;
+        if (incY != 1) {
+            yBuffer.resize(static_cast<size_t>(n));
+            if (beta != Scalar(0)) {
+                for (int64_t j = 0; j < n; ++j) yBuffer[j] = y[j * incY];
+            }
+            yContiguous = yBuffer.data();
+        }
+
+        if (!parallel) {
+            gemvColumnsKernel(int64_t(0), n, m, alpha, a, lda, x, beta, yContiguous);
+        } else {
+#if defined(LIBRAPID_HAS_OMP)
+            // Split the columns into whole cache lines, so threads never write to the same line
+            const int64_t lineElements = std::max<int64_t>(
+              Info::packetWidth,
+              static_cast<int64_t>(global::cacheLineSize) / static_cast<int64_t>(sizeof(Scalar)));
+
+            if (n >= numThreads * 4 * lineElements) {
+                const int64_t chunkSize = gemvChunkSize(n, numThreads, lineElements);
+                const int64_t numChunks = (n + chunkSize - 1) / chunkSize;
+
+#    pragma omp parallel for shared(m, n, alpha, a, lda, x, beta, yContiguous, chunkSize,          \
+                                      numChunks) default(none) num_threads(int(numThreads))
+                for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+                    const int64_t begin = chunk * chunkSize;
+                    gemvColumnsKernel(begin,
+                                      std::min(n, begin + chunkSize),
+                                      m,
+                                      alpha,
+                                      a,
+                                      lda,
+                                      x,
+                                      beta,
+                                      yContiguous);
+                }
+            } else {
+                // Too few columns to share out, so each thread takes a slice of the rows and
+                // accumulates into its own copy of y
+                const int64_t chunkSize = gemvChunkSize(m, numThreads, Info::rows);
+                const int64_t numChunks = (m + chunkSize - 1) / chunkSize;
+                std::vector<Scalar> partials(static_cast<size_t>(numChunks * n));
+                Scalar *partialData = partials.data();
+
+#    pragma omp parallel for shared(m, n, alpha, a, lda, x, partialData, chunkSize, numChunks)     \
+      default(none) num_threads(int(numThreads))
+                for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+                    const int64_t begin = chunk * chunkSize;
+                    gemvColumnsKernel(int64_t(0),
+                                      n,
+                                      std::min(m, begin + chunkSize) - begin,
+                                      alpha,
+                                      a + begin * lda,
+                                      lda,
+                                      x + begin,
+                                      Scalar(0),
+                                      partialData + chunk * n);
+                }
+
+                gemvScaleY(n, beta, yContiguous, int64_t(1));
+                for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+                    const Scalar *partial = partialData + chunk * n;
+                    for (int64_t j = 0; j < n; ++j) yContiguous[j] += partial[j];
+                }
+            }
+#endif // LIBRAPID_HAS_OMP
+        }
+
+        if (incY != 1) {
+            for (int64_t j = 0; j < n; ++j) y[j * incY] = yBuffer[j];
+        }
+    }
+} // namespace librapid::linalg::detail
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL2_GEMV_NATIVE_HPP
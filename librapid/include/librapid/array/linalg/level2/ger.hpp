@@ -0,0 +1,97 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Rows of \f$ \mathbf{A} \f$ updated together in a rank-1 update, so that each block of
+        /// \f$ \mathbf{y} \f$ is reused from cache for every row in the tile
+        constexpr int64_t gerTileRows = 64;
+
+        /// \brief Scaled rank-1 update of a row-major matrix
+        ///
+        /// Computes \f$ \mathbf{A} = \alpha \mathbf{x} \mathbf{y}^T + \beta \mathbf{A} \f$. If
+        /// \f$ \beta = 0 \f$, \f$ \mathbf{A} \f$ is never read, so it may be uninitialised.
+        ///
+        /// The output is written in tiles of ``gerTileRows`` rows by enough columns for the
+        /// matching block of \f$ \mathbf{y} \f$ and a row of the tile to fit in L1 cache
+        /// together. Tiles of rows are divided between threads.
+        /// \see librapid::linalg::ger
+        template<typename X, typename Y, typename Scalar>
+        void gerNative(int64_t m, int64_t n, Scalar alpha, const X *x, int64_t incX, const Y *y,
+                       int64_t incY, Scalar beta, Scalar *a, int64_t lda) {
+            if (m <= 0 || n <= 0) return;
+
+            const int64_t tileCols = std::max<int64_t>(
+              64, static_cast<int64_t>(global::l1CacheSize / (2 * sizeof(Scalar))));
+            const int64_t numTiles = (m + gerTileRows - 1) / gerTileRows;
+            const bool parallel    = m * n > static_cast<int64_t>(global::multithreadThreshold) &&
+                                  global::numThreads > 1;
+
+#pragma omp parallel for shared(m, n, alpha, x, incX, y, incY, beta, a, lda, tileCols, numTiles)   \
+  default(none) if (parallel) num_threads(int(global::numThreads))
+            for (int64_t tile = 0; tile < numTiles; ++tile) {
+                const int64_t rowBegin = tile * gerTileRows;
+                const int64_t rowEnd   = std::min(m, rowBegin + gerTileRows);
+
+                for (int64_t colBegin = 0; colBegin < n; colBegin += tileCols) {
+                    const int64_t cols = std::min(tileCols, n - colBegin);
+                    const Y *yBlock    = y + colBegin * incY;
+
+                    for (int64_t row = rowBegin; row < rowEnd; ++row) {
+                        const Scalar scale = alpha * static_cast<Scalar>(x[row * incX]);
+                        Scalar *out        = a + row * lda + colBegin;
+
+                        if (beta == Scalar(0)) {
+                            for (int64_t col = 0; col < cols; ++col) {
+                                out[col] = scale * static_cast<Scalar>(yBlock[col * incY]);
+                            }
+                        } else {
+                            for (int64_t col = 0; col < cols; ++col) {
+                                out[col] = scale * static_cast<Scalar>(yBlock[col * incY]) +
+                                           beta * out[col];
+                            }
+                        }
+                    }
+                }
+            }
+        }
+    } // namespace detail
+
+    /// \brief General rank-1 update
+    ///
+    /// Computes \f$ \mathbf{A} = \alpha \mathbf{x} \mathbf{y}^T + \mathbf{A} \f$ for an
+    /// \f$ m \times n \f$ row-major matrix \f$ \mathbf{A} \f$ and vectors \f$ \mathbf{x} \f$ and
+    /// \f$ \mathbf{y} \f$.
+    /// \tparam Int Integer type for matrix dimensions
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam X Type of \f$ \mathbf{x} \f$
+    /// \tparam Y Type of \f$ \mathbf{y} \f$
+    /// \tparam A Type of \f$ \mathbf{A} \f$
+    /// \param m Rows of \f$ \mathbf{A} \f$ and elements of \f$ \mathbf{x} \f$
+    /// \param n Columns of \f$ \mathbf{A} \f$ and elements of \f$ \mathbf{y} \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param x Pointer to \f$ \mathbf{x} \f$
+    /// \param incX Increment of \f$ \mathbf{x} \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$
+    /// \param incY Increment of \f$ \mathbf{y} \f$
+    /// \param a Pointer to \f$ \mathbf{A} \f$
+    /// \param lda Leading dimension of \f$ \mathbf{A} \f$
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename X, typename Y, typename A>
+    void ger(Int m, Int n, Alpha alpha, X *x, Int incX, Y *y, Int incY, A *a, Int lda,
+             backend::CPU backend = backend::CPU()) {
+        using Scalar = std::remove_cv_t<A>;
+        detail::gerNative(static_cast<int64_t>(m),
+                          static_cast<int64_t>(n),
+                          static_cast<Scalar>(alpha),
+                          x,
+                          static_cast<int64_t>(incX),
+                          y,
+                          static_cast<int64_t>(incY),
+                          Scalar(1),
+                          a,
+                          static_cast<int64_t>(lda));
+    }
+} // namespace librapid::linalg
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL2_GER_HPP
@@ -0,0 +1,126 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL2_SPMV_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL2_SPMV_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// \brief Split the rows of a compressed sparse matrix into blocks of similar cost
+        ///
+        /// Each row costs one unit per nonzero element, plus one for writing its result, so long
+        /// rows are not grouped together and runs of empty rows are not free. Rows are never split
+        /// between blocks.
+        /// \param offsets Row offsets of the matrix (``rows + 1`` values)
+        /// \param rows Number of rows
+        /// \param parts Number of blocks
+        /// \return ``parts + 1`` row boundaries. Block ``p`` covers rows ``[bounds[p],
+        /// bounds[p + 1])``
+        LIBRAPID_NODISCARD inline std::vector<int64_t>
+        sparseRowPartition(const int64_t *offsets, int64_t rows, int64_t parts) {
+            std::vector<int64_t> bounds(parts + 1, rows);
+            bounds[0] = 0;
+
+            // Cost of all rows before row i
+            auto cost = [&](int64_t i) { return offsets[i] - offsets[0] + i; };
+            const int64_t total = cost(rows);
+
+            for (int64_t p = 1; p < parts; ++p) {
+                const int64_t target = total / parts * p + (total % parts) * p / parts;
+                int64_t lo = bounds[p - 1], hi = rows;
+                while (lo < hi) {
+                    const int64_t mid = lo + (hi - lo) / 2;
+                    if (cost(mid) < target) {
+                        lo = mid + 1;
+                    } else {
+                        hi = mid;
+                    }
+                }
+                bounds[p] = lo;
+            }
+
+            return bounds;
+        }
+
+        /// \brief Sparse matrix-vector product for a matrix in CSR format
+        ///
+        /// Computes \f$ \mathbf{y} = \alpha \mathbf{A} \mathbf{x} + \beta \mathbf{y} \f$. The rows
+        /// are split between threads in blocks with similar numbers of nonzero elements (see
+        /// ``sparseRowPartition``). If \f$ \beta = 0 \f$, \f$ \mathbf{y} \f$ is never read.
+        template<typename Scalar>
+        void spmvCsr(int64_t m, Scalar alpha, const Scalar *values, const int64_t *offsets,
+                     const int64_t *indices, const Scalar *x, Scalar beta, Scalar *y) {
+            if (m <= 0) return;
+
+            const int64_t nnz   = offsets[m] - offsets[0];
+            const bool parallel = nnz + m > static_cast<int64_t>(global::multithreadThreshold) &&
+                                  global::numThreads > 1;
+            const int64_t parts = parallel ? static_cast<int64_t>(global::numThreads) : 1;
+            const std::vector<int64_t> bounds = sparseRowPartition(offsets, m, parts);
+
+#pragma omp parallel for shared(alpha, values, offsets, indices, x, beta, y, parts, bounds)        \
+  default(none) if (parallel) num_threads(int(global::numThreads))
+            for (int64_t part = 0; part < parts; ++part) {
+                for (int64_t row = bounds[part]; row < bounds[part + 1]; ++row) {
+                    Scalar sum(0);
+                    for (int64_t i = offsets[row]; i < offsets[row + 1]; ++i) {
+                        sum += values[i] * x[indices[i]];
+                    }
+
+                    if (beta == Scalar(0)) {
+                        y[row] = alpha * sum;
+                    } else {
+                        y[row] = alpha * sum + beta * y[row];
+                    }
+                }
+            }
+        }
+    } // namespace detail
+
+    /// \brief Sparse matrix-vector product
+    ///
+    /// Computes \f$ \mathbf{y} = \alpha \mathbf{A} \mathbf{x} + \beta \mathbf{y} \f$ for a sparse
+    /// \f$ m \times n \f$ matrix \f$ \mathbf{A} \f$ and dense, contiguous vectors
+    /// \f$ \mathbf{x} \f$ and \f$ \mathbf{y} \f$.
+    ///
+    /// CSR matrices use a multithreaded implementation which balances the nonzero elements
+    /// between threads. CSC matrices are passed to cxxblas' ``gecrsmv`` as the transpose of a CSR
+    /// matrix, since each column scatters into many elements of \f$ \mathbf{y} \f$.
+    /// \tparam Scalar Scalar type
+    /// \param a Sparse matrix \f$ \mathbf{A} \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param x Pointer to \f$ \mathbf{x} \f$ (\f$ n \f$ elements)
+    /// \param beta Scalar \f$ \beta \f$
+    /// \param y Pointer to \f$ \mathbf{y} \f$ (\f$ m \f$ elements)
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void spmv(const SparseMatrix<Scalar> &a, Scalar alpha, const Scalar *x, Scalar beta,
+              Scalar *y, backend::CPU backend = backend::CPU()) {
+        if (a.format() == SparseFormat::CSR) {
+            detail::spmvCsr(a.rows(),
+                            alpha,
+                            a.values().data(),
+                            a.offsets().data(),
+                            a.indices().data(),
+                            x,
+                            beta,
+                            y);
+        } else if (a.rows() == 0 || a.cols() == 0) {
+            // Nothing to multiply, and x or y may not point to any memory
+            for (int64_t i = 0; i < a.rows(); ++i) {
+                y[i] = beta == Scalar(0) ? Scalar(0) : beta * y[i];
+            }
+        } else {
+            // The CSC arrays of A are the CSR arrays of A^T
+            cxxblas::gecrsmv(cxxblas::Transpose::Trans,
+                             a.cols(),
+                             a.rows(),
+                             alpha,
+                             a.values().data(),
+                             a.offsets().data(),
+                             a.indices().data(),
+                             x,
+                             beta,
+                             y);
+        }
+    }
+} // namespace librapid::linalg
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL2_SPMV_HPP
@@ -2,6 +2,84 @@
 #define LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_HPP
 
 namespace librapid::linalg {
+    /// \brief General matrix-matrix multiplication with a fused epilogue
+    ///
+    /// Computes \f$ \mathbf{C} = \alpha \mathrm{OP}_A(\mathbf{A}) \mathrm{OP}_B(\mathbf{B}) +
+    /// \beta \mathbf{C} \f$, then applies \p epilogue to the result. LibRapid's native GEMM
+    /// applies the epilogue to each block of \f$ \mathbf{C} \f$ while it is still in cache;
+    /// other implementations apply it in a single pass once the product is complete.
+    /// \param epilogue Operation to apply to the result (see ``makeGemmEpilogue``)
+    /// \see gemm
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemm(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda, B *b,
+              Int ldb, Beta beta, C *c, Int ldc, const GemmEpilogue<std::remove_cv_t<C>> &epilogue,
+              backend::CPU backend = backend::CPU()) {
+        using ScalarA = std::remove_cv_t<A>;
+        using ScalarB = std::remove_cv_t<B>;
+
+        // BLAS libraries do not support bfloat16, so it always uses LibRapid's own packed
+        // implementation, which accumulates in single precision
+        if constexpr (std::is_same_v<ScalarA, bfloat16> && std::is_same_v<ScalarB, bfloat16> &&
+                      std::is_same_v<C, bfloat16>) {
+            detail::gemmNativeBfloat16(transA,
+                                       transB,
+                                       static_cast<int64_t>(m),
+                                       static_cast<int64_t>(n),
+                                       static_cast<int64_t>(k),
+                                       static_cast<float>(alpha),
+                                       a,
+                                       static_cast<int64_t>(lda),
+                                       b,
+                                       static_cast<int64_t>(ldb),
+                                       static_cast<float>(beta),
+                                       c,
+                                       static_cast<int64_t>(ldc),
+                                       epilogue);
+            return;
+        }
+
+#if !defined(LIBRAPID_HAS_BLAS)
+        // Without a BLAS library, real single- and double-precision GEMMs use LibRapid's own
+        // packed implementation. All other types fall back to cxxblas' generic kernels.
+        if constexpr (std::is_same_v<ScalarA, ScalarB> && std::is_same_v<ScalarA, C> &&
+                      (std::is_same_v<C, float> || std::is_same_v<C, double>)) {
+            detail::gemmNative<C>(transA,
+                                  transB,
+                                  static_cast<int64_t>(m),
+                                  static_cast<int64_t>(n),
+                                  static_cast<int64_t>(k),
+                                  static_cast<C>(alpha),
+                                  a,
+                                  static_cast<int64_t>(lda),
+                                  b,
+                                  static_cast<int64_t>(ldb),
+                                  static_cast<C>(beta),
+                                  c,
+                                  static_cast<int64_t>(ldc),
+                                  epilogue);
+            return;
+        }
+#endif // LIBRAPID_HAS_BLAS
+
+        cxxblas::gemm(cxxblas::StorageOrder::RowMajor,
+                      (transA ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans),
+                      (transB ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans),
+                      m,
+                      n,
+                      k,
+                      alpha,
+                      a,
+                      lda,
+                      b,
+                      ldb,
+                      beta,
+                      c,
+                      ldc);
+
+        detail::gemmApplyEpilogue<std::remove_cv_t<C>>(
+          epilogue, static_cast<int64_t>(m), static_cast<int64_t>(n), c, static_cast<int64_t>(ldc));
+    }
+
     /// \brief General matrix-matrix multiplication
     ///
     /// Computes \f$ \mathbf{C} = \alpha \mathrm{OP}_A(\mathbf{A}) \mathrm{OP}_B(\mathbf{B}) +
@@ -32,20 +110,115 @@ namespace librapid::linalg {
     template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
     void gemm(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *a, Int lda, B *b,
               Int ldb, Beta beta, C *c, Int ldc, backend::CPU backend = backend::CPU()) {
-        cxxblas::gemm(cxxblas::StorageOrder::RowMajor,
-                      (transA ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans),
-                      (transB ? cxxblas::Transpose::Trans : cxxblas::Transpose::NoTrans),
-                      m,
-                      n,
-                      k,
-                      alpha,
-                      a,
-                      lda,
-                      b,
-                      ldb,
-                      beta,
-                      c,
-                      ldc);
+        gemm(transA,
+             transB,
+             m,
+             n,
+             k,
+             alpha,
+             a,
+             lda,
+             b,
+             ldb,
+             beta,
+             c,
+             ldc,
+             GemmEpilogue<std::remove_cv_t<C>>(),
+             backend);
+    }
+
+    /// \brief Batched general matrix-matrix multiplication with a fused epilogue
+    ///
+    /// The epilogue is applied to each \f$ \mathbf{C}_i \f$ as described for ``gemm``.
+    /// \param epilogue Operation to apply to each result (see ``makeGemmEpilogue``)
+    /// \see gemmBatched
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *const *a,
+                     Int lda, B *const *b, Int ldb, Beta beta, C *const *c, Int ldc,
+                     int64_t batchCount, const GemmEpilogue<std::remove_cv_t<C>> &epilogue,
+                     backend::CPU backend = backend::CPU()) {
+        const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+        const bool parallel =
+          numThreads > 1 && batchCount > 1 &&
+          (batchCount >= numThreads ||
+           static_cast<size_t>(std::max<int64_t>(m, n)) < global::gemmMultithreadThreshold);
+
+#pragma omp parallel for shared(transA, transB, m, n, k, alpha, a, lda, b, ldb, beta, c, ldc,      \
+                                  batchCount, epilogue, backend) default(none) if (parallel)       \
+  num_threads(int(numThreads)) schedule(dynamic)
+        for (int64_t i = 0; i < batchCount; ++i) {
+            gemm(transA,
+                 transB,
+                 m,
+                 n,
+                 k,
+                 alpha,
+                 a[i],
+                 lda,
+                 b[i],
+                 ldb,
+                 beta,
+                 c[i],
+                 ldc,
+                 epilogue,
+                 backend);
+        }
+    }
+
+    /// \brief Batched general matrix-matrix multiplication
+    ///
+    /// Computes \f$ \mathbf{C}_i = \alpha \mathrm{OP}_A(\mathbf{A}_i) \mathrm{OP}_B(\mathbf{B}_i) +
+    /// \beta \mathbf{C}_i \f$ for \f$ i = 0, \ldots, \mathrm{batchCount} - 1 \f$, where every
+    /// product has the same dimensions and leading dimensions. The same matrix may appear more
+    /// than once in \p a or \p b (for example, when broadcasting), but the matrices in \p c
+    /// must not overlap.
+    ///
+    /// When there are enough products to occupy every thread, or the matrices are too small to
+    /// be worth splitting up, the products are divided between threads and each one is computed
+    /// serially. Otherwise, the products are computed one after another, each using every
+    /// thread.
+    /// \tparam Int Integer type for matrix dimensions
+    /// \tparam Alpha Type of \f$ \alpha \f$
+    /// \tparam A Type of \f$ \mathbf{A} \f$
+    /// \tparam B Type of \f$ \mathbf{B} \f$
+    /// \tparam Beta Type of \f$ \beta \f$
+    /// \tparam C Type of \f$ \mathbf{C} \f$
+    /// \param transA Whether to transpose each \f$ \mathbf{A}_i \f$
+    /// \param transB Whether to transpose each \f$ \mathbf{B}_i \f$
+    /// \param m Rows of each \f$ \mathrm{OP}_A(\mathbf{A}_i) \f$ and \f$ \mathbf{C}_i \f$
+    /// \param n Columns of each \f$ \mathrm{OP}_B(\mathbf{B}_i) \f$ and \f$ \mathbf{C}_i \f$
+    /// \param k Columns of each \f$ \mathrm{OP}_A(\mathbf{A}_i) \f$ and rows of each
+    /// \f$ \mathrm{OP}_B(\mathbf{B}_i) \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param a Array of pointers to each \f$ \mathbf{A}_i \f$
+    /// \param lda Leading dimension of each \f$ \mathbf{A}_i \f$
+    /// \param b Array of pointers to each \f$ \mathbf{B}_i \f$
+    /// \param ldb Leading dimension of each \f$ \mathbf{B}_i \f$
+    /// \param beta Scalar \f$ \beta \f$
+    /// \param c Array of pointers to each \f$ \mathbf{C}_i \f$
+    /// \param ldc Leading dimension of each \f$ \mathbf{C}_i \f$
+    /// \param batchCount Number of products to compute
+    /// \param backend Backend to use for computation
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *const *a,
+                     Int lda, B *const *b, Int ldb, Beta beta, C *const *c, Int ldc,
+                     int64_t batchCount, backend::CPU backend = backend::CPU()) {
+        gemmBatched(transA,
+                    transB,
+                    m,
+                    n,
+                    k,
+                    alpha,
+                    a,
+                    lda,
+                    b,
+                    ldb,
+                    beta,
+                    c,
+                    ldc,
+                    batchCount,
+                    GemmEpilogue<std::remove_cv_t<C>>(),
+                    backend);
     }
 
 #if defined(LIBRAPID_HAS_OPENCL)
@@ -297,6 +470,16 @@ namespace librapid::linalg {
         }
     }
 
+    template<typename Int, typename Alpha, typename A, typename B, typename Beta, typename C>
+    void gemmBatched(bool transA, bool transB, Int m, Int n, Int k, Alpha alpha, A *const *a,
+                     Int lda, B *const *b, Int ldb, Beta beta, C *const *c, Int ldc,
+                     int64_t batchCount, backend::CUDA backend) {
+        // Each product is launched asynchronously on the same stream
+        for (int64_t i = 0; i < batchCount; ++i) {
+            gemm(transA, transB, m, n, k, alpha, a[i], lda, b[i], ldb, beta, c[i], ldc, backend);
+        }
+    }
+
 #endif // LIBRAPID_HAS_CUDA
 } // namespace librapid::linalg
 
@@ -0,0 +1,123 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
+
+namespace librapid::linalg {
+    /// How a bias vector is broadcast over the result of a GEMM
+    enum class GemmBias {
+        NONE,   // No bias
+        ROW,    // One value per row of C, added to every element in that row
+        COLUMN, // One value per column of C, added to every element in that column
+    };
+
+    /// \brief Operation applied to each finished block of a GEMM result
+    ///
+    /// Called as ``epilogue(row, col, rows, cols, c, ldc)``, where ``c`` points to element
+    /// (``row``, ``col``) of the full result and the block is ``rows`` by ``cols``. Every element
+    /// of the result is passed to the epilogue exactly once, after its final value has been
+    /// computed. An empty epilogue does nothing.
+    template<typename Scalar>
+    using GemmEpilogue =
+      std::function<void(int64_t, int64_t, int64_t, int64_t, Scalar *, int64_t)>;
+
+    namespace detail {
+        /// Activation used by epilogues which only add a bias
+        struct GemmIdentity {
+            template<typename T>
+            LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T operator()(const T &val) const {
+                return val;
+            }
+
+            template<typename Packet>
+            LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(const Packet &val) const {
+                return val;
+            }
+        };
+
+        /// Rows of C passed to an epilogue at once by ``gemmApplyEpilogue``
+        constexpr int64_t gemmEpilogueRows = 16;
+
+        /// \brief Apply an epilogue to a whole m x n row-major matrix
+        ///
+        /// Used by GEMM implementations which cannot call the epilogue on each block as it is
+        /// computed (for example, an external BLAS library). Blocks of rows are divided between
+        /// threads.
+        template<typename Scalar>
+        void gemmApplyEpilogue(const GemmEpilogue<Scalar> &epilogue, int64_t m, int64_t n,
+                               Scalar *c, int64_t ldc) {
+            if (!epilogue || m <= 0 || n <= 0) return;
+
+            const int64_t numBlocks = (m + gemmEpilogueRows - 1) / gemmEpilogueRows;
+            const bool parallel     = m * n > static_cast<int64_t>(global::multithreadThreshold) &&
+                                  global::numThreads > 1;
+
+#pragma omp parallel for shared(epilogue, m, n, c, ldc, numBlocks) default(none) if (parallel)     \
+  num_threads(int(global::numThreads))
+            for (int64_t block = 0; block < numBlocks; ++block) {
+                const int64_t row  = block * gemmEpilogueRows;
+                const int64_t rows = std::min(int64_t(gemmEpilogueRows), m - row);
+                epilogue(row, 0, rows, n, c + row * ldc, ldc);
+            }
+        }
+    } // namespace detail
+
+    /// \brief Create a GEMM epilogue which adds a bias and applies an activation function
+    ///
+    /// Each element of the result is replaced by \f$ f(c_{ij} + b) \f$, where \f$ b \f$ is
+    /// selected from \p bias according to \p biasMode. The activation may be any element-wise
+    /// functor callable on a single scalar, such as the functors in ``operations.hpp`` or
+    /// ``ml::Sigmoid``. If it also provides a ``packet`` method, it is applied to whole SIMD
+    /// packets at a time.
+    /// \tparam Scalar Scalar type of the GEMM
+    /// \tparam Activation Type of the activation function
+    /// \param bias Bias values (one per row or column of the result, or empty)
+    /// \param biasMode How the bias is broadcast over the result
+    /// \param activation Activation function
+    /// \return An epilogue which can be passed to ``gemm``
+    template<typename Scalar, typename Activation = detail::GemmIdentity>
+    LIBRAPID_NODISCARD GemmEpilogue<Scalar> makeGemmEpilogue(std::vector<Scalar> bias,
+                                                             GemmBias biasMode,
+                                                             Activation activation = Activation()) {
+        // Shared, so copying the epilogue does not copy the bias
+        auto sharedBias = std::make_shared<const std::vector<Scalar>>(std::move(bias));
+
+        return [sharedBias, biasMode, activation](int64_t row,
+                                                  int64_t col,
+                                                  int64_t rows,
+                                                  int64_t cols,
+                                                  Scalar *c,
+                                                  int64_t ldc) {
+            const Scalar *colBias = biasMode == GemmBias::COLUMN ? sharedBias->data() + col
+                                                                   : nullptr;
+
+            for (int64_t i = 0; i < rows; ++i) {
+                Scalar *dst = c + i * ldc;
+                const Scalar rowBias =
+                  biasMode == GemmBias::ROW ? (*sharedBias)[row + i] : Scalar(0);
+                int64_t j = 0;
+
+                if constexpr ((std::is_same_v<Scalar, float> || std::is_same_v<Scalar, double>) &&
+                              requires(const Activation &func, const xsimd::batch<Scalar> &val) {
+                                  func.packet(val);
+                              }) {
+                    using Packet                  = xsimd::batch<Scalar>;
+                    constexpr int64_t packetWidth = Packet::size;
+                    const Packet rowBiasPacket(rowBias);
+
+                    for (; j + packetWidth <= cols; j += packetWidth) {
+                        const Packet biasPacket =
+                          colBias ? xsimd::load_unaligned(colBias + j) : rowBiasPacket;
+                        const Packet val = xsimd::load_unaligned(dst + j) + biasPacket;
+                        Packet(activation.packet(val)).store_unaligned(dst + j);
+                    }
+                }
+
+                for (; j < cols; ++j) {
+                    const Scalar biasVal = colBias ? colBias[j] : rowBias;
+                    dst[j]               = static_cast<Scalar>(activation(dst[j] + biasVal));
+                }
+            }
+        };
+    }
+} // namespace librapid::linalg
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_EPILOGUE_HPP
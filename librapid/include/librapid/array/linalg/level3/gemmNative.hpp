@@ -0,0 +1,423 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_NATIVE_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_NATIVE_HPP
+
+/*
+ * A packed, register-blocked GEMM implementation used when LibRapid is built without a BLAS
+ * library. The structure follows the approach described by Goto and van de Geijn:
+ *
+ *  - C is split into NC-wide column blocks (sized for L3)
+ *  - The shared dimension is split into KC-deep slices (sized so a micro-panel of B fits in L1)
+ *  - A is split into MC-tall row blocks (sized for L2)
+ *  - Blocks of A and B are copied into contiguous, zero-padded "micro-panels" so the innermost
+ *    kernel only ever performs unit-stride loads
+ *  - An MR x NR micro-kernel keeps the block of C in SIMD registers for the entire KC loop
+ *
+ * Transposition of A and B, as well as the scaling by alpha, is folded into the packing step, so
+ * the micro-kernel is the same for all four transpose combinations.
+ *
+ * An optional epilogue (bias, activation, etc.) is applied to each block of C straight after its
+ * final KC slice has been accumulated, while the block is still in cache.
+ */
+
+namespace librapid::linalg::detail {
+    template<typename Scalar>
+    struct GemmKernelInfo {
+        using Packet = xsimd::batch<Scalar>;
+
+        /// Number of elements in a SIMD register
+        static constexpr int64_t packetWidth = Packet::size;
+
+        /// Rows of C computed by a single micro-kernel invocation
+        static constexpr int64_t mr = 6;
+
+        /// Columns of C computed by a single micro-kernel invocation
+        static constexpr int64_t nr = 2 * packetWidth;
+    };
+
+    /// Cache blocking parameters for the native GEMM implementation
+    struct GemmBlocking {
+        int64_t mc; // Rows of A packed per block (L2 resident)
+        int64_t kc; // Depth of each packed block (L1 resident micro-panel of B)
+        int64_t nc; // Columns of B packed per block (L3 resident)
+    };
+
+    /// \brief Compute cache blocking parameters for a GEMM on the current machine
+    ///
+    /// The blocking is derived from the detected cache sizes (``global::l1CacheSize``,
+    /// ``global::l2CacheSize`` and ``global::l3CacheSize``). Roughly half of each cache is
+    /// targeted, leaving space for the streaming operands. KC is rounded to a whole number of
+    /// cache lines, MC to a multiple of MR and NC to a multiple of NR.
+    /// \tparam Scalar Scalar type of the GEMM
+    /// \return Blocking parameters
+    template<typename Scalar>
+    LIBRAPID_NODISCARD GemmBlocking gemmBlocking() {
+        using Info                   = GemmKernelInfo<Scalar>;
+        constexpr int64_t scalarSize = sizeof(Scalar);
+
+        int64_t lineElements = std::max<int64_t>(
+          1, static_cast<int64_t>(global::cacheLineSize) / scalarSize);
+
+        // Half of L1 holds a KC x NR micro-panel of B
+        int64_t kc = static_cast<int64_t>(global::l1CacheSize) / 2 / (Info::nr * scalarSize);
+        kc         = std::clamp<int64_t>((kc / lineElements) * lineElements, 64, 1024);
+
+        // Half of L2 holds an MC x KC block of A
+        int64_t mc = static_cast<int64_t>(global::l2CacheSize) / 2 / (kc * scalarSize);
+        mc         = std::clamp<int64_t>((mc / Info::mr) * Info::mr, Info::mr, 4096);
+
+        // Half of L3 holds a KC x NC block of B
+        int64_t nc = static_cast<int64_t>(global::l3CacheSize) / 2 / (kc * scalarSize);
+        nc         = std::clamp<int64_t>((nc / Info::nr) * Info::nr, Info::nr, 8192);
+
+        return {mc, kc, nc};
+    }
+
+    /// \brief Pack an mc x kc block of op(A), scaled by alpha, into MR-row micro-panels
+    ///
+    /// Within each micro-panel, the MR values for each step along k are stored contiguously.
+    /// Rows beyond the end of the block are zero-filled. Values are converted from \p Source
+    /// to \p Scalar as they are copied.
+    template<typename Scalar, typename Source>
+    void gemmPackA(bool transA, int64_t mc, int64_t kc, Scalar alpha, const Source *a,
+                   int64_t lda, Scalar *packed) {
+        constexpr int64_t mr = GemmKernelInfo<Scalar>::mr;
+
+        for (int64_t ir = 0; ir < mc; ir += mr) {
+            const int64_t rows = std::min(mr, mc - ir);
+            Scalar *dst        = packed + ir * kc;
+
+            if (!transA) {
+                for (int64_t p = 0; p < kc; ++p) {
+                    int64_t i = 0;
+                    for (; i < rows; ++i) {
+                        dst[p * mr + i] = alpha * static_cast<Scalar>(a[(ir + i) * lda + p]);
+                    }
+                    for (; i < mr; ++i) dst[p * mr + i] = Scalar(0);
+                }
+            } else {
+                for (int64_t p = 0; p < kc; ++p) {
+                    const Source *src = a + p * lda + ir;
+                    int64_t i         = 0;
+                    for (; i < rows; ++i) dst[p * mr + i] = alpha * static_cast<Scalar>(src[i]);
+                    for (; i < mr; ++i) dst[p * mr + i] = Scalar(0);
+                }
+            }
+        }
+    }
+
+    /// \brief Pack a kc x nc block of op(B) into NR-column micro-panels
+    ///
+    /// Within each micro-panel, the NR values for each step along k are stored contiguously.
+    /// Columns beyond the end of the block are zero-filled. Values are converted from
+    /// \p Source to \p Scalar as they are copied.
+    template<typename Scalar, typename Source>
+    void gemmPackB(bool transB, int64_t kc, int64_t nc, const Source *b, int64_t ldb,
+                   Scalar *packed, int64_t jrBegin, int64_t jrEnd) {
+        constexpr int64_t nr = GemmKernelInfo<Scalar>::nr;
+
+        for (int64_t jr = jrBegin; jr < jrEnd; jr += nr) {
+            const int64_t cols = std::min(nr, nc - jr);
+            Scalar *dst        = packed + jr * kc;
+
+            if (!transB) {
+                for (int64_t p = 0; p < kc; ++p) {
+                    const Source *src = b + p * ldb + jr;
+                    int64_t j         = 0;
+                    for (; j < cols; ++j) dst[p * nr + j] = static_cast<Scalar>(src[j]);
+                    for (; j < nr; ++j) dst[p * nr + j] = Scalar(0);
+                }
+            } else {
+                for (int64_t p = 0; p < kc; ++p) {
+                    int64_t j = 0;
+                    for (; j < cols; ++j) {
+                        dst[p * nr + j] = static_cast<Scalar>(b[(jr + j) * ldb + p]);
+                    }
+                    for (; j < nr; ++j) dst[p * nr + j] = Scalar(0);
+                }
+            }
+        }
+    }
+
+    /// \brief Compute an MR x NR tile of C += A * B from packed micro-panels
+    ///
+    /// The full tile is accumulated in registers. If the tile lies partially outside of C
+    /// (\p rows < MR or \p cols < NR), it is accumulated into a temporary buffer and only the
+    /// valid region is written back.
+    template<typename Scalar>
+    LIBRAPID_ALWAYS_INLINE void gemmMicroKernel(int64_t kc, const Scalar *__restrict a,
+                                                const Scalar *__restrict b, Scalar *__restrict c,
+                                                int64_t ldc, int64_t rows, int64_t cols) {
+        using Info                  = GemmKernelInfo<Scalar>;
+        using Packet                = typename Info::Packet;
+        constexpr int64_t mr        = Info::mr;
+        constexpr int64_t nr        = Info::nr;
+        constexpr int64_t width     = Info::packetWidth;
+        constexpr int64_t nrPackets = nr / width;
+
+        Packet acc[mr][nrPackets];
+        for (int64_t i = 0; i < mr; ++i) {
+            for (int64_t j = 0; j < nrPackets; ++j) acc[i][j] = Packet(Scalar(0));
+        }
+
+        for (int64_t p = 0; p < kc; ++p) {
+            Packet bPacket[nrPackets];
+            for (int64_t j = 0; j < nrPackets; ++j) {
+                bPacket[j] = xsimd::load_unaligned(b + p * nr + j * width);
+            }
+
+            for (int64_t i = 0; i < mr; ++i) {
+                Packet aBroadcast(a[p * mr + i]);
+                for (int64_t j = 0; j < nrPackets; ++j) {
+                    acc[i][j] = xsimd::fma(aBroadcast, bPacket[j], acc[i][j]);
+                }
+            }
+        }
+
+        if (rows == mr && cols == nr) LIBRAPID_LIKELY {
+            for (int64_t i = 0; i < mr; ++i) {
+                for (int64_t j = 0; j < nrPackets; ++j) {
+                    Scalar *dst = c + i * ldc + j * width;
+                    (xsimd::load_unaligned(dst) + acc[i][j]).store_unaligned(dst);
+                }
+            }
+        } else {
+            alignas(LIBRAPID_MEM_ALIGN) Scalar tile[mr * nr];
+            for (int64_t i = 0; i < mr; ++i) {
+                for (int64_t j = 0; j < nrPackets; ++j) {
+                    acc[i][j].store_unaligned(tile + i * nr + j * width);
+                }
+            }
+
+            for (int64_t i = 0; i < rows; ++i) {
+                for (int64_t j = 0; j < cols; ++j) c[i * ldc + j] += tile[i * nr + j];
+            }
+        }
+    }
+
+    /// \brief Multiply a packed MC x KC block of A by a packed KC x NC block of B
+    ///
+    /// Only the micro-panels of B in [jrBegin, jrEnd) are processed, which allows the column
+    /// loop to be split between threads.
+    template<typename Scalar>
+    void gemmMacroKernel(int64_t mc, int64_t nc, int64_t kc, const Scalar *packedA,
+                         const Scalar *packedB, Scalar *c, int64_t ldc, int64_t jrBegin,
+                         int64_t jrEnd) {
+        constexpr int64_t mr = GemmKernelInfo<Scalar>::mr;
+        constexpr int64_t nr = GemmKernelInfo<Scalar>::nr;
+
+        for (int64_t jr = jrBegin; jr < jrEnd; jr += nr) {
+            const int64_t cols = std::min(nr, nc - jr);
+            for (int64_t ir = 0; ir < mc; ir += mr) {
+                const int64_t rows = std::min(mr, mc - ir);
+                gemmMicroKernel(
+                  kc, packedA + ir * kc, packedB + jr * kc, c + ir * ldc + jr, ldc, rows, cols);
+            }
+        }
+    }
+
+    /// Scale an m x n row-major matrix by beta. A beta of zero overwrites C, so any NaN or
+    /// infinite values already present do not propagate into the result
+    template<typename Scalar>
+    void gemmScaleC(int64_t m, int64_t n, Scalar beta, Scalar *c, int64_t ldc) {
+        if (beta == Scalar(1)) return;
+
+        for (int64_t i = 0; i < m; ++i) {
+            Scalar *row = c + i * ldc;
+            if (beta == Scalar(0)) {
+                std::fill(row, row + n, Scalar(0));
+            } else {
+                for (int64_t j = 0; j < n; ++j) row[j] *= beta;
+            }
+        }
+    }
+
+    /// \brief Native packed GEMM for row-major matrices
+    ///
+    /// Computes \f$ \mathbf{C} = \alpha \mathrm{OP}_A(\mathbf{A}) \mathrm{OP}_B(\mathbf{B}) +
+    /// \beta \mathbf{C} \f$ using cache-blocked, packed micro-panels and an xsimd micro-kernel.
+    /// Parallelism (when enabled) is over blocks of rows of C, or over micro-panels of columns
+    /// if there are too few row blocks to occupy ``global::numThreads`` threads.
+    ///
+    /// If \p epilogue is not empty, it is called on each block of C as soon as the block is
+    /// complete, by the thread which computed it.
+    /// \tparam Scalar ``float`` or ``double``
+    /// \tparam Source Element type of A and B, converted to \p Scalar as the blocks are packed
+    /// \see librapid::linalg::gemm
+    /// \see librapid::linalg::GemmEpilogue
+    template<typename Scalar, typename Source = Scalar>
+    void gemmNative(bool transA, bool transB, int64_t m, int64_t n, int64_t k, Scalar alpha,
+                    const Source *a, int64_t lda, const Source *b, int64_t ldb, Scalar beta,
+                    Scalar *c, int64_t ldc, const GemmEpilogue<Scalar> &epilogue = {}) {
+        using Info = GemmKernelInfo<Scalar>;
+
+        if (m <= 0 || n <= 0) return;
+
+        gemmScaleC(m, n, beta, c, ldc);
+        if (k <= 0 || alpha == Scalar(0)) {
+            gemmApplyEpilogue(epilogue, m, n, c, ldc);
+            return;
+        }
+
+        const GemmBlocking blocking = gemmBlocking<Scalar>();
+        const int64_t mcMax         = blocking.mc;
+        const int64_t kcMax         = blocking.kc;
+        const int64_t ncMax         = blocking.nc;
+
+#if defined(LIBRAPID_HAS_OMP)
+        const int64_t numThreads = std::max<int64_t>(1, static_cast<int64_t>(global::numThreads));
+        // Stay serial when called from inside a parallel region (e.g. a batched GEMM)
+        const bool parallel =
+          numThreads > 1 && !omp_in_parallel() &&
+          static_cast<size_t>(std::max(m, n)) >= global::gemmMultithreadThreshold;
+#else
+        const int64_t numThreads = 1;
+        const bool parallel      = false;
+#endif // LIBRAPID_HAS_OMP
+
+        // Round the panel buffers up so every micro-panel is padded to MR/NR
+        const int64_t mcPadded    = ((std::min(mcMax, m) + Info::mr - 1) / Info::mr) * Info::mr;
+        const int64_t ncPadded    = ((std::min(ncMax, n) + Info::nr - 1) / Info::nr) * Info::nr;
+        const int64_t kcBuffer    = std::min(kcMax, k);
+        const int64_t aBufferSize = mcPadded * kcBuffer;
+        const int64_t bBufferSize = ncPadded * kcBuffer;
+
+        // Both buffers are returned to this allocator, even if the current one changes
+        memory::Allocator &alloc = memory::getAllocator();
+
+        Scalar *packedB = librapid::detail::safeAllocate<Scalar>(bBufferSize, alloc);
+        Scalar *packedA = librapid::detail::safeAllocate<Scalar>(aBufferSize * numThreads, alloc);
+
+        for (int64_t jc = 0; jc < n; jc += ncMax) {
+            const int64_t nc       = std::min(ncMax, n - jc);
+            const int64_t ncPanels = (nc + Info::nr - 1) / Info::nr;
+
+            for (int64_t pc = 0; pc < k; pc += kcMax) {
+                // Blocks of C are final once the last KC slice has been accumulated into them
+                const int64_t kc  = std::min(kcMax, k - pc);
+                const bool finish = epilogue && pc + kc == k;
+
+                const Source *bBlock = transB ? b + jc * ldb + pc : b + pc * ldb + jc;
+
+                if (!parallel) {
+                    gemmPackB(transB, kc, nc, bBlock, ldb, packedB, 0, nc);
+
+                    for (int64_t ic = 0; ic < m; ic += mcMax) {
+                        const int64_t mc     = std::min(mcMax, m - ic);
+                        const Source *aBlock = transA ? a + pc * lda + ic : a + ic * lda + pc;
+                        gemmPackA(transA, mc, kc, alpha, aBlock, lda, packedA);
+                        gemmMacroKernel(mc, nc, kc, packedA, packedB, c + ic * ldc + jc, ldc,
+                                        int64_t(0), nc);
+                        if (finish) epilogue(ic, jc, mc, nc, c + ic * ldc + jc, ldc);
+                    }
+                    continue;
+                }
+
+#if defined(LIBRAPID_HAS_OMP)
+                // Pack B cooperatively -- each thread packs whole micro-panels
+#    pragma omp parallel for shared(transB, kc, nc, ncPanels, bBlock, ldb, packedB) default(none) \
+      num_threads(int(numThreads))
+                for (int64_t panel = 0; panel < ncPanels; ++panel) {
+                    const int64_t jr = panel * Info::nr;
+                    gemmPackB(transB, kc, nc, bBlock, ldb, packedB, jr, jr + Info::nr);
+                }
+
+                const int64_t mBlocks = (m + mcMax - 1) / mcMax;
+
+                if (mBlocks >= numThreads) {
+                    // Enough row blocks to keep every thread busy, so each thread packs and
+                    // multiplies its own block of A
+#    pragma omp parallel for shared(transA, m, mBlocks, mcMax, kc, nc, pc, alpha, a, lda, c,    \
+                                      ldc, jc, packedA, packedB, aBufferSize, finish, epilogue) \
+      default(none) num_threads(int(numThreads)) schedule(dynamic)
+                    for (int64_t block = 0; block < mBlocks; ++block) {
+                        const int64_t ic     = block * mcMax;
+                        const int64_t mc     = std::min(mcMax, m - ic);
+                        const Source *aBlock = transA ? a + pc * lda + ic : a + ic * lda + pc;
+                        Scalar *threadA      = packedA + omp_get_thread_num() * aBufferSize;
+                        gemmPackA(transA, mc, kc, alpha, aBlock, lda, threadA);
+                        gemmMacroKernel(mc, nc, kc, threadA, packedB, c + ic * ldc + jc, ldc,
+                                        int64_t(0), nc);
+                        if (finish) epilogue(ic, jc, mc, nc, c + ic * ldc + jc, ldc);
+                    }
+                } else {
+                    // Few, tall-and-wide blocks -- share each packed block of A and split the
+                    // micro-panels of B between threads instead
+                    for (int64_t ic = 0; ic < m; ic += mcMax) {
+                        const int64_t mc     = std::min(mcMax, m - ic);
+                        const Source *aBlock = transA ? a + pc * lda + ic : a + ic * lda + pc;
+                        gemmPackA(transA, mc, kc, alpha, aBlock, lda, packedA);
+
+#    pragma omp parallel for shared(mc, nc, kc, ncPanels, packedA, packedB, c, ic, ldc, jc,     \
+                                      finish, epilogue) default(none) num_threads(int(numThreads))
+                        for (int64_t panel = 0; panel < ncPanels; ++panel) {
+                            const int64_t jr = panel * Info::nr;
+                            gemmMacroKernel(mc, nc, kc, packedA, packedB, c + ic * ldc + jc, ldc,
+                                            jr, jr + Info::nr);
+                            if (finish) {
+                                const int64_t cols = std::min(int64_t(Info::nr), nc - jr);
+                                epilogue(ic, jc + jr, mc, cols, c + ic * ldc + jc + jr, ldc);
+                            }
+                        }
+                    }
+                }
+#endif // LIBRAPID_HAS_OMP
+            }
+        }
+
+        librapid::detail::safeDeallocate(packedA, aBufferSize * numThreads, alloc);
+        librapid::detail::safeDeallocate(packedB, bBufferSize, alloc);
+    }
+
+    /// \brief Native GEMM for row-major ``bfloat16`` matrices
+    ///
+    /// Blocks of A and B are widened to ``float`` as they are packed, and the product is
+    /// accumulated in a single precision copy of C by ``gemmNative``. Each block of C is rounded
+    /// to ``bfloat16`` once, as soon as it is complete, and \p epilogue is then applied to the
+    /// rounded block.
+    /// \see gemmNative
+    inline void gemmNativeBfloat16(bool transA, bool transB, int64_t m, int64_t n, int64_t k,
+                                   float alpha, const bfloat16 *a, int64_t lda, const bfloat16 *b,
+                                   int64_t ldb, float beta, bfloat16 *c, int64_t ldc,
+                                   const GemmEpilogue<bfloat16> &epilogue = {}) {
+        if (m <= 0 || n <= 0) return;
+
+        memory::Allocator &alloc = memory::getAllocator();
+        float *accumulator       = librapid::detail::safeAllocate<float>(m * n, alloc);
+        for (int64_t i = 0; i < m; ++i) {
+            float *dst          = accumulator + i * n;
+            const bfloat16 *src = c + i * ldc;
+            for (int64_t j = 0; j < n; ++j) {
+                dst[j] = beta == 0.0f ? 0.0f : beta * static_cast<float>(src[j]);
+            }
+        }
+
+        const GemmEpilogue<float> store = [c, ldc, &epilogue](int64_t row,
+                                                              int64_t col,
+                                                              int64_t rows,
+                                                              int64_t cols,
+                                                              float *block,
+                                                              int64_t ldBlock) {
+            using Packet                  = Bfloat16Packet;
+            constexpr int64_t packetWidth = Packet::size;
+
+            for (int64_t i = 0; i < rows; ++i) {
+                const float *src = block + i * ldBlock;
+                bfloat16 *dst    = c + (row + i) * ldc + col;
+                int64_t j        = 0;
+                for (; j + packetWidth <= cols; j += packetWidth) {
+                    Packet(xsimd::load_unaligned(src + j)).store_unaligned(dst + j);
+                }
+                for (; j < cols; ++j) dst[j] = bfloat16(src[j]);
+            }
+
+            if (epilogue) epilogue(row, col, rows, cols, c + row * ldc + col, ldc);
+        };
+
+        gemmNative<float, bfloat16>(
+          transA, transB, m, n, k, alpha, a, lda, b, ldb, 1.0f, accumulator, n, store);
+
+        librapid::detail::safeDeallocate(accumulator, m * n, alloc);
+    }
+} // namespace librapid::linalg::detail
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_GEMM_NATIVE_HPP
@@ -0,0 +1,160 @@
+#ifndef LIBRAPID_ARRAY_LINALG_LEVEL3_SPMM_HPP
+#define LIBRAPID_ARRAY_LINALG_LEVEL3_SPMM_HPP
+
+namespace librapid::linalg {
+    namespace detail {
+        /// Minimum number of columns of C given to each thread by ``spmmCsc``
+        constexpr int64_t spmmStripCols = 64;
+
+        /// \brief Scale an m x n row-major block by \f$ \beta \f$
+        ///
+        /// If \f$ \beta = 0 \f$, the block is zeroed without being read.
+        template<typename Scalar>
+        LIBRAPID_ALWAYS_INLINE void spmmScale(int64_t m, int64_t n, Scalar beta, Scalar *c,
+                                              int64_t ldc) {
+            if (beta == Scalar(1)) return;
+
+            for (int64_t i = 0; i < m; ++i) {
+                Scalar *row = c + i * ldc;
+                if (beta == Scalar(0)) {
+                    std::fill(row, row + n, Scalar(0));
+                } else {
+                    for (int64_t j = 0; j < n; ++j) row[j] *= beta;
+                }
+            }
+        }
+
+        /// \brief Sparse-dense matrix product for a matrix in CSR format
+        ///
+        /// Computes \f$ \mathbf{C} = \alpha \mathbf{A} \mathbf{B} + \beta \mathbf{C} \f$, where
+        /// \f$ \mathbf{B} \f$ and \f$ \mathbf{C} \f$ are row-major. Each row of \f$ \mathbf{C} \f$
+        /// is a sum of the rows of \f$ \mathbf{B} \f$ selected by the matching row of
+        /// \f$ \mathbf{A} \f$, so every access to \f$ \mathbf{B} \f$ and \f$ \mathbf{C} \f$ is
+        /// contiguous. Rows are split between threads in the same way as ``spmvCsr``.
+        template<typename Scalar>
+        void spmmCsr(int64_t m, int64_t n, Scalar alpha, const Scalar *values,
+                     const int64_t *offsets, const int64_t *indices, const Scalar *b, int64_t ldb,
+                     Scalar beta, Scalar *c, int64_t ldc) {
+            if (m <= 0 || n <= 0) return;
+
+            const int64_t nnz   = offsets[m] - offsets[0];
+            const bool parallel =
+              (nnz + m) * n > static_cast<int64_t>(global::multithreadThreshold) &&
+              global::numThreads > 1;
+            const int64_t parts = parallel ? static_cast<int64_t>(global::numThreads) : 1;
+            const std::vector<int64_t> bounds = sparseRowPartition(offsets, m, parts);
+
+#pragma omp parallel for shared(n, alpha, values, offsets, indices, b, ldb, beta, c, ldc, parts,   \
+                                bounds) default(none) if (parallel)                                \
+  num_threads(int(global::numThreads))
+            for (int64_t part = 0; part < parts; ++part) {
+                for (int64_t row = bounds[part]; row < bounds[part + 1]; ++row) {
+                    Scalar *out = c + row * ldc;
+                    spmmScale(int64_t(1), n, beta, out, ldc);
+
+                    for (int64_t i = offsets[row]; i < offsets[row + 1]; ++i) {
+                        const Scalar scale = alpha * values[i];
+                        const Scalar *in   = b + indices[i] * ldb;
+                        for (int64_t j = 0; j < n; ++j) out[j] += scale * in[j];
+                    }
+                }
+            }
+        }
+
+        /// \brief Sparse-dense matrix product for a matrix in CSC format
+        ///
+        /// Computes \f$ \mathbf{C} = \alpha \mathbf{A} \mathbf{B} + \beta \mathbf{C} \f$, where
+        /// \f$ \mathbf{B} \f$ and \f$ \mathbf{C} \f$ are row-major. Each column of
+        /// \f$ \mathbf{A} \f$ scatters into many rows of \f$ \mathbf{C} \f$, so threads are given
+        /// vertical strips of \f$ \mathbf{C} \f$ (and \f$ \mathbf{B} \f$) instead of rows, and
+        /// never write to the same element.
+        template<typename Scalar>
+        void spmmCsc(int64_t m, int64_t n, int64_t k, Scalar alpha, const Scalar *values,
+                     const int64_t *offsets, const int64_t *indices, const Scalar *b, int64_t ldb,
+                     Scalar beta, Scalar *c, int64_t ldc) {
+            if (m <= 0 || n <= 0) return;
+
+            const int64_t nnz   = offsets[k] - offsets[0];
+            const bool parallel =
+              (nnz + m) * n > static_cast<int64_t>(global::multithreadThreshold) &&
+              global::numThreads > 1;
+            const int64_t stripCols =
+              parallel ? std::max(int64_t(spmmStripCols),
+                                  (n + static_cast<int64_t>(global::numThreads) - 1) /
+                                    static_cast<int64_t>(global::numThreads))
+                       : n;
+            const int64_t numStrips = (n + stripCols - 1) / stripCols;
+
+#pragma omp parallel for shared(m, n, k, alpha, values, offsets, indices, b, ldb, beta, c, ldc,    \
+                                stripCols, numStrips) default(none) if (parallel)                  \
+  num_threads(int(global::numThreads))
+            for (int64_t strip = 0; strip < numStrips; ++strip) {
+                const int64_t colBegin = strip * stripCols;
+                const int64_t cols     = std::min(stripCols, n - colBegin);
+                spmmScale(m, cols, beta, c + colBegin, ldc);
+
+                for (int64_t col = 0; col < k; ++col) {
+                    const Scalar *in = b + col * ldb + colBegin;
+                    for (int64_t i = offsets[col]; i < offsets[col + 1]; ++i) {
+                        const Scalar scale = alpha * values[i];
+                        Scalar *out        = c + indices[i] * ldc + colBegin;
+                        for (int64_t j = 0; j < cols; ++j) out[j] += scale * in[j];
+                    }
+                }
+            }
+        }
+    } // namespace detail
+
+    /// \brief Sparse-dense matrix product
+    ///
+    /// Computes \f$ \mathbf{C} = \alpha \mathbf{A} \mathbf{B} + \beta \mathbf{C} \f$ for a sparse
+    /// \f$ m \times k \f$ matrix \f$ \mathbf{A} \f$, a dense, row-major \f$ k \times n \f$
+    /// matrix \f$ \mathbf{B} \f$ and a dense, row-major \f$ m \times n \f$ matrix
+    /// \f$ \mathbf{C} \f$. If \f$ \beta = 0 \f$, \f$ \mathbf{C} \f$ is never read.
+    ///
+    /// cxxblas' ``gecrsmm`` expects column-major dense matrices, so both formats use native,
+    /// multithreaded implementations instead.
+    /// \tparam Scalar Scalar type
+    /// \param a Sparse matrix \f$ \mathbf{A} \f$
+    /// \param n Columns of \f$ \mathbf{B} \f$ and \f$ \mathbf{C} \f$
+    /// \param alpha Scalar \f$ \alpha \f$
+    /// \param b Pointer to \f$ \mathbf{B} \f$
+    /// \param ldb Leading dimension of \f$ \mathbf{B} \f$
+    /// \param beta Scalar \f$ \beta \f$
+    /// \param c Pointer to \f$ \mathbf{C} \f$
+    /// \param ldc Leading dimension of \f$ \mathbf{C} \f$
+    /// \param backend Backend to use for computation
+    template<typename Scalar>
+    void spmm(const SparseMatrix<Scalar> &a, int64_t n, Scalar alpha, const Scalar *b,
+              int64_t ldb, Scalar beta, Scalar *c, int64_t ldc,
+              backend::CPU backend = backend::CPU()) {
+        if (a.format() == SparseFormat::CSR) {
+            detail::spmmCsr(a.rows(),
+                            n,
+                            alpha,
+                            a.values().data(),
+                            a.offsets().data(),
+                            a.indices().data(),
+                            b,
+                            ldb,
+                            beta,
+                            c,
+                            ldc);
+        } else {
+            detail::spmmCsc(a.rows(),
+                            n,
+                            a.cols(),
+                            alpha,
+                            a.values().data(),
+                            a.offsets().data(),
+                            a.indices().data(),
+                            b,
+                            ldb,
+                            beta,
+                            c,
+                            ldc);
+        }
+    }
+} // namespace librapid::linalg
+
+#endif // LIBRAPID_ARRAY_LINALG_LEVEL3_SPMM_HPP
@@ -23,13 +23,36 @@ namespace librapid::typetraits {
 
 #include "transpose.hpp"
 
+#include "level1/common.hpp"
+#include "level1/dot.hpp"
+#include "level1/asum.hpp"
+#include "level1/iamax.hpp"
+#include "level1/nrm2.hpp"
+#include "level1/axpy.hpp"
+#include "level1/scal.hpp"
+
+#include "level3/gemmEpilogue.hpp"
+#include "level3/gemmNative.hpp"
 #include "level3/gemm.hpp" // Included before gemv, since gemm is used in some gemv implementations
 
+#include "level2/gemvNative.hpp"
 #include "level2/gemv.hpp"
+#include "level2/ger.hpp"
+#include "level2/spmv.hpp"
 
 #include "level3/geam.hpp"
+#include "level3/spmm.hpp"
 
 #include "arrayMultiply.hpp"
+#include "sparseArrayMultiply.hpp"
+
+#include "factorisation/lu.hpp"
+#include "factorisation/cholesky.hpp"
+#include "factorisation/qr.hpp"
+#include "factorisation/eigh.hpp"
+#include "factorisation/svd.hpp"
+
+#include "einsum.hpp"
 
 #include "compat.hpp"
 
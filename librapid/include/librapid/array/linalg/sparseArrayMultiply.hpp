@@ -0,0 +1,145 @@
+#ifndef LIBRAPID_ARRAY_LINALG_SPARSE_ARRAY_MULTIPLY_HPP
+#define LIBRAPID_ARRAY_LINALG_SPARSE_ARRAY_MULTIPLY_HPP
+
+namespace librapid {
+	namespace linalg {
+		/// \brief Product of a sparse matrix and a dense vector or matrix
+		///
+		/// Specialisation of ArrayMultiply used when the first operand is a SparseMatrix. A dense
+		/// vector gives a sparse matrix-vector product (see ``spmv``) and a dense matrix gives a
+		/// sparse-dense matrix product (see ``spmm``). The result is dense.
+		/// \tparam SparseScalar Scalar type of the sparse matrix
+		/// \tparam ShapeTypeB Shape of the dense array
+		/// \tparam StorageTypeB Storage type of the dense array
+		/// \tparam Alpha Type of \f$ \alpha \f$ scaling factor
+		/// \tparam Beta Type of \f$ \beta \f$ scaling factor
+		template<typename SparseScalar, typename ShapeTypeB, typename StorageTypeB, typename Alpha,
+				 typename Beta>
+		class ArrayMultiply<MatrixShape, SparseMatrix<SparseScalar>, ShapeTypeB, StorageTypeB,
+							Alpha, Beta> {
+		public:
+			using TypeA		= SparseMatrix<SparseScalar>;
+			using TypeB		= array::ArrayContainer<ShapeTypeB, StorageTypeB>;
+			using ScalarA	= SparseScalar;
+			using ScalarB	= typename StorageTypeB::Scalar;
+			using Scalar	= SparseScalar;
+			using ShapeType = ShapeTypeB;
+			using Backend	= typename typetraits::TypeInfo<TypeB>::Backend;
+
+			static_assert(std::is_same_v<Backend, backend::CPU>,
+						  "Sparse matrix products are only supported on the CPU");
+			static_assert(std::is_same_v<ScalarA, ScalarB>,
+						  "Sparse and dense operands must have the same scalar type");
+
+			ArrayMultiply()										= delete;
+			ArrayMultiply(const ArrayMultiply &)				= default;
+			ArrayMultiply(ArrayMultiply &&) noexcept			= default;
+			ArrayMultiply &operator=(const ArrayMultiply &)		= default;
+			ArrayMultiply &operator=(ArrayMultiply &&) noexcept = default;
+
+			/// \brief Sparse product with a scaling factor
+			/// \param a Sparse matrix
+			/// \param alpha Scaling factor \f$ \alpha \f$
+			/// \param b Dense vector or matrix
+			ArrayMultiply(const TypeA &a, Alpha alpha, TypeB &&b) :
+					m_a(a), m_alpha(static_cast<Scalar>(alpha)), m_b(std::forward<TypeB>(b)),
+					m_shape(calculateShape()) {}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ShapeType shape() const { return m_shape; }
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE size_t size() const { return m_shape.size(); }
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t ndim() const {
+				return m_shape.ndim();
+			}
+
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Scalar alpha() const { return m_alpha; }
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const TypeA &a() const { return m_a; }
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const TypeB &b() const { return m_b; }
+
+			/// \brief Force evaluation of the product, returning an Array object
+			/// \return Array object containing the result
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto eval() const {
+				Array<Scalar, Backend> result(shape());
+				applyTo(result);
+				return result;
+			}
+
+			/// \brief Apply the product to an array container with the correct shape
+			/// \tparam OutShapeType Shape type of the array container
+			/// \tparam OutStorageType Storage type of the array container
+			/// \param out Array container to store the result in
+			template<typename OutShapeType, typename OutStorageType>
+			void applyTo(array::ArrayContainer<OutShapeType, OutStorageType> &out) const {
+				LIBRAPID_ASSERT(out.shape() == m_shape,
+								"Output shape must match the result. Expected: {} -- Got: {}",
+								m_shape,
+								out.shape());
+
+				const Scalar *b = m_b.storage().data();
+				Scalar *c		= out.storage().data();
+
+				if (m_b.ndim() == 1) {
+					spmv(m_a, m_alpha, b, Scalar(0), c, Backend());
+				} else {
+					const int64_t n = m_b.shape()[1];
+					spmm(m_a, n, m_alpha, b, n, Scalar(0), c, n, Backend());
+				}
+			}
+
+			template<typename T, typename Char, size_t N, typename Ctx>
+			void str(const fmt::formatter<T, Char> &format, char bracket, char separator,
+					 const char (&formatString)[N], Ctx &ctx) const {
+				eval().str(format, bracket, separator, formatString, ctx);
+			}
+
+		private:
+			LIBRAPID_NODISCARD ShapeType calculateShape() const {
+				const auto &shapeB = m_b.shape();
+
+				LIBRAPID_ASSERT(shapeB.ndim() == 1 || shapeB.ndim() == 2,
+								"Sparse matrices can only multiply vectors or matrices. Got: {}",
+								shapeB);
+				LIBRAPID_ASSERT(m_a.cols() == int64_t(shapeB[0]),
+								"Columns of A must match rows of B. Expected: {} -- Got: {}",
+								m_a.cols(),
+								shapeB[0]);
+
+				if (shapeB.ndim() == 1) return {m_a.rows()};
+				return {m_a.rows(), int64_t(shapeB[1])};
+			}
+
+			TypeA m_a;		// Sparse matrix
+			Scalar m_alpha; // Scaling factor for A
+			TypeB m_b;		// Dense vector or matrix
+			ShapeType m_shape;
+		};
+	} // namespace linalg
+
+	/// \brief Multiply a sparse matrix by a dense vector or matrix
+	///
+	/// If \p b is a vector, this computes the sparse matrix-vector product
+	/// \f$ y_i = \sum_j a_{ij} b_j \f$. If \p b is a matrix, this computes the sparse-dense
+	/// matrix product \f$ c_{ij} = \sum_k a_{ik} b_{kj} \f$. Scaling factors applied to \p b
+	/// are carried through, but \p b may not be transposed.
+	/// \tparam Scalar Scalar type of the sparse matrix
+	/// \tparam Second Type of the dense operand
+	/// \param a The sparse matrix.
+	/// \param b The dense vector or matrix.
+	/// \return The product, which evaluates to a dense array.
+	template<typename Scalar, typename Second>
+		requires(IsArrayType<Second>::value)
+	auto dot(const SparseMatrix<Scalar> &a, Second &&b) {
+		using ScalarB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Scalar;
+		using BackendB	   = typename typetraits::TypeInfo<std::decay_t<Second>>::Backend;
+		using ArrayB	   = Array<ScalarB, BackendB>;
+		using ShapeTypeB   = typename ArrayB::ShapeType;
+		using StorageTypeB = typename ArrayB::StorageType;
+
+		auto [transB, beta, arrB] = detail::dotHelper(std::forward<Second>(b));
+		LIBRAPID_ASSERT(!transB, "Transposed operands are not supported by sparse products");
+
+		return linalg::ArrayMultiply<MatrixShape, SparseMatrix<Scalar>, ShapeTypeB, StorageTypeB,
+									 Scalar, Scalar>(a, beta, ArrayB(std::move(arrB)));
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_LINALG_SPARSE_ARRAY_MULTIPLY_HPP
@@ -24,8 +24,9 @@ namespace librapid {
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeFloatKernel(float *__restrict out,
-														 float *__restrict in, Alpha alpha,
-														 int64_t cols) {
+														 const float *__restrict in,
+														 Alpha alpha, int64_t inStride,
+														 int64_t outStride) {
 			__m256 r0, r1, r2, r3, r4, r5, r6, r7;
 			__m256 t0, t1, t2, t3, t4, t5, t6, t7;
 
@@ -33,14 +34,14 @@ namespace librapid {
 			_mm256_insertf128_ps(                                                                  \
 			  _mm256_castps128_ps256(_mm_loadu_ps(&(LEFT_))), _mm_loadu_ps(&(RIGHT_)), 1)
 
-			r0 = LOAD256_IMPL(in[0 * cols + 0], in[4 * cols + 0]);
-			r1 = LOAD256_IMPL(in[1 * cols + 0], in[5 * cols + 0]);
-			r2 = LOAD256_IMPL(in[2 * cols + 0], in[6 * cols + 0]);
-			r3 = LOAD256_IMPL(in[3 * cols + 0], in[7 * cols + 0]);
-			r4 = LOAD256_IMPL(in[0 * cols + 4], in[4 * cols + 4]);
-			r5 = LOAD256_IMPL(in[1 * cols + 4], in[5 * cols + 4]);
-			r6 = LOAD256_IMPL(in[2 * cols + 4], in[6 * cols + 4]);
-			r7 = LOAD256_IMPL(in[3 * cols + 4], in[7 * cols + 4]);
+			r0 = LOAD256_IMPL(in[0 * inStride + 0], in[4 * inStride + 0]);
+			r1 = LOAD256_IMPL(in[1 * inStride + 0], in[5 * inStride + 0]);
+			r2 = LOAD256_IMPL(in[2 * inStride + 0], in[6 * inStride + 0]);
+			r3 = LOAD256_IMPL(in[3 * inStride + 0], in[7 * inStride + 0]);
+			r4 = LOAD256_IMPL(in[0 * inStride + 4], in[4 * inStride + 4]);
+			r5 = LOAD256_IMPL(in[1 * inStride + 4], in[5 * inStride + 4]);
+			r6 = LOAD256_IMPL(in[2 * inStride + 4], in[6 * inStride + 4]);
+			r7 = LOAD256_IMPL(in[3 * inStride + 4], in[7 * inStride + 4]);
 
 #		undef LOAD256_IMPL
 
@@ -74,55 +75,45 @@ namespace librapid {
 			__m256 alphaVec = _mm256_set1_ps(alpha);
 
 			// Must store unaligned, since the indices are not guaranteed to be aligned
-			_mm256_storeu_ps(&out[0 * cols], _mm256_mul_ps(r0, alphaVec));
-			_mm256_storeu_ps(&out[1 * cols], _mm256_mul_ps(r1, alphaVec));
-			_mm256_storeu_ps(&out[2 * cols], _mm256_mul_ps(r2, alphaVec));
-			_mm256_storeu_ps(&out[3 * cols], _mm256_mul_ps(r3, alphaVec));
-			_mm256_storeu_ps(&out[4 * cols], _mm256_mul_ps(r4, alphaVec));
-			_mm256_storeu_ps(&out[5 * cols], _mm256_mul_ps(r5, alphaVec));
-			_mm256_storeu_ps(&out[6 * cols], _mm256_mul_ps(r6, alphaVec));
-			_mm256_storeu_ps(&out[7 * cols], _mm256_mul_ps(r7, alphaVec));
+			_mm256_storeu_ps(&out[0 * outStride], _mm256_mul_ps(r0, alphaVec));
+			_mm256_storeu_ps(&out[1 * outStride], _mm256_mul_ps(r1, alphaVec));
+			_mm256_storeu_ps(&out[2 * outStride], _mm256_mul_ps(r2, alphaVec));
+			_mm256_storeu_ps(&out[3 * outStride], _mm256_mul_ps(r3, alphaVec));
+			_mm256_storeu_ps(&out[4 * outStride], _mm256_mul_ps(r4, alphaVec));
+			_mm256_storeu_ps(&out[5 * outStride], _mm256_mul_ps(r5, alphaVec));
+			_mm256_storeu_ps(&out[6 * outStride], _mm256_mul_ps(r6, alphaVec));
+			_mm256_storeu_ps(&out[7 * outStride], _mm256_mul_ps(r7, alphaVec));
 		}
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeDoubleKernel(double *__restrict out,
-														  double *__restrict in, Alpha alpha,
-														  int64_t cols) {
+														  const double *__restrict in,
+														  Alpha alpha, int64_t inStride,
+														  int64_t outStride) {
 			__m256d r0, r1, r2, r3;
 			__m256d t0, t1, t2, t3;
 
-#		define LOAD256_IMPL(LEFT_, RIGHT_)                                                        \
-			_mm256_insertf128_pd(                                                                  \
-			  _mm256_castpd128_pd256(_mm_loadu_pd(&(LEFT_))), _mm_loadu_pd(&(RIGHT_)), 1)
-
-			r0 = LOAD256_IMPL(in[0 * cols + 0], in[2 * cols + 0]);
-			r1 = LOAD256_IMPL(in[1 * cols + 0], in[3 * cols + 0]);
-			r2 = LOAD256_IMPL(in[0 * cols + 2], in[2 * cols + 2]);
-			r3 = LOAD256_IMPL(in[1 * cols + 2], in[3 * cols + 2]);
-
-#		undef LOAD256_IMPL
+			r0 = _mm256_loadu_pd(&in[0 * inStride]);
+			r1 = _mm256_loadu_pd(&in[1 * inStride]);
+			r2 = _mm256_loadu_pd(&in[2 * inStride]);
+			r3 = _mm256_loadu_pd(&in[3 * inStride]);
 
 			t0 = _mm256_unpacklo_pd(r0, r1);
 			t1 = _mm256_unpackhi_pd(r0, r1);
 			t2 = _mm256_unpacklo_pd(r2, r3);
 			t3 = _mm256_unpackhi_pd(r2, r3);
 
-			__m256d v;
-
-			v  = _mm256_shuffle_pd(t0, t2, 0x0);
-			r0 = _mm256_blend_pd(t0, v, 0xC);
-			r1 = _mm256_blend_pd(t2, v, 0x3);
-
-			v  = _mm256_shuffle_pd(t1, t3, 0x0);
-			r2 = _mm256_blend_pd(t1, v, 0xC);
-			r3 = _mm256_blend_pd(t3, v, 0x3);
+			r0 = _mm256_permute2f128_pd(t0, t2, 0x20);
+			r1 = _mm256_permute2f128_pd(t1, t3, 0x20);
+			r2 = _mm256_permute2f128_pd(t0, t2, 0x31);
+			r3 = _mm256_permute2f128_pd(t1, t3, 0x31);
 
 			__m256d alphaVec = _mm256_set1_pd(alpha);
 
-			_mm256_store_pd(&out[0 * cols], _mm256_mul_pd(r0, alphaVec));
-			_mm256_store_pd(&out[1 * cols], _mm256_mul_pd(r1, alphaVec));
-			_mm256_store_pd(&out[2 * cols], _mm256_mul_pd(r2, alphaVec));
-			_mm256_store_pd(&out[3 * cols], _mm256_mul_pd(r3, alphaVec));
+			_mm256_storeu_pd(&out[0 * outStride], _mm256_mul_pd(r0, alphaVec));
+			_mm256_storeu_pd(&out[1 * outStride], _mm256_mul_pd(r1, alphaVec));
+			_mm256_storeu_pd(&out[2 * outStride], _mm256_mul_pd(r2, alphaVec));
+			_mm256_storeu_pd(&out[3 * outStride], _mm256_mul_pd(r3, alphaVec));
 		}
 #	elif !defined(LIBRAPID_APPLE) && LIBRAPID_ARCH >= ARCH_SSE
 
@@ -131,32 +122,42 @@ namespace librapid {
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeFloatKernel(float *__restrict out,
-														 float *__restrict in, Alpha alpha,
-														 int64_t cols) {
-			__m128 tmp3, tmp2, tmp1, tmp0;
-
-			tmp0 = _mm_shuffle_ps(_mm_loadu_ps(in + 0 * cols), _mm_loadu_ps(in + 1 * cols), 0x44);
-			tmp2 = _mm_shuffle_ps(_mm_loadu_ps(in + 0 * cols), _mm_loadu_ps(in + 1 * cols), 0xEE);
-			tmp1 = _mm_shuffle_ps(_mm_loadu_ps(in + 2 * cols), _mm_loadu_ps(in + 3 * cols), 0x44);
-			tmp3 = _mm_shuffle_ps(_mm_loadu_ps(in + 2 * cols), _mm_loadu_ps(in + 3 * cols), 0xEE);
+														 const float *__restrict in,
+														 Alpha alpha, int64_t inStride,
+														 int64_t outStride) {
+			const __m128 row0 = _mm_loadu_ps(in + 0 * inStride);
+			const __m128 row1 = _mm_loadu_ps(in + 1 * inStride);
+			const __m128 row2 = _mm_loadu_ps(in + 2 * inStride);
+			const __m128 row3 = _mm_loadu_ps(in + 3 * inStride);
+
+			__m128 tmp0 = _mm_shuffle_ps(row0, row1, 0x44);
+			__m128 tmp2 = _mm_shuffle_ps(row0, row1, 0xEE);
+			__m128 tmp1 = _mm_shuffle_ps(row2, row3, 0x44);
+			__m128 tmp3 = _mm_shuffle_ps(row2, row3, 0xEE);
+
+			const __m128 col0 = _mm_shuffle_ps(tmp0, tmp1, 0x88);
+			const __m128 col1 = _mm_shuffle_ps(tmp0, tmp1, 0xDD);
+			const __m128 col2 = _mm_shuffle_ps(tmp2, tmp3, 0x88);
+			const __m128 col3 = _mm_shuffle_ps(tmp2, tmp3, 0xDD);
 
 			__m128 alphaVec = _mm_set1_ps(alpha);
 
-			_mm_storeu_ps(out + 0 * cols, _mm_mul_ps(_mm_shuffle_ps(tmp0, tmp1, 0x88), alphaVec));
-			_mm_storeu_ps(out + 1 * cols, _mm_mul_ps(_mm_shuffle_ps(tmp0, tmp1, 0xDD), alphaVec));
-			_mm_storeu_ps(out + 2 * cols, _mm_mul_ps(_mm_shuffle_ps(tmp2, tmp3, 0x88), alphaVec));
-			_mm_storeu_ps(out + 3 * cols, _mm_mul_ps(_mm_shuffle_ps(tmp2, tmp3, 0xDD), alphaVec));
+			_mm_storeu_ps(out + 0 * outStride, _mm_mul_ps(col0, alphaVec));
+			_mm_storeu_ps(out + 1 * outStride, _mm_mul_ps(col1, alphaVec));
+			_mm_storeu_ps(out + 2 * outStride, _mm_mul_ps(col2, alphaVec));
+			_mm_storeu_ps(out + 3 * outStride, _mm_mul_ps(col3, alphaVec));
 		}
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeDoubleKernel(double *__restrict out,
-														  double *__restrict in, Alpha alpha,
-														  int64_t cols) {
+														  const double *__restrict in,
+														  Alpha alpha, int64_t inStride,
+														  int64_t outStride) {
 			__m128d tmp0, tmp1;
 
 			// Load the values from input matrix
-			tmp0 = _mm_loadu_pd(in + 0 * cols);
-			tmp1 = _mm_loadu_pd(in + 1 * cols);
+			tmp0 = _mm_loadu_pd(in + 0 * inStride);
+			tmp1 = _mm_loadu_pd(in + 1 * inStride);
 
 			// Transpose the 2x2 matrix
 			__m128d tmp0Unpck = _mm_unpacklo_pd(tmp0, tmp1);
@@ -164,8 +165,8 @@ namespace librapid {
 
 			// Store the transposed values in the output matrix
 			__m128d alphaVec = _mm_set1_pd(alpha);
-			_mm_storeu_pd(out + 0 * cols, _mm_mul_pd(tmp0Unpck, alphaVec));
-			_mm_storeu_pd(out + 1 * cols, _mm_mul_pd(tmp1Unpck, alphaVec));
+			_mm_storeu_pd(out + 0 * outStride, _mm_mul_pd(tmp0Unpck, alphaVec));
+			_mm_storeu_pd(out + 1 * outStride, _mm_mul_pd(tmp1Unpck, alphaVec));
 		}
 
 #	elif defined(LIBRAPID_NEON)
@@ -174,15 +175,16 @@ namespace librapid {
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeFloatKernel(float *__restrict out,
-														 float *__restrict in, Alpha alpha,
-														 int64_t cols) {
+														 const float *__restrict in,
+														 Alpha alpha, int64_t inStride,
+														 int64_t outStride) {
 			float32x4_t r0, r1, r2, r3;
 			float32x4_t t0, t1, t2, t3;
 
-			r0 = vld1q_f32(&in[0 * cols]);
-			r1 = vld1q_f32(&in[1 * cols]);
-			r2 = vld1q_f32(&in[2 * cols]);
-			r3 = vld1q_f32(&in[3 * cols]);
+			r0 = vld1q_f32(&in[0 * inStride]);
+			r1 = vld1q_f32(&in[1 * inStride]);
+			r2 = vld1q_f32(&in[2 * inStride]);
+			r3 = vld1q_f32(&in[3 * inStride]);
 
 			t0 = vzip1q_f32(r0, r1);
 			t1 = vzip2q_f32(r0, r1);
@@ -196,28 +198,29 @@ namespace librapid {
 
 			float32x4_t alphaVec = vdupq_n_f32(alpha);
 
-			vst1q_f32(&out[0 * cols], vmulq_f32(r0, alphaVec));
-			vst1q_f32(&out[1 * cols], vmulq_f32(r1, alphaVec));
-			vst1q_f32(&out[2 * cols], vmulq_f32(r2, alphaVec));
-			vst1q_f32(&out[3 * cols], vmulq_f32(r3, alphaVec));
+			vst1q_f32(&out[0 * outStride], vmulq_f32(r0, alphaVec));
+			vst1q_f32(&out[1 * outStride], vmulq_f32(r1, alphaVec));
+			vst1q_f32(&out[2 * outStride], vmulq_f32(r2, alphaVec));
+			vst1q_f32(&out[3 * outStride], vmulq_f32(r3, alphaVec));
 		}
 
 		template<typename Alpha>
 		LIBRAPID_ALWAYS_INLINE void transposeDoubleKernel(double *__restrict out,
-														  double *__restrict in, Alpha alpha,
-														  int64_t cols) {
+														  const double *__restrict in,
+														  Alpha alpha, int64_t inStride,
+														  int64_t outStride) {
 			float64x2_t r0, r1;
 
-			r0 = vld1q_f64(&in[0 * cols]);
-			r1 = vld1q_f64(&in[1 * cols]);
+			r0 = vld1q_f64(&in[0 * inStride]);
+			r1 = vld1q_f64(&in[1 * inStride]);
 
 			float64x2_t t0 = vzip1q_f64(r0, r1);
 			float64x2_t t1 = vzip2q_f64(r0, r1);
 
 			float64x2_t alphaVec = vdupq_n_f64(alpha);
 
-			vst1q_f64(&out[0 * cols], vmulq_f64(t0, alphaVec));
-			vst1q_f64(&out[1 * cols], vmulq_f64(t1, alphaVec));
+			vst1q_f64(&out[0 * outStride], vmulq_f64(t0, alphaVec));
+			vst1q_f64(&out[1 * outStride], vmulq_f64(t1, alphaVec));
 		}
 #	endif
 #endif // LIBRAPID_NATIVE_ARCH
@@ -235,133 +238,406 @@ namespace librapid {
 
 	namespace detail {
 		namespace cpu {
+			/// Blocks with no side longer than this are transposed directly, rather than being
+			/// subdivided further. Must be a multiple of every transpose kernel size.
+			constexpr int64_t transposeLeafSize = 32;
+
+			/// An axis permutation with unit axes removed, and with runs of output axes which are
+			/// also adjacent (and in the same order) in the input merged into a single axis.
+			/// Output axis ``i`` has ``extent[i]`` elements, and consecutive elements along it
+			/// are ``inStride[i]`` apart in the input and ``outStride[i]`` apart in the output.
+			struct ReducedPermutation {
+				int64_t ndim = 0;
+				std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> extent {};
+				std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> inStride {};
+				std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> outStride {};
+			};
+
+			/// Reduce the permutation of an array with shape \p shape by \p axes
+			/// \tparam ShapeType The shape type
+			/// \param shape The shape of the input array
+			/// \param axes Output axis ``i`` is input axis ``axes[i]``
+			/// \return The reduced permutation
+			template<typename ShapeType>
+			LIBRAPID_NODISCARD ReducedPermutation reducePermutation(const ShapeType &shape,
+																	const ShapeType &axes) {
+				const int64_t ndim = shape.ndim();
+				std::array<int64_t, LIBRAPID_MAX_ARRAY_DIMS> strides {};
+				int64_t stride = 1;
+				for (int64_t d = ndim - 1; d >= 0; --d) {
+					strides[d] = stride;
+					stride *= static_cast<int64_t>(shape[d]);
+				}
+
+				ReducedPermutation res;
+				for (int64_t i = 0; i < ndim; ++i) {
+					LIBRAPID_ASSERT(static_cast<int64_t>(axes[i]) < ndim,
+									"Transpose axis {} is out of range for an array with {} "
+									"dimensions",
+									axes[i],
+									ndim);
+
+					const int64_t extent = shape[axes[i]];
+					if (extent == 1) continue;
+
+					// This axis directly follows the previous one in the input, so the two can be
+					// iterated over as one
+					const int64_t inStride = strides[axes[i]];
+					const int64_t prev	   = res.ndim - 1;
+					if (prev >= 0 && res.inStride[prev] == extent * inStride) {
+						res.extent[prev] *= extent;
+						res.inStride[prev] = inStride;
+					} else {
+						res.extent[res.ndim]   = extent;
+						res.inStride[res.ndim] = inStride;
+						++res.ndim;
+					}
+				}
+
+				stride = 1;
+				for (int64_t d = res.ndim - 1; d >= 0; --d) {
+					res.outStride[d] = stride;
+					stride *= res.extent[d];
+				}
+
+				return res;
+			}
+
+			/// Compute the input and output offsets of the \p index'th combination of the axes of
+			/// \p perm, excluding axes \p skipA and \p skipB
+			/// \param perm The reduced permutation
+			/// \param index The index of the combination
+			/// \param skipA An axis to exclude
+			/// \param skipB Another axis to exclude (may equal \p skipA)
+			/// \param inOffset Set to the offset into the input
+			/// \param outOffset Set to the offset into the output
+			LIBRAPID_ALWAYS_INLINE void batchOffsets(const ReducedPermutation &perm, int64_t index,
+													 int64_t skipA, int64_t skipB,
+													 int64_t &inOffset, int64_t &outOffset) {
+				inOffset  = 0;
+				outOffset = 0;
+				for (int64_t d = perm.ndim - 1; d >= 0 && index > 0; --d) {
+					if (d == skipA || d == skipB) continue;
+					const int64_t i = index % perm.extent[d];
+					index /= perm.extent[d];
+					inOffset += i * perm.inStride[d];
+					outOffset += i * perm.outStride[d];
+				}
+			}
+
+			/// Transpose a \p rows x \p cols block directly, using the architecture-specific
+			/// kernels for full tiles where they are available:
+			/// ``out[c * outStride + r] = in[r * inStride + c] * alpha``
 			template<typename Scalar, typename Alpha>
-			LIBRAPID_ALWAYS_INLINE void
-			transposeImpl(Scalar *__restrict out, const Scalar *__restrict in, int64_t rows,
-						  int64_t cols, Alpha alpha, int64_t blockSize) {
-#if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#	pragma omp parallel for shared(rows, cols, blockSize, in, out, alpha) default(none)           \
-	  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-								for (int64_t col = j; col < j + blockSize && col < cols; ++col) {
-									out[col * rows + row] = in[row * cols + col] * alpha;
-								}
+			LIBRAPID_ALWAYS_INLINE void transposeLeaf(Scalar *__restrict out,
+													  const Scalar *__restrict in, int64_t rows,
+													  int64_t cols, int64_t inStride,
+													  int64_t outStride, Alpha alpha) {
+				constexpr int64_t kernelSize = []() {
+					if constexpr (std::is_same_v<Scalar, float>) {
+						return LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE;
+					} else if constexpr (std::is_same_v<Scalar, double>) {
+						return LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE;
+					} else {
+						return 0;
+					}
+				}();
+
+				int64_t tileRows = 0, tileCols = 0;
+				if constexpr (kernelSize > 0) {
+					tileRows = rows - rows % kernelSize;
+					tileCols = cols - cols % kernelSize;
+
+					for (int64_t i = 0; i < tileRows; i += kernelSize) {
+						for (int64_t j = 0; j < tileCols; j += kernelSize) {
+							Scalar *tileOut		  = out + j * outStride + i;
+							const Scalar *tileIn = in + i * inStride + j;
+#if LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
+							if constexpr (std::is_same_v<Scalar, float>) {
+								kernels::transposeFloatKernel(
+								  tileOut, tileIn, alpha, inStride, outStride);
 							}
+#endif // LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
+#if LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE > 0
+							if constexpr (std::is_same_v<Scalar, double>) {
+								kernels::transposeDoubleKernel(
+								  tileOut, tileIn, alpha, inStride, outStride);
+							}
+#endif // LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE > 0
 						}
 					}
-				} else
+				}
+
+				// Rows and columns which do not fill a complete tile
+				for (int64_t row = 0; row < rows; ++row) {
+					const int64_t colStart = row < tileRows ? tileCols : 0;
+					for (int64_t col = colStart; col < cols; ++col) {
+						out[col * outStride + row] = in[row * inStride + col] * alpha;
+					}
+				}
+			}
+
+			/// Cache-oblivious transposition of a \p rows x \p cols block. The longer side is
+			/// halved until the block is small enough to fit in cache at any level, at which point
+			/// it is transposed directly.
+			/// \see transposeLeaf
+			template<typename Scalar, typename Alpha>
+			void transposeRecursive(Scalar *__restrict out, const Scalar *__restrict in,
+									int64_t rows, int64_t cols, int64_t inStride,
+									int64_t outStride, Alpha alpha) {
+				if (rows <= transposeLeafSize && cols <= transposeLeafSize) {
+					transposeLeaf(out, in, rows, cols, inStride, outStride, alpha);
+				} else if (rows >= cols) {
+					// Split on a multiple of the leaf size, so kernel tiles are never cut in half
+					const int64_t half = (rows / 2 + transposeLeafSize - 1) / transposeLeafSize *
+										 transposeLeafSize;
+					transposeRecursive(out, in, half, cols, inStride, outStride, alpha);
+					transposeRecursive(out + half,
+									   in + half * inStride,
+									   rows - half,
+									   cols,
+									   inStride,
+									   outStride,
+									   alpha);
+				} else {
+					const int64_t half = (cols / 2 + transposeLeafSize - 1) / transposeLeafSize *
+										 transposeLeafSize;
+					transposeRecursive(out, in, rows, half, inStride, outStride, alpha);
+					transposeRecursive(out + half * outStride,
+									   in + half,
+									   rows,
+									   cols - half,
+									   inStride,
+									   outStride,
+									   alpha);
+				}
+			}
+
+			/// Permute the axes of a contiguous array. Output axis ``i`` is input axis
+			/// ``axes[i]``, and every element is multiplied by \p alpha.
+			///
+			/// Unit axes are dropped and axes which stay adjacent are merged. If the innermost
+			/// axis is unchanged, the result is a batch of scaled copies. Otherwise, it is a batch
+			/// of 2D transposes between the innermost input axis and the innermost output axis,
+			/// each of which is evaluated with cache-oblivious blocking. The batch (and, if it is
+			/// too small to occupy every thread, the rows of each transpose) are divided between
+			/// threads.
+			/// \tparam Scalar The scalar type
+			/// \tparam ShapeType The shape type
+			/// \tparam Alpha The scaling factor type
+			/// \param out The output data
+			/// \param in The input data
+			/// \param shape The shape of the input
+			/// \param axes The permutation to apply
+			/// \param alpha The scaling factor
+			template<typename Scalar, typename ShapeType, typename Alpha>
+			void transposeImpl(Scalar *__restrict out, const Scalar *__restrict in,
+							   const ShapeType &shape, const ShapeType &axes, Alpha alpha) {
+				const int64_t size = shape.size();
+				if (size == 0) return;
+
+				const ReducedPermutation perm = reducePermutation(shape, axes);
+				if (perm.ndim == 0) {
+					out[0] = in[0] * alpha;
+					return;
+				}
+
+#if defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
+				const bool parallel = false;
+#else
+				const bool parallel = size > static_cast<int64_t>(global::multithreadThreshold) &&
+									  global::numThreads > 1;
 #endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
-				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-								for (int64_t col = j; col < j + blockSize && col < cols; ++col) {
-									out[col * rows + row] = in[row * cols + col] * alpha;
-								}
-							}
+
+				// The innermost output axis is contiguous in the output, and the innermost input
+				// axis (the only one with unit stride) is contiguous in the input
+				const int64_t rowAxis = perm.ndim - 1;
+				int64_t colAxis		  = 0;
+				while (perm.inStride[colAxis] != 1) ++colAxis;
+
+				if (colAxis == rowAxis) {
+					const int64_t run	= perm.extent[rowAxis];
+					const int64_t batch = size / run;
+
+#pragma omp parallel for shared(out, in, perm, alpha, run, batch, rowAxis) default(none)           \
+  if (parallel) num_threads(int(global::numThreads))
+					for (int64_t b = 0; b < batch; ++b) {
+						int64_t inOffset, outOffset;
+						batchOffsets(perm, b, rowAxis, rowAxis, inOffset, outOffset);
+						for (int64_t i = 0; i < run; ++i) {
+							out[outOffset + i] = in[inOffset + i] * alpha;
 						}
 					}
+					return;
+				}
+
+				const int64_t rows		= perm.extent[rowAxis];
+				const int64_t cols		= perm.extent[colAxis];
+				const int64_t inStride	= perm.inStride[rowAxis];
+				const int64_t outStride = perm.outStride[colAxis];
+				const int64_t batch		= size / (rows * cols);
+
+				// If there are fewer transposes than threads, split each one into bands of rows
+				int64_t bandRows = rows;
+				if (parallel && batch < static_cast<int64_t>(global::numThreads)) {
+					const int64_t threads = static_cast<int64_t>(global::numThreads);
+					const int64_t bands	  = (threads + batch - 1) / batch;
+					bandRows = ((rows + bands - 1) / bands + transposeLeafSize - 1) /
+							   transposeLeafSize * transposeLeafSize;
+				}
+				const int64_t bands = (rows + bandRows - 1) / bandRows;
+
+#pragma omp parallel for shared(out, in, perm, alpha, rows, cols, inStride, outStride, batch,      \
+								  bandRows, bands, rowAxis, colAxis) default(none)                 \
+  if (parallel) num_threads(int(global::numThreads))
+				for (int64_t task = 0; task < batch * bands; ++task) {
+					int64_t inOffset, outOffset;
+					batchOffsets(perm, task / bands, rowAxis, colAxis, inOffset, outOffset);
+
+					const int64_t rowBegin = (task % bands) * bandRows;
+					const int64_t rowEnd   = std::min(rowBegin + bandRows, rows);
+					transposeRecursive(out + outOffset + rowBegin,
+									   in + inOffset + rowBegin * inStride,
+									   rowEnd - rowBegin,
+									   cols,
+									   inStride,
+									   outStride,
+									   alpha);
 				}
 			}
 
-#if LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
-			template<typename Alpha>
-			LIBRAPID_ALWAYS_INLINE void transposeImpl(float *__restrict out, float *__restrict in,
-													  int64_t rows, int64_t cols, Alpha alpha,
-													  int64_t) {
-				constexpr int64_t blockSize = LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE;
-
-#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#		pragma omp parallel for shared(rows, cols, in, out, alpha) default(none)                  \
-		  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeFloatKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col];
-									}
-								}
+			/// Transpose an ``n x n`` matrix in place. Blocks on the diagonal have their elements
+			/// swapped directly, while each pair of blocks mirrored across the diagonal is swapped
+			/// through a small per-thread buffer, using the same kernels as the out-of-place
+			/// transpose.
+			/// \tparam Scalar The scalar type
+			/// \param data The matrix data
+			/// \param n The number of rows (and columns) in the matrix
+			template<typename Scalar>
+			void transposeInPlaceSquare(Scalar *__restrict data, int64_t n) {
+				const int64_t numBlocks = (n + transposeLeafSize - 1) / transposeLeafSize;
+				const bool parallel = n * n > static_cast<int64_t>(global::multithreadThreshold) &&
+									  global::numThreads > 1;
+
+#pragma omp parallel shared(data, n, numBlocks) default(none) if (parallel)                        \
+  num_threads(int(global::numThreads))
+				{
+					std::vector<Scalar> buffer(transposeLeafSize * transposeLeafSize);
+
+#pragma omp for schedule(dynamic)
+					for (int64_t blockRow = 0; blockRow < numBlocks; ++blockRow) {
+						const int64_t row  = blockRow * transposeLeafSize;
+						const int64_t rows = std::min(n - row, int64_t(transposeLeafSize));
+
+						for (int64_t i = row; i < row + rows; ++i) {
+							for (int64_t j = i + 1; j < row + rows; ++j) {
+								std::swap(data[i * n + j], data[j * n + i]);
 							}
 						}
-					}
-				} else
-#	endif
-				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeFloatKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col];
-									}
+
+						for (int64_t blockCol = blockRow + 1; blockCol < numBlocks; ++blockCol) {
+							const int64_t col  = blockCol * transposeLeafSize;
+							const int64_t cols = std::min(n - col, int64_t(transposeLeafSize));
+							Scalar *upper	   = data + row * n + col;
+							Scalar *lower	   = data + col * n + row;
+
+							transposeLeaf(
+							  buffer.data(), upper, rows, cols, n, transposeLeafSize, Scalar(1));
+							transposeLeaf(upper, lower, cols, rows, n, n, Scalar(1));
+							for (int64_t i = 0; i < cols; ++i) {
+								for (int64_t j = 0; j < rows; ++j) {
+									lower[i * n + j] = buffer[i * transposeLeafSize + j];
 								}
 							}
 						}
 					}
 				}
 			}
-#endif // LIBRAPID_F32_TRANSPOSE_KERNEL_SIZE > 0
 
-#if LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE > 0
-			template<typename Alpha>
-			LIBRAPID_ALWAYS_INLINE void transposeImpl(double *__restrict out, double *__restrict in,
-													  int64_t rows, int64_t cols, Alpha alpha,
-													  int64_t) {
-				constexpr int64_t blockSize = LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE;
-
-#	if !defined(LIBRAPID_OPTIMISE_SMALL_ARRAYS)
-				if (rows * cols > global::multithreadThreshold) {
-#		pragma omp parallel for shared(rows, cols, in, out, alpha) default(none)                  \
-		  num_threads((int)global::numThreads)
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeDoubleKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col] * alpha;
-									}
+			/// Transpose a ``rows x cols`` matrix in place, using the decomposition described in
+			/// "A Decomposition for In-place Matrix Transposition" (Catanzaro et al., 2014).
+			///
+			/// Rather than following the cycles of the transposition permutation, which are hard
+			/// to divide between threads, the transpose is split into three passes, each of
+			/// which permutes the elements within every column or within every row
+			/// independently:
+			///  1. Rotate column ``j`` down by ``j / (cols / gcd(rows, cols))`` (only needed when
+			///     ``rows`` and ``cols`` are not coprime), so that no row contains two elements
+			///     with the same destination column
+			///  2. Move every element to its destination column within its row
+			///  3. Move every element to its destination row within its column
+			///
+			/// Each pass needs a buffer of ``O(max(rows, cols))`` elements per thread.
+			/// \tparam Scalar The scalar type
+			/// \param data The matrix data
+			/// \param rows The number of rows in the matrix
+			/// \param cols The number of columns in the matrix
+			template<typename Scalar>
+			void transposeInPlaceRectangular(Scalar *__restrict data, int64_t rows, int64_t cols) {
+				const int64_t numBlocks = (cols + transposeLeafSize - 1) / transposeLeafSize;
+				const int64_t rotation	= cols / std::gcd(rows, cols);
+				const bool parallel =
+				  rows * cols > static_cast<int64_t>(global::multithreadThreshold) &&
+				  global::numThreads > 1;
+
+				// Passes 1 and 3 gather each element of a block of columns from a source row
+				auto permuteColumns = [&](auto &&sourceRow) {
+#pragma omp parallel shared(data, rows, cols, numBlocks, sourceRow) default(none) if (parallel)    \
+  num_threads(int(global::numThreads))
+					{
+						std::vector<Scalar> buffer(rows * transposeLeafSize);
+
+#pragma omp for
+						for (int64_t block = 0; block < numBlocks; ++block) {
+							const int64_t col	= block * transposeLeafSize;
+							const int64_t count = std::min(cols - col, int64_t(transposeLeafSize));
+
+							for (int64_t i = 0; i < rows; ++i) {
+								Scalar *tile = buffer.data() + i * transposeLeafSize;
+								for (int64_t j = 0; j < count; ++j) {
+									tile[j] = data[sourceRow(i, col + j) * cols + col + j];
+								}
+							}
+
+							for (int64_t i = 0; i < rows; ++i) {
+								const Scalar *tile = buffer.data() + i * transposeLeafSize;
+								for (int64_t j = 0; j < count; ++j) {
+									data[i * cols + col + j] = tile[j];
 								}
 							}
 						}
 					}
-				} else
-#	endif // LIBRAPID_OPTIMISE_SMALL_ARRAYS
+				};
+
+				if (rotation != cols) {
+					permuteColumns([rows, rotation](int64_t i, int64_t j) {
+						return (i + rows - j / rotation) % rows;
+					});
+				}
+
+#pragma omp parallel shared(data, rows, cols, rotation) default(none) if (parallel)                \
+  num_threads(int(global::numThreads))
 				{
-					for (int64_t i = 0; i < rows; i += blockSize) {
-						for (int64_t j = 0; j < cols; j += blockSize) {
-							if (i + blockSize <= rows && j + blockSize <= cols) {
-								kernels::transposeDoubleKernel(
-								  &out[j * rows + i], &in[i * cols + j], alpha, rows);
-							} else {
-								for (int64_t row = i; row < i + blockSize && row < rows; ++row) {
-									for (int64_t col = j; col < j + blockSize && col < cols;
-										 ++col) {
-										out[col * rows + row] = in[row * cols + col] * alpha;
-									}
-								}
-							}
+					std::vector<Scalar> buffer(cols);
+
+#pragma omp for
+					for (int64_t i = 0; i < rows; ++i) {
+						Scalar *row = data + i * cols;
+						for (int64_t j = 0; j < cols; ++j) {
+							const int64_t source = (i + rows - j / rotation) % rows;
+							buffer[(j * rows + source) % cols] = row[j];
 						}
+						for (int64_t j = 0; j < cols; ++j) { row[j] = buffer[j]; }
 					}
 				}
+
+				permuteColumns([rows, cols, rotation](int64_t i, int64_t j) {
+					// The element which belongs at (i, j) started at index i * cols + j of the
+					// transposed matrix, and was moved to this row in the first pass
+					const int64_t index = i * cols + j;
+					return (index % rows + index / rows / rotation) % rows;
+				});
 			}
-#endif // LIBRAPID_F64_TRANSPOSE_KERNEL_SIZE > 0
 		} // namespace cpu
 
 #if defined(LIBRAPID_HAS_OPENCL)
@@ -640,22 +916,16 @@ namespace librapid {
 		template<typename ShapeType_, typename StorageType_>
 		void Transpose<T>::applyTo(ArrayContainer<ShapeType_, StorageType_> &out) const {
 			bool inplace = ((void *)&out) == ((void *)&m_array);
-			LIBRAPID_ASSERT(!inplace, "Cannot transpose inplace");
+			LIBRAPID_ASSERT(!inplace, "Cannot transpose inplace. Use transposeInPlace instead");
 			LIBRAPID_ASSERT(out.shape() == m_outputShape, "Transpose assignment shape mismatch");
 
 			if constexpr (isArray) {
 				if constexpr (isHost) {
-					auto *__restrict outPtr = out.storage().begin();
-					auto *__restrict inPtr	= m_array.storage().begin();
-					int64_t blockSize		= global::cacheLineSize / sizeof(Scalar);
-
-					if (m_inputShape.ndim() == 2) {
-						detail::cpu::transposeImpl(
-						  outPtr, inPtr, m_inputShape[0], m_inputShape[1], m_alpha, blockSize);
-
-					} else {
-						LIBRAPID_NOT_IMPLEMENTED
-					}
+					detail::cpu::transposeImpl(out.storage().data(),
+											   m_array.storage().data(),
+											   m_inputShape,
+											   m_axes,
+											   m_alpha);
 				}
 #if defined(LIBRAPID_HAS_OPENCL)
 				else if constexpr (isOpenCL) {
@@ -712,12 +982,13 @@ namespace librapid {
 		}
 	}; // namespace array
 
-	template<typename T, typename ShapeType = MatrixShape>
+	template<typename T, typename ShapeType = typename std::decay_t<T>::ShapeType>
 		requires(typetraits::IsSizeType<ShapeType>::value)
 	auto transpose(T &&array, const ShapeType &axes = ShapeType()) {
-		// If axes is empty, transpose the array in reverse order
+		// If axes is empty, transpose the array in reverse order. A default-constructed Shape has
+		// no dimensions, while a default-constructed MatrixShape is {0, 0}
 		ShapeType newAxes = axes;
-		if (axes.size() == 0) {
+		if (axes.ndim() == 0 || axes.size() == 0) {
 			newAxes = ShapeType::zeros(array.ndim());
 			for (size_t i = 0; i < array.ndim(); i++) { newAxes[i] = array.ndim() - i - 1; }
 		}
@@ -725,6 +996,45 @@ namespace librapid {
 		return array::Transpose<T>(std::forward<T>(array), newAxes);
 	}
 
+	/// Transpose a matrix in place, swapping the dimensions of its shape. Unlike ``transpose``,
+	/// no second matrix is needed to hold the result, which halves the peak memory usage for
+	/// large matrices. Square matrices are transposed by swapping blocks across the diagonal,
+	/// and rectangular matrices by permuting their rows and columns in three passes.
+	/// \tparam ShapeType The shape type of the matrix
+	/// \tparam StorageType The storage type of the matrix
+	/// \param array The matrix to transpose
+	template<typename ShapeType, typename StorageType>
+	void transposeInPlace(array::ArrayContainer<ShapeType, StorageType> &array) {
+		using Backend =
+		  typename typetraits::TypeInfo<array::ArrayContainer<ShapeType, StorageType>>::Backend;
+		static_assert(std::is_same_v<Backend, backend::CPU>,
+					  "In-place transposition is only supported for host arrays");
+		LIBRAPID_ASSERT(array.ndim() == 2,
+						"In-place transposition requires a matrix, but the array has {} "
+						"dimensions",
+						array.ndim());
+
+#if defined(LIBRAPID_HAS_MMAP)
+		if constexpr (typetraits::IsMmapStorage<StorageType>::value) {
+			LIBRAPID_ASSERT(array.storage().mode() != MmapMode::ReadOnly,
+							"Cannot transpose a read-only memory-mapped array in place");
+		}
+#endif // LIBRAPID_HAS_MMAP
+
+		auto &shape		   = array.shape();
+		const int64_t rows = shape[0];
+		const int64_t cols = shape[1];
+
+		if (rows == cols) {
+			detail::cpu::transposeInPlaceSquare(array.storage().data(), rows);
+		} else if (rows > 1 && cols > 1) {
+			detail::cpu::transposeInPlaceRectangular(array.storage().data(), rows, cols);
+		}
+
+		shape[0] = cols;
+		shape[1] = rows;
+	}
+
 	namespace typetraits {
 		template<typename Descriptor, typename TransposeType, typename ScalarType>
 		struct HasCustomEval<detail::Function<Descriptor, detail::Multiply,
@@ -0,0 +1,553 @@
+#ifndef LIBRAPID_ARRAY_MMAP_STORAGE_HPP
+#define LIBRAPID_ARRAY_MMAP_STORAGE_HPP
+
+/*
+ * This file defines the MmapStorage class, which backs an array with a memory-mapped file.
+ * Pages are read in (and written back) by the operating system on demand, so arrays larger
+ * than the available memory can be evaluated without being read into the heap.
+ */
+
+namespace librapid {
+	namespace typetraits {
+		template<typename T>
+		struct IsMmapStorage : std::false_type {};
+
+		template<typename Scalar>
+		struct IsMmapStorage<MmapStorage<Scalar>> : std::true_type {};
+
+		/// Evaluates as true if the input type is an ArrayContainer backed by an MmapStorage
+		/// object, or a Function which references one (directly or through another Function)
+		/// \tparam T Input type
+		template<typename T>
+		struct ContainsMmapStorage : std::false_type {};
+
+		template<typename ShapeType, typename Scalar>
+		struct ContainsMmapStorage<array::ArrayContainer<ShapeType, MmapStorage<Scalar>>>
+				: std::true_type {};
+
+		template<typename desc, typename Functor, typename... Args>
+		struct ContainsMmapStorage<detail::Function<desc, Functor, Args...>>
+				: std::disjunction<ContainsMmapStorage<std::decay_t<Args>>...> {};
+	} // namespace typetraits
+
+#if defined(LIBRAPID_HAS_MMAP)
+	/// The access mode of a memory-mapped file
+	enum class MmapMode {
+		ReadOnly,	 /// The file is mapped read-only. The array must not be written to
+		CopyOnWrite, /// Writes are private to this process and never reach the file
+		ReadWrite	 /// Writes are written back to the file, which is created or extended
+	};
+
+	namespace typetraits {
+		template<typename Scalar_>
+		struct TypeInfo<MmapStorage<Scalar_>> {
+			static constexpr bool isLibRapidType = true;
+			using Scalar						 = Scalar_;
+			using Backend						 = backend::CPU;
+		};
+	} // namespace typetraits
+
+	namespace detail {
+		/// Return the size of a virtual memory page in bytes
+		LIBRAPID_NODISCARD inline size_t pageSize() {
+			static const size_t size = static_cast<size_t>(::sysconf(_SC_PAGESIZE));
+			return size;
+		}
+
+		/// A single memory mapping. It is shared between every MmapStorage object that references
+		/// it and unmapped when the last of them is destroyed.
+		struct MemoryMapping {
+			void *address	= nullptr; // Page-aligned start of the mapping
+			size_t bytes	= 0;	   // Length of the mapping in bytes
+			bool fileBacked = false;   // False for anonymous memory
+			std::string path;		   // Path of the mapped file, if any
+
+			MemoryMapping() = default;
+			MemoryMapping(const MemoryMapping &) = delete;
+			MemoryMapping &operator=(const MemoryMapping &) = delete;
+
+			~MemoryMapping() {
+				if (address != nullptr) ::munmap(address, bytes);
+			}
+		};
+
+		/// Throw a std::runtime_error describing the system call which just failed
+		/// \param call Name of the system call
+		/// \param path Path of the file being operated on
+		[[noreturn]] inline void throwMmapError(const char *call, const std::string &path) {
+			throw std::runtime_error(
+			  fmt::format("{} failed for '{}': {}", call, path, std::strerror(errno)));
+		}
+
+		/// Map \p bytes bytes of zero-initialised anonymous memory
+		/// \param bytes Number of bytes to map
+		/// \return The new mapping
+		inline std::shared_ptr<MemoryMapping> mapAnonymous(size_t bytes) {
+			auto mapping = std::make_shared<MemoryMapping>();
+			if (bytes == 0) return mapping;
+
+			void *address =
+			  ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+			if (address == MAP_FAILED) LIBRAPID_UNLIKELY { throw std::bad_alloc(); }
+
+			mapping->address = address;
+			mapping->bytes	 = bytes;
+			return mapping;
+		}
+
+		/// Check that \p offset, in bytes, keeps a mapped array aligned to LIBRAPID_MEM_ALIGN
+		/// \param offset Offset into the file in bytes
+		/// \return \p offset
+		/// \throws std::invalid_argument if \p offset is not a multiple of LIBRAPID_MEM_ALIGN
+		inline size_t checkMapOffset(size_t offset) {
+			if (offset % LIBRAPID_MEM_ALIGN != 0) LIBRAPID_UNLIKELY {
+				throw std::invalid_argument(fmt::format(
+				  "Offset {} is not a multiple of {} bytes", offset, LIBRAPID_MEM_ALIGN));
+			}
+			return offset;
+		}
+
+		/// Map \p bytes bytes of the file at \p path, starting \p offset bytes into the file. The
+		/// mapping starts at the page containing \p offset, so the data itself begins
+		/// ``offset % pageSize()`` bytes into it.
+		/// \param path Path of the file to map
+		/// \param offset Offset into the file in bytes
+		/// \param bytes Number of bytes to map
+		/// \param mode Access mode of the mapping
+		/// \return The new mapping
+		inline std::shared_ptr<MemoryMapping> mapFile(const std::string &path, size_t offset,
+													  size_t bytes, MmapMode mode) {
+			const bool writeBack = mode == MmapMode::ReadWrite;
+			const int fd = writeBack ? ::open(path.c_str(), O_RDWR | O_CREAT, 0644)
+									 : ::open(path.c_str(), O_RDONLY);
+			if (fd < 0) LIBRAPID_UNLIKELY { throwMmapError("open", path); }
+
+			// The mapping remains valid after the file is closed, so the descriptor is only
+			// needed until mmap returns
+			struct FileCloser {
+				int fd;
+				~FileCloser() { ::close(fd); }
+			} closer {fd};
+
+			struct stat info {};
+			if (::fstat(fd, &info) != 0) LIBRAPID_UNLIKELY { throwMmapError("fstat", path); }
+
+			const auto required = static_cast<off_t>(offset + bytes);
+			if (info.st_size < required) {
+				if (!writeBack) {
+					throw std::runtime_error(fmt::format(
+					  "'{}' holds {} bytes, but {} are required", path, info.st_size, required));
+				}
+				if (::ftruncate(fd, required) != 0) LIBRAPID_UNLIKELY {
+					throwMmapError("ftruncate", path);
+				}
+			}
+
+			auto mapping		= std::make_shared<MemoryMapping>();
+			mapping->fileBacked = true;
+			mapping->path		= path;
+			if (bytes == 0) return mapping;
+
+			const size_t pageOffset = offset % pageSize();
+
+			const int protection = mode == MmapMode::ReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+			const int flags		 = writeBack ? MAP_SHARED : MAP_PRIVATE;
+
+			void *address = ::mmap(nullptr,
+								   bytes + pageOffset,
+								   protection,
+								   flags,
+								   fd,
+								   static_cast<off_t>(offset - pageOffset));
+			if (address == MAP_FAILED) LIBRAPID_UNLIKELY { throwMmapError("mmap", path); }
+
+			mapping->address = address;
+			mapping->bytes	 = bytes + pageOffset;
+
+			// Expressions are evaluated front to back, so ask for aggressive read-ahead
+			::madvise(address, mapping->bytes, MADV_SEQUENTIAL);
+			return mapping;
+		}
+
+		/// Apply \p advice to every page overlapping the byte range [begin, end)
+		/// \param begin Start of the range
+		/// \param end End of the range
+		/// \param advice The madvise advice to apply
+		LIBRAPID_ALWAYS_INLINE void adviseRange(const void *begin, const void *end, int advice) {
+			const auto first = reinterpret_cast<uintptr_t>(begin) & ~(pageSize() - 1);
+			const auto last	 = reinterpret_cast<uintptr_t>(end);
+			if (last <= first) return;
+			::madvise(reinterpret_cast<void *>(first), last - first, advice);
+		}
+	} // namespace detail
+
+	template<typename Scalar_>
+	class MmapStorage {
+	public:
+		using Scalar						  = Scalar_;
+		using Packet						  = typename typetraits::TypeInfo<Scalar>::Packet;
+		static constexpr uint64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+		using Pointer						  = Scalar *;
+		using ConstPointer					  = const Scalar *;
+		using Reference						  = Scalar &;
+		using ConstReference				  = const Scalar &;
+		using SizeType						  = size_t;
+		using DifferenceType				  = ptrdiff_t;
+		using Iterator						  = Pointer;
+		using ConstIterator					  = ConstPointer;
+		using ReverseIterator				  = std::reverse_iterator<Iterator>;
+		using ConstReverseIterator			  = std::reverse_iterator<ConstIterator>;
+
+		static_assert(std::is_trivially_copyable_v<Scalar>,
+					  "MmapStorage can only hold trivially copyable types");
+
+		/// Default constructor
+		MmapStorage() = default;
+
+		/// Create an MmapStorage object with \p size elements, backed by anonymous memory rather
+		/// than a file. This is used for temporaries, such as the result of ``copy()``.
+		/// \param size Number of elements to allocate
+		LIBRAPID_ALWAYS_INLINE explicit MmapStorage(SizeType size);
+
+		/// Create an anonymous MmapStorage object with \p size elements, each initialized to
+		/// \p value.
+		/// \param size Number of elements to allocate
+		/// \param value Value to initialize each element to
+		LIBRAPID_ALWAYS_INLINE MmapStorage(SizeType size, ConstReference value);
+
+		/// Map \p size elements of the file at \p path, starting \p offset bytes into the file.
+		/// In ReadWrite mode, the file is created or extended as required. Otherwise, it must
+		/// already hold at least ``offset + size * sizeof(Scalar)`` bytes.
+		/// \param path Path of the file to map
+		/// \param size Number of elements to map
+		/// \param mode Access mode of the mapping
+		/// \param offset Offset into the file in bytes. Must be a multiple of LIBRAPID_MEM_ALIGN
+		/// \throws std::invalid_argument if \p offset is misaligned. The file is not opened
+		MmapStorage(const std::string &path, SizeType size, MmapMode mode = MmapMode::ReadOnly,
+					SizeType offset = 0);
+
+		/// Reference the mapping of another MmapStorage object. The data is **NOT** copied. For
+		/// a deep copy, use the ``copy()`` method.
+		/// \param other MmapStorage object to reference
+		LIBRAPID_ALWAYS_INLINE MmapStorage(const MmapStorage &other) = default;
+
+		/// Move an MmapStorage object into this object.
+		/// \param other MmapStorage object to move
+		LIBRAPID_ALWAYS_INLINE MmapStorage(MmapStorage &&other) noexcept;
+
+		/// Reference the mapping of another MmapStorage object
+		/// \param other MmapStorage object to reference
+		/// \return *this
+		LIBRAPID_ALWAYS_INLINE MmapStorage &operator=(const MmapStorage &other) = default;
+
+		/// Move assignment operator for an MmapStorage object
+		/// \param other MmapStorage object to move
+		/// \return *this
+		LIBRAPID_ALWAYS_INLINE MmapStorage &operator=(MmapStorage &&other) noexcept;
+
+		/// Release this object's reference to the mapping. The file is unmapped once no
+		/// MmapStorage object references it.
+		~MmapStorage() = default;
+
+		/// \brief Create a deep copy of this MmapStorage object in anonymous memory
+		/// \return Deep copy of this MmapStorage object
+		MmapStorage copy() const;
+
+		template<typename ShapeType>
+		static ShapeType defaultShape();
+
+		/// Resize an MmapStorage object to \p size elements. Existing elements are preserved.
+		/// Only anonymous storage can be resized.
+		/// \param size New size of the MmapStorage object
+		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize);
+
+		/// Resize an MmapStorage object to \p size elements. Existing elements are not
+		/// preserved. Only anonymous storage can be resized.
+		/// \param size New size of the MmapStorage object
+		LIBRAPID_ALWAYS_INLINE void resize(SizeType newSize, int);
+
+		/// Return the number of elements in the MmapStorage object
+		/// \return Number of elements in the MmapStorage object
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SizeType size() const noexcept;
+
+		/// Return the access mode of the mapping. Anonymous storage is always ReadWrite.
+		/// \return Access mode of the mapping
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE MmapMode mode() const noexcept;
+
+		/// Return true if the storage is backed by a file rather than anonymous memory
+		/// \return True if the storage is backed by a file
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool isFileBacked() const noexcept;
+
+		/// Hint that elements [begin, end) will be accessed soon, so the pages holding them can
+		/// be read ahead of time (``MADV_WILLNEED``)
+		/// \param begin Index of the first element in the range
+		/// \param end Index one past the last element in the range
+		LIBRAPID_ALWAYS_INLINE void prefetch(SizeType begin, SizeType end) const;
+
+		/// Hint that elements [begin, end) will not be accessed again soon, so the pages holding
+		/// them can be dropped (``MADV_DONTNEED``). This is ignored for CopyOnWrite and anonymous
+		/// storage, where dropping a page would discard its contents.
+		/// \param begin Index of the first element in the range
+		/// \param end Index one past the last element in the range
+		LIBRAPID_ALWAYS_INLINE void release(SizeType begin, SizeType end) const;
+
+		/// Write any modified pages back to the file and wait for the write to complete. This
+		/// only has an effect in ReadWrite mode.
+		void flush() const;
+
+		/// Const access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return Const reference to the element at index \p index
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReference operator[](SizeType index) const;
+
+		/// Access to the element at index \p index
+		/// \param index Index of the element to access
+		/// \return Reference to the element at index \p index
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Reference operator[](SizeType index);
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer data() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer begin() noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Pointer end() noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstPointer begin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstPointer end() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cbegin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstIterator cend() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rbegin() noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ReverseIterator rend() noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator rbegin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator rend() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator crbegin() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ConstReverseIterator crend() const noexcept;
+
+	private:
+		std::shared_ptr<detail::MemoryMapping> m_mapping; // The mapping this object references
+		Pointer m_begin = nullptr;						  // Pointer to the beginning of the data
+		SizeType m_size = 0;							  // Number of elements
+		MmapMode m_mode = MmapMode::ReadWrite;			  // Access mode of the mapping
+	};
+
+	template<typename T>
+	MmapStorage<T>::MmapStorage(SizeType size) :
+			m_mapping(detail::mapAnonymous(size * sizeof(T))),
+			m_begin(static_cast<Pointer>(m_mapping->address)), m_size(size) {}
+
+	template<typename T>
+	MmapStorage<T>::MmapStorage(SizeType size, ConstReference value) : MmapStorage(size) {
+		auto ptr_ = LIBRAPID_ASSUME_ALIGNED(m_begin);
+		for (SizeType i = 0; i < size; ++i) { ptr_[i] = value; }
+	}
+
+	template<typename T>
+	MmapStorage<T>::MmapStorage(const std::string &path, SizeType size, MmapMode mode,
+								SizeType offset) :
+			m_mapping(
+			  detail::mapFile(path, detail::checkMapOffset(offset), size * sizeof(T), mode)),
+			m_size(size), m_mode(mode) {
+		if (m_mapping->address != nullptr) {
+			m_begin = reinterpret_cast<Pointer>(static_cast<char *>(m_mapping->address) +
+												offset % detail::pageSize());
+		}
+	}
+
+	template<typename T>
+	MmapStorage<T>::MmapStorage(MmapStorage &&other) noexcept :
+			m_mapping(std::move(other.m_mapping)), m_begin(other.m_begin), m_size(other.m_size),
+			m_mode(other.m_mode) {
+		other.m_begin = nullptr;
+		other.m_size  = 0;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::operator=(MmapStorage &&other) noexcept -> MmapStorage & {
+		if (this != &other) {
+			m_mapping = std::move(other.m_mapping);
+			m_begin	  = other.m_begin;
+			m_size	  = other.m_size;
+			m_mode	  = other.m_mode;
+
+			other.m_begin = nullptr;
+			other.m_size  = 0;
+		}
+		return *this;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::copy() const -> MmapStorage {
+		MmapStorage ret(m_size);
+		detail::fastCopy(ret.m_begin, m_begin, m_size);
+		return ret;
+	}
+
+	template<typename T>
+	template<typename ShapeType>
+	auto MmapStorage<T>::defaultShape() -> ShapeType {
+		return ShapeType({0});
+	}
+
+	template<typename T>
+	void MmapStorage<T>::resize(SizeType newSize) {
+		// Resize and retain data
+		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
+		if (newSize == size()) return;
+
+		LIBRAPID_ASSERT(!isFileBacked(), "A file-backed MmapStorage cannot be resized");
+
+		MmapStorage resized(newSize);
+		detail::fastCopy(resized.m_begin, m_begin, std::min(m_size, newSize));
+		*this = std::move(resized);
+	}
+
+	template<typename T>
+	void MmapStorage<T>::resize(SizeType newSize, int) {
+		// Resize and discard data
+		LIBRAPID_ASSERT(newSize > 0, "Cannot resize to a size of 0");
+		if (newSize == size()) return;
+
+		LIBRAPID_ASSERT(!isFileBacked(), "A file-backed MmapStorage cannot be resized");
+
+		*this = MmapStorage(newSize);
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::size() const noexcept -> SizeType {
+		return m_size;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::mode() const noexcept -> MmapMode {
+		return m_mode;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::isFileBacked() const noexcept -> bool {
+		return m_mapping && m_mapping->fileBacked;
+	}
+
+	template<typename T>
+	void MmapStorage<T>::prefetch(SizeType begin, SizeType end) const {
+		end = std::min(end, m_size);
+		if (!isFileBacked() || begin >= end) return;
+		detail::adviseRange(m_begin + begin, m_begin + end, MADV_WILLNEED);
+	}
+
+	template<typename T>
+	void MmapStorage<T>::release(SizeType begin, SizeType end) const {
+		end = std::min(end, m_size);
+		if (!isFileBacked() || m_mode == MmapMode::CopyOnWrite || begin >= end) return;
+		detail::adviseRange(m_begin + begin, m_begin + end, MADV_DONTNEED);
+	}
+
+	template<typename T>
+	void MmapStorage<T>::flush() const {
+		if (!isFileBacked() || m_mode != MmapMode::ReadWrite || m_mapping->address == nullptr)
+			return;
+
+		if (::msync(m_mapping->address, m_mapping->bytes, MS_SYNC) != 0) LIBRAPID_UNLIKELY {
+			detail::throwMmapError("msync", m_mapping->path);
+		}
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::operator[](SizeType index) const -> ConstReference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return m_begin[index];
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::operator[](SizeType index) -> Reference {
+		LIBRAPID_ASSERT(index < size(), "Index {} out of bounds for size {}", index, size());
+		return m_begin[index];
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::data() const noexcept -> Pointer {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::begin() noexcept -> Pointer {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::end() noexcept -> Pointer {
+		return m_begin + m_size;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::begin() const noexcept -> ConstPointer {
+		return m_begin;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::end() const noexcept -> ConstPointer {
+		return m_begin + m_size;
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::cbegin() const noexcept -> ConstIterator {
+		return begin();
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::cend() const noexcept -> ConstIterator {
+		return end();
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::rbegin() noexcept -> ReverseIterator {
+		return ReverseIterator(m_begin + m_size);
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::rend() noexcept -> ReverseIterator {
+		return ReverseIterator(m_begin);
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::rbegin() const noexcept -> ConstReverseIterator {
+		return ConstReverseIterator(m_begin + m_size);
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::rend() const noexcept -> ConstReverseIterator {
+		return ConstReverseIterator(m_begin);
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::crbegin() const noexcept -> ConstReverseIterator {
+		return rbegin();
+	}
+
+	template<typename T>
+	auto MmapStorage<T>::crend() const noexcept -> ConstReverseIterator {
+		return rend();
+	}
+
+	/// Create an array which references the file at \p path directly. The array can be larger
+	/// than the available memory -- pages are read in (and, in ReadWrite mode, written back) as
+	/// the array is evaluated.
+	/// \tparam Scalar The scalar type of the array
+	/// \tparam ShapeType The shape type of the array
+	/// \param path Path of the file to map
+	/// \param shape Shape of the array
+	/// \param mode Access mode of the mapping
+	/// \param offset Offset into the file in bytes. Must be a multiple of LIBRAPID_MEM_ALIGN
+	/// \return The memory-mapped array
+	template<typename Scalar, typename ShapeType = Shape>
+	LIBRAPID_NODISCARD auto mapArray(const std::string &path, const ShapeType &shape,
+									 MmapMode mode = MmapMode::ReadOnly, size_t offset = 0)
+	  -> array::ArrayContainer<ShapeType, MmapStorage<Scalar>> {
+		return array::ArrayContainer<ShapeType, MmapStorage<Scalar>>(
+		  shape, MmapStorage<Scalar>(path, shape.size(), mode, offset));
+	}
+#endif // LIBRAPID_HAS_MMAP
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_MMAP_STORAGE_HPP
@@ -31,6 +31,45 @@
 		}                                                                                          \
 	}
 
+#define LIBRAPID_BINARY_BITWISE_FUNCTOR(NAME_, OP_)                                                \
+	struct NAME_ {                                                                                 \
+		template<typename T, typename V>                                                           \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &lhs,                    \
+																  const V &rhs) const {            \
+			return static_cast<std::common_type_t<T, V>>(lhs OP_ rhs);                             \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,                   \
+															  const Packet &rhs) const {           \
+			return lhs OP_ rhs;                                                                    \
+		}                                                                                          \
+	}
+
+#define LIBRAPID_BINARY_SHIFT_FUNCTOR(NAME_, OP_)                                                  \
+	struct NAME_ {                                                                                 \
+		template<typename T, typename V>                                                           \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &lhs,                    \
+																  const V &rhs) const {            \
+			using Scalar = std::common_type_t<T, V>;                                               \
+			LIBRAPID_ASSERT(::librapid::detail::shiftInRange<Scalar>(rhs),                         \
+							"Cannot shift a {}-bit value by {} bits",                              \
+							sizeof(Scalar) * CHAR_BIT,                                             \
+							rhs);                                                                  \
+			return static_cast<Scalar>(lhs OP_ rhs);                                               \
+		}                                                                                          \
+                                                                                                   \
+		template<typename Packet>                                                                  \
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,                   \
+															  const Packet &rhs) const {           \
+			LIBRAPID_ASSERT(::librapid::detail::shiftsInRange(rhs),                                \
+							"Cannot shift a {}-bit value by less than 0 or more than {} bits",     \
+							sizeof(typename Packet::value_type) * CHAR_BIT,                        \
+							sizeof(typename Packet::value_type) * CHAR_BIT - 1);                   \
+			return lhs OP_ rhs;                                                                    \
+		}                                                                                          \
+	}
+
 #define LIBRAPID_UNARY_KERNEL_GETTER                                                               \
 	template<typename... Args>                                                                     \
 	static constexpr const char *getKernelName(std::tuple<Args...> args) {                         \
@@ -91,13 +130,17 @@
 	  const std::tuple<First, Second> &tup) {                                                      \
 		if constexpr (IsArrayType<std::decay_t<First>>::value) {                                   \
 			if constexpr (IsArrayType<std::decay_t<Second>>::value) {                              \
+				using ResultShape = typename ::librapid::detail::ShapeTypeHelper<                  \
+				  std::decay_t<decltype(std::get<0>(tup).shape())>,                                \
+				  std::decay_t<decltype(std::get<1>(tup).shape())>>::Type;                         \
 				LIBRAPID_ASSERT_WITH_EXCEPTION(                                                    \
 				  std::range_error,                                                                \
-				  std::get<0>(tup).shape() == std::get<1>(tup).shape(),                            \
-				  "Shapes must match for binary operations. {} vs {}",                             \
+				  shapesBroadcastable(std::get<0>(tup).shape(), std::get<1>(tup).shape()),         \
+				  "Shapes {} and {} cannot be broadcast together",                                 \
 				  std::get<0>(tup).shape(),                                                        \
 				  std::get<1>(tup).shape());                                                       \
-				return std::get<0>(tup).shape();                                                   \
+				return broadcastShape<ResultShape>(std::get<0>(tup).shape(),                       \
+												   std::get<1>(tup).shape());                      \
 			}                                                                                      \
 			return std::get<0>(tup).shape();                                                       \
 		} else if constexpr (IsArrayType<std::decay_t<Second>>::value) {                           \
@@ -139,10 +182,25 @@ namespace librapid {
 			return OperationType(Functor(), std::forward<Args>(args)...);
 		}
 
-		LIBRAPID_BINARY_FUNCTOR(Plus, +);	  // a + b
-		LIBRAPID_BINARY_FUNCTOR(Minus, -);	  // a - b
-		LIBRAPID_BINARY_FUNCTOR(Multiply, *); // a * b
-		LIBRAPID_BINARY_FUNCTOR(Divide, /);	  // a / b
+		LIBRAPID_BINARY_FUNCTOR(Plus, +);	// a + b
+		LIBRAPID_BINARY_FUNCTOR(Minus, -);	// a - b
+		LIBRAPID_BINARY_FUNCTOR(Divide, /); // a / b
+
+		// a * b. Packets go through multiplyPacket, which emulates 64-bit integer multiplication
+		// on ISAs without it
+		struct Multiply {
+			template<typename T, typename V>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator()(const T &lhs,
+																	  const V &rhs) const {
+				return lhs * rhs;
+			}
+
+			template<typename Packet>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto packet(const Packet &lhs,
+																  const Packet &rhs) const {
+				return multiplyPacket(lhs, rhs);
+			}
+		};
 
 		LIBRAPID_UNARY_FUNCTOR(Neg, -);
 
@@ -153,6 +211,37 @@ namespace librapid {
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseEqual, ==);	 // a == b
 		LIBRAPID_BINARY_COMPARISON_FUNCTOR(ElementWiseNotEqual, !=); // a != b
 
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseAnd, &);	 // a & b
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseOr, |);	 // a | b
+		LIBRAPID_BINARY_BITWISE_FUNCTOR(BitwiseXor, ^);	 // a ^ b
+
+		/// \brief Check that \p shift is a valid number of bits to shift a \p Scalar by
+		///
+		/// Shifting an integer by a negative number of bits, or by at least its width, is
+		/// undefined in C++, and SIMD instruction sets disagree on the result.
+		/// \tparam Scalar The type of the value being shifted
+		/// \param shift The number of bits to shift by
+		/// \return True if \p shift is in \f$ [0, \mathrm{bits}) \f$
+		template<typename Scalar, typename T>
+		LIBRAPID_NODISCARD constexpr bool shiftInRange(const T &shift) {
+			if constexpr (std::is_signed_v<T>) {
+				if (shift < 0) return false;
+			}
+			return static_cast<std::make_unsigned_t<T>>(shift) < sizeof(Scalar) * CHAR_BIT;
+		}
+
+		/// \brief Check that every lane of \p shift is a valid number of bits to shift a lane of
+		/// the same packet type by
+		/// \see shiftInRange
+		template<typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool shiftsInRange(const Packet &shift) {
+			constexpr auto bits = sizeof(typename Packet::value_type) * CHAR_BIT;
+			return xsimd::all(shift >= Packet(0) && shift < Packet(bits));
+		}
+
+		LIBRAPID_BINARY_SHIFT_FUNCTOR(LeftShift, <<);  // a << b
+		LIBRAPID_BINARY_SHIFT_FUNCTOR(RightShift, >>); // a >> b
+
 		LIBRAPID_UNARY_FUNCTOR(Sin, ::librapid::sin);	 // sin(a)
 		LIBRAPID_UNARY_FUNCTOR(Cos, ::librapid::cos);	 // cos(a)
 		LIBRAPID_UNARY_FUNCTOR(Tan, ::librapid::tan);	 // tan(a)
@@ -376,6 +465,61 @@ namespace librapid {
 			LIBRAPID_BINARY_SHAPE_EXTRACTOR
 		};
 
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseAnd> {
+			static constexpr const char *name				 = "bitwise and";
+			static constexpr const char *filename			 = "arithmetic";
+			static constexpr const char *kernelName			 = "bitwiseAndArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseAndArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseAndArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseOr> {
+			static constexpr const char *name				 = "bitwise or";
+			static constexpr const char *filename			 = "arithmetic";
+			static constexpr const char *kernelName			 = "bitwiseOrArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseOrArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseOrArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::BitwiseXor> {
+			static constexpr const char *name				 = "bitwise xor";
+			static constexpr const char *filename			 = "arithmetic";
+			static constexpr const char *kernelName			 = "bitwiseXorArrays";
+			static constexpr const char *kernelNameScalarRhs = "bitwiseXorArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "bitwiseXorArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::LeftShift> {
+			static constexpr const char *name				 = "left shift";
+			static constexpr const char *filename			 = "arithmetic";
+			static constexpr const char *kernelName			 = "leftShiftArrays";
+			static constexpr const char *kernelNameScalarRhs = "leftShiftArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "leftShiftArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
+		template<>
+		struct TypeInfo<::librapid::detail::RightShift> {
+			static constexpr const char *name				 = "right shift";
+			static constexpr const char *filename			 = "arithmetic";
+			static constexpr const char *kernelName			 = "rightShiftArrays";
+			static constexpr const char *kernelNameScalarRhs = "rightShiftArraysScalarRhs";
+			static constexpr const char *kernelNameScalarLhs = "rightShiftArraysScalarLhs";
+			LIBRAPID_BINARY_KERNEL_GETTER
+			LIBRAPID_BINARY_SHAPE_EXTRACTOR
+		};
+
 		template<>
 		struct TypeInfo<::librapid::detail::Neg> {
 			static constexpr const char *name		= "negate";
@@ -648,6 +792,23 @@ namespace librapid {
 
 		template<typename LHS, typename RHS>
 		concept IsArrayOpWithScalar = isArrayOpWithScalar<LHS, RHS>();
+
+		/// Convert a scalar operand of a bitwise operation to the scalar type of the array it is
+		/// combined with. Both arguments then have the same type, so the operation can be
+		/// vectorised. Arrays and functions are forwarded unchanged.
+		/// \tparam Other Type of the other operand
+		/// \tparam T Type of the operand
+		/// \param value The operand
+		/// \return The converted or forwarded operand
+		template<typename Other, typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE decltype(auto) bitwiseOperand(T &&value) {
+			if constexpr (typetraits::TypeInfo<std::decay_t<T>>::type == LibRapidType::Scalar) {
+				using Scalar = typename typetraits::TypeInfo<std::decay_t<Other>>::Scalar;
+				return static_cast<Scalar>(value);
+			} else {
+				return std::forward<T>(value);
+			}
+		}
 	} // namespace detail
 
 	namespace array {
@@ -657,8 +818,8 @@ namespace librapid {
 
 		/// \brief Element-wise array addition
 		///
-		/// Performs element-wise addition on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise addition on two arrays. They must be of the same data type,
+		/// and their shapes must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -670,8 +831,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator+(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -682,8 +843,8 @@ namespace librapid {
 
 		/// \brief Element-wise array subtraction
 		///
-		/// Performs element-wise subtraction on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise subtraction on two arrays. They must be of the same data type,
+		/// and their shapes must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -695,8 +856,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator-(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -707,8 +868,8 @@ namespace librapid {
 
 		/// \brief Element-wise array multiplication
 		///
-		/// Performs element-wise multiplication on two arrays. They must both be the same
-		/// size and of the same data type.
+		/// Performs element-wise multiplication on two arrays. They must be of the same data
+		/// type, and their shapes must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -720,8 +881,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator*(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -732,8 +893,8 @@ namespace librapid {
 
 		/// \brief Element-wise array division
 		///
-		/// Performs element-wise division on two arrays. They must both be the same size
-		/// and of the same data type.
+		/// Performs element-wise division on two arrays. They must be of the same data type,
+		/// and their shapes must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -745,8 +906,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator/(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -759,8 +920,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than the second. They must both be the same size and of the same data
-		/// type.
+		/// is less than the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -772,8 +933,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator<(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -786,8 +947,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than the second. They must both be the same size and of the same data
-		/// type.
+		/// is greater than the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -799,8 +960,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -814,8 +975,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is less than or equal to the second. They must both be the same size and of the
-		/// same data type.
+		/// is less than or equal to the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -827,8 +988,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator<=(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -842,8 +1003,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is greater than or equal to the second. They must both be the same size and of
-		/// the same data type.
+		/// is greater than or equal to the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -855,8 +1016,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>=(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -870,8 +1031,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// is equal to the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -883,8 +1044,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator==(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -898,8 +1059,8 @@ namespace librapid {
 		/// input arrays
 		///
 		/// Performs an element-wise comparison on two arrays, checking if the first value
-		/// is not equal to the second. They must both be the same size and of the same data
-		/// type.
+		/// is not equal to the second. They must be of the same data type, and their shapes
+		/// must be broadcastable (see ``shapesBroadcastable``).
 		///
 		/// \tparam LHS Type of the LHS element
 		/// \tparam RHS Type of the RHS element
@@ -911,8 +1072,8 @@ namespace librapid {
 		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator!=(LHS &&lhs, RHS &&rhs) {
 			if constexpr (IS_ARRAY_OP_ARRAY) {
 				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
-											   lhs.shape().operator==(rhs.shape()),
-											   "Shapes must be equal. {} vs {}",
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
 											   lhs.shape(),
 											   rhs.shape());
 			}
@@ -922,6 +1083,147 @@ namespace librapid {
 																	 std::forward<RHS>(rhs));
 		}
 
+		/// \brief Element-wise bitwise AND of two arrays
+		///
+		/// Performs an element-wise bitwise AND on two integer arrays, or on an integer array and a
+		/// scalar. A scalar is first converted to the scalar type of the array. The shapes of two
+		/// arrays must be broadcastable (see ``shapesBroadcastable``).
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise bitwise AND of the two arrays
+		template<class LHS, class RHS>
+			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator&(LHS &&lhs, RHS &&rhs) {
+			if constexpr (IS_ARRAY_OP_ARRAY) {
+				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
+											   lhs.shape(),
+											   rhs.shape());
+			}
+
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseAnd>(
+			  detail::bitwiseOperand<RHS>(std::forward<LHS>(lhs)),
+			  detail::bitwiseOperand<LHS>(std::forward<RHS>(rhs)));
+		}
+
+		/// \brief Element-wise bitwise OR of two arrays
+		///
+		/// Performs an element-wise bitwise OR on two integer arrays, or on an integer array and a
+		/// scalar. A scalar is first converted to the scalar type of the array. The shapes of two
+		/// arrays must be broadcastable (see ``shapesBroadcastable``).
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise bitwise OR of the two arrays
+		template<class LHS, class RHS>
+			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator|(LHS &&lhs, RHS &&rhs) {
+			if constexpr (IS_ARRAY_OP_ARRAY) {
+				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
+											   lhs.shape(),
+											   rhs.shape());
+			}
+
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseOr>(
+			  detail::bitwiseOperand<RHS>(std::forward<LHS>(lhs)),
+			  detail::bitwiseOperand<LHS>(std::forward<RHS>(rhs)));
+		}
+
+		/// \brief Element-wise bitwise XOR of two arrays
+		///
+		/// Performs an element-wise bitwise XOR on two integer arrays, or on an integer array and a
+		/// scalar. A scalar is first converted to the scalar type of the array. The shapes of two
+		/// arrays must be broadcastable (see ``shapesBroadcastable``).
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise bitwise XOR of the two arrays
+		template<class LHS, class RHS>
+			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator^(LHS &&lhs, RHS &&rhs) {
+			if constexpr (IS_ARRAY_OP_ARRAY) {
+				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
+											   lhs.shape(),
+											   rhs.shape());
+			}
+
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::BitwiseXor>(
+			  detail::bitwiseOperand<RHS>(std::forward<LHS>(lhs)),
+			  detail::bitwiseOperand<LHS>(std::forward<RHS>(rhs)));
+		}
+
+		/// \brief Element-wise left shift of two arrays
+		///
+		/// Shifts each element of the first integer array left by the corresponding element of
+		/// the second. Their shapes must be broadcastable (see ``shapesBroadcastable``).
+		///
+		/// Every shift must be at least zero and less than the width of the scalar type in bits.
+		/// As in C++, the result of any other shift is undefined. It is checked when assertions
+		/// are enabled.
+		///
+		/// ``array << value`` starts a comma initializer, so shifting by a scalar is done with
+		/// ``leftShift`` or ``<<=`` instead.
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise left shift of the two arrays
+		template<class LHS, class RHS>
+			requires(detail::IsArrayOpArray<LHS, RHS>)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator<<(LHS &&lhs, RHS &&rhs) {
+			LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+										   shapesBroadcastable(lhs.shape(), rhs.shape()),
+										   "Shapes {} and {} cannot be broadcast together",
+										   lhs.shape(),
+										   rhs.shape());
+
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::LeftShift>(
+			  std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+		}
+
+		/// \brief Element-wise right shift of two arrays
+		///
+		/// Shifts each element of an integer array right by the corresponding element of another
+		/// array, or by a scalar, which is first converted to the scalar type of the array. The
+		/// shapes of two arrays must be broadcastable (see ``shapesBroadcastable``).
+		///
+		/// Every shift must be at least zero and less than the width of the scalar type in bits.
+		/// Signed values are shifted arithmetically. See ``operator<<``.
+		///
+		/// \tparam LHS Type of the LHS element
+		/// \tparam RHS Type of the RHS element
+		/// \param lhs The first array
+		/// \param rhs The second array
+		/// \return The element-wise right shift of the two arrays
+		template<class LHS, class RHS>
+			requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator>>(LHS &&lhs, RHS &&rhs) {
+			if constexpr (IS_ARRAY_OP_ARRAY) {
+				LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+											   shapesBroadcastable(lhs.shape(), rhs.shape()),
+											   "Shapes {} and {} cannot be broadcast together",
+											   lhs.shape(),
+											   rhs.shape());
+			}
+
+			return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::RightShift>(
+			  detail::bitwiseOperand<RHS>(std::forward<LHS>(lhs)),
+			  detail::bitwiseOperand<LHS>(std::forward<RHS>(rhs)));
+		}
+
 		/// \brief Negate each element in the array
 		/// \tparam VAL Type to negate
 		/// \param val The input array or function
@@ -934,6 +1236,52 @@ namespace librapid {
 		}
 	} // namespace array
 
+	/// \brief Shift each element of an integer array left
+	///
+	/// Equivalent to ``lhs << rhs``, but also accepts a scalar shift (or a scalar shifted by an
+	/// array). A scalar is first converted to the scalar type of the array.
+	///
+	/// Every shift must be at least zero and less than the width of the scalar type in bits.
+	/// As in C++, the result of any other shift is undefined. It is checked when assertions are
+	/// enabled.
+	///
+	/// \tparam LHS Type of the value to shift
+	/// \tparam RHS Type of the shift
+	/// \param lhs The array or scalar to shift
+	/// \param rhs The number of bits to shift by
+	/// \return Left shift function object
+	template<class LHS, class RHS>
+		requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto leftShift(LHS &&lhs, RHS &&rhs) {
+		if constexpr (IS_ARRAY_OP_ARRAY) {
+			LIBRAPID_ASSERT_WITH_EXCEPTION(std::range_error,
+										   shapesBroadcastable(lhs.shape(), rhs.shape()),
+										   "Shapes {} and {} cannot be broadcast together",
+										   lhs.shape(),
+										   rhs.shape());
+		}
+
+		return detail::makeFunction<typetraits::DescriptorType_t<LHS, RHS>, detail::LeftShift>(
+		  detail::bitwiseOperand<RHS>(std::forward<LHS>(lhs)),
+		  detail::bitwiseOperand<LHS>(std::forward<RHS>(rhs)));
+	}
+
+	/// \brief Shift each element of an integer array right
+	///
+	/// Equivalent to ``lhs >> rhs``. Provided for symmetry with ``leftShift``, and with the same
+	/// range of valid shifts.
+	///
+	/// \tparam LHS Type of the value to shift
+	/// \tparam RHS Type of the shift
+	/// \param lhs The array or scalar to shift
+	/// \param rhs The number of bits to shift by
+	/// \return Right shift function object
+	template<class LHS, class RHS>
+		requires(detail::IsArrayOpArray<LHS, RHS> || detail::IsArrayOpWithScalar<LHS, RHS>)
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto rightShift(LHS &&lhs, RHS &&rhs) {
+		return array::operator>>(std::forward<LHS>(lhs), std::forward<RHS>(rhs));
+	}
+
 	/// \brief Calculate the sine of each element in the array
 	///
 	/// \f$R = \{ R_0, R_1, R_2, ... \} \f$ \text{ where } \f$R_i = \sin(A_i)\f$
@@ -0,0 +1,935 @@
+#ifndef LIBRAPID_ARRAY_REDUCTIONS_HPP
+#define LIBRAPID_ARRAY_REDUCTIONS_HPP
+
+namespace librapid {
+	namespace detail {
+		namespace reduce {
+			/// Reducer for the sum of a set of values
+			struct Sum {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto init(const T &, int64_t) {
+					return typename typetraits::TypeInfo<T>::Scalar(0);
+				}
+
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Scalar combine(const Scalar &a,
+																				const Scalar &b) {
+					return a + b;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &a, const Packet &b) {
+					return a + b;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto
+				reducePacket(const Packet &packet) {
+					return xsimd::reduce_add(packet);
+				}
+			};
+
+			/// Reducer for the product of a set of values
+			struct Prod {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto init(const T &, int64_t) {
+					return typename typetraits::TypeInfo<T>::Scalar(1);
+				}
+
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Scalar combine(const Scalar &a,
+																				const Scalar &b) {
+					return a * b;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &a, const Packet &b) {
+					return a * b;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto
+				reducePacket(const Packet &packet) {
+					using Scalar = typename Packet::value_type;
+					Scalar lanes[Packet::size];
+					packet.store_unaligned(lanes);
+
+					Scalar res = lanes[0];
+					for (size_t i = 1; i < Packet::size; ++i) res *= lanes[i];
+					return res;
+				}
+			};
+
+			/// Reducer for the minimum of a set of values. There is no general identity for the
+			/// minimum, so the accumulators are initialised with the first element of the range
+			struct Min {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto init(const T &obj,
+																		   int64_t index) {
+					return typename typetraits::TypeInfo<T>::Scalar(obj.scalar(index));
+				}
+
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Scalar combine(const Scalar &a,
+																				const Scalar &b) {
+					return b < a ? b : a;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &a, const Packet &b) {
+					return xsimd::min(a, b);
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto
+				reducePacket(const Packet &packet) {
+					return xsimd::reduce_min(packet);
+				}
+
+				/// Returns true if \p a should replace \p b as the extreme value
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static bool better(const Scalar &a,
+																			 const Scalar &b) {
+					return a < b;
+				}
+			};
+
+			/// Reducer for the maximum of a set of values
+			/// \see Min
+			struct Max {
+				template<typename T>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto init(const T &obj,
+																		   int64_t index) {
+					return typename typetraits::TypeInfo<T>::Scalar(obj.scalar(index));
+				}
+
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Scalar combine(const Scalar &a,
+																				const Scalar &b) {
+					return b > a ? b : a;
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Packet
+				combinePacket(const Packet &a, const Packet &b) {
+					return xsimd::max(a, b);
+				}
+
+				template<typename Packet>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static auto
+				reducePacket(const Packet &packet) {
+					return xsimd::reduce_max(packet);
+				}
+
+				/// Returns true if \p a should replace \p b as the extreme value
+				template<typename Scalar>
+				LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static bool better(const Scalar &a,
+																			 const Scalar &b) {
+					return a > b;
+				}
+			};
+
+			/// Number of columns processed at once when reducing along a non-contiguous axis.
+			/// This is a multiple of every packet width, so each block starts on a packet boundary
+			constexpr int64_t columnBlockSize = 256;
+
+			/// Returns true if the object can be read in packets. Arrays and (CPU) Functions
+			/// support this, while GeneralArrayView objects must be read element by element.
+			/// The reducers work on xsimd batches, so scalars with other packet types (such as
+			/// Complex) are also reduced element by element
+			template<typename T>
+			constexpr bool reductionVectorisable() {
+				using Info	 = typetraits::TypeInfo<T>;
+				using Scalar = typename Info::Scalar;
+				using Packet = typename typetraits::TypeInfo<Scalar>::Packet;
+
+				if constexpr (!std::is_same_v<typename Info::Backend, backend::CPU> ||
+							  typetraits::TypeInfo<Scalar>::packetWidth <= 1 ||
+							  !typetraits::IsSIMD<Packet>::value) {
+					return false;
+				} else if constexpr (Info::type == LibRapidType::ArrayFunction) {
+					// Transpose and ArrayMultiply objects are also tagged as Functions, but
+					// never allow vectorisation
+					if constexpr (Info::allowVectorisation) {
+						return T::argsAreSameType;
+					} else {
+						return false;
+					}
+				} else if constexpr (Info::type == LibRapidType::ArrayContainer) {
+					return Info::allowVectorisation;
+				} else {
+					return false;
+				}
+			}
+
+			template<typename T>
+			constexpr void checkBackend() {
+				static_assert(
+				  std::is_same_v<typename typetraits::TypeInfo<T>::Backend, backend::CPU>,
+				  "Reductions are currently only supported for CPU arrays");
+			}
+
+			/// Reduce the elements of \p obj in the range [begin, end) on a single thread. Four
+			/// independent packet accumulators are used to hide the latency of the reduction
+			/// operation.
+			/// \tparam Reducer The reduction operation
+			/// \tparam T The type of the object to reduce
+			/// \param obj The array or Function to reduce
+			/// \param begin The first (linear) index to reduce
+			/// \param end One past the last (linear) index to reduce
+			/// \return The reduced value
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto reduceRange(const T &obj, int64_t begin,
+																	   int64_t end) {
+				using Scalar	  = typename typetraits::TypeInfo<T>::Scalar;
+				const Scalar init = Reducer::init(obj, begin);
+				Scalar acc		  = init;
+				int64_t index	  = begin;
+
+				if constexpr (reductionVectorisable<T>()) {
+					using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+					constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					if (canVectorise(obj, packetWidth)) {
+						// Packets are loaded from aligned memory, so peel until the index is a
+						// multiple of the packet width
+						const int64_t aligned =
+						  std::min(end, (begin + packetWidth - 1) / packetWidth * packetWidth);
+						for (; index < aligned; ++index) {
+							acc = Reducer::combine(acc, Scalar(obj.scalar(index)));
+						}
+
+						if (end - index >= packetWidth) {
+							Packet acc0(init), acc1(init), acc2(init), acc3(init);
+
+							for (; index + 4 * packetWidth <= end; index += 4 * packetWidth) {
+								acc0 = Reducer::combinePacket(acc0, obj.packet(index));
+								acc1 = Reducer::combinePacket(acc1,
+															  obj.packet(index + packetWidth));
+								acc2 = Reducer::combinePacket(acc2,
+															  obj.packet(index + 2 * packetWidth));
+								acc3 = Reducer::combinePacket(acc3,
+															  obj.packet(index + 3 * packetWidth));
+							}
+
+							for (; index + packetWidth <= end; index += packetWidth) {
+								acc0 = Reducer::combinePacket(acc0, obj.packet(index));
+							}
+
+							acc0 = Reducer::combinePacket(Reducer::combinePacket(acc0, acc1),
+														  Reducer::combinePacket(acc2, acc3));
+							acc	 = Reducer::combine(acc, Scalar(Reducer::reducePacket(acc0)));
+						}
+					}
+				}
+
+				for (; index < end; ++index) {
+					acc = Reducer::combine(acc, Scalar(obj.scalar(index)));
+				}
+
+				return acc;
+			}
+
+			/// Reduce the elements of \p obj in the range [begin, end), splitting the range into
+			/// one chunk per thread if it is large enough. The partial results are combined in a
+			/// pairwise tree, so the result does not depend on the order in which threads finish.
+			/// \tparam Reducer The reduction operation
+			/// \tparam T The type of the object to reduce
+			/// \param obj The array or Function to reduce
+			/// \param begin The first (linear) index to reduce
+			/// \param end One past the last (linear) index to reduce
+			/// \return The reduced value
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD auto reduceParallel(const T &obj, int64_t begin, int64_t end) {
+				using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+
+				const int64_t length = end - begin;
+				if (global::numThreads < 2 ||
+					length <= static_cast<int64_t>(global::multithreadThreshold)) {
+					return reduceRange<Reducer>(obj, begin, end);
+				}
+
+				// Round the chunk size up so every chunk starts on a packet boundary
+				const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+				const int64_t chunkSize	 = ((length + numThreads - 1) / numThreads + 63) / 64 * 64;
+				const int64_t numChunks	 = (length + chunkSize - 1) / chunkSize;
+
+				std::vector<Scalar> partials(numChunks);
+
+#pragma omp parallel for shared(obj, partials, begin, end, chunkSize, numChunks) default(none)     \
+  num_threads(int(global::numThreads))
+				for (int64_t chunk = 0; chunk < numChunks; ++chunk) {
+					const int64_t chunkBegin = begin + chunk * chunkSize;
+					const int64_t chunkEnd	 = std::min(end, chunkBegin + chunkSize);
+					partials[chunk]			 = reduceRange<Reducer>(obj, chunkBegin, chunkEnd);
+				}
+
+				for (int64_t stride = 1; stride < numChunks; stride *= 2) {
+					for (int64_t i = 0; i + stride < numChunks; i += 2 * stride) {
+						partials[i] = Reducer::combine(partials[i], partials[i + stride]);
+					}
+				}
+
+				return partials[0];
+			}
+
+			/// Reduce a block of columns [colBegin, colEnd) down \p rows rows of length
+			/// \p rowStride, starting at \p base. Rows are streamed in order, so each input
+			/// element is read exactly once from contiguous memory.
+			template<typename Reducer, typename T, typename Scalar>
+			LIBRAPID_ALWAYS_INLINE void reduceColumns(const T &obj, Scalar *out, int64_t base,
+													  int64_t rows, int64_t rowStride,
+													  int64_t colBegin, int64_t colEnd) {
+				for (int64_t col = colBegin; col < colEnd; ++col) {
+					out[col] = Reducer::init(obj, base + col);
+				}
+
+				int64_t vectorEnd = colBegin;
+
+				if constexpr (reductionVectorisable<T>()) {
+					constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					if (rowStride % packetWidth == 0 && canVectorise(obj, packetWidth)) {
+						vectorEnd = colBegin + (colEnd - colBegin) / packetWidth * packetWidth;
+
+						for (int64_t row = 0; row < rows; ++row) {
+							const int64_t rowBase = base + row * rowStride;
+							for (int64_t col = colBegin; col < vectorEnd; col += packetWidth) {
+								Reducer::combinePacket(xsimd::load_unaligned(out + col),
+													   obj.packet(rowBase + col))
+								  .store_unaligned(out + col);
+							}
+						}
+					}
+				}
+
+				for (int64_t row = 0; row < rows; ++row) {
+					const int64_t rowBase = base + row * rowStride;
+					for (int64_t col = vectorEnd; col < colEnd; ++col) {
+						out[col] = Reducer::combine(out[col], Scalar(obj.scalar(rowBase + col)));
+					}
+				}
+			}
+
+			/// Describes the memory layout of a reduction over a set of axes. If the reduced axes
+			/// form a single contiguous group (ignoring axes of extent 1), the input can be viewed
+			/// as an [outer, extent, inner] array reduced along its middle axis.
+			struct AxisLayout {
+				bool simple	   = true;
+				int64_t outer  = 1;
+				int64_t extent = 1;
+				int64_t inner  = 1;
+			};
+
+			template<typename ShapeType>
+			LIBRAPID_NODISCARD AxisLayout
+			axisLayout(const ShapeType &shape,
+					   const std::array<bool, LIBRAPID_MAX_ARRAY_DIMS> &reduced) {
+				AxisLayout layout;
+				int stage = 0; // 0: leading kept axes, 1: reduced axes, 2: trailing kept axes
+
+				for (int64_t d = 0; d < static_cast<int64_t>(shape.ndim()); ++d) {
+					const int64_t dim = static_cast<int64_t>(shape[d]);
+					if (dim == 1) continue;
+
+					if (reduced[d]) {
+						if (stage == 2) layout.simple = false;
+						stage = 1;
+						layout.extent *= dim;
+					} else if (stage == 0) {
+						layout.outer *= dim;
+					} else {
+						stage = 2;
+						layout.inner *= dim;
+					}
+				}
+
+				return layout;
+			}
+
+			/// Validate a list of axes, returning a mask of the axes to reduce
+			template<typename ShapeType>
+			LIBRAPID_NODISCARD std::array<bool, LIBRAPID_MAX_ARRAY_DIMS>
+			axisMask(const ShapeType &shape, const std::vector<int64_t> &axes) {
+				const int64_t ndim = static_cast<int64_t>(shape.ndim());
+				std::array<bool, LIBRAPID_MAX_ARRAY_DIMS> reduced {};
+
+				for (int64_t axis : axes) {
+					const int64_t normalised = axis < 0 ? axis + ndim : axis;
+					LIBRAPID_ASSERT_WITH_EXCEPTION(
+					  std::out_of_range,
+					  normalised >= 0 && normalised < ndim,
+					  "Axis {} is out of range for an array with {} dimensions",
+					  axis,
+					  ndim);
+					LIBRAPID_ASSERT_WITH_EXCEPTION(
+					  std::invalid_argument, !reduced[normalised], "Axis {} is repeated", axis);
+					reduced[normalised] = true;
+				}
+
+				return reduced;
+			}
+
+			/// Compute the shape of the result of reducing \p shape along the masked axes
+			template<typename ShapeType>
+			LIBRAPID_NODISCARD Shape
+			reducedShape(const ShapeType &shape,
+						 const std::array<bool, LIBRAPID_MAX_ARRAY_DIMS> &reduced) {
+				std::vector<int64_t> dims;
+				for (int64_t d = 0; d < static_cast<int64_t>(shape.ndim()); ++d) {
+					if (!reduced[d]) dims.push_back(static_cast<int64_t>(shape[d]));
+				}
+
+				if (dims.empty()) return Shape({1});
+				return Shape(dims);
+			}
+
+			/// Reduce \p obj along the given axes
+			/// \tparam Reducer The reduction operation
+			/// \tparam T The type of the object to reduce
+			/// \param obj The array, Function or array view to reduce
+			/// \param axes The axes to reduce along. Negative values count from the last axis
+			/// \return An Array containing the result of the reduction
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD auto reduceAxes(const T &obj, const std::vector<int64_t> &axes) {
+				checkBackend<T>();
+				using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+
+				const auto shape   = obj.shape();
+				const auto reduced = axisMask(shape, axes);
+				const auto layout  = axisLayout(shape, reduced);
+
+				Array<Scalar, backend::CPU> result(reducedShape(shape, reduced));
+				Scalar *out = result.storage().begin();
+
+				const int64_t size	  = static_cast<int64_t>(shape.size());
+				const int64_t outSize = static_cast<int64_t>(result.shape().size());
+				if (size == 0) {
+					for (int64_t i = 0; i < outSize; ++i) out[i] = Reducer::init(obj, 0);
+					return result;
+				}
+
+				const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+				const bool parallel =
+				  numThreads > 1 && size > static_cast<int64_t>(global::multithreadThreshold);
+
+				if (layout.simple && layout.inner == 1) {
+					// Each output element is the reduction of a contiguous range of the input
+					const int64_t outer	 = layout.outer;
+					const int64_t extent = layout.extent;
+
+					if (!parallel || outer < numThreads) {
+						for (int64_t o = 0; o < outer; ++o) {
+							out[o] = reduceParallel<Reducer>(obj, o * extent, (o + 1) * extent);
+						}
+					} else {
+#pragma omp parallel for shared(obj, out, outer, extent) default(none)                             \
+  num_threads(int(global::numThreads))
+						for (int64_t o = 0; o < outer; ++o) {
+							out[o] = reduceRange<Reducer>(obj, o * extent, (o + 1) * extent);
+						}
+					}
+				} else if (layout.simple) {
+					// Each output row is the reduction of `extent` contiguous rows of the input
+					const int64_t extent	   = layout.extent;
+					const int64_t inner		   = layout.inner;
+					const int64_t blocksPerRow = (inner + columnBlockSize - 1) / columnBlockSize;
+					const int64_t numBlocks	   = layout.outer * blocksPerRow;
+
+					if (parallel) {
+#pragma omp parallel for shared(obj, out, extent, inner, blocksPerRow, numBlocks) default(none)    \
+  num_threads(int(global::numThreads))
+						for (int64_t block = 0; block < numBlocks; ++block) {
+							const int64_t o		   = block / blocksPerRow;
+							const int64_t colBegin = (block % blocksPerRow) * columnBlockSize;
+							const int64_t colEnd   = std::min(inner, colBegin + columnBlockSize);
+							reduceColumns<Reducer>(obj,
+												   out + o * inner,
+												   o * extent * inner,
+												   extent,
+												   inner,
+												   colBegin,
+												   colEnd);
+						}
+					} else {
+						for (int64_t block = 0; block < numBlocks; ++block) {
+							const int64_t o		   = block / blocksPerRow;
+							const int64_t colBegin = (block % blocksPerRow) * columnBlockSize;
+							const int64_t colEnd   = std::min(inner, colBegin + columnBlockSize);
+							reduceColumns<Reducer>(obj,
+												   out + o * inner,
+												   o * extent * inner,
+												   extent,
+												   inner,
+												   colBegin,
+												   colEnd);
+						}
+					}
+				} else {
+					// Reduced axes are interleaved with kept axes, so fall back to computing the
+					// offset of every element from its coordinates
+					const int64_t ndim = static_cast<int64_t>(shape.ndim());
+					std::vector<int64_t> keptExtent, keptStride, reducedExtent, reducedStride;
+
+					int64_t stride = 1;
+					for (int64_t d = ndim - 1; d >= 0; --d) {
+						if (reduced[d]) {
+							reducedExtent.insert(reducedExtent.begin(), shape[d]);
+							reducedStride.insert(reducedStride.begin(), stride);
+						} else {
+							keptExtent.insert(keptExtent.begin(), shape[d]);
+							keptStride.insert(keptStride.begin(), stride);
+						}
+						stride *= static_cast<int64_t>(shape[d]);
+					}
+
+					const int64_t reducedSize = size / outSize;
+					auto offset = [](int64_t index, const std::vector<int64_t> &extents,
+									 const std::vector<int64_t> &strides) {
+						int64_t res = 0;
+						for (int64_t d = static_cast<int64_t>(extents.size()) - 1; d >= 0; --d) {
+							res += (index % extents[d]) * strides[d];
+							index /= extents[d];
+						}
+						return res;
+					};
+
+					auto reduceElement = [&](int64_t o) {
+						const int64_t base = offset(o, keptExtent, keptStride);
+						Scalar acc		   = Reducer::init(obj, base);
+						for (int64_t k = 0; k < reducedSize; ++k) {
+							const int64_t index = base + offset(k, reducedExtent, reducedStride);
+							acc = Reducer::combine(acc, Scalar(obj.scalar(index)));
+						}
+						out[o] = acc;
+					};
+
+					if (parallel) {
+#pragma omp parallel for shared(outSize, reduceElement) default(none)                              \
+  num_threads(int(global::numThreads))
+						for (int64_t o = 0; o < outSize; ++o) { reduceElement(o); }
+					} else {
+						for (int64_t o = 0; o < outSize; ++o) { reduceElement(o); }
+					}
+				}
+
+				return result;
+			}
+
+			/// Return the index of the first element in [begin, end) equal to the reduced value
+			/// of the range, relative to \p begin
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD int64_t argReduceRange(const T &obj, int64_t begin, int64_t end,
+													  bool parallel) {
+				using Scalar	  = typename typetraits::TypeInfo<T>::Scalar;
+				const Scalar best = parallel ? reduceParallel<Reducer>(obj, begin, end)
+											 : reduceRange<Reducer>(obj, begin, end);
+				int64_t index	  = begin;
+
+				if constexpr (reductionVectorisable<T>()) {
+					using Packet				  = typename typetraits::TypeInfo<Scalar>::Packet;
+					constexpr int64_t packetWidth = typetraits::TypeInfo<Scalar>::packetWidth;
+
+					if (canVectorise(obj, packetWidth)) {
+						const int64_t aligned =
+						  std::min(end, (begin + packetWidth - 1) / packetWidth * packetWidth);
+						for (; index < aligned; ++index) {
+							if (Scalar(obj.scalar(index)) == best) return index - begin;
+						}
+
+						// Skip whole packets which do not contain the extreme value
+						const Packet target(best);
+						while (index + packetWidth <= end &&
+							   !xsimd::any(obj.packet(index) == target)) {
+							index += packetWidth;
+						}
+					}
+				}
+
+				for (; index < end; ++index) {
+					if (Scalar(obj.scalar(index)) == best) return index - begin;
+				}
+
+				return 0; // Only reachable if the range contains NaN values
+			}
+
+			/// Compute the index of the extreme value along a single axis
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD auto argReduceAxis(const T &obj, int64_t axis) {
+				checkBackend<T>();
+				using Scalar = typename typetraits::TypeInfo<T>::Scalar;
+
+				const auto shape   = obj.shape();
+				const auto reduced = axisMask(shape, {axis});
+				const int64_t size = static_cast<int64_t>(shape.size());
+				LIBRAPID_ASSERT_WITH_EXCEPTION(
+				  std::invalid_argument, size > 0, "Cannot reduce an empty array");
+
+				// A single axis is always "simple"
+				const auto layout	 = axisLayout(shape, reduced);
+				const int64_t outer	 = layout.outer;
+				const int64_t extent = layout.extent;
+				const int64_t inner	 = layout.inner;
+
+				Array<int64_t, backend::CPU> result(reducedShape(shape, reduced));
+				int64_t *out = result.storage().begin();
+
+				const int64_t numThreads = static_cast<int64_t>(global::numThreads);
+				const bool parallel =
+				  numThreads > 1 && size > static_cast<int64_t>(global::multithreadThreshold);
+
+				if (inner == 1) {
+					if (!parallel || outer < numThreads) {
+						for (int64_t o = 0; o < outer; ++o) {
+							out[o] = argReduceRange<Reducer>(
+							  obj, o * extent, (o + 1) * extent, parallel);
+						}
+					} else {
+#pragma omp parallel for shared(obj, out, outer, extent) default(none)                             \
+  num_threads(int(global::numThreads))
+						for (int64_t o = 0; o < outer; ++o) {
+							out[o] =
+							  argReduceRange<Reducer>(obj, o * extent, (o + 1) * extent, false);
+						}
+					}
+					return result;
+				}
+
+				const int64_t blocksPerRow = (inner + columnBlockSize - 1) / columnBlockSize;
+				const int64_t numBlocks	   = outer * blocksPerRow;
+
+				auto reduceBlock = [&](int64_t block) {
+					const int64_t o		   = block / blocksPerRow;
+					const int64_t colBegin = (block % blocksPerRow) * columnBlockSize;
+					const int64_t colEnd   = std::min(inner, colBegin + columnBlockSize);
+					const int64_t base	   = o * extent * inner;
+					int64_t *outRow		   = out + o * inner;
+
+					Scalar bestValue[columnBlockSize];
+					for (int64_t col = colBegin; col < colEnd; ++col) {
+						bestValue[col - colBegin] = Scalar(obj.scalar(base + col));
+						outRow[col]				  = 0;
+					}
+
+					for (int64_t row = 1; row < extent; ++row) {
+						const int64_t rowBase = base + row * inner;
+						for (int64_t col = colBegin; col < colEnd; ++col) {
+							const Scalar value = Scalar(obj.scalar(rowBase + col));
+							if (Reducer::better(value, bestValue[col - colBegin])) {
+								bestValue[col - colBegin] = value;
+								outRow[col]				  = row;
+							}
+						}
+					}
+				};
+
+				if (parallel) {
+#pragma omp parallel for shared(numBlocks, reduceBlock) default(none)                              \
+  num_threads(int(global::numThreads))
+					for (int64_t block = 0; block < numBlocks; ++block) { reduceBlock(block); }
+				} else {
+					for (int64_t block = 0; block < numBlocks; ++block) { reduceBlock(block); }
+				}
+
+				return result;
+			}
+
+			/// Full reduction of an array or Function to a single value
+			template<typename Reducer, typename T>
+			LIBRAPID_NODISCARD auto reduceAll(const T &obj) {
+				checkBackend<T>();
+				return reduceParallel<Reducer>(obj, 0, static_cast<int64_t>(obj.shape().size()));
+			}
+
+			template<typename T>
+			using MeanType =
+			  std::conditional_t<std::is_integral_v<typename typetraits::TypeInfo<T>::Scalar>,
+								 double, typename typetraits::TypeInfo<T>::Scalar>;
+		} // namespace reduce
+	}	  // namespace detail
+
+	/// \brief Compute the sum of all elements of an array
+	///
+	/// The input may be an Array, a lazily-evaluated Function or an array view. Functions are
+	/// reduced directly, without evaluating them into a temporary array.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \return The sum of all elements in the input
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto sum(const T &array) {
+		return detail::reduce::reduceAll<detail::reduce::Sum>(array);
+	}
+
+	/// \brief Compute the sum of the elements of an array along a set of axes
+	///
+	/// The reduced axes are removed from the shape of the result. Negative axes count backwards
+	/// from the last axis.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axes The axes to reduce along
+	/// \return An Array containing the sum along the given axes
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto sum(const T &array, const std::vector<int64_t> &axes) {
+		return detail::reduce::reduceAxes<detail::reduce::Sum>(array, axes);
+	}
+
+	/// \brief Compute the sum of the elements of an array along a single axis
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axis The axis to reduce along
+	/// \return An Array containing the sum along the given axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto sum(const T &array, int64_t axis) {
+		return sum(array, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Compute the product of all elements of an array
+	///
+	/// The input may be an Array, a lazily-evaluated Function or an array view. Functions are
+	/// reduced directly, without evaluating them into a temporary array.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \return The product of all elements in the input
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto prod(const T &array) {
+		return detail::reduce::reduceAll<detail::reduce::Prod>(array);
+	}
+
+	/// \brief Compute the product of the elements of an array along a set of axes
+	///
+	/// The reduced axes are removed from the shape of the result. Negative axes count backwards
+	/// from the last axis.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axes The axes to reduce along
+	/// \return An Array containing the product along the given axes
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto prod(const T &array, const std::vector<int64_t> &axes) {
+		return detail::reduce::reduceAxes<detail::reduce::Prod>(array, axes);
+	}
+
+	/// \brief Compute the product of the elements of an array along a single axis
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axis The axis to reduce along
+	/// \return An Array containing the product along the given axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto prod(const T &array, int64_t axis) {
+		return prod(array, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Compute the minimum of all elements of an array
+	///
+	/// The input may be an Array, a lazily-evaluated Function or an array view. Functions are
+	/// reduced directly, without evaluating them into a temporary array.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \return The minimum of all elements in the input
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto min(const T &array) {
+		LIBRAPID_ASSERT_WITH_EXCEPTION(std::invalid_argument,
+									   array.shape().size() > 0,
+									   "Cannot compute the minimum of an empty array");
+		return detail::reduce::reduceAll<detail::reduce::Min>(array);
+	}
+
+	/// \brief Compute the minimum of the elements of an array along a set of axes
+	///
+	/// The reduced axes are removed from the shape of the result. Negative axes count backwards
+	/// from the last axis.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axes The axes to reduce along
+	/// \return An Array containing the minimum along the given axes
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto min(const T &array, const std::vector<int64_t> &axes) {
+		LIBRAPID_ASSERT_WITH_EXCEPTION(std::invalid_argument,
+									   array.shape().size() > 0,
+									   "Cannot compute the minimum of an empty array");
+		return detail::reduce::reduceAxes<detail::reduce::Min>(array, axes);
+	}
+
+	/// \brief Compute the minimum of the elements of an array along a single axis
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axis The axis to reduce along
+	/// \return An Array containing the minimum along the given axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto min(const T &array, int64_t axis) {
+		return min(array, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Compute the maximum of all elements of an array
+	///
+	/// The input may be an Array, a lazily-evaluated Function or an array view. Functions are
+	/// reduced directly, without evaluating them into a temporary array.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \return The maximum of all elements in the input
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto max(const T &array) {
+		LIBRAPID_ASSERT_WITH_EXCEPTION(std::invalid_argument,
+									   array.shape().size() > 0,
+									   "Cannot compute the maximum of an empty array");
+		return detail::reduce::reduceAll<detail::reduce::Max>(array);
+	}
+
+	/// \brief Compute the maximum of the elements of an array along a set of axes
+	///
+	/// The reduced axes are removed from the shape of the result. Negative axes count backwards
+	/// from the last axis.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axes The axes to reduce along
+	/// \return An Array containing the maximum along the given axes
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto max(const T &array, const std::vector<int64_t> &axes) {
+		LIBRAPID_ASSERT_WITH_EXCEPTION(std::invalid_argument,
+									   array.shape().size() > 0,
+									   "Cannot compute the maximum of an empty array");
+		return detail::reduce::reduceAxes<detail::reduce::Max>(array, axes);
+	}
+
+	/// \brief Compute the maximum of the elements of an array along a single axis
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axis The axis to reduce along
+	/// \return An Array containing the maximum along the given axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto max(const T &array, int64_t axis) {
+		return max(array, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Compute the arithmetic mean of all elements of an array
+	///
+	/// Integer inputs produce a double-precision result.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \return The mean of all elements in the input
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto mean(const T &array) {
+		using Result	   = detail::reduce::MeanType<T>;
+		const int64_t size = static_cast<int64_t>(array.shape().size());
+		LIBRAPID_ASSERT_WITH_EXCEPTION(
+		  std::invalid_argument, size > 0, "Cannot compute the mean of an empty array");
+		return static_cast<Result>(sum(array)) / static_cast<Result>(size);
+	}
+
+	/// \brief Compute the arithmetic mean of the elements of an array along a set of axes
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axes The axes to reduce along
+	/// \return An Array containing the mean along the given axes
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto mean(const T &array, const std::vector<int64_t> &axes) {
+		using Result	   = detail::reduce::MeanType<T>;
+		const int64_t size = static_cast<int64_t>(array.shape().size());
+		LIBRAPID_ASSERT_WITH_EXCEPTION(
+		  std::invalid_argument, size > 0, "Cannot compute the mean of an empty array");
+
+		auto total			= sum(array, axes);
+		const int64_t count = size / static_cast<int64_t>(total.shape().size());
+
+		Array<Result, backend::CPU> result(total.shape());
+		for (int64_t i = 0; i < static_cast<int64_t>(total.shape().size()); ++i) {
+			result.storage()[i] =
+			  static_cast<Result>(total.storage()[i]) / static_cast<Result>(count);
+		}
+		return result;
+	}
+
+	/// \brief Compute the arithmetic mean of the elements of an array along a single axis
+	/// \tparam T The type of the input
+	/// \param array The input to reduce
+	/// \param axis The axis to reduce along
+	/// \return An Array containing the mean along the given axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto mean(const T &array, int64_t axis) {
+		return mean(array, std::vector<int64_t> {axis});
+	}
+
+	/// \brief Return the (linear) index of the smallest element of an array
+	///
+	/// If the minimum occurs more than once, the index of the first occurrence is returned.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to search
+	/// \return The index of the smallest element
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD int64_t argmin(const T &array) {
+		detail::reduce::checkBackend<T>();
+		const int64_t size = static_cast<int64_t>(array.shape().size());
+		LIBRAPID_ASSERT_WITH_EXCEPTION(
+		  std::invalid_argument, size > 0, "Cannot compute the argmin of an empty array");
+		return detail::reduce::argReduceRange<detail::reduce::Min>(array, 0, size, true);
+	}
+
+	/// \brief Return the indices of the smallest elements along an axis of an array
+	/// \tparam T The type of the input
+	/// \param array The input to search
+	/// \param axis The axis to search along
+	/// \return An Array of indices into \p axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto argmin(const T &array, int64_t axis) {
+		return detail::reduce::argReduceAxis<detail::reduce::Min>(array, axis);
+	}
+
+	/// \brief Return the (linear) index of the largest element of an array
+	///
+	/// If the maximum occurs more than once, the index of the first occurrence is returned.
+	///
+	/// \tparam T The type of the input
+	/// \param array The input to search
+	/// \return The index of the largest element
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD int64_t argmax(const T &array) {
+		detail::reduce::checkBackend<T>();
+		const int64_t size = static_cast<int64_t>(array.shape().size());
+		LIBRAPID_ASSERT_WITH_EXCEPTION(
+		  std::invalid_argument, size > 0, "Cannot compute the argmax of an empty array");
+		return detail::reduce::argReduceRange<detail::reduce::Max>(array, 0, size, true);
+	}
+
+	/// \brief Return the indices of the largest elements along an axis of an array
+	/// \tparam T The type of the input
+	/// \param array The input to search
+	/// \param axis The axis to search along
+	/// \return An Array of indices into \p axis
+	template<typename T>
+		requires(IsArrayType<T>::value)
+	LIBRAPID_NODISCARD auto argmax(const T &array, int64_t axis) {
+		return detail::reduce::argReduceAxis<detail::reduce::Max>(array, axis);
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_REDUCTIONS_HPP
@@ -816,6 +816,51 @@ namespace librapid {
 		return true;
 	}
 
+	/// Returns true if two shapes are compatible under NumPy-style broadcasting. Dimensions are
+	/// compared from the innermost (last) axis outwards, and two extents are compatible if they
+	/// are equal or if either of them is one. Missing leading dimensions are treated as one.
+	/// \tparam ShapeA Type of the first shape
+	/// \tparam ShapeB Type of the second shape
+	/// \param a First shape
+	/// \param b Second shape
+	/// \return True if the shapes can be broadcast together, false otherwise
+	template<typename ShapeA, typename ShapeB>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool shapesBroadcastable(const ShapeA &a,
+																	   const ShapeB &b) {
+		const int64_t dimsA = a.ndim();
+		const int64_t dimsB = b.ndim();
+		for (int64_t i = 1; i <= std::min(dimsA, dimsB); ++i) {
+			const auto extentA = a[dimsA - i];
+			const auto extentB = b[dimsB - i];
+			if (extentA != extentB && extentA != 1 && extentB != 1) return false;
+		}
+		return true;
+	}
+
+	/// Compute the shape resulting from broadcasting two shapes together. The shapes must be
+	/// broadcastable (see ``shapesBroadcastable``).
+	/// \tparam Result The shape type to return
+	/// \tparam ShapeA Type of the first shape
+	/// \tparam ShapeB Type of the second shape
+	/// \param a First shape
+	/// \param b Second shape
+	/// \return The broadcast shape
+	template<typename Result = Shape, typename ShapeA, typename ShapeB>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Result broadcastShape(const ShapeA &a,
+																	const ShapeB &b) {
+		const int64_t dimsA	  = a.ndim();
+		const int64_t dimsB	  = b.ndim();
+		const int64_t dimsRes = std::max(dimsA, dimsB);
+
+		Shape res = Shape::zeros(static_cast<Shape::DimType>(dimsRes));
+		for (int64_t i = 1; i <= dimsRes; ++i) {
+			const int64_t extentA = i <= dimsA ? static_cast<int64_t>(a[dimsA - i]) : 1;
+			const int64_t extentB = i <= dimsB ? static_cast<int64_t>(b[dimsB - i]) : 1;
+			res[dimsRes - i]	  = static_cast<Shape::SizeType>(extentA == 1 ? extentB : extentA);
+		}
+		return Result(res);
+	}
+
 	namespace detail {
 		template<typename First, typename Second>
 		struct ShapeTypeHelperImpl {
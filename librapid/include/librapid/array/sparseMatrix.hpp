@@ -0,0 +1,339 @@
+#ifndef LIBRAPID_ARRAY_SPARSE_MATRIX_HPP
+#define LIBRAPID_ARRAY_SPARSE_MATRIX_HPP
+
+/*
+ * This file defines the SparseMatrix class, which stores only the nonzero elements of a matrix in
+ * compressed sparse row (CSR) or compressed sparse column (CSC) format. Products with dense
+ * vectors and matrices are evaluated through ArrayMultiply (see linalg/sparseArrayMultiply.hpp).
+ */
+
+namespace librapid {
+	/// Storage formats for a SparseMatrix
+	enum class SparseFormat {
+		CSR, // Compressed sparse row
+		CSC, // Compressed sparse column
+	};
+
+	/// \brief A sparse matrix in compressed sparse row or compressed sparse column format
+	///
+	/// The nonzero elements are stored in three arrays. In CSR format, ``offsets`` has one entry
+	/// per row plus one, and the elements of row ``i`` are ``values[offsets[i]]`` to
+	/// ``values[offsets[i + 1] - 1]``, with their column numbers in the matching entries of
+	/// ``indices``. CSC format is the same, with the roles of rows and columns swapped. The
+	/// indices within each row (or column) are sorted and unique.
+	///
+	/// Only the CPU backend is supported.
+	/// \tparam Scalar_ The type of each element
+	template<typename Scalar_>
+	class SparseMatrix {
+	public:
+		using Scalar	= Scalar_;
+		using Backend	= backend::CPU;
+		using ShapeType = MatrixShape;
+		using IndexType = int64_t;
+
+		/// Create an empty 0x0 matrix
+		SparseMatrix();
+
+		/// Create a matrix with no nonzero elements
+		/// \param rows Number of rows
+		/// \param cols Number of columns
+		/// \param format Storage format
+		SparseMatrix(int64_t rows, int64_t cols, SparseFormat format = SparseFormat::CSR);
+
+		/// \brief Create a matrix from existing compressed arrays
+		///
+		/// The arrays are moved into the matrix and must already satisfy the requirements
+		/// described for SparseMatrix.
+		/// \param rows Number of rows
+		/// \param cols Number of columns
+		/// \param format Storage format of the arrays
+		/// \param offsets Start of each row (CSR) or column (CSC), followed by the number of
+		/// nonzero elements
+		/// \param indices Column (CSR) or row (CSC) of each nonzero element
+		/// \param values Value of each nonzero element
+		SparseMatrix(int64_t rows, int64_t cols, SparseFormat format, std::vector<int64_t> offsets,
+					 std::vector<int64_t> indices, std::vector<Scalar> values);
+
+		SparseMatrix(const SparseMatrix &other)				= default;
+		SparseMatrix(SparseMatrix &&other) noexcept			= default;
+		SparseMatrix &operator=(const SparseMatrix &other)	= default;
+		SparseMatrix &operator=(SparseMatrix &&other) noexcept = default;
+
+		/// \brief Create a matrix from coordinate (COO) triplets
+		///
+		/// Element ``i`` has the value ``values[i]`` at (``rowIndices[i]``, ``colIndices[i]``).
+		/// The triplets may be in any order, and duplicated coordinates are summed.
+		/// \param rows Number of rows
+		/// \param cols Number of columns
+		/// \param rowIndices Row of each element
+		/// \param colIndices Column of each element
+		/// \param values Value of each element
+		/// \param format Storage format of the result
+		/// \return The sparse matrix
+		LIBRAPID_NODISCARD static SparseMatrix
+		fromTriplets(int64_t rows, int64_t cols, const std::vector<int64_t> &rowIndices,
+					 const std::vector<int64_t> &colIndices, const std::vector<Scalar> &values,
+					 SparseFormat format = SparseFormat::CSR);
+
+		/// \brief Create a matrix from the nonzero elements of a dense matrix
+		/// \tparam ShapeType_ Shape type of the dense matrix
+		/// \tparam StorageType_ Storage type of the dense matrix
+		/// \param dense A two-dimensional array
+		/// \param format Storage format of the result
+		/// \return The sparse matrix
+		template<typename ShapeType_, typename StorageType_>
+		LIBRAPID_NODISCARD static SparseMatrix
+		fromDense(const array::ArrayContainer<ShapeType_, StorageType_> &dense,
+				  SparseFormat format = SparseFormat::CSR);
+
+		/// Return a dense copy of this matrix
+		/// \return A two-dimensional array
+		LIBRAPID_NODISCARD Array<Scalar, backend::CPU> toDense() const;
+
+		/// Return a copy of this matrix in the requested storage format
+		/// \param format Storage format of the result
+		/// \return The converted matrix
+		LIBRAPID_NODISCARD SparseMatrix toFormat(SparseFormat format) const;
+
+		/// Return the value at (\p row, \p col), which is zero if the element is not stored
+		/// \param row Row of the element
+		/// \param col Column of the element
+		/// \return The value of the element
+		LIBRAPID_NODISCARD Scalar operator()(int64_t row, int64_t col) const;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t rows() const { return m_rows; }
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t cols() const { return m_cols; }
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE SparseFormat format() const { return m_format; }
+
+		/// Return the shape of the matrix
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ShapeType shape() const {
+			return ShapeType({m_rows, m_cols});
+		}
+
+		/// Return the number of stored (nonzero) elements
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t nnz() const {
+			return static_cast<int64_t>(m_values.size());
+		}
+
+		/// Return the fraction of elements which are stored
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE double density() const {
+			return m_rows * m_cols == 0 ? 0.0 : double(nnz()) / (double(m_rows) * double(m_cols));
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<int64_t> &offsets() const {
+			return m_offsets;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<int64_t> &indices() const {
+			return m_indices;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const std::vector<Scalar> &values() const {
+			return m_values;
+		}
+
+		/// Return the stored values. The sparsity pattern cannot be changed through this
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE std::vector<Scalar> &values() {
+			return m_values;
+		}
+
+	private:
+		/// Number of rows (CSR) or columns (CSC), which the offsets are indexed by
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE int64_t majorSize() const {
+			return m_format == SparseFormat::CSR ? m_rows : m_cols;
+		}
+
+		int64_t m_rows;					// Number of rows
+		int64_t m_cols;					// Number of columns
+		SparseFormat m_format;			// Storage format
+		std::vector<int64_t> m_offsets; // Start of each row (CSR) or column (CSC)
+		std::vector<int64_t> m_indices; // Column (CSR) or row (CSC) of each element
+		std::vector<Scalar> m_values;	// Value of each element
+	};
+
+	template<typename Scalar_>
+	SparseMatrix<Scalar_>::SparseMatrix() : SparseMatrix(0, 0) {}
+
+	template<typename Scalar_>
+	SparseMatrix<Scalar_>::SparseMatrix(int64_t rows, int64_t cols, SparseFormat format) :
+			m_rows(rows), m_cols(cols), m_format(format), m_offsets(majorSize() + 1, 0) {
+		LIBRAPID_ASSERT(rows >= 0 && cols >= 0, "Matrix dimensions must be non-negative");
+	}
+
+	template<typename Scalar_>
+	SparseMatrix<Scalar_>::SparseMatrix(int64_t rows, int64_t cols, SparseFormat format,
+										std::vector<int64_t> offsets,
+										std::vector<int64_t> indices, std::vector<Scalar> values) :
+			m_rows(rows),
+			m_cols(cols), m_format(format), m_offsets(std::move(offsets)),
+			m_indices(std::move(indices)), m_values(std::move(values)) {
+		LIBRAPID_ASSERT(static_cast<int64_t>(m_offsets.size()) == majorSize() + 1,
+						"Expected {} offsets. Got: {}",
+						majorSize() + 1,
+						m_offsets.size());
+		LIBRAPID_ASSERT(m_indices.size() == m_values.size() &&
+						  m_offsets.back() == static_cast<int64_t>(m_values.size()),
+						"Number of indices and values must match the final offset");
+	}
+
+	template<typename Scalar_>
+	auto SparseMatrix<Scalar_>::fromTriplets(int64_t rows, int64_t cols,
+											 const std::vector<int64_t> &rowIndices,
+											 const std::vector<int64_t> &colIndices,
+											 const std::vector<Scalar> &values,
+											 SparseFormat format) -> SparseMatrix {
+		LIBRAPID_ASSERT(rowIndices.size() == values.size() && colIndices.size() == values.size(),
+						"Triplet arrays must have the same length");
+
+		const bool csr			  = format == SparseFormat::CSR;
+		const int64_t majorSize	  = csr ? rows : cols;
+		const int64_t numTriplets = static_cast<int64_t>(values.size());
+		const auto &major		  = csr ? rowIndices : colIndices;
+		const auto &minor		  = csr ? colIndices : rowIndices;
+
+		// Bucket the triplets by row (or column) with a counting sort
+		std::vector<int64_t> offsets(majorSize + 1, 0);
+		for (int64_t i = 0; i < numTriplets; ++i) {
+			LIBRAPID_ASSERT(rowIndices[i] >= 0 && rowIndices[i] < rows && colIndices[i] >= 0 &&
+							  colIndices[i] < cols,
+							"Triplet ({}, {}) is out of range for a {}x{} matrix",
+							rowIndices[i],
+							colIndices[i],
+							rows,
+							cols);
+			++offsets[major[i] + 1];
+		}
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		std::vector<int64_t> order(numTriplets);
+		std::vector<int64_t> next(offsets.begin(), offsets.end() - 1);
+		for (int64_t i = 0; i < numTriplets; ++i) order[next[major[i]]++] = i;
+
+		// Sort each bucket and sum duplicates, compacting the result as we go
+		std::vector<int64_t> indices;
+		std::vector<Scalar> compacted;
+		indices.reserve(numTriplets);
+		compacted.reserve(numTriplets);
+
+		std::vector<int64_t> resultOffsets(majorSize + 1, 0);
+		for (int64_t m = 0; m < majorSize; ++m) {
+			auto begin = order.begin() + offsets[m];
+			auto end   = order.begin() + offsets[m + 1];
+			std::sort(begin, end, [&](int64_t a, int64_t b) { return minor[a] < minor[b]; });
+
+			for (auto it = begin; it != end; ++it) {
+				if (static_cast<int64_t>(indices.size()) > resultOffsets[m] &&
+					indices.back() == minor[*it]) {
+					compacted.back() += values[*it];
+				} else {
+					indices.push_back(minor[*it]);
+					compacted.push_back(values[*it]);
+				}
+			}
+
+			resultOffsets[m + 1] = static_cast<int64_t>(indices.size());
+		}
+
+		return SparseMatrix(
+		  rows, cols, format, std::move(resultOffsets), std::move(indices), std::move(compacted));
+	}
+
+	template<typename Scalar_>
+	template<typename ShapeType_, typename StorageType_>
+	auto
+	SparseMatrix<Scalar_>::fromDense(const array::ArrayContainer<ShapeType_, StorageType_> &dense,
+									 SparseFormat format) -> SparseMatrix {
+		LIBRAPID_ASSERT(dense.ndim() == 2, "Input must be a matrix. Got: {}", dense.shape());
+
+		const int64_t rows		= dense.shape()[0];
+		const int64_t cols		= dense.shape()[1];
+		const bool csr			= format == SparseFormat::CSR;
+		const int64_t majorSize = csr ? rows : cols;
+		const int64_t minorSize = csr ? cols : rows;
+		const auto &storage		= dense.storage();
+
+		std::vector<int64_t> offsets(majorSize + 1, 0);
+		std::vector<int64_t> indices;
+		std::vector<Scalar> values;
+
+		for (int64_t m = 0; m < majorSize; ++m) {
+			for (int64_t n = 0; n < minorSize; ++n) {
+				const auto value = static_cast<Scalar>(storage[csr ? m * cols + n : n * cols + m]);
+				if (value != Scalar(0)) {
+					indices.push_back(n);
+					values.push_back(value);
+				}
+			}
+			offsets[m + 1] = static_cast<int64_t>(values.size());
+		}
+
+		return SparseMatrix(
+		  rows, cols, format, std::move(offsets), std::move(indices), std::move(values));
+	}
+
+	template<typename Scalar_>
+	auto SparseMatrix<Scalar_>::toDense() const -> Array<Scalar, backend::CPU> {
+		Array<Scalar, backend::CPU> result(Shape({m_rows, m_cols}), Scalar(0));
+		Scalar *data   = result.storage().data();
+		const bool csr = m_format == SparseFormat::CSR;
+
+		for (int64_t m = 0; m < majorSize(); ++m) {
+			for (int64_t i = m_offsets[m]; i < m_offsets[m + 1]; ++i) {
+				const int64_t n = m_indices[i];
+				data[csr ? m * m_cols + n : n * m_cols + m] = m_values[i];
+			}
+		}
+
+		return result;
+	}
+
+	template<typename Scalar_>
+	auto SparseMatrix<Scalar_>::toFormat(SparseFormat format) const -> SparseMatrix {
+		if (format == m_format) return *this;
+
+		// Switching format is a transpose of the compressed arrays. Walking the current rows (or
+		// columns) in order leaves the indices of the result sorted.
+		const int64_t newMajorSize = format == SparseFormat::CSR ? m_rows : m_cols;
+		std::vector<int64_t> offsets(newMajorSize + 1, 0);
+		for (int64_t index : m_indices) ++offsets[index + 1];
+		std::partial_sum(offsets.begin(), offsets.end(), offsets.begin());
+
+		std::vector<int64_t> indices(m_indices.size());
+		std::vector<Scalar> values(m_values.size());
+		std::vector<int64_t> next(offsets.begin(), offsets.end() - 1);
+
+		for (int64_t m = 0; m < majorSize(); ++m) {
+			for (int64_t i = m_offsets[m]; i < m_offsets[m + 1]; ++i) {
+				const int64_t dst = next[m_indices[i]]++;
+				indices[dst]	  = m;
+				values[dst]		  = m_values[i];
+			}
+		}
+
+		return SparseMatrix(
+		  m_rows, m_cols, format, std::move(offsets), std::move(indices), std::move(values));
+	}
+
+	template<typename Scalar_>
+	auto SparseMatrix<Scalar_>::operator()(int64_t row, int64_t col) const -> Scalar {
+		LIBRAPID_ASSERT(row >= 0 && row < m_rows && col >= 0 && col < m_cols,
+						"Index ({}, {}) is out of range for a {}x{} matrix",
+						row,
+						col,
+						m_rows,
+						m_cols);
+
+		const bool csr	   = m_format == SparseFormat::CSR;
+		const int64_t m	   = csr ? row : col;
+		const int64_t n	   = csr ? col : row;
+		const auto begin   = m_indices.begin() + m_offsets[m];
+		const auto end	   = m_indices.begin() + m_offsets[m + 1];
+		const auto element = std::lower_bound(begin, end, n);
+
+		if (element == end || *element != n) return Scalar(0);
+		return m_values[std::distance(m_indices.begin(), element)];
+	}
+} // namespace librapid
+
+#endif // LIBRAPID_ARRAY_SPARSE_MATRIX_HPP
@@ -49,6 +49,11 @@ namespace librapid {
 		/// \param size Number of elements to allocate
 		LIBRAPID_ALWAYS_INLINE explicit Storage(SizeType size);
 
+		/// Create a Storage object referencing existing data. If \p ownsData is true, the data
+		/// is released with memory::systemAllocator() when the Storage object is destroyed
+		/// \param begin Beginning of the data
+		/// \param end End of the data
+		/// \param ownsData Whether the Storage object takes ownership of the data
 		LIBRAPID_ALWAYS_INLINE explicit Storage(Scalar *begin, Scalar *end, bool ownsData);
 
 		/// Create a Storage object with \p size elements, each initialized
@@ -178,6 +183,9 @@ namespace librapid {
 
 		SizeType m_size = 0;	// Number of elements in the Storage object
 		bool m_ownsData = true; // Whether this Storage object owns the data it points to
+
+		// The allocator which the data came from, and which it must be returned to
+		memory::Allocator *m_allocator = &memory::defaultAllocator();
 	};
 
 	template<typename Scalar_, size_t... Size_>
@@ -310,15 +318,15 @@ namespace librapid {
 	} // namespace typetraits
 
 	namespace detail {
-		/// Safely deallocate memory for \p size elements, using an std::allocator \p alloc. If the
+		/// Safely deallocate memory for \p size elements, allocated with safeAllocate. If the
 		/// object cannot be trivially destroyed, the destructor will be called on each element of
 		/// the data, ensuring that it is safe to free the allocated memory.
-		/// \tparam A The allocator type
-		/// \param alloc The allocator object
+		/// \tparam T The type of the elements
 		/// \param ptr The pointer to free
-		/// \param size The number of elements of type \p in the memory block
+		/// \param size The number of elements of type \p T in the memory block
+		/// \param alloc The allocator passed to safeAllocate
 		template<typename T>
-		void safeDeallocate(T *ptr, size_t size) {
+		void safeDeallocate(T *ptr, size_t size, memory::Allocator &alloc) {
 			if (!ptr) return;
 
 			auto ptr_ = LIBRAPID_ASSUME_ALIGNED(ptr);
@@ -328,55 +336,29 @@ namespace librapid {
 				for (size_t i = 0; i < size; ++i) { ptr_[i].~T(); }
 			}
 
-#if defined(LIBRAPID_BLAS_MKLBLAS)
-			mkl_free(ptr_);
-#elif defined(LIBRAPID_APPLE)
-			free(ptr_);
-#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
-			_aligned_free(ptr_);
-#else
-			free(ptr_);
-#endif
+			alloc.deallocate(ptr_, size * sizeof(T), LIBRAPID_MEM_ALIGN);
 		}
 
 		/// Safely allocate memory for \p size elements using the allocator \p alloc. If the data
 		/// can be trivially default constructed, then the constructor is not called and no data
 		/// is initialized. Otherwise, the correct default constructor will be called for each
 		/// element in the data, making sure the returned pointer is safe to use.
-		/// \tparam A The allocator type to use
-		/// \param alloc The allocator object to use
+		///
+		/// The block must be freed with safeDeallocate, passing the same allocator. Callers
+		/// keep track of it themselves, so that memory::setAllocator() can be called while the
+		/// block is alive.
+		/// \tparam T The type of the elements
 		/// \param size Number of elements to allocate
+		/// \param alloc The allocator to use. Defaults to memory::getAllocator()
 		/// \return Pointer to the first element
 		/// \see safeDeallocate
 		template<typename T>
-		T *safeAllocate(size_t size) {
+		T *safeAllocate(size_t size, memory::Allocator &alloc = memory::getAllocator()) {
 			if (size == 0) return nullptr;
 
 			using Pointer = T *;
 
-#if defined(LIBRAPID_BLAS_MKLBLAS)
-			// MKL has its own memory allocation function
-			auto ptr = static_cast<Pointer>(mkl_malloc(size * sizeof(T), 64));
-#elif defined(LIBRAPID_APPLE)
-			// Use posix_memalign
-			void *_ptr;
-			auto err = posix_memalign(&_ptr, LIBRAPID_MEM_ALIGN, size * sizeof(T));
-			LIBRAPID_ASSERT(err == 0, "posix_memalign failed with error code {}", err);
-			auto ptr = static_cast<Pointer>(_ptr);
-#elif defined(LIBRAPID_MSVC) || defined(LIBRAPID_MINGW)
-			Pointer ptr;
-			try {
-				ptr = static_cast<Pointer>(_aligned_malloc(size * sizeof(T), LIBRAPID_MEM_ALIGN));
-			} catch (const std::exception &) {
-				LIBRAPID_ASSERT(false, "Failed to allocate {} bytes of memory", size * sizeof(T));
-			}
-#else
-			auto ptr =
-			  static_cast<Pointer>(std::aligned_alloc(LIBRAPID_MEM_ALIGN, size * sizeof(T)));
-#endif
-
-			LIBRAPID_ASSERT(
-			  ptr != nullptr, "Failed to allocate {} bytes of memory", size * sizeof(T));
+			auto ptr = static_cast<Pointer>(alloc.allocate(size * sizeof(T), LIBRAPID_MEM_ALIGN));
 
 			// If the type cannot be trivially constructed, we need to
 			// initialize each value
@@ -417,17 +399,19 @@ namespace librapid {
 
 	template<typename T>
 	Storage<T>::Storage(SizeType size) :
-			m_begin(detail::safeAllocate<T>(size)), m_size(size), m_ownsData(true) {
+			m_size(size), m_ownsData(true), m_allocator(&memory::getAllocator()) {
+		m_begin = detail::safeAllocate<T>(size, *m_allocator);
 	}
 
 	template<typename T>
 	Storage<T>::Storage(Scalar *begin, Scalar *end, bool ownsData) :
-			m_begin(begin), m_size(std::distance(begin, end)), m_ownsData(ownsData) {
-	}
+			m_begin(begin), m_size(std::distance(begin, end)), m_ownsData(ownsData),
+			m_allocator(&memory::systemAllocator()) {}
 
 	template<typename T>
 	Storage<T>::Storage(SizeType size, ConstReference value) :
-			m_begin(detail::safeAllocate<T>(size)), m_size(size), m_ownsData(true) {
+			m_size(size), m_ownsData(true), m_allocator(&memory::getAllocator()) {
+		m_begin	  = detail::safeAllocate<T>(size, *m_allocator);
 		auto ptr_ = LIBRAPID_ASSUME_ALIGNED(m_begin);
 		for (SizeType i = 0; i < size; ++i) { ptr_[i] = value; }
 	}
@@ -443,7 +427,7 @@ namespace librapid {
 	template<typename T>
 	Storage<T>::Storage(Storage &&other) noexcept :
 			m_begin(std::move(other.m_begin)), m_size(std::move(other.m_size)),
-			m_ownsData(std::move(other.m_ownsData)) {
+			m_ownsData(std::move(other.m_ownsData)), m_allocator(other.m_allocator) {
 		other.m_begin	 = nullptr;
 		other.m_size	 = 0;
 		other.m_ownsData = false;
@@ -485,8 +469,9 @@ namespace librapid {
 			if (oldSize != m_size) LIBRAPID_UNLIKELY {
 					if (m_ownsData) LIBRAPID_LIKELY {
 							// Reallocate
-							detail::safeDeallocate(m_begin, oldSize);
-							m_begin = detail::safeAllocate<Scalar>(m_size);
+							detail::safeDeallocate(m_begin, oldSize, *m_allocator);
+							m_allocator = &memory::getAllocator();
+							m_begin		= detail::safeAllocate<Scalar>(m_size, *m_allocator);
 						}
 					else
 						LIBRAPID_UNLIKELY {
@@ -503,9 +488,12 @@ namespace librapid {
 	template<typename T>
 	auto Storage<T>::operator=(Storage &&other) noexcept -> Storage & {
 		if (this != &other) {
-			m_begin	   = std::move(other.m_begin);
-			m_size	   = std::move(other.m_size);
-			m_ownsData = std::move(other.m_ownsData);
+			if (m_ownsData) detail::safeDeallocate(m_begin, m_size, *m_allocator);
+
+			m_begin		= std::move(other.m_begin);
+			m_size		= std::move(other.m_size);
+			m_ownsData	= std::move(other.m_ownsData);
+			m_allocator = other.m_allocator;
 
 			other.m_begin	 = nullptr;
 			other.m_size	 = 0;
@@ -516,7 +504,7 @@ namespace librapid {
 
 	template<typename T>
 	Storage<T>::~Storage() {
-		if (m_ownsData) { detail::safeDeallocate(m_begin, m_size); }
+		if (m_ownsData) { detail::safeDeallocate(m_begin, m_size, *m_allocator); }
 	}
 
 	template<typename T>
@@ -526,7 +514,8 @@ namespace librapid {
 		if (begin == nullptr || end == nullptr || begin == end) return;
 
 		m_size			= static_cast<SizeType>(std::distance(begin, end));
-		m_begin			= detail::safeAllocate<T>(m_size);
+		m_allocator		= &memory::getAllocator();
+		m_begin			= detail::safeAllocate<T>(m_size, *m_allocator);
 		m_ownsData		= true;
 		auto thisBegin	= LIBRAPID_ASSUME_ALIGNED(m_begin);
 		auto otherBegin = LIBRAPID_ASSUME_ALIGNED(begin);
@@ -579,15 +568,18 @@ namespace librapid {
 		Pointer oldBegin = LIBRAPID_ASSUME_ALIGNED(m_begin);
 		SizeType oldSize = m_size;
 
+		memory::Allocator *oldAllocator = m_allocator;
+
 		// Allocate a new block of memory
-		m_begin = LIBRAPID_ASSUME_ALIGNED(detail::safeAllocate<T>(newSize));
-		m_size	= newSize;
+		m_allocator = &memory::getAllocator();
+		m_begin		= LIBRAPID_ASSUME_ALIGNED(detail::safeAllocate<T>(newSize, *m_allocator));
+		m_size		= newSize;
 
 		// Copy the data
 		detail::fastCopy(m_begin, oldBegin, std::min(oldSize, newSize));
 
 		// Free the old block of memory
-		detail::safeDeallocate(oldBegin, oldSize);
+		detail::safeDeallocate(oldBegin, oldSize, *oldAllocator);
 	}
 
 	template<typename T>
@@ -602,12 +594,15 @@ namespace librapid {
 		Pointer oldBegin = LIBRAPID_ASSUME_ALIGNED(m_begin);
 		SizeType oldSize = m_size;
 
+		memory::Allocator *oldAllocator = m_allocator;
+
 		// Allocate a new block of memory
-		m_begin = detail::safeAllocate<T>(newSize);
-		m_size	= newSize;
+		m_allocator = &memory::getAllocator();
+		m_begin		= detail::safeAllocate<T>(newSize, *m_allocator);
+		m_size		= newSize;
 
 		// Free the old block of memory
-		detail::safeDeallocate(oldBegin, oldSize);
+		detail::safeDeallocate(oldBegin, oldSize, *oldAllocator);
 	}
 
 	template<typename T>
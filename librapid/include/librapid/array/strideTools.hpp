@@ -140,6 +140,75 @@ namespace librapid {
 		}
 		fmt::format_to(ctx.out(), ")");
 	}
+
+	namespace detail {
+		/// Iterate over the elements of a strided N-dimensional layout, one contiguous run at a
+		/// time. Dimensions which are contiguous with the next are merged and dimensions of
+		/// extent 1 are skipped, so the innermost run is as long as possible. The multi-index of
+		/// the outer dimensions is advanced incrementally, so no division is required.
+		///
+		/// \p func is called as ``func(index, offset, length, stride)``, where ``index`` is the
+		/// row-major position of the first element of the run, ``offset`` is its position in
+		/// memory, ``length`` is the number of elements in the run, and ``stride`` is the distance
+		/// between consecutive elements of the run in memory.
+		///
+		/// \tparam ShapeType The shape type of the layout
+		/// \tparam StrideType The stride type of the layout
+		/// \tparam Func The type of the callback
+		/// \param shape The shape of the layout
+		/// \param stride The stride of the layout
+		/// \param offset The memory offset of the first element
+		/// \param func The function to call for each run
+		template<typename ShapeType, typename StrideType, typename Func>
+		LIBRAPID_ALWAYS_INLINE void forEachStridedRun(const ShapeType &shape,
+													  const StrideType &stride, int64_t offset,
+													  Func &&func) {
+			int64_t extents[LIBRAPID_MAX_ARRAY_DIMS];
+			int64_t strides[LIBRAPID_MAX_ARRAY_DIMS];
+			int64_t dims = 0;
+
+			for (int64_t d = 0; d < static_cast<int64_t>(shape.ndim()); ++d) {
+				const int64_t extent = static_cast<int64_t>(shape[d]);
+				const int64_t step	 = static_cast<int64_t>(stride[d]);
+				if (extent == 0) return;
+				if (extent == 1) continue;
+
+				if (dims > 0 && strides[dims - 1] == step * extent) {
+					extents[dims - 1] *= extent;
+					strides[dims - 1] = step;
+				} else {
+					extents[dims] = extent;
+					strides[dims] = step;
+					++dims;
+				}
+			}
+
+			if (dims == 0) {
+				func(int64_t(0), offset, int64_t(1), int64_t(1));
+				return;
+			}
+
+			const int64_t length	= extents[dims - 1];
+			const int64_t runStride = strides[dims - 1];
+			int64_t coord[LIBRAPID_MAX_ARRAY_DIMS] {};
+			int64_t index = 0;
+
+			while (true) {
+				func(index, offset, length, runStride);
+				index += length;
+
+				int64_t d = dims - 2;
+				for (; d >= 0; --d) {
+					offset += strides[d];
+					if (++coord[d] < extents[d]) break;
+					offset -= strides[d] * extents[d];
+					coord[d] = 0;
+				}
+
+				if (d < 0) return;
+			}
+		}
+	} // namespace detail
 } // namespace librapid
 
 // Support FMT printing
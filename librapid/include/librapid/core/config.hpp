@@ -68,6 +68,17 @@
 #	define LIBRAPID_OS_NAME "unknown"
 #endif
 
+// Memory-mapped storage relies on POSIX mmap/madvise
+#if (defined(LIBRAPID_UNIX) || defined(LIBRAPID_ANDROID)) && !defined(LIBRAPID_NO_MMAP)
+#	define LIBRAPID_HAS_MMAP
+#	include <cerrno>
+#	include <cstring>
+#	include <fcntl.h>
+#	include <sys/mman.h>
+#	include <sys/stat.h>
+#	include <unistd.h>
+#endif
+
 // Compiler information
 #if defined(__GNUC__) && !defined(__clang__) && !defined(__INTEL_COMPILER)
 #	define LIBRAPID_GNU
@@ -283,6 +294,12 @@
 #	endif
 #endif // Instruction set detection
 
+// F16C provides the half <-> float conversions used by librapid::HalfPacket. Every CPU with AVX2
+// supports it, but MSVC does not define a macro for it
+#if defined(__F16C__) || (defined(LIBRAPID_MSVC) && LIBRAPID_ARCH >= ARCH_AVX2)
+#	define LIBRAPID_F16C
+#endif
+
 // Check for 32bit vs 64bit
 #if _WIN32 || _WIN64 // Check windows
 #	if _WIN64
@@ -17,6 +17,11 @@
 #include "../cxxblas/cxxblas.h"
 #include "../cxxblas/cxxblas.tcc"
 
+// LAPACK
+#if defined(LIBRAPID_HAS_LAPACK)
+#	include <lapacke.h>
+#endif // LIBRAPID_HAS_LAPACK
+
 // Fourier Transform
 #if defined(LIBRAPID_HAS_FFTW) && !defined(LIBRAPID_HAS_CUDA)
 // If CUDA is enabled, we use cuFFT
@@ -30,6 +35,12 @@
 #	pragma warning(disable : 4456)
 #endif // LIBRAPID_MSVC
 
+// Cache pocketfft plans (twiddle factors) so repeated transforms of the same size don't
+// recompute them
+#if !defined(POCKETFFT_CACHE_SIZE)
+#	define POCKETFFT_CACHE_SIZE 16
+#endif
+
 #include <pocketfft_hdronly.h>
 
 #if defined(LIBRAPID_MSVC)
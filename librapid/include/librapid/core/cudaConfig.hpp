@@ -42,6 +42,15 @@ const char *getCublasErrorEnum_(cublasStatus_t error);
               (err) == CUBLAS_STATUS_SUCCESS, "cuBLAS error: {}", getCublasErrorEnum_(err))
 #    endif
 
+//*******************//
+// cuFFT ERROR CHECK //
+//*******************//
+
+#    if !defined(cufftSafeCall)
+#        define cufftSafeCall(err)                                                                 \
+            LIBRAPID_ASSERT_ALWAYS((err) == CUFFT_SUCCESS, "cuFFT error: {}", static_cast<int>(err))
+#    endif
+
 //********************//
 //  CUDA ERROR CHECK  //
 //********************//
@@ -23,6 +23,12 @@ namespace librapid {
 	template<typename Scalar_>
 	class CudaStorage;
 
+	template<typename Scalar_>
+	class MmapStorage;
+
+	template<typename Scalar_>
+	class SparseMatrix;
+
 	namespace array {
 		template<typename ShapeType_, typename StorageType_>
 		class ArrayContainer;
@@ -81,6 +87,22 @@ namespace librapid {
 		  array::ArrayContainer<ShapeType_, FixedStorage<StorageScalar, StorageSize...>> &lhs,
 		  const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
 
+#	if defined(LIBRAPID_HAS_MMAP)
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+			requires(!typetraits::HasCustomEval<
+					 detail::Function<descriptor::Trivial, Functor_, Args...>>::value)
+		LIBRAPID_ALWAYS_INLINE void
+		assign(array::ArrayContainer<ShapeType_, MmapStorage<StorageScalar>> &lhs,
+			   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+
+		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
+			requires(!typetraits::HasCustomEval<
+					 detail::Function<descriptor::Trivial, Functor_, Args...>>::value)
+		LIBRAPID_ALWAYS_INLINE void
+		assignParallel(array::ArrayContainer<ShapeType_, MmapStorage<StorageScalar>> &lhs,
+					   const detail::Function<descriptor::Trivial, Functor_, Args...> &function);
+#	endif // LIBRAPID_HAS_MMAP
+
 #	if defined(LIBRAPID_HAS_OPENCL)
 		template<typename ShapeType_, typename StorageScalar, typename Functor_, typename... Args>
 			requires(!typetraits::HasCustomEval<
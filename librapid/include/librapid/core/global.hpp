@@ -26,12 +26,25 @@ namespace librapid {
         // Random seed used by LibRapid (when changed, the random number generator is reseeded)
         extern size_t randomSeed;
 
-        // Should the random number generator be reseeded?
-        extern bool reseed;
+        // Should the random number generator be reseeded? This is atomic, so exactly one thread
+        // observes each request
+        extern std::atomic<bool> reseed;
 
         // Size of a cache line in bytes
         extern size_t cacheLineSize;
 
+        // Size of the L1 data cache in bytes
+        extern size_t l1CacheSize;
+
+        // Size of the L2 cache in bytes
+        extern size_t l2CacheSize;
+
+        // Size of the L3 cache in bytes
+        extern size_t l3CacheSize;
+
+        // Number of bytes evaluated at a time when streaming over memory-mapped arrays
+        extern size_t mmapBlockSize;
+
 #if defined(LIBRAPID_HAS_OPENCL)
         // OpenCL device list
         extern std::vector<cl::Device> openclDevices;
@@ -10,15 +10,22 @@
 
 // Standard Library
 #include <array>
+#include <atomic>
+#include <bit>
 #include <cfloat>
 #include <chrono>
+#include <climits>
 #include <cmath>
 #include <compare>
 #include <cstdint>
+#include <functional>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <random>
+#include <unordered_set>
 
 #if defined(LIBRAPID_HAS_OMP)
 #    include <omp.h>
@@ -406,15 +406,15 @@ namespace librapid {
 		struct TypeInfo<int64_t> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = int64_t;
-			using Packet							   = std::false_type;
+			using Packet							   = xsimd::batch<int64_t>;
 			using Backend							   = backend::CPU;
 			using ShapeType							   = std::false_type;
-			static constexpr int64_t packetWidth	   = 1;
+			static constexpr int64_t packetWidth	   = Packet::size;
 			static constexpr char name[]			   = "int64_t";
 			static constexpr bool supportsArithmetic   = true;
 			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = true;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = true;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_64I;
@@ -438,15 +438,15 @@ namespace librapid {
 		struct TypeInfo<uint64_t> {
 			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
 			using Scalar							   = uint64_t;
-			using Packet							   = std::false_type;
+			using Packet							   = xsimd::batch<uint64_t>;
 			using Backend							   = backend::CPU;
 			using ShapeType							   = std::false_type;
-			static constexpr int64_t packetWidth	   = 1;
+			static constexpr int64_t packetWidth	   = Packet::size;
 			static constexpr char name[]			   = "uint64_t";
 			static constexpr bool supportsArithmetic   = true;
 			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = true;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = true;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_64U;
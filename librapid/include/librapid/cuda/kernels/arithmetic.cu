@@ -189,3 +189,93 @@ __global__ void elementWiseNotEqualArraysScalarRhs(size_t elements, Destination
     const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
     if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] != rhs; }
 }
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseAndArrays(size_t elements, Destination *dst, LHS *lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] & rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseAndArraysScalarLhs(size_t elements, Destination *dst, LHS lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs & rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseAndArraysScalarRhs(size_t elements, Destination *dst, LHS *lhs, RHS rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] & rhs; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseOrArrays(size_t elements, Destination *dst, LHS *lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] | rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseOrArraysScalarLhs(size_t elements, Destination *dst, LHS lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs | rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseOrArraysScalarRhs(size_t elements, Destination *dst, LHS *lhs, RHS rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] | rhs; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseXorArrays(size_t elements, Destination *dst, LHS *lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] ^ rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseXorArraysScalarLhs(size_t elements, Destination *dst, LHS lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs ^ rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void bitwiseXorArraysScalarRhs(size_t elements, Destination *dst, LHS *lhs, RHS rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] ^ rhs; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void leftShiftArrays(size_t elements, Destination *dst, LHS *lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] << rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void leftShiftArraysScalarLhs(size_t elements, Destination *dst, LHS lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs << rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void leftShiftArraysScalarRhs(size_t elements, Destination *dst, LHS *lhs, RHS rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] << rhs; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void rightShiftArrays(size_t elements, Destination *dst, LHS *lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] >> rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void rightShiftArraysScalarLhs(size_t elements, Destination *dst, LHS lhs, RHS *rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs >> rhs[kernelIndex]; }
+}
+
+template<typename Destination, typename LHS, typename RHS>
+__global__ void rightShiftArraysScalarRhs(size_t elements, Destination *dst, LHS *lhs, RHS rhs) {
+    const size_t kernelIndex = blockDim.x * blockIdx.x + threadIdx.x;
+    if (kernelIndex < elements) { dst[kernelIndex] = lhs[kernelIndex] >> rhs; }
+}
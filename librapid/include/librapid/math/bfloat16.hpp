@@ -0,0 +1,302 @@
+#ifndef LIBRAPID_MATH_BFLOAT16_HPP
+#define LIBRAPID_MATH_BFLOAT16_HPP
+
+//
+// bfloat16 is the upper half of an IEEE 754 single precision value: 1 sign bit, 8 exponent bits
+// and 7 fraction bits. It has the same range as float, with roughly three significant decimal
+// digits of precision.
+//
+
+namespace librapid {
+	namespace detail {
+		/// \brief Round the bits of a float to the nearest bfloat16, with ties to even
+		///
+		/// NaNs are kept quiet, so truncating the fraction never turns one into an infinity.
+		/// \param bits The bits of the float
+		/// \return The bits of the bfloat16
+		constexpr inline uint16_t floatToBfloat16(uint32_t bits) noexcept {
+			if ((bits & 0x7fffffff) > 0x7f800000) return static_cast<uint16_t>((bits >> 16) | 0x40);
+			return static_cast<uint16_t>((bits + 0x7fff + ((bits >> 16) & 1)) >> 16);
+		}
+
+		/// \brief Widen the bits of a bfloat16 to the bits of the equivalent float
+		/// \param bits The bits of the bfloat16
+		/// \return The bits of the float
+		constexpr inline uint32_t bfloat16ToFloat(uint16_t bits) noexcept {
+			return static_cast<uint32_t>(bits) << 16;
+		}
+	} // namespace detail
+
+	class Bfloat16Packet;
+
+	class bfloat16 {
+	public:
+		bfloat16() noexcept		   = default;
+		bfloat16(const bfloat16 &) = default;
+		bfloat16(bfloat16 &&)	   = default;
+
+		LIBRAPID_ALWAYS_INLINE bfloat16(float f) noexcept;
+
+		template<typename T>
+		LIBRAPID_ALWAYS_INLINE explicit bfloat16(T d) noexcept;
+
+		bfloat16 &operator=(const bfloat16 &) = default;
+		bfloat16 &operator=(bfloat16 &&)	  = default;
+
+		template<typename T>
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator=(T d) noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static bfloat16 fromBits(uint16_t bits) noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE explicit operator float() const noexcept;
+
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE explicit operator T() const noexcept;
+
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator+=(const bfloat16 &rhs) noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator-=(const bfloat16 &rhs) noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator*=(const bfloat16 &rhs) noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator/=(const bfloat16 &rhs) noexcept;
+
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator--() noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 operator--(int) noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 &operator++() noexcept;
+		LIBRAPID_ALWAYS_INLINE bfloat16 operator++(int) noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator-() const noexcept;
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator+() const noexcept;
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint16_t bits() const noexcept;
+
+		template<typename T, typename Char, typename Ctx>
+		void str(const fmt::formatter<T, Char> &formatter, Ctx &ctx) const;
+
+	private:
+		uint16_t m_bits;
+	};
+
+	bfloat16::bfloat16(float f) noexcept {
+		detail::float32_t tmp;
+		tmp.m_float = f;
+		m_bits		= detail::floatToBfloat16(tmp.m_bits);
+	}
+
+	template<typename T>
+	bfloat16::bfloat16(T d) noexcept : bfloat16(static_cast<float>(d)) {}
+
+	template<typename T>
+	bfloat16 &bfloat16::operator=(T d) noexcept {
+		*this = bfloat16(d);
+		return *this;
+	}
+
+	bfloat16 bfloat16::fromBits(uint16_t bits) noexcept {
+		bfloat16 b;
+		b.m_bits = bits;
+		return b;
+	}
+
+	bfloat16::operator float() const noexcept {
+		detail::float32_t tmp;
+		tmp.m_bits = detail::bfloat16ToFloat(m_bits);
+		return tmp.m_float;
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD bfloat16::operator T() const noexcept {
+		return static_cast<T>(static_cast<float>(*this));
+	}
+
+	// Arithmetic is performed in single precision and rounded once, which gives the correctly
+	// rounded bfloat16 result
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator+=(const bfloat16 &rhs) noexcept {
+		*this = static_cast<float>(*this) + static_cast<float>(rhs);
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator-=(const bfloat16 &rhs) noexcept {
+		*this = static_cast<float>(*this) - static_cast<float>(rhs);
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator*=(const bfloat16 &rhs) noexcept {
+		*this = static_cast<float>(*this) * static_cast<float>(rhs);
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator/=(const bfloat16 &rhs) noexcept {
+		*this = static_cast<float>(*this) / static_cast<float>(rhs);
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator--() noexcept {
+		*this -= bfloat16::fromBits(static_cast<uint16_t>(0x3f80));
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 bfloat16::operator--(int) noexcept {
+		bfloat16 tmp(*this);
+		*this -= bfloat16::fromBits(static_cast<uint16_t>(0x3f80));
+		return tmp;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 &bfloat16::operator++() noexcept {
+		*this += bfloat16::fromBits(static_cast<uint16_t>(0x3f80));
+		return *this;
+	}
+
+	LIBRAPID_ALWAYS_INLINE bfloat16 bfloat16::operator++(int) noexcept {
+		bfloat16 tmp(*this);
+		*this += bfloat16::fromBits(static_cast<uint16_t>(0x3f80));
+		return tmp;
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 bfloat16::operator-() const noexcept {
+		return bfloat16::fromBits(static_cast<uint16_t>(m_bits ^ 0x8000));
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 bfloat16::operator+() const noexcept {
+		return *this;
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE uint16_t bfloat16::bits() const noexcept {
+		return m_bits;
+	}
+
+	template<typename T, typename Char, typename Ctx>
+	void bfloat16::str(const fmt::formatter<T, Char> &formatter, Ctx &ctx) const {
+		formatter.format(static_cast<float>(*this), ctx);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator+(const bfloat16 &lhs,
+																 const bfloat16 &rhs) noexcept {
+		bfloat16 tmp(lhs);
+		tmp += rhs;
+		return tmp;
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator-(const bfloat16 &lhs,
+																 const bfloat16 &rhs) noexcept {
+		bfloat16 tmp(lhs);
+		tmp -= rhs;
+		return tmp;
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator*(const bfloat16 &lhs,
+																 const bfloat16 &rhs) noexcept {
+		bfloat16 tmp(lhs);
+		tmp *= rhs;
+		return tmp;
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bfloat16 operator/(const bfloat16 &lhs,
+																 const bfloat16 &rhs) noexcept {
+		bfloat16 tmp(lhs);
+		tmp /= rhs;
+		return tmp;
+	}
+
+	// Comparisons follow the IEEE rules, so -0 == +0 and NaN compares unequal to everything
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator<(const bfloat16 &lhs,
+															 const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) < static_cast<float>(rhs);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator>(const bfloat16 &lhs,
+															 const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) > static_cast<float>(rhs);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator<=(const bfloat16 &lhs,
+															  const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) <= static_cast<float>(rhs);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator>=(const bfloat16 &lhs,
+															  const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) >= static_cast<float>(rhs);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator==(const bfloat16 &lhs,
+															  const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) == static_cast<float>(rhs);
+	}
+
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE bool operator!=(const bfloat16 &lhs,
+															  const bfloat16 &rhs) noexcept {
+		return static_cast<float>(lhs) != static_cast<float>(rhs);
+	}
+
+	namespace typetraits {
+		template<>
+		struct TypeInfo<bfloat16> {
+			static constexpr detail::LibRapidType type = detail::LibRapidType::Scalar;
+			using Scalar							   = bfloat16;
+			using Packet							   = Bfloat16Packet;
+			using Backend							   = backend::CPU;
+			using ShapeType							   = std::false_type;
+			static constexpr int64_t packetWidth	   = xsimd::batch<float>::size;
+			static constexpr char name[]			   = "bfloat16";
+			static constexpr bool supportsArithmetic   = true;
+			static constexpr bool supportsLogical	   = true;
+			static constexpr bool supportsBinary	   = false;
+			static constexpr bool allowVectorisation   = true;
+
+#if defined(LIBRAPID_HAS_CUDA)
+			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_R_16BF;
+			static constexpr int64_t cudaPacketWidth = 1;
+#endif
+
+			static constexpr bool canAlign	= true;
+			static constexpr bool canMemcpy = true;
+
+			LIMIT_IMPL(infinity) { return bfloat16::fromBits(static_cast<uint16_t>(0x7f80)); }
+			LIMIT_IMPL(max) { return bfloat16::fromBits(static_cast<uint16_t>(0x7f7f)); }
+			LIMIT_IMPL(maxSubnormal) { return bfloat16::fromBits(static_cast<uint16_t>(0x7f)); }
+			LIMIT_IMPL(min) { return bfloat16::fromBits(static_cast<uint16_t>(0xff7f)); }
+			LIMIT_IMPL(minPositive) { return bfloat16::fromBits(static_cast<uint16_t>(0x80)); }
+			LIMIT_IMPL(minPositiveSubnormal) {
+				return bfloat16::fromBits(static_cast<uint16_t>(0x1));
+			}
+			LIMIT_IMPL(nan) { return bfloat16::fromBits(static_cast<uint16_t>(0x7fc0)); }
+			LIMIT_IMPL(negativeInfinity) {
+				return bfloat16::fromBits(static_cast<uint16_t>(0xff80));
+			}
+			LIMIT_IMPL(epsilon) { return bfloat16::fromBits(static_cast<uint16_t>(0x3c00)); }
+
+			LIMIT_IMPL(one) { return bfloat16::fromBits(static_cast<uint16_t>(0x3f80)); }
+			LIMIT_IMPL(negativeOne) { return bfloat16::fromBits(static_cast<uint16_t>(0xbf80)); }
+			LIMIT_IMPL(two) { return bfloat16::fromBits(static_cast<uint16_t>(0x4000)); }
+			LIMIT_IMPL(negativeTwo) { return bfloat16::fromBits(static_cast<uint16_t>(0xc000)); }
+			LIMIT_IMPL(half_) { return bfloat16::fromBits(static_cast<uint16_t>(0x3f00)); }
+			LIMIT_IMPL(negativeHalf) { return bfloat16::fromBits(static_cast<uint16_t>(0xbf00)); }
+			LIMIT_IMPL(zero) { return bfloat16::fromBits(static_cast<uint16_t>(0x0)); }
+			LIMIT_IMPL(negativeZero) { return bfloat16::fromBits(static_cast<uint16_t>(0x8000)); }
+			LIMIT_IMPL(e) { return bfloat16::fromBits(static_cast<uint16_t>(0x402e)); }
+			LIMIT_IMPL(pi) { return bfloat16::fromBits(static_cast<uint16_t>(0x4049)); }
+		};
+	} // namespace typetraits
+} // namespace librapid
+
+template<typename Char>
+struct fmt::formatter<librapid::bfloat16, Char> {
+public:
+	using Base = fmt::formatter<float, Char>;
+	Base m_base;
+
+	template<typename ParseContext>
+	FMT_CONSTEXPR auto parse(ParseContext &ctx) -> const char * {
+		return m_base.parse(ctx);
+	}
+
+	template<typename FormatContext>
+	FMT_CONSTEXPR auto format(const librapid::bfloat16 &b, FormatContext &ctx)
+	  -> decltype(ctx.out()) {
+		b.str(m_base, ctx);
+		return ctx.out();
+	}
+};
+
+#endif // LIBRAPID_MATH_BFLOAT16_HPP
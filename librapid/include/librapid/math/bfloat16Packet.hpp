@@ -0,0 +1,299 @@
+#ifndef LIBRAPID_MATH_BFLOAT16_PACKET_HPP
+#define LIBRAPID_MATH_BFLOAT16_PACKET_HPP
+
+/*
+ * SIMD packets of bfloat16 values, used to vectorise element-wise operations on arrays of
+ * librapid::bfloat16.
+ *
+ * A packet holds xsimd::batch<float>::size values, widened to single precision. A bfloat16 is the
+ * upper half of a float, so widening is a zero-extension and a shift. Narrowing rounds to
+ * nearest-even with integer arithmetic, which keeps subnormal values, unlike vcvtneps2bf16 on
+ * CPUs with AVX-512-BF16. Other architectures convert one lane at a time.
+ *
+ * Every arithmetic operation rounds its result back to bfloat16, so an expression gives the same
+ * results as evaluating it one operation at a time.
+ */
+
+#if LIBRAPID_ARCH >= ARCH_SSE4_1
+#	include <immintrin.h>
+#endif
+
+namespace librapid {
+	namespace detail {
+#if LIBRAPID_ARCH >= ARCH_AVX512
+		/// Widen 16 bfloat16 values to single precision
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m512 bfloat16Unpack16(__m256i packed) {
+			return _mm512_castsi512_ps(_mm512_slli_epi32(_mm512_cvtepu16_epi32(packed), 16));
+		}
+
+		/// Round 16 single precision values to bfloat16
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m256i bfloat16Pack16(__m512 values) {
+			const __m512i bits	  = _mm512_castps_si512(values);
+			const __m512i upper	  = _mm512_srli_epi32(bits, 16);
+			const __m512i lsb	  = _mm512_and_si512(upper, _mm512_set1_epi32(1));
+			const __m512i bias	  = _mm512_add_epi32(lsb, _mm512_set1_epi32(0x7fff));
+			const __m512i rounded = _mm512_srli_epi32(_mm512_add_epi32(bits, bias), 16);
+			const __m512i quiet	  = _mm512_or_si512(upper, _mm512_set1_epi32(0x40));
+			const __mmask16 isNan = _mm512_cmp_ps_mask(values, values, _CMP_UNORD_Q);
+			return _mm512_cvtepi32_epi16(_mm512_mask_blend_epi32(isNan, rounded, quiet));
+		}
+#endif
+
+#if LIBRAPID_ARCH >= ARCH_AVX2
+		/// Widen 8 bfloat16 values to single precision
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m256 bfloat16Unpack8(__m128i packed) {
+			return _mm256_castsi256_ps(_mm256_slli_epi32(_mm256_cvtepu16_epi32(packed), 16));
+		}
+
+		/// Round 8 single precision values to bfloat16
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m128i bfloat16Pack8(__m256 values) {
+			const __m256i bits	  = _mm256_castps_si256(values);
+			const __m256i upper	  = _mm256_srli_epi32(bits, 16);
+			const __m256i lsb	  = _mm256_and_si256(upper, _mm256_set1_epi32(1));
+			const __m256i bias	  = _mm256_add_epi32(lsb, _mm256_set1_epi32(0x7fff));
+			const __m256i rounded = _mm256_srli_epi32(_mm256_add_epi32(bits, bias), 16);
+			const __m256i quiet	  = _mm256_or_si256(upper, _mm256_set1_epi32(0x40));
+			const __m256 isNan	  = _mm256_cmp_ps(values, values, _CMP_UNORD_Q);
+			const __m256i result  = _mm256_blendv_epi8(rounded, quiet, _mm256_castps_si256(isNan));
+
+			// packus works within each 128-bit lane, so gather the two valid quarters together
+			const __m256i packed = _mm256_packus_epi32(result, result);
+			return _mm256_castsi256_si128(_mm256_permute4x64_epi64(packed, 0xd8));
+		}
+#endif
+
+#if LIBRAPID_ARCH >= ARCH_SSE4_1
+		/// Widen 4 bfloat16 values, held in the lower half of \p packed, to single precision
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m128 bfloat16Unpack4(__m128i packed) {
+			return _mm_castsi128_ps(_mm_slli_epi32(_mm_cvtepu16_epi32(packed), 16));
+		}
+
+		/// Round 4 single precision values to bfloat16, held in the lower half of the result
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE __m128i bfloat16Pack4(__m128 values) {
+			const __m128i bits	  = _mm_castps_si128(values);
+			const __m128i upper	  = _mm_srli_epi32(bits, 16);
+			const __m128i lsb	  = _mm_and_si128(upper, _mm_set1_epi32(1));
+			const __m128i bias	  = _mm_add_epi32(lsb, _mm_set1_epi32(0x7fff));
+			const __m128i rounded = _mm_srli_epi32(_mm_add_epi32(bits, bias), 16);
+			const __m128i quiet	  = _mm_or_si128(upper, _mm_set1_epi32(0x40));
+			const __m128 isNan	  = _mm_cmpunord_ps(values, values);
+			const __m128i result  = _mm_blendv_epi8(rounded, quiet, _mm_castps_si128(isNan));
+			return _mm_packus_epi32(result, result);
+		}
+#endif
+
+		/// \brief Load bfloat16 values and widen them to single precision
+		/// \tparam Float The xsimd batch type to load into
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		/// \return The widened values
+		template<typename Float>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float loadBfloat16AsFloat(const bfloat16 *ptr) {
+#if LIBRAPID_ARCH >= ARCH_AVX512
+			if constexpr (Float::size == 16) {
+				const __m256i *src = reinterpret_cast<const __m256i *>(ptr);
+				return bfloat16Unpack16(_mm256_loadu_si256(src));
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_AVX2
+			if constexpr (Float::size == 8) {
+				return bfloat16Unpack8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_SSE4_1
+			if constexpr (Float::size == 4) {
+				return bfloat16Unpack4(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+			}
+#endif
+			alignas(LIBRAPID_MEM_ALIGN) float values[Float::size];
+			for (size_t i = 0; i < Float::size; ++i) values[i] = static_cast<float>(ptr[i]);
+			return Float::load_aligned(values);
+		}
+
+		/// \brief Round single precision values to bfloat16 and store them
+		/// \tparam Float The xsimd batch type to store from
+		/// \param values The values to store
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		template<typename Float>
+		LIBRAPID_ALWAYS_INLINE void storeFloatAsBfloat16(const Float &values, bfloat16 *ptr) {
+#if LIBRAPID_ARCH >= ARCH_AVX512
+			if constexpr (Float::size == 16) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr), bfloat16Pack16(values));
+				return;
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_AVX2
+			if constexpr (Float::size == 8) {
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(ptr), bfloat16Pack8(values));
+				return;
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_SSE4_1
+			if constexpr (Float::size == 4) {
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(ptr), bfloat16Pack4(values));
+				return;
+			}
+#endif
+			alignas(LIBRAPID_MEM_ALIGN) float lanes[Float::size];
+			values.store_aligned(lanes);
+			for (size_t i = 0; i < Float::size; ++i) ptr[i] = bfloat16(lanes[i]);
+		}
+
+		/// \brief Round single precision values to the nearest bfloat16 values
+		/// \tparam Float The xsimd batch type
+		/// \param values The values to round
+		/// \return The rounded values, still in single precision
+		template<typename Float>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float roundToBfloat16(const Float &values) {
+#if LIBRAPID_ARCH >= ARCH_AVX512
+			if constexpr (Float::size == 16) return bfloat16Unpack16(bfloat16Pack16(values));
+#endif
+#if LIBRAPID_ARCH >= ARCH_AVX2
+			if constexpr (Float::size == 8) return bfloat16Unpack8(bfloat16Pack8(values));
+#endif
+#if LIBRAPID_ARCH >= ARCH_SSE4_1
+			if constexpr (Float::size == 4) return bfloat16Unpack4(bfloat16Pack4(values));
+#endif
+			bfloat16 lanes[Float::size];
+			storeFloatAsBfloat16(values, lanes);
+			return loadBfloat16AsFloat<Float>(lanes);
+		}
+	} // namespace detail
+
+	/// \brief A SIMD packet of bfloat16 values, widened to single precision
+	class Bfloat16Packet {
+	public:
+		using Float		 = xsimd::batch<float>;
+		using Mask		 = typename Float::batch_bool_type;
+		using value_type = bfloat16;
+
+		/// Number of values in the packet
+		static constexpr size_t size = Float::size;
+
+		Bfloat16Packet() = default;
+
+		/// \brief Construct a packet from single precision values
+		///
+		/// The values are only rounded to bfloat16 when the packet is stored, so they should be
+		/// representable in bfloat16 if the packet is used in further arithmetic. Results of
+		/// arithmetic operations always are.
+		/// \param values The values of the packet
+		Bfloat16Packet(const Float &values) : m_values(values) {}
+
+		/// \brief Construct a packet with every lane set to the same value
+		/// \param value The value to broadcast
+		explicit Bfloat16Packet(const bfloat16 &value) : m_values(static_cast<float>(value)) {}
+
+		/// \brief Construct a packet from the result of a comparison. Lanes where \p mask is set
+		/// are one, and all other lanes are zero
+		/// \param mask The comparison result
+		explicit Bfloat16Packet(const Mask &mask) :
+				m_values(xsimd::select(mask, Float(1.0f), Float(0.0f))) {}
+
+		/// \brief Load a packet from an aligned array of bfloat16 values
+		/// \param ptr Pointer to the first value
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Bfloat16Packet
+		load_aligned(const bfloat16 *ptr) {
+			return detail::loadBfloat16AsFloat<Float>(ptr);
+		}
+
+		/// \brief Load a packet from an array of bfloat16 values
+		/// \param ptr Pointer to the first value
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static Bfloat16Packet
+		load_unaligned(const bfloat16 *ptr) {
+			return detail::loadBfloat16AsFloat<Float>(ptr);
+		}
+
+		/// \brief Store the packet to an aligned array of bfloat16 values
+		/// \param ptr Pointer to the first value
+		LIBRAPID_ALWAYS_INLINE void store_aligned(bfloat16 *ptr) const {
+			detail::storeFloatAsBfloat16(m_values, ptr);
+		}
+
+		/// \brief Store the packet to an array of bfloat16 values
+		/// \param ptr Pointer to the first value
+		LIBRAPID_ALWAYS_INLINE void store_unaligned(bfloat16 *ptr) const {
+			detail::storeFloatAsBfloat16(m_values, ptr);
+		}
+
+		/// \brief Return the values of the packet in single precision
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Float &values() const { return m_values; }
+
+		LIBRAPID_ALWAYS_INLINE Bfloat16Packet &operator+=(const Bfloat16Packet &other) {
+			return *this = *this + other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE Bfloat16Packet &operator-=(const Bfloat16Packet &other) {
+			return *this = *this - other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE Bfloat16Packet &operator*=(const Bfloat16Packet &other) {
+			return *this = *this * other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE Bfloat16Packet &operator/=(const Bfloat16Packet &other) {
+			return *this = *this / other;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Bfloat16Packet
+		operator+(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return detail::roundToBfloat16(lhs.m_values + rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Bfloat16Packet
+		operator-(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return detail::roundToBfloat16(lhs.m_values - rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Bfloat16Packet
+		operator*(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return detail::roundToBfloat16(lhs.m_values * rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Bfloat16Packet
+		operator/(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return detail::roundToBfloat16(lhs.m_values / rhs.m_values);
+		}
+
+		/// Negation is exact, so it needs no rounding
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Bfloat16Packet operator-() const {
+			return -m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator<(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values < rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator>(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values > rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator<=(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values <= rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator>=(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values >= rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator==(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values == rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask
+		operator!=(const Bfloat16Packet &lhs, const Bfloat16Packet &rhs) {
+			return lhs.m_values != rhs.m_values;
+		}
+
+	private:
+		Float m_values;
+	};
+} // namespace librapid
+
+#endif // LIBRAPID_MATH_BFLOAT16_PACKET_HPP
@@ -2056,6 +2056,24 @@ namespace librapid {
 						  ::librapid::random(imag(min), imag(max), seed));
 	}
 
+	template<typename T>
+	class ComplexPacket; // Defined in complexPacket.hpp
+
+	namespace detail {
+		/// Complex packets are provided for the component types which xsimd can vectorise
+		template<typename T>
+		constexpr bool hasComplexPacket = std::is_same_v<T, float> || std::is_same_v<T, double>;
+
+		template<typename T>
+		using ComplexPacketType =
+		  std::conditional_t<hasComplexPacket<T>, ComplexPacket<T>, std::false_type>;
+
+		/// A complex packet holds as many values as a packet of its components
+		template<typename T>
+		constexpr int64_t complexPacketWidth =
+		  hasComplexPacket<T> ? typetraits::TypeInfo<T>::packetWidth : 0;
+	} // namespace detail
+
 	namespace typetraits {
 		template<typename T>
 		struct TypeInfo<Complex<T>> {
@@ -2063,13 +2081,13 @@ namespace librapid {
 			using Scalar							   = Complex<T>;
 			using Backend							   = typename TypeInfo<T>::Backend;
 			using ShapeType							   = std::false_type;
-			using Packet							   = std::false_type;
-			static constexpr int64_t packetWidth	   = 0;
+			using Packet							   = detail::ComplexPacketType<T>;
+			static constexpr int64_t packetWidth	   = detail::complexPacketWidth<T>;
 			static constexpr char name[]			   = "Complex";
 			static constexpr bool supportsArithmetic   = true;
 			static constexpr bool supportsLogical	   = true;
 			static constexpr bool supportsBinary	   = false;
-			static constexpr bool allowVectorisation   = false;
+			static constexpr bool allowVectorisation   = detail::hasComplexPacket<T>;
 
 #if defined(LIBRAPID_HAS_CUDA)
 			static constexpr cudaDataType_t CudaType = cudaDataType_t::CUDA_C_64F;
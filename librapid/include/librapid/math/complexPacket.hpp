@@ -0,0 +1,463 @@
+#ifndef LIBRAPID_MATH_COMPLEX_PACKET_HPP
+#define LIBRAPID_MATH_COMPLEX_PACKET_HPP
+
+/*
+ * SIMD packets of complex numbers, used to vectorise element-wise operations on arrays of
+ * Complex<float> and Complex<double>.
+ *
+ * A packet holds the real and imaginary components of xsimd::batch<T>::size complex numbers in
+ * two separate batches, so arithmetic operates on whole registers without any shuffling. The
+ * values are deinterleaved when a packet is loaded and interleaved again when it is stored.
+ *
+ * Functions with a simple closed form are computed directly from the two batches. Where the
+ * scalar implementation takes special care with infinities, NaNs or values close to overflow,
+ * only the lanes which need that care are recomputed with the scalar function. Functions with
+ * no packet implementation are applied lane by lane.
+ */
+
+namespace librapid {
+	/// \brief A SIMD packet of complex numbers, stored as separate batches of real and
+	/// imaginary components
+	/// \tparam T Scalar type of the components. Must be ``float`` or ``double``
+	template<typename T>
+	class ComplexPacket {
+	public:
+		using Real		 = xsimd::batch<T>;
+		using Mask		 = typename Real::batch_bool_type;
+		using value_type = Complex<T>;
+
+		/// Number of complex values in the packet
+		static constexpr size_t size = Real::size;
+
+		ComplexPacket() = default;
+
+		/// \brief Construct a packet of real values
+		/// \param realVal The real components. The imaginary components are set to zero
+		ComplexPacket(const Real &realVal) : m_real(realVal), m_imag(T(0)) {}
+
+		/// \brief Construct a packet from batches of real and imaginary components
+		/// \param realVal The real components
+		/// \param imagVal The imaginary components
+		ComplexPacket(const Real &realVal, const Real &imagVal) :
+				m_real(realVal), m_imag(imagVal) {}
+
+		/// \brief Construct a packet with every lane set to the same complex number
+		/// \param value The value to broadcast
+		explicit ComplexPacket(const Complex<T> &value) :
+				m_real(value.real()), m_imag(value.imag()) {}
+
+		/// \brief Construct a packet with every lane set to the same real number
+		/// \param value The value to broadcast
+		explicit ComplexPacket(const T &value) : m_real(value), m_imag(T(0)) {}
+
+		/// \brief Construct a packet from the result of a comparison. Lanes where \p mask is
+		/// set are one, and all other lanes are zero
+		/// \param mask The comparison result
+		explicit ComplexPacket(const Mask &mask) :
+				m_real(xsimd::select(mask, Real(T(1)), Real(T(0)))), m_imag(T(0)) {}
+
+		/// \brief Load a packet from an aligned array of complex numbers
+		/// \param ptr Pointer to the first value. Must be aligned to the size of the packet
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static ComplexPacket
+		load_aligned(const Complex<T> *ptr) {
+			const auto interleaved = Interleaved::load_aligned(toStd(ptr));
+			return {interleaved.real(), interleaved.imag()};
+		}
+
+		/// \brief Load a packet from an array of complex numbers
+		/// \param ptr Pointer to the first value
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static ComplexPacket
+		load_unaligned(const Complex<T> *ptr) {
+			const auto interleaved = Interleaved::load_unaligned(toStd(ptr));
+			return {interleaved.real(), interleaved.imag()};
+		}
+
+		/// \brief Store the packet to an aligned array of complex numbers
+		/// \param ptr Pointer to the first value. Must be aligned to the size of the packet
+		LIBRAPID_ALWAYS_INLINE void store_aligned(Complex<T> *ptr) const {
+			Interleaved(m_real, m_imag).store_aligned(toStd(ptr));
+		}
+
+		/// \brief Store the packet to an array of complex numbers
+		/// \param ptr Pointer to the first value
+		LIBRAPID_ALWAYS_INLINE void store_unaligned(Complex<T> *ptr) const {
+			Interleaved(m_real, m_imag).store_unaligned(toStd(ptr));
+		}
+
+		/// \brief Return the real components of the packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Real &real() const { return m_real; }
+
+		/// \brief Return the imaginary components of the packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Real &imag() const { return m_imag; }
+
+		LIBRAPID_ALWAYS_INLINE ComplexPacket &operator+=(const ComplexPacket &other) {
+			return *this = *this + other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE ComplexPacket &operator-=(const ComplexPacket &other) {
+			return *this = *this - other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE ComplexPacket &operator*=(const ComplexPacket &other) {
+			return *this = *this * other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE ComplexPacket &operator/=(const ComplexPacket &other) {
+			return *this = *this / other;
+		}
+
+	private:
+		// Complex<T> has the same layout as std::complex<T>, which xsimd can deinterleave
+		using Interleaved = xsimd::batch<std::complex<T>>;
+
+		LIBRAPID_ALWAYS_INLINE static const std::complex<T> *toStd(const Complex<T> *ptr) {
+			return reinterpret_cast<const std::complex<T> *>(ptr);
+		}
+
+		LIBRAPID_ALWAYS_INLINE static std::complex<T> *toStd(Complex<T> *ptr) {
+			return reinterpret_cast<std::complex<T> *>(ptr);
+		}
+
+		Real m_real;
+		Real m_imag;
+	};
+
+	namespace detail {
+		/// \brief Apply a scalar function to every lane of a complex packet
+		/// \tparam T Scalar type of the components
+		/// \tparam F Function type
+		/// \param x The input packet
+		/// \param func The function to apply, taking and returning a ``Complex<T>``
+		/// \return A packet containing the results
+		template<typename T, typename F>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T>
+		complexPacketApply(const ComplexPacket<T> &x, F &&func) {
+			Complex<T> lanes[ComplexPacket<T>::size];
+			x.store_unaligned(lanes);
+			for (auto &lane : lanes) lane = func(lane);
+			return ComplexPacket<T>::load_unaligned(lanes);
+		}
+
+		/// \brief Recompute some lanes of a packet result with a scalar function
+		///
+		/// Lanes of \p result where \p mask is set are replaced by \p func applied to the
+		/// corresponding lane of \p x. Nothing is done if no lanes are set.
+		/// \tparam Result Packet type of the result. Either a ``ComplexPacket<T>`` or an
+		/// ``xsimd::batch<T>``
+		/// \tparam T Scalar type of the components
+		/// \tparam F Function type
+		/// \param result The result computed by the packet implementation
+		/// \param x The input packet
+		/// \param mask The lanes to recompute
+		/// \param func The scalar function
+		/// \return The corrected result
+		template<typename Result, typename T, typename F>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Result
+		complexPacketFixLanes(const Result &result, const ComplexPacket<T> &x,
+							  const typename ComplexPacket<T>::Mask &mask, F &&func) {
+			if (!xsimd::any(mask)) LIBRAPID_LIKELY { return result; }
+
+			using Value			  = typename Result::value_type;
+			constexpr size_t size = ComplexPacket<T>::size;
+
+			Complex<T> input[size];
+			Value output[size];
+			x.store_unaligned(input);
+			result.store_unaligned(output);
+
+			const uint64_t bits = mask.mask();
+			for (size_t i = 0; i < size; ++i) {
+				if ((bits >> i) & 1) output[i] = func(input[i]);
+			}
+			return Result::load_unaligned(output);
+		}
+
+		/// \brief Compute \f$ \mathrm{Re}(z)^2 + \mathrm{Im}(z)^2 \f$ for each lane of a packet
+		///
+		/// \p unsafe is set for lanes where the sum is not finite, or is so small that the
+		/// squares may have underflowed. These lanes must be handled by the scalar functions,
+		/// which rescale their inputs.
+		/// \tparam T Scalar type of the components
+		/// \param x The input packet
+		/// \param unsafe Set to the lanes where the result cannot be used
+		/// \return The squared magnitudes
+		template<typename T>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE typename ComplexPacket<T>::Real
+		complexPacketNorm(const ComplexPacket<T> &x, typename ComplexPacket<T>::Mask &unsafe) {
+			using Real			 = typename ComplexPacket<T>::Real;
+			constexpr T smallest = typetraits::NumericInfo<T>::min() /
+								   typetraits::NumericInfo<T>::epsilon();
+			constexpr T largest	 = typetraits::NumericInfo<T>::max();
+
+			const Real sumSquares = x.real() * x.real() + x.imag() * x.imag();
+
+			// This also catches NaN
+			unsafe = !((sumSquares >= Real(smallest)) & (sumSquares <= Real(largest)));
+			return sumSquares;
+		}
+	} // namespace detail
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator-(const ComplexPacket<T> &other)
+	  -> ComplexPacket<T> {
+		return {-other.real(), -other.imag()};
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator+(const ComplexPacket<T> &left,
+															 const ComplexPacket<T> &right)
+	  -> ComplexPacket<T> {
+		return {left.real() + right.real(), left.imag() + right.imag()};
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator-(const ComplexPacket<T> &left,
+															 const ComplexPacket<T> &right)
+	  -> ComplexPacket<T> {
+		return {left.real() - right.real(), left.imag() - right.imag()};
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator*(const ComplexPacket<T> &left,
+															 const ComplexPacket<T> &right)
+	  -> ComplexPacket<T> {
+		return {left.real() * right.real() - left.imag() * right.imag(),
+				left.real() * right.imag() + left.imag() * right.real()};
+	}
+
+	/// \brief Divide two complex packets
+	///
+	/// Uses the same scaled algorithm as the scalar division, choosing the form for each lane
+	/// from whichever component of the divisor is larger. Lanes which the scalar division
+	/// would set to NaN are set to NaN.
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator/(const ComplexPacket<T> &left,
+															 const ComplexPacket<T> &right)
+	  -> ComplexPacket<T> {
+		using Real = typename ComplexPacket<T>::Real;
+
+		// Where |Re(right)| <= |Im(right)|, the roles of the real and imaginary components are
+		// swapped, which also flips the sign of the imaginary part of the result
+		const auto realLarger = xsimd::abs(right.imag()) < xsimd::abs(right.real());
+		const Real large	  = xsimd::select(realLarger, right.real(), right.imag());
+		const Real small	  = xsimd::select(realLarger, right.imag(), right.real());
+		const Real first	  = xsimd::select(realLarger, left.real(), left.imag());
+		const Real second	  = xsimd::select(realLarger, left.imag(), left.real());
+
+		const Real wr = small / large;
+		const Real wd = large + wr * small;
+
+		const Real realVal = (first + second * wr) / wd;
+		const Real imagVal =
+		  xsimd::select(realLarger, second - first * wr, first * wr - second) / wd;
+
+		// A zero divisor gives 0 / 0 above, so is caught by the NaN check on wd
+		const auto invalid = xsimd::isnan(right.real()) | xsimd::isnan(right.imag()) |
+							 xsimd::isnan(wd) | (wd == Real(T(0)));
+		const Real nan(typetraits::NumericInfo<T>::quietNaN());
+		return {xsimd::select(invalid, nan, realVal), xsimd::select(invalid, nan, imagVal)};
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator==(const ComplexPacket<T> &left,
+															  const ComplexPacket<T> &right) {
+		return (left.real() == right.real()) & (left.imag() == right.imag());
+	}
+
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto operator!=(const ComplexPacket<T> &left,
+															  const ComplexPacket<T> &right) {
+		return (left.real() != right.real()) | (left.imag() != right.imag());
+	}
+
+	/// \brief Return the real components of a complex packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto real(const ComplexPacket<T> &val) {
+		return val.real();
+	}
+
+	/// \brief Return the imaginary components of a complex packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto imag(const ComplexPacket<T> &val) {
+		return val.imag();
+	}
+
+	/// \brief Return the complex conjugate of each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> conj(const ComplexPacket<T> &val) {
+		return {val.real(), -val.imag()};
+	}
+
+	/// \brief Return the squared magnitude of each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto norm(const ComplexPacket<T> &val) {
+		return val.real() * val.real() + val.imag() * val.imag();
+	}
+
+	/// \brief Return the magnitude of each lane of a packet
+	///
+	/// Lanes whose squared magnitude would overflow or underflow use the scalar ``hypot``.
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto abs(const ComplexPacket<T> &val) {
+		typename ComplexPacket<T>::Mask unsafe;
+		const auto sumSquares = detail::complexPacketNorm(val, unsafe);
+		const auto scalarAbs  = [](const Complex<T> &z) { return ::librapid::abs(z); };
+		return detail::complexPacketFixLanes(xsimd::sqrt(sumSquares), val, unsafe, scalarAbs);
+	}
+
+	/// \brief Return the phase angle of each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto arg(const ComplexPacket<T> &val) {
+		return xsimd::atan2(val.imag(), val.real());
+	}
+
+	/// \brief Compute \f$ e^z \f$ for each lane of a packet
+	///
+	/// Lanes with infinite or NaN components, or whose exponential is close to overflow or
+	/// underflow, use the scalar ``exp``.
+	template<typename T>
+	LIBRAPID_NODISCARD ComplexPacket<T> exp(const ComplexPacket<T> &val) {
+		using Real	   = typename ComplexPacket<T>::Real;
+		const T logMax = ::librapid::log(typetraits::NumericInfo<T>::max());
+
+		const Real rho = xsimd::exp(val.real());
+		const ComplexPacket<T> result(rho * xsimd::cos(val.imag()), rho * xsimd::sin(val.imag()));
+
+		// This also catches NaN
+		const auto unsafe = !((xsimd::abs(val.real()) < Real(logMax)) &
+							  (xsimd::abs(val.imag()) <= Real(typetraits::NumericInfo<T>::max())));
+		return detail::complexPacketFixLanes(
+		  result, val, unsafe, [](const Complex<T> &z) { return ::librapid::exp(z); });
+	}
+
+	/// \brief Compute \f$ \ln(z) \f$ for each lane of a packet
+	///
+	/// Lanes close to the unit circle compute \f$ \ln|z| \f$ with ``log1p`` to avoid
+	/// cancellation. Zero lanes, and lanes whose squared magnitude would overflow or underflow,
+	/// use the scalar ``log``.
+	template<typename T>
+	LIBRAPID_NODISCARD ComplexPacket<T> log(const ComplexPacket<T> &val) {
+		using Real = typename ComplexPacket<T>::Real;
+
+		typename ComplexPacket<T>::Mask unsafe;
+		const Real sumSquares = detail::complexPacketNorm(val, unsafe);
+		Real logAbs			  = Real(T(0.5)) * xsimd::log(sumSquares);
+
+		const auto nearOne = xsimd::abs(sumSquares - Real(T(1))) < Real(T(0.25));
+		if (xsimd::any(nearOne)) {
+			const Real large = xsimd::max(xsimd::abs(val.real()), xsimd::abs(val.imag()));
+			const Real small = xsimd::min(xsimd::abs(val.real()), xsimd::abs(val.imag()));
+
+			// large * large - 1 is computed with a single rounding
+			const Real offset = xsimd::fma(large, large, Real(T(-1))) + small * small;
+			logAbs			  = xsimd::select(nearOne, Real(T(0.5)) * xsimd::log1p(offset), logAbs);
+		}
+
+		const ComplexPacket<T> result(logAbs, xsimd::atan2(val.imag(), val.real()));
+		return detail::complexPacketFixLanes(
+		  result, val, unsafe, [](const Complex<T> &z) { return ::librapid::log(z); });
+	}
+
+	/// \brief Compute \f$ \log_2(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> log2(const ComplexPacket<T> &val) {
+		using Real		  = typename ComplexPacket<T>::Real;
+		const auto result = ::librapid::log(val);
+		const Real scale  = Real(static_cast<T>(::librapid::log(T(2))));
+		return {result.real() / scale, result.imag() / scale};
+	}
+
+	/// \brief Compute \f$ \log_{10}(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> log10(const ComplexPacket<T> &val) {
+		using Real		  = typename ComplexPacket<T>::Real;
+		const auto result = ::librapid::log(val);
+		const Real scale  = Real(static_cast<T>(::librapid::log(10)));
+		return {result.real() / scale, result.imag() / scale};
+	}
+
+	/// \brief Compute \f$ \sqrt{z} \f$ for each lane of a packet
+	///
+	/// The principal square root is computed in the quadrant which avoids cancellation. Zero
+	/// lanes, and lanes whose squared magnitude would overflow or underflow, use the scalar
+	/// ``sqrt``.
+	template<typename T>
+	LIBRAPID_NODISCARD ComplexPacket<T> sqrt(const ComplexPacket<T> &val) {
+		using Real = typename ComplexPacket<T>::Real;
+
+		typename ComplexPacket<T>::Mask unsafe;
+		const Real rho = xsimd::sqrt(detail::complexPacketNorm(val, unsafe));
+
+		// The larger component of the result, and the smaller one divided by it
+		const Real large = xsimd::sqrt(Real(T(0.5)) * (rho + xsimd::abs(val.real())));
+		const Real small = val.imag() / (Real(T(2)) * large);
+
+		const auto positive = val.real() >= Real(T(0));
+		const ComplexPacket<T> result(
+		  xsimd::select(positive, large, xsimd::abs(small)),
+		  xsimd::select(positive, small, xsimd::copysign(large, val.imag())));
+		return detail::complexPacketFixLanes(
+		  result, val, unsafe, [](const Complex<T> &z) { return ::librapid::sqrt(z); });
+	}
+
+	/// \brief Compute \f$ \sin(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> sin(const ComplexPacket<T> &val) {
+		return {xsimd::cosh(val.imag()) * xsimd::sin(val.real()),
+				xsimd::sinh(val.imag()) * xsimd::cos(val.real())};
+	}
+
+	/// \brief Compute \f$ \cos(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> cos(const ComplexPacket<T> &val) {
+		return {xsimd::cosh(val.imag()) * xsimd::cos(val.real()),
+				-xsimd::sinh(val.imag()) * xsimd::sin(val.real())};
+	}
+
+	/// \brief Compute \f$ \sinh(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> sinh(const ComplexPacket<T> &val) {
+		return {xsimd::sinh(val.real()) * xsimd::cos(val.imag()),
+				xsimd::cosh(val.real()) * xsimd::sin(val.imag())};
+	}
+
+	/// \brief Compute \f$ \cosh(z) \f$ for each lane of a packet
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> cosh(const ComplexPacket<T> &val) {
+		return {xsimd::cosh(val.real()) * xsimd::cos(val.imag()),
+				xsimd::sinh(val.real()) * xsimd::sin(val.imag())};
+	}
+
+	/// \brief Round the components of each lane of a packet towards \f$ -\infty \f$
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> floor(const ComplexPacket<T> &val) {
+		return {xsimd::floor(val.real()), xsimd::floor(val.imag())};
+	}
+
+	/// \brief Round the components of each lane of a packet towards \f$ +\infty \f$
+	template<typename T>
+	LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE ComplexPacket<T> ceil(const ComplexPacket<T> &val) {
+		return {xsimd::ceil(val.real()), xsimd::ceil(val.imag())};
+	}
+
+#define LIBRAPID_COMPLEX_PACKET_LANEWISE(NAME)                                                     \
+	template<typename T>                                                                           \
+	LIBRAPID_NODISCARD ComplexPacket<T> NAME(const ComplexPacket<T> &val) {                        \
+		return detail::complexPacketApply(                                                         \
+		  val, [](const Complex<T> &z) { return ::librapid::NAME(z); });                           \
+	}
+
+	// These have no packet implementation, and are evaluated one lane at a time
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(tan)
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(tanh)
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(asin)
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(acos)
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(atan)
+	LIBRAPID_COMPLEX_PACKET_LANEWISE(cbrt)
+
+#undef LIBRAPID_COMPLEX_PACKET_LANEWISE
+} // namespace librapid
+
+#endif // LIBRAPID_MATH_COMPLEX_PACKET_HPP
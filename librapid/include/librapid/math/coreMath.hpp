@@ -19,6 +19,7 @@ namespace librapid {
 	/// \param val Input set
 	/// \return Smallest element of the input set
 	template<typename T>
+		requires(!detail::ContainsArrayType<std::decay_t<T>>::val)
 	T &&min(T &&val) {
 		return std::forward<T>(val);
 	}
@@ -28,6 +29,8 @@ namespace librapid {
 	/// \param vals Input values
 	/// \return The smallest element of the input values
 	template<typename T0, typename T1, typename... Ts>
+		requires(!detail::ContainsArrayType<std::decay_t<T0>, std::decay_t<T1>,
+											std::decay_t<Ts>...>::val)
 	auto min(T0 &&val1, T1 &&val2, Ts &&...vs) {
 		return (val1 < val2) ? min(val1, std::forward<Ts>(vs)...)
 							 : min(val2, std::forward<Ts>(vs)...);
@@ -38,6 +41,7 @@ namespace librapid {
 	/// \param val Input set
 	/// \return Largest element of the input set
 	template<typename T>
+		requires(!detail::ContainsArrayType<std::decay_t<T>>::val)
 	T &&max(T &&val) {
 		return std::forward<T>(val);
 	}
@@ -47,6 +51,8 @@ namespace librapid {
 	/// \param vals Input values
 	/// \return The largest element of the input values
 	template<typename T0, typename T1, typename... Ts>
+		requires(!detail::ContainsArrayType<std::decay_t<T0>, std::decay_t<T1>,
+											std::decay_t<Ts>...>::val)
 	auto max(T0 &&val1, T1 &&val2, Ts &&...vs) {
 		return (val1 > val2) ? max(val1, std::forward<Ts>(vs)...)
 							 : max(val2, std::forward<Ts>(vs)...);
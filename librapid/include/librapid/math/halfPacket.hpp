@@ -0,0 +1,248 @@
+#ifndef LIBRAPID_MATH_HALF_PACKET_HPP
+#define LIBRAPID_MATH_HALF_PACKET_HPP
+
+/*
+ * SIMD packets of half precision values, used to vectorise element-wise operations on arrays of
+ * librapid::half.
+ *
+ * A packet holds xsimd::batch<float>::size values, widened to single precision. Loads and stores
+ * convert between the two formats with the F16C instructions (vcvtph2ps and vcvtps2ph) where
+ * they are available, and with the scalar conversions otherwise. Both round to nearest, with ties
+ * to even, and give the same result for every input.
+ *
+ * Every arithmetic operation rounds its result back to half precision, so an expression gives
+ * the same results as evaluating it one operation at a time in half precision, no matter how many
+ * operations are chained together.
+ */
+
+#if defined(LIBRAPID_F16C)
+#	include <immintrin.h>
+#endif
+
+namespace librapid {
+	namespace detail {
+		/// \brief Load half precision values and widen them to single precision, one lane at a
+		/// time. This is the fallback for CPUs without F16C
+		/// \tparam Float The xsimd batch type to load into
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		/// \return The widened values
+		template<typename Float>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float loadHalfAsFloatScalar(const half *ptr) {
+			alignas(LIBRAPID_MEM_ALIGN) float values[Float::size];
+			for (size_t i = 0; i < Float::size; ++i) values[i] = static_cast<float>(ptr[i]);
+			return Float::load_aligned(values);
+		}
+
+		/// \brief Round single precision values to half precision and store them, one lane at a
+		/// time. This is the fallback for CPUs without F16C
+		/// \tparam Float The xsimd batch type to store from
+		/// \param values The values to store
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		template<typename Float>
+		LIBRAPID_ALWAYS_INLINE void storeFloatAsHalfScalar(const Float &values, half *ptr) {
+			alignas(LIBRAPID_MEM_ALIGN) float lanes[Float::size];
+			values.store_aligned(lanes);
+			for (size_t i = 0; i < Float::size; ++i) ptr[i] = half(lanes[i]);
+		}
+
+		/// \brief Load half precision values and widen them to single precision
+		/// \tparam Float The xsimd batch type to load into
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		/// \return The widened values
+		template<typename Float>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float loadHalfAsFloat(const half *ptr) {
+#if defined(LIBRAPID_F16C)
+			if constexpr (Float::size == 16) {
+				return _mm512_cvtph_ps(_mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptr)));
+			} else if constexpr (Float::size == 8) {
+				return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<const __m128i *>(ptr)));
+			} else if constexpr (Float::size == 4) {
+				return _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<const __m128i *>(ptr)));
+			}
+#endif
+			return loadHalfAsFloatScalar<Float>(ptr);
+		}
+
+		/// \brief Round single precision values to half precision and store them
+		/// \tparam Float The xsimd batch type to store from
+		/// \param values The values to store
+		/// \param ptr Pointer to the first of ``Float::size`` values
+		template<typename Float>
+		LIBRAPID_ALWAYS_INLINE void storeFloatAsHalf(const Float &values, half *ptr) {
+#if defined(LIBRAPID_F16C)
+			if constexpr (Float::size == 16) {
+				_mm256_storeu_si256(reinterpret_cast<__m256i *>(ptr),
+									_mm512_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+				return;
+			} else if constexpr (Float::size == 8) {
+				_mm_storeu_si128(reinterpret_cast<__m128i *>(ptr),
+								 _mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+				return;
+			} else if constexpr (Float::size == 4) {
+				_mm_storel_epi64(reinterpret_cast<__m128i *>(ptr),
+								 _mm_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+				return;
+			}
+#endif
+			storeFloatAsHalfScalar(values, ptr);
+		}
+
+		/// \brief Round single precision values to the nearest half precision values
+		/// \tparam Float The xsimd batch type
+		/// \param values The values to round
+		/// \return The rounded values, still in single precision
+		template<typename Float>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Float roundToHalf(const Float &values) {
+#if defined(LIBRAPID_F16C)
+			if constexpr (Float::size == 16) {
+				return _mm512_cvtph_ps(_mm512_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+			} else if constexpr (Float::size == 8) {
+				return _mm256_cvtph_ps(_mm256_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+			} else if constexpr (Float::size == 4) {
+				return _mm_cvtph_ps(_mm_cvtps_ph(values, _MM_FROUND_TO_NEAREST_INT));
+			}
+#endif
+			half lanes[Float::size];
+			storeFloatAsHalf(values, lanes);
+			return loadHalfAsFloat<Float>(lanes);
+		}
+	} // namespace detail
+
+	/// \brief A SIMD packet of half precision values, widened to single precision
+	class HalfPacket {
+	public:
+		using Float		 = xsimd::batch<float>;
+		using Mask		 = typename Float::batch_bool_type;
+		using value_type = half;
+
+		/// Number of values in the packet
+		static constexpr size_t size = Float::size;
+
+		HalfPacket() = default;
+
+		/// \brief Construct a packet from single precision values
+		///
+		/// The values are not rounded, so they should be representable in half precision.
+		/// Results of arithmetic operations always are.
+		/// \param values The values of the packet
+		HalfPacket(const Float &values) : m_values(values) {}
+
+		/// \brief Construct a packet with every lane set to the same value
+		/// \param value The value to broadcast
+		explicit HalfPacket(const half &value) : m_values(static_cast<float>(value)) {}
+
+		/// \brief Construct a packet from the result of a comparison. Lanes where \p mask is set
+		/// are one, and all other lanes are zero
+		/// \param mask The comparison result
+		explicit HalfPacket(const Mask &mask) :
+				m_values(xsimd::select(mask, Float(1.0f), Float(0.0f))) {}
+
+		/// \brief Load a packet from an aligned array of half precision values
+		/// \param ptr Pointer to the first value
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static HalfPacket load_aligned(const half *ptr) {
+			return detail::loadHalfAsFloat<Float>(ptr);
+		}
+
+		/// \brief Load a packet from an array of half precision values
+		/// \param ptr Pointer to the first value
+		/// \return The loaded packet
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE static HalfPacket
+		load_unaligned(const half *ptr) {
+			return detail::loadHalfAsFloat<Float>(ptr);
+		}
+
+		/// \brief Store the packet to an aligned array of half precision values
+		/// \param ptr Pointer to the first value
+		LIBRAPID_ALWAYS_INLINE void store_aligned(half *ptr) const {
+			detail::storeFloatAsHalf(m_values, ptr);
+		}
+
+		/// \brief Store the packet to an array of half precision values
+		/// \param ptr Pointer to the first value
+		LIBRAPID_ALWAYS_INLINE void store_unaligned(half *ptr) const {
+			detail::storeFloatAsHalf(m_values, ptr);
+		}
+
+		/// \brief Return the values of the packet in single precision
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE const Float &values() const { return m_values; }
+
+		LIBRAPID_ALWAYS_INLINE HalfPacket &operator+=(const HalfPacket &other) {
+			return *this = *this + other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE HalfPacket &operator-=(const HalfPacket &other) {
+			return *this = *this - other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE HalfPacket &operator*=(const HalfPacket &other) {
+			return *this = *this * other;
+		}
+
+		LIBRAPID_ALWAYS_INLINE HalfPacket &operator/=(const HalfPacket &other) {
+			return *this = *this / other;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend HalfPacket
+		operator+(const HalfPacket &lhs, const HalfPacket &rhs) {
+			return detail::roundToHalf(lhs.m_values + rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend HalfPacket
+		operator-(const HalfPacket &lhs, const HalfPacket &rhs) {
+			return detail::roundToHalf(lhs.m_values - rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend HalfPacket
+		operator*(const HalfPacket &lhs, const HalfPacket &rhs) {
+			return detail::roundToHalf(lhs.m_values * rhs.m_values);
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend HalfPacket
+		operator/(const HalfPacket &lhs, const HalfPacket &rhs) {
+			return detail::roundToHalf(lhs.m_values / rhs.m_values);
+		}
+
+		/// Negation is exact, so it needs no rounding
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE HalfPacket operator-() const {
+			return -m_values;
+		}
+
+		// Comparisons follow the IEEE rules for the widened values
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator<(const HalfPacket &lhs,
+																		 const HalfPacket &rhs) {
+			return lhs.m_values < rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator>(const HalfPacket &lhs,
+																		 const HalfPacket &rhs) {
+			return lhs.m_values > rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator<=(const HalfPacket &lhs,
+																		  const HalfPacket &rhs) {
+			return lhs.m_values <= rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator>=(const HalfPacket &lhs,
+																		  const HalfPacket &rhs) {
+			return lhs.m_values >= rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator==(const HalfPacket &lhs,
+																		  const HalfPacket &rhs) {
+			return lhs.m_values == rhs.m_values;
+		}
+
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE friend Mask operator!=(const HalfPacket &lhs,
+																		  const HalfPacket &rhs) {
+			return lhs.m_values != rhs.m_values;
+		}
+
+	private:
+		Float m_values;
+	};
+} // namespace librapid
+
+#endif // LIBRAPID_MATH_HALF_PACKET_HPP
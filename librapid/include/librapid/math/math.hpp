@@ -7,9 +7,13 @@
 #include "coreMath.hpp"
 #include "random.hpp"
 #include "half.hpp"
+#include "halfPacket.hpp"
+#include "bfloat16.hpp"
+#include "bfloat16Packet.hpp"
 #include "multiprec.hpp"
 #include "vector.hpp"
 #include "complex.hpp"
+#include "complexPacket.hpp"
 #include "utilityFunctions.hpp"
 #include "round.hpp"
 
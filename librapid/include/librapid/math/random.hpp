@@ -2,20 +2,199 @@
 #define LIBRAPID_MATH_RANDOM_HPP
 
 namespace librapid {
-	template<typename Lower = double, typename Upper = double>
-	LIBRAPID_NODISCARD LIBRAPID_INLINE auto random(Lower lower = 0, Upper upper = 1) {
-		// Random floating point value in range [lower, upper)
+	namespace detail::random {
+		// Philox4x32-10 constants, from Salmon et al., "Parallel Random Numbers: As Easy as
+		// 1, 2, 3" (SC'11)
+		constexpr uint32_t philoxM0		= 0xD2511F53;
+		constexpr uint32_t philoxM1		= 0xCD9E8D57;
+		constexpr uint32_t philoxW0		= 0x9E3779B9;
+		constexpr uint32_t philoxW1		= 0xBB67AE85;
+		constexpr int64_t philoxRounds	= 10;
+
+		/// Number of Philox blocks generated together. Each block yields four 32-bit words
+		constexpr int64_t philoxLanes	= 16;
+		constexpr int64_t philoxChunkWords = 4 * philoxLanes;
+
+		/// Compute \p Lanes consecutive Philox4x32-10 blocks, starting at block \p counter of
+		/// the stream identified by \p seed. The output is written as 4 * Lanes words, in stream
+		/// order. The lanes are stored as separate arrays so the rounds can be vectorised.
+		/// \tparam Lanes Number of blocks to generate
+		/// \param seed Key for the generator
+		/// \param counter Index of the first block
+		/// \param out Output words
+		template<int64_t Lanes>
+		LIBRAPID_ALWAYS_INLINE void philox(uint64_t seed, uint64_t counter, uint32_t *out) {
+			uint32_t c0[Lanes], c1[Lanes], c2[Lanes], c3[Lanes];
+			for (int64_t lane = 0; lane < Lanes; ++lane) {
+				const uint64_t ctr = counter + static_cast<uint64_t>(lane);
+				c0[lane]		   = static_cast<uint32_t>(ctr);
+				c1[lane]		   = static_cast<uint32_t>(ctr >> 32);
+				c2[lane]		   = 0;
+				c3[lane]		   = 0;
+			}
+
+			uint32_t k0 = static_cast<uint32_t>(seed);
+			uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+			for (int64_t round = 0; round < philoxRounds; ++round) {
+				for (int64_t lane = 0; lane < Lanes; ++lane) {
+					const uint64_t p0 = static_cast<uint64_t>(philoxM0) * c0[lane];
+					const uint64_t p1 = static_cast<uint64_t>(philoxM1) * c2[lane];
+					const uint32_t n0 = static_cast<uint32_t>(p1 >> 32) ^ c1[lane] ^ k0;
+					const uint32_t n2 = static_cast<uint32_t>(p0 >> 32) ^ c3[lane] ^ k1;
+					c0[lane]		  = n0;
+					c1[lane]		  = static_cast<uint32_t>(p1);
+					c2[lane]		  = n2;
+					c3[lane]		  = static_cast<uint32_t>(p0);
+				}
+				k0 += philoxW0;
+				k1 += philoxW1;
+			}
+
+			for (int64_t lane = 0; lane < Lanes; ++lane) {
+				out[lane * 4 + 0] = c0[lane];
+				out[lane * 4 + 1] = c1[lane];
+				out[lane * 4 + 2] = c2[lane];
+				out[lane * 4 + 3] = c3[lane];
+			}
+		}
+
+		/// Reserve \p blocks consecutive Philox blocks and return the index of the first one.
+		/// Every call consumes a distinct part of the stream, so successive calls produce
+		/// different values. Setting a new seed restarts the stream.
+		LIBRAPID_INLINE uint64_t reserveBlocks(uint64_t blocks) {
+			static std::atomic<uint64_t> next = 0;
+
+			// Only the thread which clears the flag restarts the stream, so a reservation made
+			// by another thread after the reset is never handed out a second time. The plain
+			// load keeps the common case free of writes to the shared flag
+			if (global::reseed.load(std::memory_order_relaxed) && global::reseed.exchange(false)) {
+				next.store(0);
+			}
+			return next.fetch_add(blocks);
+		}
+
+		/// Floating point type used to generate uniform values for \p Scalar. Single precision
+		/// values use one word per value, everything else uses two.
+		template<typename Scalar>
+		using UniformType = std::conditional_t<std::is_same_v<Scalar, float>, float, double>;
+
+		/// Convert random words into a uniform value in [0, 1)
+		template<typename Real>
+		LIBRAPID_ALWAYS_INLINE Real toUniform(const uint32_t *words) {
+			if constexpr (std::is_same_v<Real, float>) {
+				return static_cast<float>(words[0] >> 8) * 0x1.0p-24f;
+			} else {
+				const uint64_t bits =
+				  (static_cast<uint64_t>(words[0]) << 32) | static_cast<uint64_t>(words[1]);
+				return static_cast<double>(bits >> 11) * 0x1.0p-53;
+			}
+		}
+
+		/// Split \p elements values into chunks of philoxChunkWords words and call \p kernel
+		/// on each one. The values written for an element depend only on the seed, the stream
+		/// position and the element's index, so the result is identical for any number of
+		/// threads.
+		/// \tparam Real Uniform type used to generate the values
+		/// \param data Output pointer
+		/// \param elements Number of values to generate
+		/// \param parallel If true, distribute the chunks over multiple threads
+		/// \param kernel Callable taking (words, dst, count)
+		template<typename Real, typename Scalar, typename Kernel>
+		LIBRAPID_ALWAYS_INLINE void generate(Scalar *data, int64_t elements, bool parallel,
+											 const Kernel &kernel) {
+			constexpr int64_t perChunk = philoxChunkWords / (sizeof(Real) / sizeof(uint32_t));
+			const int64_t chunks	   = (elements + perChunk - 1) / perChunk;
+			const uint64_t seed		   = static_cast<uint64_t>(global::randomSeed);
+			const uint64_t base = reserveBlocks(static_cast<uint64_t>(chunks * philoxLanes));
 
-		static std::uniform_real_distribution<double> distribution(0., 1.);
-		static std::mt19937 generator((uint32_t)global::randomSeed);
+			auto generateChunk = [&](int64_t chunk) {
+				alignas(64) uint32_t words[philoxChunkWords];
+				philox<philoxLanes>(seed, base + static_cast<uint64_t>(chunk * philoxLanes), words);
+				const int64_t start = chunk * perChunk;
+				kernel(words, data + start, std::min(perChunk, elements - start));
+			};
 
-		if (global::reseed) {
-			generator.seed((uint32_t)global::randomSeed);
-			global::reseed = false;
+			if (parallel) {
+#pragma omp parallel for shared(chunks, generateChunk) default(none)                               \
+  num_threads(int(global::numThreads))
+				for (int64_t chunk = 0; chunk < chunks; ++chunk) { generateChunk(chunk); }
+			} else {
+				for (int64_t chunk = 0; chunk < chunks; ++chunk) { generateChunk(chunk); }
+			}
 		}
 
+		/// Fill \p data with uniform values in [lower, upper)
+		template<typename Scalar, typename Lower, typename Upper>
+		LIBRAPID_INLINE void fillUniform(Scalar *data, int64_t elements, const Lower &lower,
+										 const Upper &upper, bool parallel) {
+			using Real					  = UniformType<Scalar>;
+			constexpr int64_t wordsPerVal = sizeof(Real) / sizeof(uint32_t);
+			constexpr int64_t perChunk	  = philoxChunkWords / wordsPerVal;
+			const Real low				  = static_cast<Real>(lower);
+			const Real range			  = static_cast<Real>(upper) - low;
+
+			generate<Real>(
+			  data, elements, parallel, [&](const uint32_t *words, Scalar *dst, int64_t count) {
+				  Real values[perChunk];
+				  for (int64_t i = 0; i < perChunk; ++i) {
+					  values[i] = low + range * toUniform<Real>(words + i * wordsPerVal);
+				  }
+				  for (int64_t i = 0; i < count; ++i) { dst[i] = static_cast<Scalar>(values[i]); }
+			  });
+		}
+
+		/// Fill \p data with normally distributed values, using the Box-Muller transform on
+		/// whole SIMD packets. The first half of each chunk provides the radii and the second
+		/// half the angles.
+		template<typename Scalar, typename Mean, typename StdDev>
+		LIBRAPID_INLINE void fillGaussian(Scalar *data, int64_t elements, const Mean &mean,
+										  const StdDev &stdDev, bool parallel) {
+			using Real					  = UniformType<Scalar>;
+			using Packet				  = xsimd::batch<Real>;
+			constexpr int64_t wordsPerVal = sizeof(Real) / sizeof(uint32_t);
+			constexpr int64_t perChunk	  = philoxChunkWords / wordsPerVal;
+			constexpr int64_t halfChunk	  = perChunk / 2;
+			constexpr int64_t packetWidth = static_cast<int64_t>(Packet::size);
+			static_assert(halfChunk % packetWidth == 0, "Chunk must hold whole packets");
+
+			const Packet mu(static_cast<Real>(mean));
+			const Packet sigma(static_cast<Real>(stdDev));
+
+			generate<Real>(
+			  data, elements, parallel, [&](const uint32_t *words, Scalar *dst, int64_t count) {
+				  alignas(64) Real values[perChunk];
+				  for (int64_t i = 0; i < perChunk; ++i) {
+					  values[i] = toUniform<Real>(words + i * wordsPerVal);
+				  }
+
+				  for (int64_t i = 0; i < halfChunk; i += packetWidth) {
+					  // 1 - u lies in (0, 1], so the logarithm is always finite
+					  const Packet u1 = Packet(Real(1)) - Packet::load_aligned(values + i);
+					  const Packet u2 = Packet::load_aligned(values + halfChunk + i);
+					  const Packet radius = xsimd::sqrt(Packet(Real(-2)) * xsimd::log(u1));
+					  const auto [sinTheta, cosTheta] =
+						xsimd::sincos(Packet(static_cast<Real>(constants::twoPi)) * u2);
+					  (mu + sigma * radius * cosTheta).store_aligned(values + i);
+					  (mu + sigma * radius * sinTheta).store_aligned(values + halfChunk + i);
+				  }
+
+				  for (int64_t i = 0; i < count; ++i) { dst[i] = static_cast<Scalar>(values[i]); }
+			  });
+		}
+	} // namespace detail::random
+
+	template<typename Lower = double, typename Upper = double>
+	LIBRAPID_NODISCARD LIBRAPID_INLINE auto random(Lower lower = 0, Upper upper = 1) {
+		// Random floating point value in range [lower, upper). This is thread-safe, and draws
+		// from the same counter-based stream as fillRandom
+
+		uint32_t words[4];
+		detail::random::philox<1>(static_cast<uint64_t>(global::randomSeed),
+								  detail::random::reserveBlocks(1),
+								  words);
+
 		using Scalar = decltype(lower + upper);
-		return (Scalar)(lower + (upper - lower) * distribution(generator));
+		return (Scalar)(lower + (upper - lower) * detail::random::toUniform<double>(words));
 	}
 
 	LIBRAPID_NODISCARD LIBRAPID_INLINE int64_t randint(int64_t lower, int64_t upper) {
@@ -41,35 +220,18 @@ namespace librapid {
 		return (int64_t)trueRandom((double)(lower - (lower < 0 ? 1 : 0)), (double)upper + 1);
 	}
 
-	/**
-	 * Adapted from
-	 * https://docs.oracle.com/javase/6/docs/api/java/util/Random.html#nextGaussian()
-	 */
+	/// Normally distributed random value with mean 0 and standard deviation 1, computed with
+	/// the Box-Muller transform. This is thread-safe.
 	template<typename T = double>
 	LIBRAPID_NODISCARD LIBRAPID_INLINE double randomGaussian() {
-		static double nextGaussian;
-		static bool hasNextGaussian = false;
-
-		double res;
-		if (hasNextGaussian) {
-			hasNextGaussian = false;
-			res				= nextGaussian;
-		} else {
-			double v1;
-			double v2;
-			double s;
-			do {
-				v1 = random<double>(-1, 1); // between -1.0 and 1.0
-				v2 = random<double>(-1, 1); // between -1.0 and 1.0
-				s  = v1 * v1 + v2 * v2;
-			} while (s >= 1 || s == 0);
-			double multiplier = sqrt(-2 * ::librapid::log(s) / s);
-			nextGaussian	  = v2 * multiplier;
-			hasNextGaussian	  = true;
-			res				  = v1 * multiplier;
-		}
+		uint32_t words[4];
+		detail::random::philox<1>(static_cast<uint64_t>(global::randomSeed),
+								  detail::random::reserveBlocks(1),
+								  words);
 
-		return static_cast<T>(res);
+		const double u1 = 1 - detail::random::toUniform<double>(words);
+		const double u2 = detail::random::toUniform<double>(words + 2);
+		return static_cast<T>(std::sqrt(-2 * std::log(u1)) * std::cos(constants::twoPi * u2));
 	}
 } // namespace librapid
 
@@ -9,24 +9,34 @@ namespace librapid {
 		template<typename T, uint64_t N>
 		struct SimdVectorStorage;
 
+		/// SimdVectorStorage holds xsimd batches, so it is only used for scalars whose packet
+		/// type is an xsimd batch of the scalar itself
+		template<typename T>
+		constexpr bool useSimdVectorStorage() {
+			if constexpr (typetraits::TypeInfo<T>::packetWidth > 1) {
+				return std::is_same_v<typename typetraits::TypeInfo<T>::Packet, xsimd::batch<T>>;
+			} else {
+				return false;
+			}
+		}
+
 		template<typename T, uint64_t N>
 		struct VectorStorageType {
-			using type = std::conditional_t<(typetraits::TypeInfo<T>::packetWidth > 1),
-											SimdVectorStorage<T, N>, GenericVectorStorage<T, N>>;
+			using type = std::conditional_t<useSimdVectorStorage<T>(), SimdVectorStorage<T, N>,
+											GenericVectorStorage<T, N>>;
 		};
 
 		template<typename Storage0, typename Storage1>
 		auto vectorStorageTypeMerger() {
 			using Scalar0 = typename typetraits::TypeInfo<Storage0>::Scalar;
 			using Scalar1 = typename typetraits::TypeInfo<Storage1>::Scalar;
-			static constexpr uint64_t packetWidth0 = typetraits::TypeInfo<Scalar0>::packetWidth;
-			static constexpr uint64_t packetWidth1 = typetraits::TypeInfo<Scalar1>::packetWidth;
 			if constexpr (typetraits::TypeInfo<Storage0>::type == detail::LibRapidType::Scalar) {
 				return Storage1 {};
 			} else if constexpr (typetraits::TypeInfo<Storage1>::type ==
 								 detail::LibRapidType::Scalar) {
 				return Storage0 {};
-			} else if constexpr (packetWidth0 > 1 && packetWidth1 > 1) {
+			} else if constexpr (useSimdVectorStorage<Scalar0>() &&
+								 useSimdVectorStorage<Scalar1>()) {
 				return SimdVectorStorage<typename Storage0::Scalar, Storage0::dims> {};
 			} else {
 				return GenericVectorStorage<typename Storage0::Scalar, Storage0::dims> {};
@@ -77,6 +77,28 @@ namespace librapid::ml {
 			return forward(src);
 		}
 
+		/// Applies the Sigmoid activation function to a single scalar value. This allows the
+		/// activation to be fused into other operations, such as a GEMM epilogue.
+		///
+		/// @tparam T The scalar type.
+		/// @param val The input value.
+		/// @return The result of applying the Sigmoid activation function to the input value.
+		template<typename T>
+			requires(typetraits::TypeInfo<T>::type == detail::LibRapidType::Scalar)
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE T operator()(const T &val) const {
+			return T(1) / (T(1) + ::librapid::exp(-val));
+		}
+
+		/// Applies the Sigmoid activation function to each element of a SIMD packet.
+		///
+		/// @tparam Packet The SIMD packet type.
+		/// @param val The input packet.
+		/// @return The result of applying the Sigmoid activation function to the input packet.
+		template<typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet packet(const Packet &val) const {
+			return Packet(1) / (Packet(1) + ::librapid::exp(-val));
+		}
+
 		/// Applies the Sigmoid activation function to the input array and stores the result in the
 		/// output array.
 		///
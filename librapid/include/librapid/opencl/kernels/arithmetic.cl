@@ -41,6 +41,22 @@ ARITHMETIC_OP_IMPL(greaterThanEqual, >=)
 ARITHMETIC_OP_IMPL(elementWiseEqual, ==)
 ARITHMETIC_OP_IMPL(elementWiseNotEqual, !=)
 
+#define INTEGER_ARITHMETIC_OP_IMPL(NAME, OP)                                                       \
+    ARITHMETIC_KERNEL(NAME, OP, int8_t)                                                            \
+    ARITHMETIC_KERNEL(NAME, OP, int16_t)                                                           \
+    ARITHMETIC_KERNEL(NAME, OP, int32_t)                                                           \
+    ARITHMETIC_KERNEL(NAME, OP, int64_t)                                                           \
+    ARITHMETIC_KERNEL(NAME, OP, uint8_t)                                                           \
+    ARITHMETIC_KERNEL(NAME, OP, uint16_t)                                                          \
+    ARITHMETIC_KERNEL(NAME, OP, uint32_t)                                                          \
+    ARITHMETIC_KERNEL(NAME, OP, uint64_t)
+
+INTEGER_ARITHMETIC_OP_IMPL(bitwiseAnd, &)
+INTEGER_ARITHMETIC_OP_IMPL(bitwiseOr, |)
+INTEGER_ARITHMETIC_OP_IMPL(bitwiseXor, ^)
+INTEGER_ARITHMETIC_OP_IMPL(leftShift, <<)
+INTEGER_ARITHMETIC_OP_IMPL(rightShift, >>)
+
 #define DUAL_ARITHMETIC_OP(DTYPE)                                                                  \
     __kernel void addArrays_Dual_##DTYPE(__global struct Dual_##DTYPE *dst,                        \
                                          __global const struct Dual_##DTYPE *lhs,                  \
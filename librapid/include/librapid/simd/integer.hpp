@@ -0,0 +1,93 @@
+#ifndef LIBRAPID_SIMD_INTEGER
+#define LIBRAPID_SIMD_INTEGER
+
+/*
+ * Integer packet operations which xsimd does not map onto a single instruction on every ISA.
+ *
+ * Only AVX-512DQ has a 64-bit integer multiply (vpmullq). Elsewhere, xsimd splits the packet into
+ * 128-bit halves, or falls back to scalar code. Here, the low 64 bits of each product are built
+ * from three 32 x 32 -> 64-bit multiplies (pmuludq) at the full packet width instead:
+ *
+ *     a * b mod 2^64 = lo(a) * lo(b) + ((hi(a) * lo(b) + lo(a) * hi(b)) << 32)
+ *
+ * The low 64 bits of a product are the same for signed and unsigned values, so this is used for
+ * both int64_t and uint64_t.
+ */
+
+#if LIBRAPID_ARCH >= ARCH_SSE2
+#	include <immintrin.h>
+#endif
+
+namespace librapid {
+	namespace detail {
+		/// \brief Multiply packets of 64-bit integers, keeping the low 64 bits of each product
+		/// \tparam Packet ``xsimd::batch<int64_t>`` or ``xsimd::batch<uint64_t>``
+		/// \param lhs The first packet
+		/// \param rhs The second packet
+		/// \return The element-wise product, modulo \f$ 2^{64} \f$
+		template<typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE Packet multiplyInt64(const Packet &lhs,
+																		const Packet &rhs) {
+#if LIBRAPID_ARCH >= ARCH_AVX512_2
+			if constexpr (Packet::size == 8) { return _mm512_mullo_epi64(lhs, rhs); }
+#elif LIBRAPID_ARCH >= ARCH_AVX512
+			if constexpr (Packet::size == 8) {
+				const __m512i a		= lhs;
+				const __m512i b		= rhs;
+				const __m512i aHigh	= _mm512_srli_epi64(a, 32);
+				const __m512i bHigh	= _mm512_srli_epi64(b, 32);
+				const __m512i low	= _mm512_mul_epu32(a, b);
+				const __m512i cross =
+				  _mm512_add_epi64(_mm512_mul_epu32(aHigh, b), _mm512_mul_epu32(a, bHigh));
+				return _mm512_add_epi64(low, _mm512_slli_epi64(cross, 32));
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_AVX2
+			if constexpr (Packet::size == 4) {
+				const __m256i a		= lhs;
+				const __m256i b		= rhs;
+				const __m256i aHigh	= _mm256_srli_epi64(a, 32);
+				const __m256i bHigh	= _mm256_srli_epi64(b, 32);
+				const __m256i low	= _mm256_mul_epu32(a, b);
+				const __m256i cross =
+				  _mm256_add_epi64(_mm256_mul_epu32(aHigh, b), _mm256_mul_epu32(a, bHigh));
+				return _mm256_add_epi64(low, _mm256_slli_epi64(cross, 32));
+			}
+#endif
+#if LIBRAPID_ARCH >= ARCH_SSE2
+			if constexpr (Packet::size == 2) {
+				const __m128i a		= lhs;
+				const __m128i b		= rhs;
+				const __m128i aHigh	= _mm_srli_epi64(a, 32);
+				const __m128i bHigh	= _mm_srli_epi64(b, 32);
+				const __m128i low	= _mm_mul_epu32(a, b);
+				const __m128i cross =
+				  _mm_add_epi64(_mm_mul_epu32(aHigh, b), _mm_mul_epu32(a, bHigh));
+				return _mm_add_epi64(low, _mm_slli_epi64(cross, 32));
+			}
+#endif
+			return lhs * rhs;
+		}
+
+		/// \brief Multiply two packets element-wise
+		///
+		/// Packets of 64-bit integers use ``multiplyInt64``. All other packets use their own
+		/// ``operator*``.
+		/// \tparam Packet The packet type
+		/// \param lhs The first packet
+		/// \param rhs The second packet
+		/// \return The element-wise product
+		template<typename Packet>
+		LIBRAPID_NODISCARD LIBRAPID_ALWAYS_INLINE auto multiplyPacket(const Packet &lhs,
+																	  const Packet &rhs) {
+			if constexpr (std::is_same_v<Packet, xsimd::batch<int64_t>> ||
+						  std::is_same_v<Packet, xsimd::batch<uint64_t>>) {
+				return multiplyInt64(lhs, rhs);
+			} else {
+				return lhs * rhs;
+			}
+		}
+	} // namespace detail
+} // namespace librapid
+
+#endif // LIBRAPID_SIMD_INTEGER
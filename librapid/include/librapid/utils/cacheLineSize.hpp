@@ -6,6 +6,13 @@ namespace librapid {
     /// determined, the return value is 64.
     /// \return Cache line size in bytes
     size_t cacheLineSize();
+
+    /// Returns the size of the data (or unified) cache at the specified level, in bytes. If the
+    /// size cannot be determined, a conservative default is returned (32KiB for L1, 256KiB for L2
+    /// and 8MiB for L3).
+    /// \param level Cache level (1, 2 or 3)
+    /// \return Cache size in bytes
+    size_t cacheSize(size_t level);
 } // namespace librapid
 
 #endif // LIBRAPID_UTILS_CACHE_LINE_SIZE_HPP
\ No newline at end of file
@@ -12,6 +12,16 @@
 
 #include <librapid/librapid.hpp>
 
+namespace librapid::detail {
+    size_t defaultCacheSize(size_t level) {
+        switch (level) {
+            case 1: return 32 * 1024;
+            case 2: return 256 * 1024;
+            default: return 8 * 1024 * 1024;
+        }
+    }
+} // namespace librapid::detail
+
 #if defined(LIBRAPID_APPLE)
 
 #    include <sys/sysctl.h>
@@ -23,6 +33,18 @@ namespace librapid {
         sysctlbyname("hw.cachelinesize", &lineSize, &sizeOfLineSize, 0, 0);
         return lineSize;
     }
+
+    size_t cacheSize(size_t level) {
+        const char *name = level == 1 ? "hw.l1dcachesize"
+                         : level == 2 ? "hw.l2cachesize"
+                                      : "hw.l3cachesize";
+        uint64_t size     = 0;
+        size_t sizeOfSize = sizeof(size);
+        if (sysctlbyname(name, &size, &sizeOfSize, 0, 0) != 0 || size == 0) {
+            return detail::defaultCacheSize(level);
+        }
+        return static_cast<size_t>(size);
+    }
 } // namespace librapid
 
 #elif defined(LIBRAPID_WINDOWS) && !defined(LIBRAPID_NO_WINDOWS_H)
@@ -48,6 +70,27 @@ namespace librapid {
         free(buffer);
         return lineSize;
     }
+
+    size_t cacheSize(size_t level) {
+        size_t size                                  = 0;
+        DWORD bufferSize                             = 0;
+        SYSTEM_LOGICAL_PROCESSOR_INFORMATION *buffer = 0;
+
+        GetLogicalProcessorInformation(0, &bufferSize);
+        buffer = (SYSTEM_LOGICAL_PROCESSOR_INFORMATION *)malloc(bufferSize);
+        GetLogicalProcessorInformation(&buffer[0], &bufferSize);
+
+        for (DWORD i = 0; i != bufferSize / sizeof(SYSTEM_LOGICAL_PROCESSOR_INFORMATION); ++i) {
+            if (buffer[i].Relationship == RelationCache && buffer[i].Cache.Level == level &&
+                buffer[i].Cache.Type != CacheInstruction) {
+                size = buffer[i].Cache.Size;
+                break;
+            }
+        }
+
+        free(buffer);
+        return size == 0 ? detail::defaultCacheSize(level) : size;
+    }
 } // namespace librapid
 
 #elif defined(LIBRAPID_LINUX)
@@ -63,6 +106,46 @@ namespace librapid {
         }
         return lineSize;
     }
+
+    size_t cacheSize(size_t level) {
+        // Each cache is described by /sys/devices/system/cpu/cpu0/cache/indexN/{level,type,size}.
+        // Instruction caches are skipped, since we only care about data and unified caches.
+        for (int index = 0; index < 8; ++index) {
+            std::string base =
+              fmt::format("/sys/devices/system/cpu/cpu0/cache/index{}/", index);
+
+            FILE *p = fopen((base + "level").c_str(), "r");
+            if (!p) break;
+            unsigned int cacheLevel = 0;
+            fscanf(p, "%u", &cacheLevel);
+            fclose(p);
+            if (cacheLevel != level) continue;
+
+            char type[32] = {0};
+            p             = fopen((base + "type").c_str(), "r");
+            if (p) {
+                fscanf(p, "%31s", type);
+                fclose(p);
+            }
+            if (strcmp(type, "Instruction") == 0) continue;
+
+            unsigned int size = 0;
+            char unit         = 'K';
+            p                 = fopen((base + "size").c_str(), "r");
+            if (p) {
+                fscanf(p, "%u%c", &size, &unit);
+                fclose(p);
+            }
+            if (size == 0) break;
+
+            switch (unit) {
+                case 'K': return static_cast<size_t>(size) * 1024;
+                case 'M': return static_cast<size_t>(size) * 1024 * 1024;
+                default: return static_cast<size_t>(size);
+            }
+        }
+        return detail::defaultCacheSize(level);
+    }
 } // namespace librapid
 
 #else
@@ -72,6 +155,8 @@ namespace librapid {
         // On unknown platforms, return 64
         return 64;
     }
+
+    size_t cacheSize(size_t level) { return detail::defaultCacheSize(level); }
 } // namespace librapid
 
 #endif
\ No newline at end of file
@@ -10,8 +10,12 @@ namespace librapid {
         size_t gemvMultithreadThreshold = 100;
         size_t numThreads               = 8;
         size_t randomSeed               = 0; // Set in PreMain
-        bool reseed                     = false;
+        std::atomic<bool> reseed        = false;
         size_t cacheLineSize            = 64;
+        size_t l1CacheSize              = 32 * 1024;
+        size_t l2CacheSize              = 256 * 1024;
+        size_t l3CacheSize              = 8 * 1024 * 1024;
+        size_t mmapBlockSize            = 16 * 1024 * 1024;
 
 #if defined(LIBRAPID_HAS_OPENCL)
         std::vector<cl::Device> openclDevices;
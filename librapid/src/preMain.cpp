@@ -12,6 +12,9 @@ namespace librapid::detail {
 
             preMainRun            = true;
             global::cacheLineSize = cacheLineSize();
+            global::l1CacheSize   = cacheSize(1);
+            global::l2CacheSize   = cacheSize(2);
+            global::l3CacheSize   = cacheSize(3);
 
             // OpenCL compatible devices are detected after this function is called,
             // meaning nothing is found here. The user must call configureOpenCL()
@@ -0,0 +1,91 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+
+TEST_CASE("Test Size Classes", "[storage]") {
+	using Pool = lrc::memory::PoolAllocator;
+	for (size_t bytes = 1; bytes < 100000; bytes += 37) {
+		const size_t index = Pool::sizeClass(bytes);
+		REQUIRE(Pool::classBytes(index) >= bytes);
+		if (index > 0) { REQUIRE(Pool::classBytes(index - 1) < bytes); }
+	}
+
+	for (size_t index = 0; index < Pool::numClasses; ++index) {
+		REQUIRE(Pool::sizeClass(Pool::classBytes(index)) == index);
+	}
+}
+
+TEST_CASE("Test Pooled Allocation", "[storage]") {
+	lrc::memory::trim();
+	const auto before = lrc::memory::statistics();
+
+	{
+		lrc::Storage<double> first(1000);
+		first[999] = 1;
+	}
+
+	// A temporary of the same size reuses the block freed above
+	{ lrc::Storage<double> second(1000); }
+
+	const auto after = lrc::memory::statistics();
+	REQUIRE(after.allocations - before.allocations == 2);
+	REQUIRE(after.deallocations - before.deallocations == 2);
+	REQUIRE(after.cacheHits - before.cacheHits == 1);
+	REQUIRE(after.bytesInUse == before.bytesInUse);
+	REQUIRE(after.bytesCached > 0);
+
+	lrc::memory::trim();
+	REQUIRE(lrc::memory::statistics().bytesCached == 0);
+}
+
+TEST_CASE("Test Allocation Sizes", "[storage]") {
+	lrc::memory::trim();
+	const size_t before = lrc::memory::statistics().bytesInUse;
+
+	// A power of two fills its size class exactly
+	{
+		lrc::Storage<double> storage(1024);
+		REQUIRE(lrc::memory::statistics().bytesInUse - before == 1024 * sizeof(double));
+	}
+
+	// Blocks above the size limit are not rounded up to a size class. They are recognised when
+	// they are freed, even if the limit has changed since they were allocated
+	lrc::memory::SystemAllocator system;
+	lrc::memory::PoolAllocator pool(system, {4096, size_t(1) << 20, size_t(1) << 20});
+	void *large = pool.allocate(4160, 64);
+	REQUIRE(pool.statistics().bytesInUse == 4160);
+	REQUIRE(system.statistics().bytesInUse == 4160);
+
+	pool.setLimits({size_t(1) << 16, size_t(1) << 20, size_t(1) << 20});
+	pool.deallocate(large, 4160, 64);
+	REQUIRE(pool.statistics().bytesCached == 0);
+	REQUIRE(system.statistics().bytesInUse == 0);
+
+	// Raising the limit makes blocks of the same size cacheable again
+	void *pooled = pool.allocate(4160, 64);
+	REQUIRE(pool.statistics().bytesInUse == 5120);
+	pool.deallocate(pooled, 4160, 64);
+	REQUIRE(pool.statistics().bytesCached == 5120);
+}
+
+TEST_CASE("Test Custom Allocator", "[storage]") {
+	lrc::memory::SystemAllocator system;
+
+	lrc::Storage<float> pooled(100, 1);
+	lrc::memory::setAllocator(&system);
+	{
+		lrc::Storage<float> direct(100, 2);
+		REQUIRE(system.statistics().allocations == 1);
+		REQUIRE(direct[99] == 2);
+	}
+	lrc::memory::setAllocator(nullptr);
+
+	// Blocks are returned to the allocator they came from, whatever the current allocator is
+	REQUIRE(system.statistics().deallocations == 1);
+	REQUIRE(system.statistics().bytesInUse == 0);
+	REQUIRE(&lrc::memory::getAllocator() == &lrc::memory::defaultAllocator());
+	REQUIRE(pooled[99] == 1);
+}
@@ -3,6 +3,8 @@
 #include <catch2/generators/catch_generators.hpp>
 #include <catch2/benchmark/catch_benchmark.hpp>
 
+#include "threadingGuard.hpp"
+
 namespace lrc			   = librapid;
 constexpr double tolerance = 0.001;
 using CPU				   = lrc::backend::CPU;
@@ -203,6 +205,112 @@ using CUDA				   = lrc::backend::CUDA;
 	do {                                                                                           \
 	} while (false)
 
+#define TEST_ARITHMETIC_BROADCAST(SCALAR)                                                          \
+	SECTION(fmt::format("Test Array Broadcasting [{} | CPU]", STRINGIFY(SCALAR))) {                \
+		/* Rows of 41 and 3 columns leave a scalar tail after the packets of each row. 401 rows */ \
+		/* are enough to take the parallel path */                                                 \
+		ThreadingGuard threading(4);                                                               \
+		for (auto [rows, cols] : {std::pair<int64_t, int64_t> {37, 41},                            \
+								  std::pair<int64_t, int64_t> {37, 16},                            \
+								  std::pair<int64_t, int64_t> {37, 3},                             \
+								  std::pair<int64_t, int64_t> {401, 41}}) {                        \
+			lrc::Array<SCALAR, CPU> matrix(lrc::Shape({rows, cols}));                              \
+			lrc::Array<SCALAR, CPU> row(lrc::Shape({cols}));                                       \
+			lrc::Array<SCALAR, CPU> col(lrc::Shape({rows, int64_t(1)}));                           \
+                                                                                                   \
+			for (int64_t i = 0; i < rows * cols; ++i) {                                            \
+				matrix.storage()[i] = SCALAR(i % 17 + 1);                                          \
+			}                                                                                      \
+			for (int64_t j = 0; j < cols; ++j) { row.storage()[j] = SCALAR(j % 5 + 1); }           \
+			for (int64_t i = 0; i < rows; ++i) { col.storage()[i] = SCALAR(i % 7 + 1); }           \
+                                                                                                   \
+			auto rowSum	 = (matrix + row).eval();                                                  \
+			auto colProd = (col * matrix).eval();                                                  \
+			auto outer	 = (col + row).eval();                                                     \
+			auto nested	 = ((matrix - row) * col).eval();                                          \
+                                                                                                   \
+			REQUIRE(rowSum.shape() == lrc::Shape({rows, cols}));                                   \
+			REQUIRE(colProd.shape() == lrc::Shape({rows, cols}));                                  \
+			REQUIRE(outer.shape() == lrc::Shape({rows, cols}));                                    \
+			REQUIRE(nested.shape() == lrc::Shape({rows, cols}));                                   \
+                                                                                                   \
+			bool valid = true;                                                                     \
+			for (int64_t i = 0; i < rows; ++i) {                                                   \
+				for (int64_t j = 0; j < cols; ++j) {                                               \
+					const int64_t index = i * cols + j;                                            \
+					const SCALAR m		= matrix.storage()[index];                                 \
+					const SCALAR r		= row.storage()[j];                                        \
+					const SCALAR c		= col.storage()[i];                                        \
+                                                                                                   \
+					valid = valid && rowSum.scalar(index) == m + r;                                \
+					valid = valid && colProd.scalar(index) == c * m;                               \
+					valid = valid && outer.scalar(index) == c + r;                                 \
+					valid = valid && nested.scalar(index) == (m - r) * c;                          \
+				}                                                                                  \
+			}                                                                                      \
+			REQUIRE(valid);                                                                        \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+#define TEST_BITWISE(SCALAR)                                                                       \
+	SECTION(fmt::format("Test Array Bitwise Operations [{} | CPU]", STRINGIFY(SCALAR))) {          \
+		/* Full-width values, so every partial product of a 64-bit multiply is exercised */        \
+		const int64_t n = 37 * 41;                                                                 \
+		lrc::Array<SCALAR, CPU> a(lrc::Shape({37, 41}));                                           \
+		lrc::Array<SCALAR, CPU> b(lrc::Shape({37, 41}));                                           \
+		uint64_t state = 0x9e3779b97f4a7c15ull;                                                    \
+		for (int64_t i = 0; i < n; ++i) {                                                          \
+			state		   = state * 6364136223846793005ull + 1442695040888963407ull;              \
+			a.storage()[i] = static_cast<SCALAR>(state);                                           \
+			b.storage()[i] = static_cast<SCALAR>(state >> 17);                                     \
+		}                                                                                          \
+                                                                                                   \
+		const int shift	 = 13;                                                                     \
+		auto product	 = (a * b).eval();                                                         \
+		auto andResult	 = (a & b).eval();                                                         \
+		auto orResult	 = (a | b).eval();                                                         \
+		auto xorResult	 = (a ^ b).eval();                                                         \
+		auto rightResult = (a >> shift).eval();                                                    \
+		auto leftResult	 = lrc::leftShift(a, shift).eval();                                        \
+                                                                                                   \
+		/* The compound operators, chained like the mixing step of a hash function */              \
+		auto hashed = a.copy();                                                                    \
+		hashed ^= hashed >> shift;                                                                 \
+		hashed *= b;                                                                               \
+		hashed <<= 3;                                                                              \
+		hashed |= b;                                                                               \
+		hashed &= a;                                                                               \
+                                                                                                   \
+		auto multiply = [](SCALAR x, SCALAR y) {                                                   \
+			return static_cast<SCALAR>(static_cast<uint64_t>(x) * static_cast<uint64_t>(y));       \
+		};                                                                                         \
+                                                                                                   \
+		bool valid = true;                                                                         \
+		for (int64_t i = 0; i < n; ++i) {                                                          \
+			const SCALAR x = a.storage()[i];                                                       \
+			const SCALAR y = b.storage()[i];                                                       \
+                                                                                                   \
+			SCALAR h = x;                                                                          \
+			h		 = static_cast<SCALAR>(h ^ (h >> shift));                                      \
+			h		 = multiply(h, y);                                                             \
+			h		 = static_cast<SCALAR>(h << 3);                                                \
+			h		 = static_cast<SCALAR>((h | y) & x);                                           \
+                                                                                                   \
+			valid = valid && product.scalar(i) == multiply(x, y);                                  \
+			valid = valid && andResult.scalar(i) == static_cast<SCALAR>(x & y);                    \
+			valid = valid && orResult.scalar(i) == static_cast<SCALAR>(x | y);                     \
+			valid = valid && xorResult.scalar(i) == static_cast<SCALAR>(x ^ y);                    \
+			valid = valid && rightResult.scalar(i) == static_cast<SCALAR>(x >> shift);             \
+			valid = valid && leftResult.scalar(i) == static_cast<SCALAR>(x << shift);              \
+			valid = valid && hashed.scalar(i) == h;                                                \
+		}                                                                                          \
+		REQUIRE(valid);                                                                            \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
 #define TEST_ALL(SCALAR, BACKEND)                                                                  \
 	TEST_ARITHMETIC(SCALAR, BACKEND);                                                              \
 	TEST_ARITHMETIC_ARRAY_SCALAR(SCALAR, BACKEND);                                                 \
@@ -215,6 +323,21 @@ TEST_CASE("Test Array -- uint64_t CPU", "[array-lib]") { TEST_ALL(uint64_t, CPU)
 TEST_CASE("Test Array -- float CPU", "[array-lib]") { TEST_ALL(float, CPU); }
 TEST_CASE("Test Array -- double CPU", "[array-lib]") { TEST_ALL(double, CPU); }
 
+TEST_CASE("Test Array Broadcasting -- int32_t CPU", "[array-lib]") {
+	TEST_ARITHMETIC_BROADCAST(int32_t);
+}
+TEST_CASE("Test Array Broadcasting -- float CPU", "[array-lib]") {
+	TEST_ARITHMETIC_BROADCAST(float);
+}
+TEST_CASE("Test Array Broadcasting -- double CPU", "[array-lib]") {
+	TEST_ARITHMETIC_BROADCAST(double);
+}
+
+TEST_CASE("Test Array Bitwise -- int32_t CPU", "[array-lib]") { TEST_BITWISE(int32_t); }
+TEST_CASE("Test Array Bitwise -- uint32_t CPU", "[array-lib]") { TEST_BITWISE(uint32_t); }
+TEST_CASE("Test Array Bitwise -- int64_t CPU", "[array-lib]") { TEST_BITWISE(int64_t); }
+TEST_CASE("Test Array Bitwise -- uint64_t CPU", "[array-lib]") { TEST_BITWISE(uint64_t); }
+
 #if defined(LIBRAPID_USE_MULTIPREC)
 TEST_CASE("Test Array -- lrc::mpfr CPU", "[array-lib]") { TEST_ALL(lrc::mpfr, CPU); }
 #endif // LIBRAPID_USE_MULTIPREC
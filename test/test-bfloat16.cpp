@@ -0,0 +1,172 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+using lrc::bfloat16;
+
+float bitsToFloat(uint32_t bits) {
+    float result;
+    std::memcpy(&result, &bits, sizeof(float));
+    return result;
+}
+
+TEST_CASE("Test bfloat16 -- Conversion", "[math]") {
+    REQUIRE(bfloat16(1.0f).bits() == 0x3f80);
+    REQUIRE(bfloat16(-2.0f).bits() == 0xc000);
+    REQUIRE(static_cast<float>(bfloat16(3.140625f)) == 3.140625f);
+
+    // Ties round to even
+    REQUIRE(bfloat16(bitsToFloat(0x3f808000)).bits() == 0x3f80);
+    REQUIRE(bfloat16(bitsToFloat(0x3f818000)).bits() == 0x3f82);
+    REQUIRE(bfloat16(bitsToFloat(0x3f808001)).bits() == 0x3f81);
+
+    // Same range as float, so large values do not overflow...
+    REQUIRE(static_cast<float>(bfloat16(1e38f)) > 9.9e37f);
+    // ...unless they round up past the largest finite value
+    REQUIRE(bfloat16(std::numeric_limits<float>::max()).bits() == 0x7f80);
+
+    // NaNs stay NaN, even when the payload is only in the low bits
+    REQUIRE(std::isnan(static_cast<float>(bfloat16(bitsToFloat(0x7f800001)))));
+    REQUIRE(std::isnan(static_cast<float>(lrc::typetraits::TypeInfo<bfloat16>::nan())));
+
+    REQUIRE(static_cast<float>(lrc::typetraits::TypeInfo<bfloat16>::max()) ==
+            bitsToFloat(0x7f7f0000));
+    REQUIRE(static_cast<float>(lrc::typetraits::TypeInfo<bfloat16>::epsilon()) == 0.0078125f);
+
+    REQUIRE(bfloat16(0.0f) == bfloat16(-0.0f));
+    REQUIRE(bfloat16(1.0f) < bfloat16(1.5f));
+    REQUIRE(bfloat16(2.0f) * bfloat16(3.0f) == bfloat16(6.0f));
+}
+
+TEST_CASE("Test bfloat16 -- Array Arithmetic", "[array-lib]") {
+    // Prime-dimensioned to force a scalar tail
+    lrc::Array<bfloat16> a(lrc::Shape({37, 41}));
+    lrc::Array<bfloat16> b(lrc::Shape({37, 41}));
+    const int64_t size = 37 * 41;
+    for (int64_t i = 0; i < size; ++i) {
+        a.storage()[i] = bfloat16(static_cast<float>(i % 97) * 1.37f - 40.0f);
+        b.storage()[i] = bfloat16(static_cast<float>(i % 89) * 0.73f + 0.5f);
+    }
+
+    auto sum  = (a + b).eval();
+    auto diff = (a - b).eval();
+    auto prod = (a * b).eval();
+    auto quot = (a / b).eval();
+    auto neg  = (-a).eval();
+    auto fma  = (a * b + a).eval();
+    auto less = (a < b).eval();
+
+    for (int64_t i = 0; i < size; ++i) {
+        const bfloat16 x = a.storage()[i];
+        const bfloat16 y = b.storage()[i];
+        REQUIRE(sum.storage()[i].bits() == (x + y).bits());
+        REQUIRE(diff.storage()[i].bits() == (x - y).bits());
+        REQUIRE(prod.storage()[i].bits() == (x * y).bits());
+        REQUIRE(quot.storage()[i].bits() == (x / y).bits());
+        REQUIRE(neg.storage()[i].bits() == (-x).bits());
+        REQUIRE(fma.storage()[i].bits() == (x * y + x).bits());
+        REQUIRE(less.storage()[i] == bfloat16(x < y ? 1.0f : 0.0f));
+    }
+
+    // Subnormal results must not be flushed to zero
+    lrc::Array<bfloat16> tiny(lrc::Shape({37, 41}));
+    for (int64_t i = 0; i < size; ++i) {
+        tiny.storage()[i] = bfloat16::fromBits(static_cast<uint16_t>(i % 127 + 1));
+    }
+
+    auto tinySum  = (tiny + tiny).eval();
+    auto tinyProd = (tiny * b).eval();
+
+    for (int64_t i = 0; i < size; ++i) {
+        const bfloat16 x = tiny.storage()[i];
+        const bfloat16 y = b.storage()[i];
+        REQUIRE(tinySum.storage()[i].bits() == (x + x).bits());
+        REQUIRE(tinySum.storage()[i].bits() != 0);
+        REQUIRE(tinyProd.storage()[i].bits() == (x * y).bits());
+    }
+}
+
+TEST_CASE("Test bfloat16 -- Dot Product", "[array-lib]") {
+    auto n       = GENERATE(1, 7, 100, 20001);
+    auto threads = GENERATE(1, 4);
+
+    std::vector<bfloat16> x(n), y(n);
+    double expected = 0, magnitude = 0;
+    for (int64_t i = 0; i < n; ++i) {
+        x[i] = bfloat16(static_cast<float>((i * i + 3 * i) % 101) / 50.0f - 1.0f);
+        y[i] = bfloat16(static_cast<float>((i * 7 + 1) % 13) / 6.0f - 1.0f);
+
+        const double product = static_cast<double>(static_cast<float>(x[i])) *
+                               static_cast<double>(static_cast<float>(y[i]));
+        expected += product;
+        magnitude += std::abs(product);
+    }
+
+    ThreadingGuard threading(threads);
+    const bfloat16 result =
+      lrc::linalg::dot(int64_t(n), x.data(), int64_t(1), y.data(), int64_t(1));
+
+    // Accumulating in bfloat16 would lose every product once the sum reached a few hundred. In
+    // single precision, the only significant error is the final rounding
+    REQUIRE(std::abs(static_cast<double>(static_cast<float>(result)) - expected) <=
+            std::abs(expected) / 128 + magnitude * 1e-6);
+}
+
+TEST_CASE("Test bfloat16 -- GEMM", "[array-lib]") {
+    auto transA  = GENERATE(false, true);
+    auto transB  = GENERATE(false, true);
+    auto dims    = GENERATE(std::array<int64_t, 3> {1, 1, 1},
+                         std::array<int64_t, 3> {7, 13, 5},
+                         std::array<int64_t, 3> {130, 257, 301});
+    auto threads = GENERATE(1, 4);
+
+    int64_t m = dims[0], n = dims[1], k = dims[2];
+    int64_t lda = transA ? m : k;
+    int64_t ldb = transB ? k : n;
+
+    std::vector<bfloat16> a(m * k), b(k * n), c(m * n);
+    for (int64_t i = 0; i < m * k; ++i) a[i] = bfloat16(static_cast<float>((i * 7) % 11) - 5.5f);
+    for (int64_t i = 0; i < k * n; ++i) b[i] = bfloat16(static_cast<float>((i * 3) % 7) - 3.25f);
+    for (int64_t i = 0; i < m * n; ++i) c[i] = bfloat16(static_cast<float>(i % 5));
+
+    std::vector<double> expected(m * n), magnitude(m * n);
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            double sum = 0, absSum = 0;
+            for (int64_t p = 0; p < k; ++p) {
+                const double aVal = static_cast<float>(transA ? a[p * lda + i] : a[i * lda + p]);
+                const double bVal = static_cast<float>(transB ? b[j * ldb + p] : b[p * ldb + j]);
+                sum += aVal * bVal;
+                absSum += std::abs(aVal * bVal);
+            }
+            const double cVal    = static_cast<float>(c[i * n + j]);
+            expected[i * n + j]  = 1.5 * sum - 0.5 * cVal;
+            magnitude[i * n + j] = 1.5 * absSum + 0.5 * std::abs(cVal);
+        }
+    }
+
+    ThreadingGuard threading(threads);
+    lrc::linalg::gemm(transA,
+                      transB,
+                      m,
+                      n,
+                      k,
+                      1.5f,
+                      a.data(),
+                      lda,
+                      b.data(),
+                      ldb,
+                      -0.5f,
+                      c.data(),
+                      n);
+
+    for (int64_t i = 0; i < m * n; ++i) {
+        const double result = static_cast<float>(c[i]);
+        REQUIRE(std::abs(result - expected[i]) <=
+                std::abs(expected[i]) / 128 + magnitude[i] * 1e-6);
+    }
+}
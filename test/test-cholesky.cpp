@@ -0,0 +1,106 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define CHOLESKY_TEST_IMPL(SCALAR, TOLERANCE)                                                      \
+    TEST_CASE(fmt::format("Test Cholesky -- {}", STRINGIFY(SCALAR)), "[array-lib]") {              \
+        auto n       = GENERATE(int64_t(1), int64_t(8), int64_t(64), int64_t(150));                \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        /* A = M M^T + n I is symmetric positive definite */                                       \
+        lrc::Array<SCALAR> a(lrc::Shape({n, n}));                                                  \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                SCALAR sum = i == j ? SCALAR(n) : SCALAR(0);                                       \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += (SCALAR((i * 7 + k * 3) % 11) / SCALAR(10) - SCALAR(0.5)) *             \
+                           (SCALAR((j * 7 + k * 3) % 11) / SCALAR(10) - SCALAR(0.5));              \
+                }                                                                                  \
+                a.storage()[i * n + j] = sum;                                                      \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        const int64_t nrhs = 3;                                                                    \
+        lrc::Array<SCALAR> b(lrc::Shape({n, nrhs}));                                               \
+        for (int64_t i = 0; i < n * nrhs; ++i) b.storage()[i] = SCALAR(i % 5) - 2;                 \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto l = lrc::cholesky(a);                                                                 \
+        auto x = lrc::choleskySolve(l, b);                                                         \
+                                                                                                   \
+        REQUIRE(l.shape() == a.shape());                                                           \
+        REQUIRE(x.shape() == b.shape());                                                           \
+                                                                                                   \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                if (j > i) REQUIRE(l.storage()[i * n + j] == SCALAR(0));                           \
+                                                                                                   \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += l.storage()[i * n + k] * l.storage()[j * n + k];                        \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, a.storage()[i * n + j], TOLERANCE));                     \
+            }                                                                                      \
+                                                                                                   \
+            for (int64_t j = 0; j < nrhs; ++j) {                                                   \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += a.storage()[i * n + k] * x.storage()[k * nrhs + j];                     \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, b.storage()[i * nrhs + j], TOLERANCE));                  \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test Batched Cholesky -- {}", STRINGIFY(SCALAR)), "[array-lib]") {      \
+        auto n       = GENERATE(int64_t(8), int64_t(64));                                          \
+        auto batch   = GENERATE(int64_t(1), int64_t(50));                                          \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        /* Each matrix is diagonally dominant with a different diagonal */                         \
+        lrc::Array<SCALAR> a(lrc::Shape({batch, n, n}));                                           \
+        lrc::Array<SCALAR> v(lrc::Shape({batch, n}));                                              \
+        for (int64_t p = 0; p < batch; ++p) {                                                      \
+            for (int64_t i = 0; i < n; ++i) {                                                      \
+                for (int64_t j = 0; j < n; ++j) {                                                  \
+                    SCALAR offDiag = SCALAR((i + j + p) % 5) / SCALAR(10);                         \
+                    a.storage()[(p * n + i) * n + j] = i == j ? SCALAR(n + p) : offDiag;           \
+                }                                                                                  \
+                v.storage()[p * n + i] = SCALAR((i + p) % 3) + 1;                                  \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto l = lrc::cholesky(a);                                                                 \
+        auto y = lrc::choleskySolve(l, v);                                                         \
+                                                                                                   \
+        REQUIRE(l.shape() == a.shape());                                                           \
+        REQUIRE(y.shape() == v.shape());                                                           \
+                                                                                                   \
+        for (int64_t p = 0; p < batch; ++p) {                                                      \
+            const int64_t offset = p * n * n;                                                      \
+            for (int64_t i = 0; i < n; ++i) {                                                      \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += a.storage()[offset + i * n + k] * y.storage()[p * n + k];               \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, v.storage()[p * n + i], TOLERANCE));                     \
+                                                                                                   \
+                for (int64_t j = 0; j <= i; ++j) {                                                 \
+                    SCALAR prod = 0;                                                               \
+                    for (int64_t k = 0; k <= j; ++k) {                                             \
+                        prod += l.storage()[offset + i * n + k] * l.storage()[offset + j * n + k]; \
+                    }                                                                              \
+                    REQUIRE(lrc::isClose(prod, a.storage()[offset + i * n + j], TOLERANCE));       \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+CHOLESKY_TEST_IMPL(float, 1e-3)
+CHOLESKY_TEST_IMPL(double, 1e-8)
@@ -334,6 +334,82 @@ static double tolerance = 1e-5;
 TEST_COMPLEX(float)
 TEST_COMPLEX(double)
 
+#define COMPLEX_ARRAY_FUNCTION(NAME, EXPECTED)                                                     \
+    {                                                                                              \
+        auto result = lrc::NAME(a).eval();                                                         \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            const Complex x = a.storage()[i];                                                      \
+            REQUIRE(same(result.storage()[i], EXPECTED));                                          \
+        }                                                                                          \
+    }
+
+#define TEST_COMPLEX_ARRAY(SCALAR)                                                                 \
+    TEST_CASE(fmt::format("Test Complex Array {}", STRINGIFY(SCALAR)), "[math]") {                 \
+        using Complex = lrc::Complex<SCALAR>;                                                      \
+                                                                                                   \
+        /* Not a multiple of the packet width, so some elements are evaluated one at a time */     \
+        const int64_t n = 37;                                                                      \
+        lrc::Array<Complex> a(lrc::Shape({n}));                                                    \
+        lrc::Array<Complex> b(lrc::Shape({n}));                                                    \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            a.storage()[i] = Complex(SCALAR(i % 7) * SCALAR(0.5) - SCALAR(1.25),                   \
+                                     SCALAR(i % 5) * SCALAR(0.75) - SCALAR(1.5));                  \
+            b.storage()[i] = Complex(SCALAR(i % 3) + SCALAR(0.5), SCALAR(i % 4) - SCALAR(1.5));    \
+        }                                                                                          \
+                                                                                                   \
+        /* Special values must give the same results as the scalar functions */                    \
+        a.storage()[2] = Complex(std::numeric_limits<SCALAR>::infinity(), SCALAR(1));              \
+        a.storage()[6] = Complex(0, 0);                                                            \
+        b.storage()[4] = Complex(0, 0);                                                            \
+                                                                                                   \
+        auto same = [](const Complex &x, const Complex &y) {                                       \
+            auto component = [](SCALAR p, SCALAR q) {                                              \
+                if (std::isnan(p) || std::isnan(q)) return std::isnan(p) && std::isnan(q);         \
+                if (std::isinf(p) || std::isinf(q)) return p == q;                                 \
+                return lrc::isClose(p, q, tolerance, tolerance);                                   \
+            };                                                                                     \
+            return component(x.real(), y.real()) && component(x.imag(), y.imag());                 \
+        };                                                                                         \
+                                                                                                   \
+        SECTION("Arithmetic") {                                                                    \
+            auto sum        = (a + b).eval();                                                      \
+            auto difference = (a - b).eval();                                                      \
+            auto product    = (a * b).eval();                                                      \
+            auto quotient   = (a / b).eval();                                                      \
+            auto negated    = (-a).eval();                                                         \
+            auto equal      = (a == b).eval();                                                     \
+            for (int64_t i = 0; i < n; ++i) {                                                      \
+                const Complex x = a.storage()[i];                                                  \
+                const Complex y = b.storage()[i];                                                  \
+                REQUIRE(same(sum.storage()[i], x + y));                                            \
+                REQUIRE(same(difference.storage()[i], x - y));                                     \
+                REQUIRE(same(product.storage()[i], x * y));                                        \
+                REQUIRE(same(quotient.storage()[i], x / y));                                       \
+                REQUIRE(same(negated.storage()[i], -x));                                           \
+                REQUIRE(same(equal.storage()[i], Complex(x == y)));                                \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        SECTION("Functions") {                                                                     \
+            COMPLEX_ARRAY_FUNCTION(abs, Complex(lrc::abs(x)));                                     \
+            COMPLEX_ARRAY_FUNCTION(exp, lrc::exp(x));                                              \
+            COMPLEX_ARRAY_FUNCTION(log, lrc::log(x));                                              \
+            COMPLEX_ARRAY_FUNCTION(log2, lrc::log2(x));                                            \
+            COMPLEX_ARRAY_FUNCTION(log10, lrc::log10(x));                                          \
+            COMPLEX_ARRAY_FUNCTION(sqrt, lrc::sqrt(x));                                            \
+            COMPLEX_ARRAY_FUNCTION(sin, lrc::sin(x));                                              \
+            COMPLEX_ARRAY_FUNCTION(cos, lrc::cos(x));                                              \
+            COMPLEX_ARRAY_FUNCTION(tan, lrc::tan(x));                                              \
+            COMPLEX_ARRAY_FUNCTION(sinh, lrc::sinh(x));                                            \
+            COMPLEX_ARRAY_FUNCTION(cosh, lrc::cosh(x));                                            \
+            COMPLEX_ARRAY_FUNCTION(floor, lrc::floor(x));                                          \
+            COMPLEX_ARRAY_FUNCTION(ceil, lrc::ceil(x));                                            \
+        }                                                                                          \
+    }
+
+TEST_COMPLEX_ARRAY(float)
+TEST_COMPLEX_ARRAY(double)
+
 #if defined(LIBRAPID_USE_MULTIPREC)
 TEST_COMPLEX(lrc::mpfr)
 #endif // LIBRAPID_USE_MULTIPREC
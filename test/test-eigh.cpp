@@ -0,0 +1,69 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define EIGH_TEST_IMPL(SCALAR, TOLERANCE)                                                          \
+    TEST_CASE(fmt::format("Test Symmetric Eigendecomposition -- {}", STRINGIFY(SCALAR)),           \
+              "[array-lib]") {                                                                     \
+        auto n       = GENERATE(int64_t(1), int64_t(4), int64_t(40), int64_t(100));                \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        lrc::Array<SCALAR> a(lrc::Shape({n, n}));                                                  \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            for (int64_t j = 0; j <= i; ++j) {                                                     \
+                const SCALAR value     = SCALAR((i * i + 3 * j) % 19) / SCALAR(4) - 2;             \
+                a.storage()[i * n + j] = value;                                                    \
+                a.storage()[j * n + i] = value;                                                    \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto [values, vectors] = lrc::eigh(a);                                                     \
+                                                                                                   \
+        REQUIRE(values.shape() == lrc::Shape({n}));                                                \
+        REQUIRE(vectors.shape() == a.shape());                                                     \
+                                                                                                   \
+        SCALAR scale = 1;                                                                          \
+        for (int64_t i = 0; i < n; ++i) scale = lrc::max(scale, lrc::abs(values.storage()[i]));    \
+                                                                                                   \
+        for (int64_t j = 0; j < n; ++j) {                                                          \
+            if (j > 0) REQUIRE(values.storage()[j - 1] <= values.storage()[j]);                    \
+                                                                                                   \
+            /* A v = lambda v */                                                                   \
+            for (int64_t i = 0; i < n; ++i) {                                                      \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += a.storage()[i * n + k] * vectors.storage()[k * n + j];                  \
+                }                                                                                  \
+                const SCALAR expected = values.storage()[j] * vectors.storage()[i * n + j];        \
+                REQUIRE(lrc::abs(sum - expected) <= TOLERANCE * scale);                            \
+            }                                                                                      \
+                                                                                                   \
+            /* The eigenvectors are orthonormal */                                                 \
+            for (int64_t i = 0; i < n; ++i) {                                                      \
+                SCALAR dot = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    dot += vectors.storage()[k * n + i] * vectors.storage()[k * n + j];            \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(dot, SCALAR(i == j), TOLERANCE));                             \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test Known Eigenvalues -- {}", STRINGIFY(SCALAR)), "[array-lib]") {     \
+        lrc::Array<SCALAR> a(lrc::Shape({3, 3}));                                                  \
+        a << 2, -1, 0, -1, 2, -1, 0, -1, 2;                                                        \
+                                                                                                   \
+        auto [values, vectors] = lrc::eigh(a);                                                     \
+        REQUIRE(lrc::isClose(values.storage()[0], SCALAR(2 - lrc::sqrt(2.0)), TOLERANCE));         \
+        REQUIRE(lrc::isClose(values.storage()[1], SCALAR(2), TOLERANCE));                          \
+        REQUIRE(lrc::isClose(values.storage()[2], SCALAR(2 + lrc::sqrt(2.0)), TOLERANCE));         \
+    }
+
+EIGH_TEST_IMPL(float, 1e-3)
+EIGH_TEST_IMPL(double, 1e-8)
@@ -0,0 +1,126 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define EINSUM_TEST_IMPL(SCALAR, TOLERANCE)                                                        \
+    TEST_CASE(fmt::format("Test einsum -- {}", STRINGIFY(SCALAR)), "[array-lib]") {                \
+        auto threads = GENERATE(1, 4);                                                             \
+        ThreadingGuard threading(threads);                                                         \
+                                                                                                   \
+        const int64_t b = 3, m = 4, k = 5, n = 6;                                                  \
+        lrc::Array<SCALAR> x(lrc::Shape({b, m, k}));                                               \
+        lrc::Array<SCALAR> y(lrc::Shape({b, k, n}));                                               \
+        lrc::Array<SCALAR> v(lrc::Shape({n}));                                                     \
+        for (int64_t i = 0; i < b * m * k; ++i) {                                                  \
+            x.storage()[i] = SCALAR((i * i + 3 * i) % 23) / SCALAR(11) - 1;                        \
+        }                                                                                          \
+        for (int64_t i = 0; i < b * k * n; ++i) {                                                  \
+            y.storage()[i] = SCALAR((i * i + 7 * i) % 29) / SCALAR(14) - 1;                        \
+        }                                                                                          \
+        for (int64_t i = 0; i < n; ++i) v.storage()[i] = SCALAR(i % 3) - 1;                        \
+                                                                                                   \
+        /* Batched matrix multiplication */                                                        \
+        auto xy = lrc::einsum("bij,bjk->bik", x, y);                                               \
+        REQUIRE(xy.shape() == lrc::Shape({b, m, n}));                                              \
+        for (int64_t p = 0; p < b; ++p) {                                                          \
+            for (int64_t i = 0; i < m; ++i) {                                                      \
+                for (int64_t j = 0; j < n; ++j) {                                                  \
+                    SCALAR sum = 0;                                                                \
+                    for (int64_t q = 0; q < k; ++q) {                                              \
+                        sum += x.storage()[(p * m + i) * k + q] *                                  \
+                               y.storage()[(p * k + q) * n + j];                                   \
+                    }                                                                              \
+                    REQUIRE(lrc::isClose(xy.storage()[(p * m + i) * n + j], sum, TOLERANCE));      \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        /* Three operands, summing over the batch dimension */                                     \
+        auto xyv = lrc::einsum("bij,bjk,k->i", x, y, v);                                           \
+        REQUIRE(xyv.shape() == lrc::Shape({m}));                                                   \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            SCALAR sum = 0;                                                                        \
+            for (int64_t p = 0; p < b; ++p) {                                                      \
+                for (int64_t j = 0; j < n; ++j) {                                                  \
+                    sum += xy.storage()[(p * m + i) * n + j] * v.storage()[j];                     \
+                }                                                                                  \
+            }                                                                                      \
+            REQUIRE(lrc::isClose(xyv.storage()[i], sum, TOLERANCE));                               \
+        }                                                                                          \
+                                                                                                   \
+        /* Transpose, trace and implicit output */                                                 \
+        lrc::Array<SCALAR> sq(lrc::Shape({m, m}));                                                 \
+        for (int64_t i = 0; i < m * m; ++i) sq.storage()[i] = SCALAR(i);                           \
+        auto sqT = lrc::einsum("ij->ji", sq);                                                      \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < m; ++j) {                                                      \
+                REQUIRE(sqT.storage()[i * m + j] == sq.storage()[j * m + i]);                      \
+            }                                                                                      \
+        }                                                                                          \
+        auto trace = lrc::einsum("ii", sq);                                                        \
+        REQUIRE(trace.shape() == lrc::Shape({1}));                                                 \
+        REQUIRE(lrc::isClose(trace.storage()[0], SCALAR(m * (m * m - 1) / 2), TOLERANCE));         \
+                                                                                                   \
+        /* Operands laid out as transposed matrices are passed to GEMM as they are */              \
+        auto xT  = lrc::einsum("bij->bji", x);                                                     \
+        auto yT  = lrc::einsum("bij->bji", y);                                                     \
+        auto xTy = lrc::einsum("bji,bjk->bik", xT, y);                                             \
+        auto xyT = lrc::einsum("bij,bkj->bik", x, yT);                                             \
+        auto xTT = lrc::einsum("bji,bkj->bik", xT, yT);                                            \
+        for (int64_t i = 0; i < b * m * n; ++i) {                                                  \
+            REQUIRE(lrc::isClose(xTy.storage()[i], xy.storage()[i], TOLERANCE));                   \
+            REQUIRE(lrc::isClose(xyT.storage()[i], xy.storage()[i], TOLERANCE));                   \
+            REQUIRE(lrc::isClose(xTT.storage()[i], xy.storage()[i], TOLERANCE));                   \
+        }                                                                                          \
+                                                                                                   \
+        /* Contractions with no free labels are element-wise products and dot products */          \
+        auto hadamard = lrc::einsum("bij,bij->bij", x, x);                                         \
+        auto rowDots  = lrc::einsum("bij,bij->b", x, x);                                           \
+        auto vDotV    = lrc::einsum("i,i->", v, v);                                                \
+        REQUIRE(hadamard.shape() == x.shape());                                                    \
+        REQUIRE(rowDots.shape() == lrc::Shape({b}));                                               \
+        for (int64_t p = 0; p < b; ++p) {                                                          \
+            SCALAR sum = 0;                                                                        \
+            for (int64_t i = 0; i < m * k; ++i) {                                                  \
+                const SCALAR value = x.storage()[p * m * k + i];                                   \
+                REQUIRE(hadamard.storage()[p * m * k + i] == value * value);                       \
+                sum += value * value;                                                              \
+            }                                                                                      \
+            REQUIRE(lrc::isClose(rowDots.storage()[p], sum, TOLERANCE));                           \
+        }                                                                                          \
+        REQUIRE(lrc::isClose(vDotV.storage()[0], SCALAR(n - n / 3), TOLERANCE));                   \
+                                                                                                   \
+        /* Evaluating along a greedy path gives the same result */                                 \
+        const auto problem =                                                                       \
+          lrc::linalg::detail::einsumProblem("bij,bjk,k->i", {{b, m, k}, {b, k, n}, {n}});         \
+        const auto greedy =                                                                        \
+          lrc::linalg::detail::einsumPath(problem, lrc::linalg::EinsumStrategy::Greedy);           \
+        std::vector<SCALAR> greedyResult(m);                                                       \
+        lrc::linalg::detail::einsumEvaluate<SCALAR>(                                               \
+          problem,                                                                                 \
+          greedy,                                                                                  \
+          {x.storage().data(), y.storage().data(), v.storage().data()},                            \
+          greedyResult.data());                                                                    \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            REQUIRE(lrc::isClose(greedyResult[i], xyv.storage()[i], TOLERANCE));                   \
+        }                                                                                          \
+                                                                                                   \
+        /* The matrix-vector product is evaluated first */                                         \
+        auto path = lrc::linalg::einsumPath("ij,jk,k->i", {{30, 40}, {40, 50}, {50}});             \
+        REQUIRE(path.steps.size() == 2);                                                           \
+        REQUIRE(path.steps[0] == std::pair<int64_t, int64_t>(1, 2));                               \
+        REQUIRE(path.flops == 40 * 50 + 30 * 40);                                                  \
+                                                                                                   \
+        auto greedyPath = lrc::linalg::einsumPath(                                                 \
+          "ij,jk,k->i", {{30, 40}, {40, 50}, {50}}, lrc::linalg::EinsumStrategy::Greedy);          \
+        REQUIRE(greedyPath.steps == path.steps);                                                   \
+        REQUIRE(greedyPath.flops == path.flops);                                                   \
+    }
+
+EINSUM_TEST_IMPL(float, 1e-3)
+EINSUM_TEST_IMPL(double, 1e-8)
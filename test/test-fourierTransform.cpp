@@ -0,0 +1,126 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc			   = librapid;
+constexpr double tolerance = 1e-3;
+
+// Naive DFT of element (outer, k, inner) along the middle axis of a [outer, n, inner] layout
+template<typename T, typename Getter>
+lrc::Complex<double> naiveDft(Getter get, int64_t outer, int64_t k, int64_t inner, int64_t n,
+							  int64_t innerSize, double sign) {
+	lrc::Complex<double> res(0, 0);
+	for (int64_t j = 0; j < n; ++j) {
+		const double angle = sign * lrc::constants::twoPi * double(j * k) / double(n);
+		res += get((outer * n + j) * innerSize + inner) *
+			   lrc::Complex<double>(std::cos(angle), std::sin(angle));
+	}
+	return res;
+}
+
+#define TEST_FFT(SCALAR)                                                                           \
+	SECTION(fmt::format("Test FFT [{}]", STRINGIFY(SCALAR))) {                                     \
+		const int64_t rows = 6, cols = 10;                                                         \
+		lrc::Array<SCALAR> x(lrc::Shape({rows, cols}));                                            \
+		for (int64_t i = 0; i < rows * cols; ++i) {                                                \
+			x.storage()[i] = SCALAR((i * 37) % 17) - SCALAR(8);                                    \
+		}                                                                                          \
+		auto getReal = [&](int64_t i) { return lrc::Complex<double>(double(x.storage()[i])); };    \
+                                                                                                   \
+		/* Real-to-complex along both axes */                                                      \
+		auto r1 = lrc::fft::rfft(x);                                                               \
+		auto r0 = lrc::fft::rfft(x, 0);                                                            \
+		REQUIRE(r1.shape() == lrc::Shape({rows, cols / 2 + 1}));                                   \
+		REQUIRE(r0.shape() == lrc::Shape({rows / 2 + 1, cols}));                                   \
+		for (int64_t i = 0; i < rows; ++i) {                                                       \
+			for (int64_t k = 0; k < cols / 2 + 1; ++k) {                                           \
+				auto expected = naiveDft<SCALAR>(getReal, i, k, 0, cols, 1, -1);                   \
+				auto actual	  = r1.storage()[i * (cols / 2 + 1) + k];                              \
+				REQUIRE(lrc::isClose(double(actual.real()), expected.real(), tolerance));          \
+				REQUIRE(lrc::isClose(double(actual.imag()), expected.imag(), tolerance));          \
+			}                                                                                      \
+		}                                                                                          \
+		for (int64_t k = 0; k < rows / 2 + 1; ++k) {                                               \
+			for (int64_t j = 0; j < cols; ++j) {                                                   \
+				auto expected = naiveDft<SCALAR>(getReal, 0, k, j, rows, cols, -1);                \
+				auto actual	  = r0.storage()[k * cols + j];                                        \
+				REQUIRE(lrc::isClose(double(actual.real()), expected.real(), tolerance));          \
+				REQUIRE(lrc::isClose(double(actual.imag()), expected.imag(), tolerance));          \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Inverse transforms recover the input */                                                 \
+		auto back1 = lrc::fft::irfft(r1, cols);                                                    \
+		auto back0 = lrc::fft::irfft(r0, rows, 0);                                                 \
+		REQUIRE(back1.shape() == x.shape());                                                       \
+		REQUIRE(back0.shape() == x.shape());                                                       \
+		for (int64_t i = 0; i < rows * cols; ++i) {                                                \
+			REQUIRE(lrc::isClose(double(back1.storage()[i]), double(x.storage()[i]), tolerance));  \
+			REQUIRE(lrc::isClose(double(back0.storage()[i]), double(x.storage()[i]), tolerance));  \
+		}                                                                                          \
+                                                                                                   \
+		/* The full complex transform agrees with rfft on the non-redundant half */                \
+		auto c1 = lrc::fft::fft(x);                                                                \
+		for (int64_t i = 0; i < rows; ++i) {                                                       \
+			for (int64_t k = 0; k < cols / 2 + 1; ++k) {                                           \
+				auto full = c1.storage()[i * cols + k];                                            \
+				auto half = r1.storage()[i * (cols / 2 + 1) + k];                                  \
+				REQUIRE(lrc::isClose(double(full.real()), double(half.real()), tolerance));        \
+				REQUIRE(lrc::isClose(double(full.imag()), double(half.imag()), tolerance));        \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* A 2D transform is a transform along each axis in turn */                                \
+		auto c2		= lrc::fft::fft2(x);                                                           \
+		auto c10	= lrc::fft::fft(c1, 0);                                                        \
+		auto inv2	= lrc::fft::ifft2(c2);                                                         \
+		auto invAll = lrc::fft::ifftn(lrc::fft::fftn(x));                                          \
+		for (int64_t i = 0; i < rows * cols; ++i) {                                                \
+			REQUIRE(lrc::isClose(                                                                  \
+			  double(c2.storage()[i].real()), double(c10.storage()[i].real()), tolerance));        \
+			REQUIRE(lrc::isClose(                                                                  \
+			  double(c2.storage()[i].imag()), double(c10.storage()[i].imag()), tolerance));        \
+			REQUIRE(lrc::isClose(                                                                  \
+			  double(inv2.storage()[i].real()), double(x.storage()[i]), tolerance));               \
+			REQUIRE(lrc::isClose(double(inv2.storage()[i].imag()), 0.0, tolerance));               \
+			REQUIRE(lrc::isClose(                                                                  \
+			  double(invAll.storage()[i].real()), double(x.storage()[i]), tolerance));             \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test FFT -- float", "[array-lib]") { TEST_FFT(float); }
+TEST_CASE("Test FFT -- double", "[array-lib]") { TEST_FFT(double); }
+
+#if defined(LIBRAPID_HAS_CUDA)
+TEST_CASE("Test FFT -- CUDA real input", "[array-lib]") {
+	// Real inputs are promoted to complex on the device, so must match the host transforms
+	const int64_t rows = 6, cols = 10;
+	lrc::Array<float> x(lrc::Shape({rows, cols}));
+	lrc::Array<float, lrc::backend::CUDA> xGpu(lrc::Shape({rows, cols}));
+	for (int64_t i = 0; i < rows * cols; ++i) {
+		x.storage()[i]	  = float((i * 37) % 17) - 8.0f;
+		xGpu.storage()[i] = x.storage()[i];
+	}
+
+	auto c1		= lrc::fft::fft(x);
+	auto c2		= lrc::fft::fft2(x);
+	auto c1Gpu	= lrc::fft::fft(xGpu);
+	auto c2Gpu	= lrc::fft::fft2(xGpu);
+	auto invGpu = lrc::fft::ifftn(xGpu);
+	auto inv	= lrc::fft::ifftn(x);
+	for (int64_t i = 0; i < rows * cols; ++i) {
+		const lrc::Complex<float> a = c1Gpu.storage()[i].get();
+		const lrc::Complex<float> b = c2Gpu.storage()[i].get();
+		const lrc::Complex<float> c = invGpu.storage()[i].get();
+		REQUIRE(lrc::isClose(double(a.real()), double(c1.storage()[i].real()), tolerance));
+		REQUIRE(lrc::isClose(double(a.imag()), double(c1.storage()[i].imag()), tolerance));
+		REQUIRE(lrc::isClose(double(b.real()), double(c2.storage()[i].real()), tolerance));
+		REQUIRE(lrc::isClose(double(b.imag()), double(c2.storage()[i].imag()), tolerance));
+		REQUIRE(lrc::isClose(double(c.real()), double(inv.storage()[i].real()), tolerance));
+		REQUIRE(lrc::isClose(double(c.imag()), double(inv.storage()[i].imag()), tolerance));
+	}
+}
+#endif // LIBRAPID_HAS_CUDA
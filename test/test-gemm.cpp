@@ -0,0 +1,281 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc              = librapid;
+constexpr double tolerance = 1e-4;
+
+template<typename Scalar>
+void referenceGemm(bool transA, bool transB, int64_t m, int64_t n, int64_t k, Scalar alpha,
+                   const Scalar *a, int64_t lda, const Scalar *b, int64_t ldb, Scalar beta,
+                   Scalar *c, int64_t ldc) {
+    for (int64_t i = 0; i < m; ++i) {
+        for (int64_t j = 0; j < n; ++j) {
+            Scalar sum = 0;
+            for (int64_t p = 0; p < k; ++p) {
+                Scalar aVal = transA ? a[p * lda + i] : a[i * lda + p];
+                Scalar bVal = transB ? b[j * ldb + p] : b[p * ldb + j];
+                sum += aVal * bVal;
+            }
+            c[i * ldc + j] = alpha * sum + beta * c[i * ldc + j];
+        }
+    }
+}
+
+#define GEMM_TEST_IMPL(SCALAR)                                                                     \
+    TEST_CASE(fmt::format("Test GEMM -- {}", STRINGIFY(SCALAR)), "[array-lib]") {                  \
+        auto transA = GENERATE(false, true);                                                       \
+        auto transB = GENERATE(false, true);                                                       \
+        auto dims   = GENERATE(std::array<int64_t, 3> {1, 1, 1},                                   \
+                               std::array<int64_t, 3> {7, 13, 5},                                  \
+                               std::array<int64_t, 3> {64, 64, 64},                                \
+                               std::array<int64_t, 3> {130, 257, 301},                             \
+                               std::array<int64_t, 3> {3, 511, 67});                               \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        int64_t m = dims[0], n = dims[1], k = dims[2];                                             \
+        int64_t lda = transA ? m : k;                                                              \
+        int64_t ldb = transB ? k : n;                                                              \
+                                                                                                   \
+        std::vector<SCALAR> a(m * k), b(k * n), c(m * n), expected(m * n);                         \
+        for (int64_t i = 0; i < m * k; ++i) a[i] = SCALAR((i * 7) % 11) - SCALAR(5);               \
+        for (int64_t i = 0; i < k * n; ++i) b[i] = SCALAR((i * 3) % 7) - SCALAR(3);                \
+        for (int64_t i = 0; i < m * n; ++i) c[i] = expected[i] = SCALAR(i % 5);                    \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        lrc::linalg::gemm(transA,                                                                  \
+                          transB,                                                                  \
+                          m,                                                                       \
+                          n,                                                                       \
+                          k,                                                                       \
+                          SCALAR(2),                                                               \
+                          a.data(),                                                                \
+                          lda,                                                                     \
+                          b.data(),                                                                \
+                          ldb,                                                                     \
+                          SCALAR(3),                                                               \
+                          c.data(),                                                                \
+                          n);                                                                      \
+                                                                                                   \
+        referenceGemm(transA,                                                                      \
+                      transB,                                                                      \
+                      m,                                                                           \
+                      n,                                                                           \
+                      k,                                                                           \
+                      SCALAR(2),                                                                   \
+                      a.data(),                                                                    \
+                      lda,                                                                         \
+                      b.data(),                                                                    \
+                      ldb,                                                                         \
+                      SCALAR(3),                                                                   \
+                      expected.data(),                                                             \
+                      n);                                                                          \
+                                                                                                   \
+        for (int64_t i = 0; i < m * n; ++i) {                                                      \
+            REQUIRE(lrc::isClose(c[i], expected[i], tolerance));                                   \
+        }                                                                                          \
+    }
+
+GEMM_TEST_IMPL(float)
+GEMM_TEST_IMPL(double)
+
+#define BATCHED_GEMM_TEST_IMPL(SCALAR)                                                             \
+    TEST_CASE(fmt::format("Test Batched GEMM -- {}", STRINGIFY(SCALAR)), "[array-lib]") {          \
+        using Case    = std::pair<std::vector<int64_t>, std::vector<int64_t>>;                     \
+        auto testCase = GENERATE(Case {{4, 7, 5}, {4, 5, 3}},                                      \
+                                 Case {{2, 1, 7, 5}, {3, 5, 4}},                                   \
+                                 Case {{7, 5}, {2, 3, 5, 4}},                                      \
+                                 Case {{6, 64, 64}, {64, 64}},                                     \
+                                 Case {{2, 130, 67}, {2, 67, 129}});                               \
+        auto threads  = GENERATE(1, 4);                                                            \
+                                                                                                   \
+        const auto &[shapeVecA, shapeVecB] = testCase;                                             \
+        lrc::Shape shapeA = lrc::Shape::zeros(shapeVecA.size());                                   \
+        lrc::Shape shapeB = lrc::Shape::zeros(shapeVecB.size());                                   \
+        for (size_t i = 0; i < shapeVecA.size(); ++i) shapeA[i] = shapeVecA[i];                    \
+        for (size_t i = 0; i < shapeVecB.size(); ++i) shapeB[i] = shapeVecB[i];                    \
+                                                                                                   \
+        lrc::Array<SCALAR> a(shapeA);                                                              \
+        lrc::Array<SCALAR> b(shapeB);                                                              \
+        for (size_t i = 0; i < shapeA.size(); ++i) a.storage()[i] = SCALAR((i * 7) % 11) - 5;      \
+        for (size_t i = 0; i < shapeB.size(); ++i) b.storage()[i] = SCALAR((i * 3) % 7) - 3;       \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        lrc::Array<SCALAR> c = lrc::dot(a, b);                                                     \
+                                                                                                   \
+        const int64_t ndimA = shapeA.ndim(), ndimB = shapeB.ndim(), ndimC = c.ndim();              \
+        const int64_t m = shapeA[ndimA - 2], k = shapeA[ndimA - 1], n = shapeB[ndimB - 1];         \
+        REQUIRE(ndimC == std::max(ndimA, ndimB));                                                  \
+        REQUIRE(c.shape()[ndimC - 2] == m);                                                        \
+        REQUIRE(c.shape()[ndimC - 1] == n);                                                        \
+                                                                                                   \
+        std::vector<SCALAR> expected(m * n);                                                       \
+        const int64_t batches = c.shape().size() / (m * n);                                        \
+        for (int64_t batch = 0; batch < batches; ++batch) {                                        \
+            /* Broadcast the batch index back to an offset into A and B */                         \
+            int64_t remaining = batch, offsetA = 0, offsetB = 0, strideA = m * k, strideB = k * n; \
+            for (int64_t i = 3; i <= ndimC; ++i) {                                                 \
+                const int64_t index = remaining % c.shape()[ndimC - i];                            \
+                remaining /= c.shape()[ndimC - i];                                                 \
+                if (i <= ndimA) {                                                                  \
+                    if (shapeA[ndimA - i] != 1) offsetA += index * strideA;                        \
+                    strideA *= shapeA[ndimA - i];                                                  \
+                }                                                                                  \
+                if (i <= ndimB) {                                                                  \
+                    if (shapeB[ndimB - i] != 1) offsetB += index * strideB;                        \
+                    strideB *= shapeB[ndimB - i];                                                  \
+                }                                                                                  \
+            }                                                                                      \
+                                                                                                   \
+            std::fill(expected.begin(), expected.end(), SCALAR(0));                                \
+            referenceGemm(false,                                                                   \
+                          false,                                                                   \
+                          m,                                                                       \
+                          n,                                                                       \
+                          k,                                                                       \
+                          SCALAR(1),                                                               \
+                          a.storage().data() + offsetA,                                            \
+                          k,                                                                       \
+                          b.storage().data() + offsetB,                                            \
+                          n,                                                                       \
+                          SCALAR(0),                                                               \
+                          expected.data(),                                                         \
+                          n);                                                                      \
+                                                                                                   \
+            for (int64_t i = 0; i < m * n; ++i) {                                                  \
+                REQUIRE(lrc::isClose(c.storage()[batch * m * n + i], expected[i], tolerance));     \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+BATCHED_GEMM_TEST_IMPL(float)
+BATCHED_GEMM_TEST_IMPL(double)
+
+#define VECTOR_PRODUCT_TEST_IMPL(SCALAR)                                                           \
+    TEST_CASE(fmt::format("Test Vector Products -- {}", STRINGIFY(SCALAR)), "[array-lib]") {       \
+        auto dims    = GENERATE(std::array<int64_t, 2> {1, 1},                                     \
+                                std::array<int64_t, 2> {7, 13},                                    \
+                                std::array<int64_t, 2> {65, 130},                                  \
+                                std::array<int64_t, 2> {1000, 5000});                              \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims[0], n = dims[1];                                                    \
+        lrc::Array<SCALAR> x(lrc::Shape({m}));                                                     \
+        lrc::Array<SCALAR> y(lrc::Shape({n}));                                                     \
+        for (int64_t i = 0; i < m; ++i) x.storage()[i] = SCALAR((i * 7) % 11) - 5;                 \
+        for (int64_t i = 0; i < n; ++i) y.storage()[i] = SCALAR((i * 3) % 7) - 3;                  \
+                                                                                                   \
+        ThreadingGuard threading(threads, 100);                                                    \
+        lrc::Array<SCALAR> inner  = lrc::dot(y, y);                                                \
+        lrc::Array<SCALAR> outer  = lrc::outer(x, y);                                              \
+        lrc::Array<SCALAR> innerT = lrc::dot(y, lrc::transpose(y));                                \
+        lrc::Array<SCALAR> scaled = lrc::outer(x * SCALAR(2), y);                                  \
+                                                                                                   \
+        SCALAR expected = 0;                                                                       \
+        for (int64_t i = 0; i < n; ++i) expected += y.storage()[i] * y.storage()[i];               \
+        REQUIRE(inner.shape() == lrc::Shape({1}));                                                 \
+        REQUIRE(lrc::isClose(inner.storage()[0], expected, tolerance));                            \
+        /* As in NumPy, transposing a vector does not make the product an outer product */         \
+        REQUIRE(innerT.shape() == lrc::Shape({1}));                                                \
+        REQUIRE(lrc::isClose(innerT.storage()[0], expected, tolerance));                           \
+                                                                                                   \
+        REQUIRE(outer.shape() == lrc::Shape({m, n}));                                              \
+        REQUIRE(scaled.shape() == lrc::Shape({m, n}));                                             \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                const SCALAR value = x.storage()[i] * y.storage()[j];                              \
+                REQUIRE(outer.storage()[i * n + j] == value);                                      \
+                REQUIRE(scaled.storage()[i * n + j] == value * 2);                                 \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+VECTOR_PRODUCT_TEST_IMPL(float)
+VECTOR_PRODUCT_TEST_IMPL(double)
+
+#define GEMV_TEST_IMPL(SCALAR)                                                                     \
+    TEST_CASE(fmt::format("Test GEMV -- {}", STRINGIFY(SCALAR)), "[array-lib]") {                  \
+        auto dims    = GENERATE(std::array<int64_t, 2> {1, 1},                                     \
+                                std::array<int64_t, 2> {7, 13},                                    \
+                                std::array<int64_t, 2> {130, 65},                                  \
+                                std::array<int64_t, 2> {1000, 3},                                  \
+                                std::array<int64_t, 2> {3, 2000});                                 \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims[0], n = dims[1];                                                    \
+        lrc::Array<SCALAR> a(lrc::Shape({m, n}));                                                  \
+        lrc::Array<SCALAR> x(lrc::Shape({n}));                                                     \
+        lrc::Array<SCALAR> z(lrc::Shape({m}));                                                     \
+        for (int64_t i = 0; i < m * n; ++i) a.storage()[i] = SCALAR((i * 7) % 11) - 5;             \
+        for (int64_t i = 0; i < n; ++i) x.storage()[i] = SCALAR((i * 3) % 7) - 3;                  \
+        for (int64_t i = 0; i < m; ++i) z.storage()[i] = SCALAR((i * 5) % 9) - 4;                  \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        lrc::Array<SCALAR> ax  = lrc::dot(a, x);                                                   \
+        lrc::Array<SCALAR> atz = lrc::dot(lrc::transpose(a), z);                                   \
+                                                                                                   \
+        REQUIRE(ax.shape() == lrc::Shape({m}));                                                    \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            SCALAR expected = 0;                                                                   \
+            for (int64_t j = 0; j < n; ++j) expected += a.storage()[i * n + j] * x.storage()[j];   \
+            REQUIRE(ax.storage()[i] == expected);                                                  \
+        }                                                                                          \
+                                                                                                   \
+        REQUIRE(atz.shape() == lrc::Shape({n}));                                                   \
+        for (int64_t j = 0; j < n; ++j) {                                                          \
+            SCALAR expected = 0;                                                                   \
+            for (int64_t i = 0; i < m; ++i) expected += a.storage()[i * n + j] * z.storage()[i];   \
+            REQUIRE(atz.storage()[j] == expected);                                                 \
+        }                                                                                          \
+    }
+
+GEMV_TEST_IMPL(float)
+GEMV_TEST_IMPL(double)
+
+#define FUSED_GEMM_TEST_IMPL(SCALAR)                                                               \
+    TEST_CASE(fmt::format("Test Fused GEMM Epilogue -- {}", STRINGIFY(SCALAR)), "[array-lib]") {   \
+        auto dims    = GENERATE(std::array<int64_t, 3> {7, 13, 5},                                 \
+                                std::array<int64_t, 3> {64, 64, 64},                               \
+                                std::array<int64_t, 3> {130, 257, 1100});                          \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims[0], n = dims[1], k = dims[2];                                       \
+        lrc::Array<SCALAR> a(lrc::Shape({m, k}));                                                  \
+        lrc::Array<SCALAR> b(lrc::Shape({k, n}));                                                  \
+        lrc::Array<SCALAR> rowBias(lrc::Shape({m}));                                               \
+        lrc::Array<SCALAR> colBias(lrc::Shape({n}));                                               \
+        for (int64_t i = 0; i < m * k; ++i) a.storage()[i] = SCALAR((i * 7) % 11) - 5;             \
+        for (int64_t i = 0; i < k * n; ++i) b.storage()[i] = SCALAR((i * 3) % 7) - 3;              \
+        for (int64_t i = 0; i < m; ++i) rowBias.storage()[i] = SCALAR(i % 5) - 2;                  \
+        for (int64_t i = 0; i < n; ++i) colBias.storage()[i] = SCALAR(i % 3) - 1;                  \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        lrc::Array<SCALAR> plain     = lrc::dot(a, b);                                             \
+        lrc::Array<SCALAR> rows      =                                                             \
+          lrc::dot(a, b).withEpilogue(rowBias, lrc::linalg::GemmBias::ROW);                        \
+        lrc::Array<SCALAR> cols      = lrc::dot(a, b * SCALAR(0.01))                               \
+                                    .withEpilogue(colBias, lrc::linalg::GemmBias::COLUMN,          \
+                                                  lrc::ml::Sigmoid());                             \
+        lrc::Array<SCALAR> activated =                                                             \
+          lrc::dot(a, b * SCALAR(0.01)).withEpilogue(lrc::detail::Tanh());                         \
+                                                                                                   \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                const SCALAR value = plain.storage()[i * n + j];                                   \
+                const SCALAR small = value * SCALAR(0.01);                                         \
+                const SCALAR sigmoid =                                                             \
+                  SCALAR(1) / (SCALAR(1) + std::exp(-(small + colBias.storage()[j])));             \
+                REQUIRE(lrc::isClose(                                                              \
+                  rows.storage()[i * n + j], value + rowBias.storage()[i], tolerance));            \
+                REQUIRE(lrc::isClose(cols.storage()[i * n + j], sigmoid, tolerance));              \
+                REQUIRE(                                                                           \
+                  lrc::isClose(activated.storage()[i * n + j], std::tanh(small), tolerance));      \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+FUSED_GEMM_TEST_IMPL(float)
+FUSED_GEMM_TEST_IMPL(double)
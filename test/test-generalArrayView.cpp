@@ -73,6 +73,65 @@ constexpr double tolerance = 0.001;
 			REQUIRE(evalTest.storage()[i] == i);                                                   \
 			REQUIRE(evalTestCopy.storage()[i] == i);                                               \
 			REQUIRE(evalTestMoveView.storage()[i] == i);                                           \
+		}                                                                                          \
+                                                                                                   \
+		auto row = testView[3].eval();                                                             \
+		REQUIRE(row.shape() == lrc::Shape({shape[1]}));                                            \
+		for (int64_t col = 0; col < shape[1]; ++col) {                                             \
+			REQUIRE(row.storage()[col] == 3 * shape[1] + col);                                     \
+		}                                                                                          \
+                                                                                                   \
+		testView[1] = testView[2] + testView[3];                                                   \
+		for (int64_t col = 0; col < shape[1]; ++col) {                                             \
+			REQUIRE(testArr.storage()[shape[1] + col] == 5 * shape[1] + 2 * col);                  \
+		}                                                                                          \
+                                                                                                   \
+		/* A transposed view, so every run has a non-unit stride */                                \
+		for (int64_t i = 0; i < testArr.shape().size(); ++i) { testArr.storage()[i] = i; }         \
+		auto transposed	= lrc::createGeneralArrayView(testArr);                                    \
+		auto tShape		= transposed.shape();                                                      \
+		auto tStride	= transposed.stride();                                                     \
+		std::swap(tShape[0], tShape[1]);                                                           \
+		std::swap(tStride[0], tStride[1]);                                                         \
+		transposed.setShape(tShape);                                                               \
+		transposed.setStride(tStride);                                                             \
+                                                                                                   \
+		auto transposedEval = transposed.eval();                                                   \
+		REQUIRE(transposedEval.shape() == lrc::Shape({shape[1], shape[0]}));                       \
+		for (int64_t i = 0; i < shape[1]; ++i) {                                                   \
+			for (int64_t j = 0; j < shape[0]; ++j) {                                               \
+				REQUIRE(transposedEval.storage()[i * shape[0] + j] == j * shape[1] + i);           \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Every other column, starting from the second */                                         \
+		const int64_t halfCols = shape[1] / 2;                                                     \
+		auto sliced			   = lrc::createGeneralArrayView(testArr);                             \
+		auto sShape			   = sliced.shape();                                                   \
+		auto sStride		   = sliced.stride();                                                  \
+		sShape[1]			   = halfCols;                                                         \
+		sStride[1]			   = 2;                                                                \
+		sliced.setShape(sShape);                                                                   \
+		sliced.setStride(sStride);                                                                 \
+		sliced.setOffset(1);                                                                       \
+                                                                                                   \
+		auto slicedEval = sliced.eval();                                                           \
+		REQUIRE(slicedEval.shape() == lrc::Shape({shape[0], halfCols}));                           \
+		for (int64_t row = 0; row < shape[0]; ++row) {                                             \
+			for (int64_t col = 0; col < halfCols; ++col) {                                         \
+				const int64_t expected = row * shape[1] + 1 + 2 * col;                             \
+				REQUIRE(slicedEval.storage()[row * halfCols + col] == expected);                   \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		/* Writing through the view only changes the elements it references */                     \
+		sliced = lrc::Array<SCALAR, BACKEND>(sShape, SCALAR(-1));                                  \
+		for (int64_t row = 0; row < shape[0]; ++row) {                                             \
+			for (int64_t col = 0; col < shape[1]; ++col) {                                         \
+				const bool referenced = col % 2 == 1 && col < 2 * halfCols;                        \
+				REQUIRE(testArr.storage()[row * shape[1] + col] ==                                 \
+						(referenced ? -1 : row * shape[1] + col));                                 \
+			}                                                                                      \
 		}                                                                                          \
 	}
 
@@ -0,0 +1,194 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+namespace lrc = librapid;
+using lrc::half;
+using Float = lrc::HalfPacket::Float;
+
+constexpr size_t width = lrc::HalfPacket::size;
+
+uint16_t halfBits(const half &value) { return value.data().m_bits; }
+
+uint32_t floatBits(float value) {
+    uint32_t bits;
+    std::memcpy(&bits, &value, sizeof(float));
+    return bits;
+}
+
+bool isHalfNaN(const half &value) { return std::isnan(static_cast<float>(value)); }
+
+// IEEE 754 does not specify which NaN an operation returns, so any NaN matches any other
+bool sameResult(const half &a, const half &b) {
+    return halfBits(a) == halfBits(b) || (isHalfNaN(a) && isHalfNaN(b));
+}
+
+// Every half value, and a permutation of them, so each packet mixes signs, zeros, subnormals,
+// infinities and NaNs
+std::vector<half> allHalves(uint32_t multiplier, uint32_t offset) {
+    std::vector<half> result(65536);
+    for (uint32_t i = 0; i < 65536; ++i) {
+        result[i] = half::fromBits(static_cast<uint16_t>((i * multiplier + offset) & 0xffff));
+    }
+    return result;
+}
+
+TEST_CASE("Test half -- Conversion", "[math]") {
+    // Widening is exact. The F16C path (used if LIBRAPID_F16C is defined) must match the scalar
+    // fallback and the scalar conversion for every value
+    const std::vector<half> values = allHalves(1, 0);
+    bool widenValid = true, roundTripValid = true;
+    for (size_t i = 0; i < values.size(); i += width) {
+        const Float simd     = lrc::detail::loadHalfAsFloat<Float>(&values[i]);
+        const Float fallback = lrc::detail::loadHalfAsFloatScalar<Float>(&values[i]);
+
+        alignas(LIBRAPID_MEM_ALIGN) float simdLanes[width], fallbackLanes[width];
+        simd.store_aligned(simdLanes);
+        fallback.store_aligned(fallbackLanes);
+
+        half simdOut[width], fallbackOut[width];
+        lrc::detail::storeFloatAsHalf(simd, simdOut);
+        lrc::detail::storeFloatAsHalfScalar(fallback, fallbackOut);
+
+        for (size_t j = 0; j < width; ++j) {
+            const uint32_t expected = floatBits(static_cast<float>(values[i + j]));
+            widenValid = widenValid && floatBits(simdLanes[j]) == expected &&
+                         floatBits(fallbackLanes[j]) == expected;
+
+            // Signalling NaNs come back quietened
+            uint16_t original = halfBits(values[i + j]);
+            if (isHalfNaN(values[i + j])) original |= 0x0200;
+            roundTripValid = roundTripValid && halfBits(simdOut[j]) == original &&
+                             halfBits(fallbackOut[j]) == original;
+        }
+    }
+    REQUIRE(widenValid);
+    REQUIRE(roundTripValid);
+
+    // Narrowing rounds to nearest, with ties to even. Check the exact midpoint between every
+    // pair of adjacent finite values, which is representable in single precision
+    bool tiesValid = true;
+    for (uint32_t bits = 0; bits < 0x7bff; bits += width) {
+        alignas(LIBRAPID_MEM_ALIGN) float midpoints[width];
+        for (size_t j = 0; j < width; ++j) {
+            const uint16_t lower = static_cast<uint16_t>(std::min<uint32_t>(bits + j, 0x7bfe));
+            const double low     = static_cast<float>(half::fromBits(lower));
+            const double high    = static_cast<float>(half::fromBits(lower + 1));
+            midpoints[j]         = static_cast<float>((low + high) / 2);
+        }
+
+        half simdOut[width], fallbackOut[width];
+        lrc::detail::storeFloatAsHalf(Float::load_aligned(midpoints), simdOut);
+        lrc::detail::storeFloatAsHalfScalar(Float::load_aligned(midpoints), fallbackOut);
+
+        for (size_t j = 0; j < width; ++j) {
+            const uint16_t result = halfBits(half(midpoints[j]));
+            tiesValid = tiesValid && (result & 1) == 0 && halfBits(simdOut[j]) == result &&
+                        halfBits(fallbackOut[j]) == result;
+        }
+    }
+    REQUIRE(tiesValid);
+
+    // A spread of single precision values, including those which overflow, underflow to a
+    // subnormal or to zero, and NaNs with payloads
+    bool narrowValid = true;
+    for (uint64_t bits = 0; bits < (uint64_t(1) << 32); bits += 65521 * width) {
+        alignas(LIBRAPID_MEM_ALIGN) float inputs[width];
+        for (size_t j = 0; j < width; ++j) {
+            const uint32_t inputBits = static_cast<uint32_t>(bits + j * 65521);
+            std::memcpy(&inputs[j], &inputBits, sizeof(float));
+        }
+
+        half simdOut[width], fallbackOut[width];
+        lrc::detail::storeFloatAsHalf(Float::load_aligned(inputs), simdOut);
+        lrc::detail::storeFloatAsHalfScalar(Float::load_aligned(inputs), fallbackOut);
+
+        for (size_t j = 0; j < width; ++j) {
+            const uint16_t result = halfBits(half(inputs[j]));
+            narrowValid = narrowValid && halfBits(simdOut[j]) == result &&
+                          halfBits(fallbackOut[j]) == result;
+        }
+    }
+    REQUIRE(narrowValid);
+
+    REQUIRE(halfBits(half(1.0f)) == 0x3c00);
+    REQUIRE(halfBits(half(65504.0f)) == 0x7bff);
+    REQUIRE(halfBits(half(65520.0f)) == 0x7c00);
+    REQUIRE(halfBits(half(-0.0f)) == 0x8000);
+    REQUIRE(halfBits(half(std::numeric_limits<float>::denorm_min())) == 0x0000);
+    REQUIRE(static_cast<float>(half::fromBits(0x0001)) == std::ldexp(1.0f, -24));
+}
+
+TEST_CASE("Test half -- Packet Arithmetic", "[math]") {
+    const std::vector<half> a = allHalves(1, 0);
+    const std::vector<half> b = allHalves(40503, 12345);
+
+    bool valid = true;
+    for (size_t i = 0; i < a.size(); i += width) {
+        const lrc::HalfPacket x = lrc::HalfPacket::load_unaligned(&a[i]);
+        const lrc::HalfPacket y = lrc::HalfPacket::load_unaligned(&b[i]);
+
+        auto check = [&](const lrc::HalfPacket &packet, auto scalarOp) {
+            half out[width];
+            packet.store_unaligned(out);
+            for (size_t j = 0; j < width; ++j) {
+                valid = valid && sameResult(out[j], scalarOp(a[i + j], b[i + j]));
+            }
+        };
+
+        auto mask = [](bool value) { return half(value ? 1.0f : 0.0f); };
+
+        check(x + y, [](half p, half q) { return p + q; });
+        check(x - y, [](half p, half q) { return p - q; });
+        check(x * y, [](half p, half q) { return p * q; });
+        check(x / y, [](half p, half q) { return p / q; });
+        check(-x, [](half p, half) { return -p; });
+        check(lrc::HalfPacket(x < y), [&](half p, half q) { return mask(p < q); });
+        check(lrc::HalfPacket(x > y), [&](half p, half q) { return mask(p > q); });
+        check(lrc::HalfPacket(x <= y), [&](half p, half q) { return mask(p <= q); });
+        check(lrc::HalfPacket(x >= y), [&](half p, half q) { return mask(p >= q); });
+        check(lrc::HalfPacket(x == y), [&](half p, half q) { return mask(p == q); });
+        check(lrc::HalfPacket(x != y), [&](half p, half q) { return mask(p != q); });
+    }
+    REQUIRE(valid);
+
+    // Comparisons follow the IEEE rules
+    REQUIRE(half(0.0f) == half(-0.0f));
+    REQUIRE_FALSE(half::fromBits(0x7e00) == half::fromBits(0x7e00));
+    REQUIRE_FALSE(half::fromBits(0x7e00) > half(1.0f));
+    REQUIRE(half(-2.0f) < half(-1.0f));
+}
+
+TEST_CASE("Test half -- Array Arithmetic", "[array-lib]") {
+    // Prime-dimensioned to force a scalar tail
+    lrc::Array<half> a(lrc::Shape({37, 41}));
+    lrc::Array<half> b(lrc::Shape({37, 41}));
+    const int64_t size = 37 * 41;
+    for (int64_t i = 0; i < size; ++i) {
+        a.storage()[i] = half(static_cast<float>(i % 97) * 1.37f - 40.0f);
+        b.storage()[i] = half(static_cast<float>(i % 89) * 0.73f + 0.5f);
+    }
+
+    auto sum     = (a + b).eval();
+    auto diff    = (a - b).eval();
+    auto prod    = (a * b).eval();
+    auto quot    = (a / b).eval();
+    auto neg     = (-a).eval();
+    auto fma     = (a * b + a).eval();
+    auto less    = (a < b).eval();
+    auto notLess = (a >= b).eval();
+
+    for (int64_t i = 0; i < size; ++i) {
+        const half x = a.storage()[i];
+        const half y = b.storage()[i];
+        REQUIRE(halfBits(sum.storage()[i]) == halfBits(x + y));
+        REQUIRE(halfBits(diff.storage()[i]) == halfBits(x - y));
+        REQUIRE(halfBits(prod.storage()[i]) == halfBits(x * y));
+        REQUIRE(halfBits(quot.storage()[i]) == halfBits(x / y));
+        REQUIRE(halfBits(neg.storage()[i]) == halfBits(-x));
+        REQUIRE(halfBits(fma.storage()[i]) == halfBits(x * y + x));
+        REQUIRE(less.storage()[i] == half(x < y ? 1.0f : 0.0f));
+        REQUIRE(notLess.storage()[i] == half(x >= y ? 1.0f : 0.0f));
+    }
+}
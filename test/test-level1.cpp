@@ -0,0 +1,145 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define LEVEL1_TEST_IMPL(SCALAR, TOLERANCE)                                                        \
+    TEST_CASE(fmt::format("Test Level 1 BLAS -- {}", STRINGIFY(SCALAR)), "[array-lib]") {          \
+        auto n       = GENERATE(1, 7, 100, 20001);                                                 \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        lrc::Array<SCALAR> x(lrc::Shape({n}));                                                     \
+        lrc::Array<SCALAR> y(lrc::Shape({n}));                                                     \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            x.storage()[i] = SCALAR((i * i + 3 * i) % 101) / SCALAR(50) - 1;                       \
+            y.storage()[i] = SCALAR((i * 7 + 1) % 13) / SCALAR(6) - 1;                             \
+        }                                                                                          \
+                                                                                                   \
+        double sumSquares = 0, sumAbs = 0, sumCubes = 0, largest = -1;                             \
+        int64_t largestIndex = 0;                                                                  \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            const double value = lrc::abs(static_cast<double>(x.storage()[i]));                    \
+            sumSquares += value * value;                                                           \
+            sumAbs += value;                                                                       \
+            sumCubes += value * value * value;                                                     \
+            if (value > largest) {                                                                 \
+                largest      = value;                                                              \
+                largestIndex = i;                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+                                                                                                   \
+        REQUIRE(lrc::isClose(lrc::norm(x), SCALAR(lrc::sqrt(sumSquares)), TOLERANCE));             \
+        REQUIRE(lrc::isClose(lrc::norm(x, 1), SCALAR(sumAbs), TOLERANCE * n));                     \
+        REQUIRE(lrc::isClose(lrc::norm(x, 3), SCALAR(std::cbrt(sumCubes)), TOLERANCE * n));        \
+        REQUIRE(lrc::norm(x, std::numeric_limits<double>::infinity()) == SCALAR(largest));         \
+        REQUIRE(lrc::isClose(lrc::asum(x), SCALAR(sumAbs), TOLERANCE * n));                        \
+        REQUIRE(lrc::argmaxAbs(x) == largestIndex);                                                \
+                                                                                                   \
+        /* The 2-norm does not overflow */                                                         \
+        lrc::Array<SCALAR> big(lrc::Shape({n}), std::numeric_limits<SCALAR>::max() / 1000);        \
+        const SCALAR bigNorm = lrc::norm(big);                                                     \
+        REQUIRE(lrc::isClose(bigNorm / lrc::sqrt(SCALAR(n)), big.storage()[0], TOLERANCE));        \
+                                                                                                   \
+        /* y <- 2.5 x + y, then y <- 2 x - 0.5 y, then y <- 3 y */                                 \
+        lrc::Array<SCALAR> z = y;                                                                  \
+        lrc::axpy(SCALAR(2.5), x, z);                                                              \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            const SCALAR expected = SCALAR(2.5) * x.storage()[i] + y.storage()[i];                 \
+            REQUIRE(lrc::isClose(z.storage()[i], expected, TOLERANCE));                            \
+        }                                                                                          \
+                                                                                                   \
+        lrc::axpby(SCALAR(2), x, SCALAR(-0.5), z);                                                 \
+        lrc::scal(SCALAR(3), z);                                                                   \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            const SCALAR previous = SCALAR(2.5) * x.storage()[i] + y.storage()[i];                 \
+            const SCALAR expected = 3 * (2 * x.storage()[i] - SCALAR(0.5) * previous);             \
+            REQUIRE(lrc::isClose(z.storage()[i], expected, TOLERANCE * 10));                       \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test norm along an axis -- {}", STRINGIFY(SCALAR)), "[array-lib]") {    \
+        lrc::Array<SCALAR> a(lrc::Shape({3, 4}));                                                  \
+        a << 3, 0, -1, 2, 4, 1, 0, -2, 0, 0, 0, 0;                                                 \
+                                                                                                   \
+        auto rows = lrc::norm(a, 2, 1);                                                            \
+        REQUIRE(rows.shape() == lrc::Shape({3}));                                                  \
+        REQUIRE(lrc::isClose(rows.storage()[0], lrc::sqrt(SCALAR(14)), TOLERANCE));                \
+        REQUIRE(lrc::isClose(rows.storage()[1], lrc::sqrt(SCALAR(21)), TOLERANCE));                \
+        REQUIRE(rows.storage()[2] == 0);                                                           \
+                                                                                                   \
+        auto cols = lrc::norm(a, 1, 0);                                                            \
+        REQUIRE(cols.shape() == lrc::Shape({4}));                                                  \
+        REQUIRE(cols.storage()[0] == 7);                                                           \
+        REQUIRE(cols.storage()[1] == 1);                                                           \
+        REQUIRE(cols.storage()[2] == 1);                                                           \
+        REQUIRE(cols.storage()[3] == 4);                                                           \
+                                                                                                   \
+        auto colsMax = lrc::norm(a, std::numeric_limits<double>::infinity(), -2);                  \
+        REQUIRE(colsMax.storage()[0] == 4);                                                        \
+        REQUIRE(colsMax.storage()[3] == 2);                                                        \
+    }
+
+#define ARGMAX_NAN_TEST_IMPL(SCALAR)                                                               \
+    TEST_CASE(fmt::format("Test argmaxAbs with NaN -- {}", STRINGIFY(SCALAR)), "[array-lib]") {    \
+        auto n       = GENERATE(3, 37, 20001);                                                     \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const SCALAR nan = std::numeric_limits<SCALAR>::quiet_NaN();                               \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+                                                                                                   \
+        /* Shorter than a packet when n is 3 */                                                    \
+        lrc::Array<SCALAR> x(lrc::Shape({n}), nan);                                                \
+        REQUIRE(lrc::argmaxAbs(x) == 0);                                                           \
+                                                                                                   \
+        /* A NaN in the scalar tail, after the largest finite value */                             \
+        for (int64_t i = 0; i < n; ++i) x.storage()[i] = SCALAR(i % 10);                           \
+        x.storage()[n - 1] = nan;                                                                  \
+        REQUIRE(lrc::argmaxAbs(x) == n - 1);                                                       \
+                                                                                                   \
+        /* The first NaN is returned */                                                            \
+        x.storage()[n / 2] = -nan;                                                                 \
+        REQUIRE(lrc::argmaxAbs(x) == n / 2);                                                       \
+    }
+
+LEVEL1_TEST_IMPL(float, 1e-3)
+LEVEL1_TEST_IMPL(double, 1e-8)
+
+TEST_CASE("Test nrm2 without underflow or overflow", "[array-lib]") {
+    auto n       = GENERATE(2, 37, 20001);
+    auto threads = GENERATE(1, 4);
+
+    ThreadingGuard threading(threads, 100);
+
+    // The squares of these values underflow to zero or overflow to infinity, so the norm is only
+    // correct if the vector is rescaled
+    const int64_t threes = (n + 1) / 2, fours = n / 2;
+    const double expected = std::sqrt(double(threes * 9 + fours * 16));
+    for (double scale : {1e-200, 1e200}) {
+        lrc::Array<double> x(lrc::Shape({n}));
+        for (int64_t i = 0; i < n; ++i) x.storage()[i] = scale * (i % 2 == 0 ? 3 : 4);
+        REQUIRE(lrc::isClose(lrc::norm(x) / scale, expected, 1e-12, 1e-12));
+
+        // Enough rows that each norm is computed on a single thread
+        const int64_t rows = 8;
+        lrc::Array<double> a(lrc::Shape({rows, n}));
+        for (int64_t i = 0; i < rows * n; ++i) a.storage()[i] = x.storage()[i % n];
+        auto rowNorms = lrc::norm(a, 2, 1);
+        for (int64_t i = 0; i < rows; ++i) {
+            REQUIRE(lrc::isClose(rowNorms.storage()[i] / scale, expected, 1e-12, 1e-12));
+        }
+    }
+}
+
+// How a BLAS library's iamax treats NaN is implementation-defined, so only the native kernel is
+// checked
+#if !defined(LIBRAPID_HAS_BLAS)
+ARGMAX_NAN_TEST_IMPL(float)
+ARGMAX_NAN_TEST_IMPL(double)
+#endif // LIBRAPID_HAS_BLAS
@@ -0,0 +1,79 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define LU_TEST_IMPL(SCALAR, TOLERANCE)                                                            \
+    TEST_CASE(fmt::format("Test LU Solve -- {}", STRINGIFY(SCALAR)), "[array-lib]") {              \
+        /* 300 columns in the inverse are split between threads in the triangular solves */        \
+        auto n       = GENERATE(int64_t(1), int64_t(5), int64_t(64), int64_t(150), int64_t(300));  \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        /* Diagonally dominant, so the system is well conditioned, with the largest element of     \
+         * each column below the diagonal to force row interchanges */                             \
+        lrc::Array<SCALAR> a(lrc::Shape({n, n}));                                                  \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                a.storage()[i * n + j] = SCALAR((i * 7 + j * 3) % 11) / SCALAR(10) - SCALAR(0.5);  \
+            }                                                                                      \
+            a.storage()[((i + 1) % n) * n + i] += SCALAR(2 * n);                                   \
+        }                                                                                          \
+                                                                                                   \
+        const int64_t nrhs = 3;                                                                    \
+        lrc::Array<SCALAR> b(lrc::Shape({n, nrhs}));                                               \
+        lrc::Array<SCALAR> v(lrc::Shape({n}));                                                     \
+        for (int64_t i = 0; i < n * nrhs; ++i) b.storage()[i] = SCALAR(i % 5) - 2;                 \
+        for (int64_t i = 0; i < n; ++i) v.storage()[i] = SCALAR(i % 3) + 1;                        \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto x    = lrc::solve(a, b);                                                              \
+        auto y    = lrc::solve(a, v);                                                              \
+        auto aInv = lrc::inv(a);                                                                   \
+                                                                                                   \
+        REQUIRE(x.shape() == b.shape());                                                           \
+        REQUIRE(y.shape() == v.shape());                                                           \
+                                                                                                   \
+        for (int64_t i = 0; i < n; ++i) {                                                          \
+            for (int64_t j = 0; j < nrhs; ++j) {                                                   \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    sum += a.storage()[i * n + k] * x.storage()[k * nrhs + j];                     \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, b.storage()[i * nrhs + j], TOLERANCE));                  \
+            }                                                                                      \
+                                                                                                   \
+            SCALAR sum = 0;                                                                        \
+            for (int64_t k = 0; k < n; ++k) sum += a.storage()[i * n + k] * y.storage()[k];        \
+            REQUIRE(lrc::isClose(sum, v.storage()[i], TOLERANCE));                                 \
+                                                                                                   \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                SCALAR identity = 0;                                                               \
+                for (int64_t k = 0; k < n; ++k) {                                                  \
+                    identity += a.storage()[i * n + k] * aInv.storage()[k * n + j];                \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(identity, SCALAR(i == j), TOLERANCE));                        \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test Determinant -- {}", STRINGIFY(SCALAR)), "[array-lib]") {           \
+        lrc::Array<SCALAR> a(lrc::Shape({3, 3}));                                                  \
+        a << 2, 1, 0, 1, 3, 1, 0, 1, 4;                                                            \
+        REQUIRE(lrc::isClose(lrc::det(a), SCALAR(18), TOLERANCE));                                 \
+                                                                                                   \
+        /* Swapping two rows flips the sign */                                                     \
+        lrc::Array<SCALAR> swapped(lrc::Shape({3, 3}));                                            \
+        swapped << 1, 3, 1, 2, 1, 0, 0, 1, 4;                                                      \
+        REQUIRE(lrc::isClose(lrc::det(swapped), SCALAR(-18), TOLERANCE));                          \
+                                                                                                   \
+        lrc::Array<SCALAR> singular(lrc::Shape({3, 3}));                                           \
+        singular << 1, 2, 3, 2, 4, 6, 1, 0, 1;                                                     \
+        REQUIRE(lrc::det(singular) == SCALAR(0));                                                  \
+    }
+
+LU_TEST_IMPL(float, 1e-3)
+LU_TEST_IMPL(double, 1e-8)
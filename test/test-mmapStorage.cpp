@@ -0,0 +1,122 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include <filesystem>
+#include <fstream>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#if defined(LIBRAPID_HAS_MMAP)
+namespace {
+	std::string writeTestFile(const std::string &name, const std::vector<float> &values) {
+		const auto path = (std::filesystem::temp_directory_path() / name).string();
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		file.write(reinterpret_cast<const char *>(values.data()),
+				   static_cast<std::streamsize>(values.size() * sizeof(float)));
+		return path;
+	}
+
+	std::vector<float> readTestFile(const std::string &path, size_t elements) {
+		std::vector<float> values(elements);
+		std::ifstream file(path, std::ios::binary);
+		file.read(reinterpret_cast<char *>(values.data()),
+				  static_cast<std::streamsize>(elements * sizeof(float)));
+		return values;
+	}
+} // namespace
+
+TEST_CASE("Test Anonymous MmapStorage", "[storage]") {
+	lrc::MmapStorage<float> storage(100, 3);
+	REQUIRE(storage.size() == 100);
+	REQUIRE(!storage.isFileBacked());
+	REQUIRE(storage[0] == 3);
+	REQUIRE(storage[99] == 3);
+
+	// Copies reference the same mapping
+	auto reference = storage;
+	reference[5]   = 10;
+	REQUIRE(storage[5] == 10);
+
+	auto copy = storage.copy();
+	copy[5]	  = 20;
+	REQUIRE(storage[5] == 10);
+	REQUIRE(copy[5] == 20);
+
+	storage.resize(200);
+	REQUIRE(storage.size() == 200);
+	REQUIRE(storage[5] == 10);
+	REQUIRE(storage[99] == 3);
+}
+
+TEST_CASE("Test Memory-Mapped Arrays", "[storage]") {
+	// Use a small block size so the streaming assignment runs over many blocks
+	const size_t oldBlockSize  = lrc::global::mmapBlockSize;
+	lrc::global::mmapBlockSize = 4096;
+
+	int64_t numThreads = GENERATE(1, 4);
+	ThreadingGuard threading(numThreads, 100);
+
+	const int64_t rows = 123, cols = 257;
+	std::vector<float> values(rows * cols);
+	for (size_t i = 0; i < values.size(); ++i) { values[i] = static_cast<float>(i % 1000); }
+	const auto inputPath  = writeTestFile("librapid-mmap-input.bin", values);
+	const auto outputPath =
+	  (std::filesystem::temp_directory_path() / "librapid-mmap-output.bin").string();
+	std::filesystem::remove(outputPath);
+
+	SECTION("Read-only input, in-memory result") {
+		auto input = lrc::mapArray<float>(inputPath, lrc::Shape({rows, cols}));
+		REQUIRE(input.storage().isFileBacked());
+		REQUIRE(input.storage().mode() == lrc::MmapMode::ReadOnly);
+
+		lrc::Array<float> result = input * 2.0f + 1.0f;
+		REQUIRE(result.shape() == lrc::Shape({rows, cols}));
+		for (int64_t i = 0; i < rows * cols; ++i) {
+			REQUIRE(result.storage()[i] == values[i] * 2 + 1);
+		}
+	}
+
+	SECTION("Read-write output") {
+		auto input	= lrc::mapArray<float>(inputPath, lrc::Shape({rows, cols}));
+		auto output = lrc::mapArray<float>(
+		  outputPath, lrc::Shape({rows, cols}), lrc::MmapMode::ReadWrite);
+
+		output = input + input;
+		output.storage().flush();
+
+		const auto written = readTestFile(outputPath, rows * cols);
+		for (int64_t i = 0; i < rows * cols; ++i) { REQUIRE(written[i] == values[i] * 2); }
+	}
+
+	SECTION("Copy-on-write never modifies the file") {
+		auto input = lrc::mapArray<float>(
+		  inputPath, lrc::Shape({rows, cols}), lrc::MmapMode::CopyOnWrite);
+
+		input = input - 1.0f;
+		REQUIRE(input.storage()[10] == values[10] - 1);
+
+		const auto unchanged = readTestFile(inputPath, rows * cols);
+		REQUIRE(unchanged == values);
+	}
+
+	SECTION("Invalid use is rejected without touching the file") {
+		auto input = lrc::mapArray<float>(inputPath, lrc::Shape({rows, cols}));
+		REQUIRE_THROWS_AS(input = input * 2.0f, std::runtime_error);
+		REQUIRE(readTestFile(inputPath, rows * cols) == values);
+
+		// A misaligned offset is rejected before the file is created
+		REQUIRE_THROWS_AS(lrc::mapArray<float>(
+							outputPath, lrc::Shape({rows, cols}), lrc::MmapMode::ReadWrite, 4),
+						  std::invalid_argument);
+		REQUIRE(!std::filesystem::exists(outputPath));
+	}
+
+	std::filesystem::remove(inputPath);
+	std::filesystem::remove(outputPath);
+	lrc::global::mmapBlockSize = oldBlockSize;
+}
+#endif // LIBRAPID_HAS_MMAP
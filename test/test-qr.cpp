@@ -0,0 +1,113 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define QR_TEST_IMPL(SCALAR, TOLERANCE)                                                            \
+    TEST_CASE(fmt::format("Test QR -- {}", STRINGIFY(SCALAR)), "[array-lib]") {                    \
+        using Dims   = std::pair<int64_t, int64_t>;                                                \
+        auto dims    = GENERATE(values<Dims>({{5, 3}, {3, 5}, {64, 64}, {150, 70}, {2000, 10}}));  \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims.first;                                                              \
+        const int64_t n = dims.second;                                                             \
+        const int64_t k = std::min(m, n);                                                          \
+                                                                                                   \
+        lrc::Array<SCALAR> a(lrc::Shape({m, n}));                                                  \
+        for (int64_t i = 0; i < m * n; ++i) {                                                      \
+            a.storage()[i] = SCALAR((i * i + 3 * i) % 101) / SCALAR(50) - 1;                       \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto [q, r] = lrc::qr(a);                                                                  \
+                                                                                                   \
+        REQUIRE(q.shape() == lrc::Shape({m, k}));                                                  \
+        REQUIRE(r.shape() == lrc::Shape({k, n}));                                                  \
+                                                                                                   \
+        /* Q has orthonormal columns */                                                            \
+        for (int64_t i = 0; i < k; ++i) {                                                          \
+            for (int64_t j = 0; j < k; ++j) {                                                      \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t p = 0; p < m; ++p) {                                                  \
+                    sum += q.storage()[p * k + i] * q.storage()[p * k + j];                        \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, SCALAR(i == j), TOLERANCE));                             \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        /* R is upper triangular and QR = A */                                                     \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                if (i < k && j < i) REQUIRE(r.storage()[i * n + j] == SCALAR(0));                  \
+                                                                                                   \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t p = 0; p < k; ++p) {                                                  \
+                    sum += q.storage()[i * k + p] * r.storage()[p * n + j];                        \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(sum, a.storage()[i * n + j], TOLERANCE));                     \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test Least Squares -- {}", STRINGIFY(SCALAR)), "[array-lib]") {         \
+        auto m       = GENERATE(int64_t(8), int64_t(100), int64_t(4000));                          \
+        auto threads = GENERATE(1, 4);                                                             \
+        const int64_t n = 6;                                                                       \
+                                                                                                   \
+        lrc::Array<SCALAR> a(lrc::Shape({m, n}));                                                  \
+        lrc::Array<SCALAR> b(lrc::Shape({m}));                                                     \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                a.storage()[i * n + j] = SCALAR((i * i + 7 * j) % 23) / 8 + SCALAR(i == j);        \
+            }                                                                                      \
+            b.storage()[i] = SCALAR(i % 9) - 4;                                                    \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto x = lrc::lstsq(a, b);                                                                 \
+                                                                                                   \
+        REQUIRE(x.shape() == lrc::Shape({n}));                                                     \
+                                                                                                   \
+        /* The residual is orthogonal to the columns of A */                                       \
+        std::vector<SCALAR> residual(m);                                                           \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            SCALAR sum = 0;                                                                        \
+            for (int64_t j = 0; j < n; ++j) sum += a.storage()[i * n + j] * x.storage()[j];        \
+            residual[i] = sum - b.storage()[i];                                                    \
+        }                                                                                          \
+                                                                                                   \
+        for (int64_t j = 0; j < n; ++j) {                                                          \
+            SCALAR dot = 0, scale = 0;                                                             \
+            for (int64_t i = 0; i < m; ++i) {                                                      \
+                dot += a.storage()[i * n + j] * residual[i];                                       \
+                scale += lrc::abs(a.storage()[i * n + j] * residual[i]);                           \
+            }                                                                                      \
+            REQUIRE(lrc::abs(dot) <= TOLERANCE * (scale + 1));                                     \
+        }                                                                                          \
+                                                                                                   \
+        /* A consistent system is solved exactly */                                                \
+        lrc::Array<SCALAR> c(lrc::Shape({m, 2}));                                                  \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            c.storage()[i * 2]     = 0;                                                            \
+            c.storage()[i * 2 + 1] = 0;                                                            \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                c.storage()[i * 2] += a.storage()[i * n + j] * SCALAR(j + 1);                      \
+                c.storage()[i * 2 + 1] += a.storage()[i * n + j] * SCALAR(j % 2);                  \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        auto y = lrc::lstsq(a, c);                                                                 \
+                                                                                                   \
+        REQUIRE(y.shape() == lrc::Shape({n, 2}));                                                  \
+        for (int64_t j = 0; j < n; ++j) {                                                          \
+            REQUIRE(lrc::isClose(y.storage()[j * 2], SCALAR(j + 1), TOLERANCE));                   \
+            REQUIRE(lrc::isClose(y.storage()[j * 2 + 1], SCALAR(j % 2), TOLERANCE));               \
+        }                                                                                          \
+    }
+
+QR_TEST_IMPL(float, 1e-3)
+QR_TEST_IMPL(double, 1e-8)
@@ -0,0 +1,70 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+TEST_CASE("Test Philox", "[math]") {
+	// Known-answer test from the Random123 reference implementation
+	uint32_t words[4];
+	lrc::detail::random::philox<1>(0, 0, words);
+	REQUIRE(words[0] == 0x6627e8d5);
+	REQUIRE(words[1] == 0xe169c58d);
+	REQUIRE(words[2] == 0xbc57ac4c);
+	REQUIRE(words[3] == 0x9b00dbd8);
+
+	// Multi-lane generation must match generating each block separately
+	uint32_t lanes[lrc::detail::random::philoxChunkWords];
+	lrc::detail::random::philox<lrc::detail::random::philoxLanes>(1234, 100, lanes);
+	for (int64_t lane = 0; lane < lrc::detail::random::philoxLanes; ++lane) {
+		lrc::detail::random::philox<1>(1234, 100 + lane, words);
+		for (int64_t i = 0; i < 4; ++i) { REQUIRE(lanes[lane * 4 + i] == words[i]); }
+	}
+}
+
+#define TEST_FILL_RANDOM(SCALAR)                                                                   \
+	SECTION(fmt::format("Test fillRandom [{}]", STRINGIFY(SCALAR))) {                              \
+		const int64_t elements = 10007;                                                            \
+		ThreadingGuard threading(1, 100);                                                          \
+                                                                                                   \
+		lrc::setSeed(42);                                                                          \
+		auto serialUniform  = lrc::random<SCALAR>(lrc::Shape({elements}), -2, 3);                  \
+		auto serialGaussian = lrc::Array<SCALAR>(lrc::Shape({elements}));                          \
+		lrc::fillRandomGaussian(serialGaussian, 1, 2);                                             \
+                                                                                                   \
+		lrc::setNumThreads(4);                                                                     \
+		lrc::setSeed(42);                                                                          \
+		auto parallelUniform  = lrc::random<SCALAR>(lrc::Shape({elements}), -2, 3);                \
+		auto parallelGaussian = lrc::Array<SCALAR>(lrc::Shape({elements}));                        \
+		lrc::fillRandomGaussian(parallelGaussian, 1, 2);                                           \
+                                                                                                   \
+		double mean = 0, variance = 0;                                                             \
+		for (int64_t i = 0; i < elements; ++i) {                                                   \
+			REQUIRE(serialUniform.storage()[i] == parallelUniform.storage()[i]);                   \
+			REQUIRE(serialGaussian.storage()[i] == parallelGaussian.storage()[i]);                 \
+			REQUIRE(serialUniform.storage()[i] >= SCALAR(-2));                                     \
+			REQUIRE(serialUniform.storage()[i] < SCALAR(3));                                       \
+			mean += double(serialGaussian.storage()[i]);                                           \
+			variance += double(serialGaussian.storage()[i]) * double(serialGaussian.storage()[i]); \
+		}                                                                                          \
+		mean /= elements;                                                                          \
+		variance = variance / elements - mean * mean;                                              \
+		REQUIRE(std::abs(mean - 1) < 0.1);                                                         \
+		REQUIRE(std::abs(variance - 4) < 0.4);                                                     \
+                                                                                                   \
+		/* Successive calls continue the stream rather than repeating it */                        \
+		auto next = lrc::random<SCALAR>(lrc::Shape({elements}), -2, 3);                            \
+		bool allEqual = true;                                                                      \
+		for (int64_t i = 0; i < elements; ++i) {                                                   \
+			allEqual = allEqual && next.storage()[i] == serialUniform.storage()[i];                \
+		}                                                                                          \
+		REQUIRE(!allEqual);                                                                        \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test fillRandom -- float", "[math]") { TEST_FILL_RANDOM(float); }
+TEST_CASE("Test fillRandom -- double", "[math]") { TEST_FILL_RANDOM(double); }
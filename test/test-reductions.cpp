@@ -0,0 +1,80 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc			   = librapid;
+constexpr double tolerance = 1e-4;
+
+#define TEST_REDUCTIONS(SCALAR)                                                                    \
+	SECTION(fmt::format("Test Reductions [{}]", STRINGIFY(SCALAR))) {                              \
+		int64_t numThreads = GENERATE(1, 4);                                                       \
+		ThreadingGuard threading(numThreads, 100);                                                 \
+                                                                                                   \
+		/* Prime-dimensioned to force peeling and scalar tails */                                  \
+		const int64_t rows = 37, cols = 41;                                                        \
+		lrc::Array<SCALAR> a(lrc::Shape({rows, cols}));                                            \
+		lrc::Array<SCALAR> b(lrc::Shape({rows, cols}));                                            \
+		for (int64_t i = 0; i < rows * cols; ++i) {                                                \
+			a.storage()[i] = SCALAR((i * 7919) % 101) - SCALAR(50);                                \
+			b.storage()[i] = SCALAR(i % 3 + 1);                                                    \
+		}                                                                                          \
+                                                                                                   \
+		double expectedSum = 0, expectedDot = 0;                                                   \
+		SCALAR expectedMin = a.storage()[0], expectedMax = a.storage()[0];                         \
+		int64_t expectedArgmin = 0, expectedArgmax = 0;                                            \
+		std::vector<double> rowSums(rows, 0), colSums(cols, 0);                                    \
+		for (int64_t i = 0; i < rows; ++i) {                                                       \
+			for (int64_t j = 0; j < cols; ++j) {                                                   \
+				const SCALAR val = a.storage()[i * cols + j];                                      \
+				expectedSum += val;                                                                \
+				expectedDot += val * b.storage()[i * cols + j];                                    \
+				rowSums[i] += val;                                                                 \
+				colSums[j] += val;                                                                 \
+				if (val < expectedMin) {                                                           \
+					expectedMin	   = val;                                                          \
+					expectedArgmin = i * cols + j;                                                 \
+				}                                                                                  \
+				if (val > expectedMax) {                                                           \
+					expectedMax	   = val;                                                          \
+					expectedArgmax = i * cols + j;                                                 \
+				}                                                                                  \
+			}                                                                                      \
+		}                                                                                          \
+                                                                                                   \
+		REQUIRE(lrc::isClose(double(lrc::sum(a)), expectedSum, tolerance));                        \
+		REQUIRE(lrc::isClose(double(lrc::sum(a * b)), expectedDot, tolerance));                    \
+		REQUIRE(lrc::min(a) == expectedMin);                                                       \
+		REQUIRE(lrc::max(a) == expectedMax);                                                       \
+		REQUIRE(lrc::argmin(a) == expectedArgmin);                                                 \
+		REQUIRE(lrc::argmax(a) == expectedArgmax);                                                 \
+		REQUIRE(lrc::isClose(double(lrc::mean(a)), expectedSum / (rows * cols), tolerance));       \
+                                                                                                   \
+		auto sum0 = lrc::sum(a, 0);                                                                \
+		auto sum1 = lrc::sum(a, -1);                                                               \
+		REQUIRE(sum0.shape() == lrc::Shape({cols}));                                               \
+		REQUIRE(sum1.shape() == lrc::Shape({rows}));                                               \
+		for (int64_t j = 0; j < cols; ++j) {                                                       \
+			REQUIRE(lrc::isClose(double(sum0.scalar(j)), colSums[j], tolerance));                  \
+		}                                                                                          \
+		for (int64_t i = 0; i < rows; ++i) {                                                       \
+			REQUIRE(lrc::isClose(double(sum1.scalar(i)), rowSums[i], tolerance));                  \
+		}                                                                                          \
+                                                                                                   \
+		auto sumAll = lrc::sum(a, {0, 1});                                                         \
+		REQUIRE(lrc::isClose(double(sumAll.scalar(0)), expectedSum, tolerance));                   \
+                                                                                                   \
+		auto argmax0 = lrc::argmax(a, 0);                                                          \
+		auto max0	 = lrc::max(a, 0);                                                             \
+		for (int64_t j = 0; j < cols; ++j) {                                                       \
+			REQUIRE(a.storage()[argmax0.scalar(j) * cols + j] == max0.scalar(j));                  \
+		}                                                                                          \
+	}                                                                                              \
+	do {                                                                                           \
+	} while (false)
+
+TEST_CASE("Test Reductions -- int32_t", "[array-lib]") { TEST_REDUCTIONS(int32_t); }
+TEST_CASE("Test Reductions -- float", "[array-lib]") { TEST_REDUCTIONS(float); }
+TEST_CASE("Test Reductions -- double", "[array-lib]") { TEST_REDUCTIONS(double); }
@@ -0,0 +1,87 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc              = librapid;
+constexpr double tolerance = 1e-4;
+
+#define SPARSE_MATRIX_TEST_IMPL(SCALAR)                                                            \
+    TEST_CASE(fmt::format("Test SparseMatrix -- {}", STRINGIFY(SCALAR)), "[array-lib]") {          \
+        auto dims    = GENERATE(std::array<int64_t, 3> {1, 1, 1},                                  \
+                                std::array<int64_t, 3> {7, 13, 5},                                 \
+                                std::array<int64_t, 3> {130, 257, 64},                             \
+                                std::array<int64_t, 3> {1000, 900, 3});                            \
+        auto format  = GENERATE(lrc::SparseFormat::CSR, lrc::SparseFormat::CSC);                   \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims[0], k = dims[1], n = dims[2];                                       \
+                                                                                                   \
+        /* Roughly 5% of the elements are set, and some coordinates appear twice */                \
+        std::vector<int64_t> rowIndices, colIndices;                                               \
+        std::vector<SCALAR> values;                                                                \
+        lrc::Array<SCALAR> dense(lrc::Shape({m, k}), SCALAR(0));                                   \
+        for (int64_t i = 0; i < m * k; i += 19 + i % 5) {                                          \
+            const int64_t copies = i % 3 == 0 ? 2 : 1;                                             \
+            for (int64_t c = 0; c < copies; ++c) {                                                 \
+                rowIndices.push_back(i / k);                                                       \
+                colIndices.push_back(i % k);                                                       \
+                values.push_back(SCALAR(i % 7) - 3);                                               \
+                dense.storage()[i] += SCALAR(i % 7) - 3;                                           \
+            }                                                                                      \
+        }                                                                                          \
+        std::reverse(values.begin(), values.end());                                                \
+        std::reverse(rowIndices.begin(), rowIndices.end());                                        \
+        std::reverse(colIndices.begin(), colIndices.end());                                        \
+                                                                                                   \
+        auto sparse =                                                                              \
+          lrc::SparseMatrix<SCALAR>::fromTriplets(m, k, rowIndices, colIndices, values, format);   \
+        REQUIRE(sparse.rows() == m);                                                               \
+        REQUIRE(sparse.cols() == k);                                                               \
+        REQUIRE(sparse.format() == format);                                                        \
+                                                                                                   \
+        auto roundTrip = sparse.toDense();                                                         \
+        auto converted = lrc::SparseMatrix<SCALAR>::fromDense(dense, format).toFormat(             \
+          format == lrc::SparseFormat::CSR ? lrc::SparseFormat::CSC : lrc::SparseFormat::CSR);     \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < k; ++j) {                                                      \
+                const SCALAR expected = dense.storage()[i * k + j];                                \
+                REQUIRE(roundTrip.storage()[i * k + j] == expected);                               \
+                REQUIRE(sparse(i, j) == expected);                                                 \
+                REQUIRE(converted(i, j) == expected);                                              \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        lrc::Array<SCALAR> x(lrc::Shape({k}));                                                     \
+        lrc::Array<SCALAR> b(lrc::Shape({k, n}));                                                  \
+        for (int64_t i = 0; i < k; ++i) x.storage()[i] = SCALAR(i % 5) - 2;                        \
+        for (int64_t i = 0; i < k * n; ++i) b.storage()[i] = SCALAR((i * 3) % 7) - 3;              \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        lrc::Array<SCALAR> y = lrc::dot(sparse, x);                                                \
+        lrc::Array<SCALAR> c = lrc::dot(sparse, b * SCALAR(2));                                    \
+                                                                                                   \
+        REQUIRE(y.shape() == lrc::Shape({m}));                                                     \
+        REQUIRE(c.shape() == lrc::Shape({m, n}));                                                  \
+                                                                                                   \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            SCALAR expectedY = 0;                                                                  \
+            for (int64_t p = 0; p < k; ++p) {                                                      \
+                expectedY += dense.storage()[i * k + p] * x.storage()[p];                          \
+            }                                                                                      \
+            REQUIRE(lrc::isClose(y.storage()[i], expectedY, tolerance));                           \
+                                                                                                   \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                SCALAR expectedC = 0;                                                              \
+                for (int64_t p = 0; p < k; ++p) {                                                  \
+                    expectedC += dense.storage()[i * k + p] * b.storage()[p * n + j];              \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(c.storage()[i * n + j], SCALAR(2) * expectedC, tolerance));   \
+            }                                                                                      \
+        }                                                                                          \
+    }
+
+SPARSE_MATRIX_TEST_IMPL(float)
+SPARSE_MATRIX_TEST_IMPL(double)
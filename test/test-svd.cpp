@@ -0,0 +1,110 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+#define SVD_TEST_IMPL(SCALAR, TOLERANCE)                                                           \
+    TEST_CASE(fmt::format("Test SVD -- {}", STRINGIFY(SCALAR)), "[array-lib]") {                   \
+        using Dims   = std::pair<int64_t, int64_t>;                                                \
+        auto dims    = GENERATE(values<Dims>({{1, 1}, {5, 3}, {3, 5}, {40, 40}, {150, 60}}));      \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m = dims.first;                                                              \
+        const int64_t n = dims.second;                                                             \
+        const int64_t k = std::min(m, n);                                                          \
+                                                                                                   \
+        lrc::Array<SCALAR> a(lrc::Shape({m, n}));                                                  \
+        for (int64_t i = 0; i < m * n; ++i) {                                                      \
+            a.storage()[i] = SCALAR((i * i + 3 * i) % 101) / SCALAR(50) - 1;                       \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto [u, s, vt] = lrc::svd(a);                                                             \
+                                                                                                   \
+        REQUIRE(u.shape() == lrc::Shape({m, k}));                                                  \
+        REQUIRE(s.shape() == lrc::Shape({k}));                                                     \
+        REQUIRE(vt.shape() == lrc::Shape({k, n}));                                                 \
+                                                                                                   \
+        const SCALAR scale = s.storage()[0] + 1;                                                   \
+        for (int64_t i = 1; i < k; ++i) REQUIRE(s.storage()[i] <= s.storage()[i - 1]);             \
+                                                                                                   \
+        /* U S V^T = A */                                                                          \
+        for (int64_t i = 0; i < m; ++i) {                                                          \
+            for (int64_t j = 0; j < n; ++j) {                                                      \
+                SCALAR sum = 0;                                                                    \
+                for (int64_t p = 0; p < k; ++p) {                                                  \
+                    sum += u.storage()[i * k + p] * s.storage()[p] * vt.storage()[p * n + j];      \
+                }                                                                                  \
+                REQUIRE(lrc::abs(sum - a.storage()[i * n + j]) <= TOLERANCE * scale);              \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        /* The singular vectors are orthonormal */                                                 \
+        for (int64_t i = 0; i < k; ++i) {                                                          \
+            for (int64_t j = 0; j < k; ++j) {                                                      \
+                SCALAR dotU = 0, dotV = 0;                                                         \
+                for (int64_t p = 0; p < m; ++p) {                                                  \
+                    dotU += u.storage()[p * k + i] * u.storage()[p * k + j];                       \
+                }                                                                                  \
+                for (int64_t p = 0; p < n; ++p) {                                                  \
+                    dotV += vt.storage()[i * n + p] * vt.storage()[j * n + p];                     \
+                }                                                                                  \
+                REQUIRE(lrc::isClose(dotU, SCALAR(i == j), TOLERANCE));                            \
+                REQUIRE(lrc::isClose(dotV, SCALAR(i == j), TOLERANCE));                            \
+            }                                                                                      \
+        }                                                                                          \
+    }                                                                                              \
+                                                                                                   \
+    TEST_CASE(fmt::format("Test Randomised SVD -- {}", STRINGIFY(SCALAR)), "[array-lib]") {        \
+        using Dims   = std::pair<int64_t, int64_t>;                                                \
+        auto dims    = GENERATE(values<Dims>({{300, 80}, {80, 300}, {3000, 40}}));                 \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const int64_t m    = dims.first;                                                           \
+        const int64_t n    = dims.second;                                                          \
+        const int64_t rank = 5;                                                                    \
+                                                                                                   \
+        /* A sum of 12 rank-one matrices with quickly decaying weights */                          \
+        lrc::Array<SCALAR> a(lrc::Shape({m, n}), SCALAR(0));                                       \
+        for (int64_t p = 0; p < 12; ++p) {                                                         \
+            const SCALAR weight = SCALAR(100) / SCALAR(1 << p);                                    \
+            for (int64_t i = 0; i < m; ++i) {                                                      \
+                const SCALAR left = SCALAR((i * (p + 3) + p) % 17) / SCALAR(8) - 1;                \
+                for (int64_t j = 0; j < n; ++j) {                                                  \
+                    const SCALAR right = SCALAR((j * (2 * p + 5) + 1) % 13) / SCALAR(6) - 1;       \
+                    a.storage()[i * n + j] += weight * left * right;                               \
+                }                                                                                  \
+            }                                                                                      \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads);                                                         \
+        auto [u, s, vt]    = lrc::svd(a);                                                          \
+        auto [uR, sR, vtR] = lrc::svdRandomised(a, rank);                                          \
+                                                                                                   \
+        REQUIRE(uR.shape() == lrc::Shape({m, rank}));                                              \
+        REQUIRE(sR.shape() == lrc::Shape({rank}));                                                 \
+        REQUIRE(vtR.shape() == lrc::Shape({rank, n}));                                             \
+                                                                                                   \
+        const int64_t k = std::min(m, n);                                                          \
+        for (int64_t i = 0; i < rank; ++i) {                                                       \
+            REQUIRE(lrc::abs(sR.storage()[i] - s.storage()[i]) <= TOLERANCE * s.storage()[0]);     \
+                                                                                                   \
+            /* The singular vectors match up to sign */                                            \
+            SCALAR dotU = 0, dotV = 0;                                                             \
+            for (int64_t p = 0; p < m; ++p) {                                                      \
+                dotU += uR.storage()[p * rank + i] * u.storage()[p * k + i];                       \
+            }                                                                                      \
+            for (int64_t p = 0; p < n; ++p) {                                                      \
+                dotV += vtR.storage()[i * n + p] * vt.storage()[i * n + p];                        \
+            }                                                                                      \
+            REQUIRE(lrc::isClose(lrc::abs(dotU), SCALAR(1), TOLERANCE * 10));                      \
+            REQUIRE(lrc::isClose(lrc::abs(dotV), SCALAR(1), TOLERANCE * 10));                      \
+        }                                                                                          \
+    }
+
+SVD_TEST_IMPL(float, 1e-3)
+SVD_TEST_IMPL(double, 1e-8)
@@ -0,0 +1,125 @@
+#include <librapid>
+#include <catch2/catch_test_macros.hpp>
+#include <catch2/generators/catch_generators.hpp>
+#include <catch2/benchmark/catch_benchmark.hpp>
+
+#include "threadingGuard.hpp"
+
+namespace lrc = librapid;
+
+template<typename Scalar>
+std::vector<Scalar> referenceTranspose(const std::vector<Scalar> &in,
+                                       const std::vector<int64_t> &shape,
+                                       const std::vector<int64_t> &axes, Scalar alpha) {
+    const auto ndim = static_cast<int64_t>(shape.size());
+    std::vector<int64_t> strides(ndim), outShape(ndim);
+    int64_t stride = 1;
+    for (int64_t d = ndim - 1; d >= 0; --d) {
+        strides[d] = stride;
+        stride *= shape[d];
+    }
+    for (int64_t d = 0; d < ndim; ++d) outShape[d] = shape[axes[d]];
+
+    std::vector<Scalar> out(in.size());
+    for (int64_t i = 0; i < static_cast<int64_t>(in.size()); ++i) {
+        int64_t remaining = i, offset = 0;
+        for (int64_t d = ndim - 1; d >= 0; --d) {
+            offset += (remaining % outShape[d]) * strides[axes[d]];
+            remaining /= outShape[d];
+        }
+        out[i] = in[offset] * alpha;
+    }
+    return out;
+}
+
+#define TRANSPOSE_TEST_IMPL(SCALAR)                                                                \
+    TEST_CASE(fmt::format("Test Transpose -- {}", STRINGIFY(SCALAR)), "[array-lib]") {             \
+        using Case = std::pair<std::vector<int64_t>, std::vector<int64_t>>;                        \
+        auto testCase = GENERATE(Case {{1, 1}, {1, 0}},                                            \
+                                 Case {{7, 13}, {1, 0}},                                           \
+                                 Case {{64, 64}, {1, 0}},                                          \
+                                 Case {{130, 257}, {1, 0}},                                        \
+                                 Case {{3, 16, 9, 11}, {0, 2, 3, 1}},                              \
+                                 Case {{3, 9, 11, 16}, {0, 3, 1, 2}},                              \
+                                 Case {{2, 70, 1, 45}, {3, 1, 2, 0}},                              \
+                                 Case {{4, 5, 6}, {2, 0, 1}},                                      \
+                                 Case {{4, 5, 6}, {1, 0, 2}},                                      \
+                                 Case {{2, 3, 4, 5, 6}, {4, 3, 2, 1, 0}});                         \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        const auto &[shapeVec, axesVec] = testCase;                                                \
+        lrc::Shape shape = lrc::Shape::zeros(shapeVec.size());                                     \
+        lrc::Shape axes  = lrc::Shape::zeros(axesVec.size());                                      \
+        for (size_t i = 0; i < shapeVec.size(); ++i) {                                             \
+            shape[i] = shapeVec[i];                                                                \
+            axes[i]  = axesVec[i];                                                                 \
+        }                                                                                          \
+                                                                                                   \
+        lrc::Array<SCALAR> a(shape);                                                               \
+        std::vector<SCALAR> values(shape.size());                                                  \
+        for (size_t i = 0; i < values.size(); ++i) {                                               \
+            values[i]      = SCALAR(i % 97);                                                       \
+            a.storage()[i] = values[i];                                                            \
+        }                                                                                          \
+                                                                                                   \
+        ThreadingGuard threading(threads, 100);                                                    \
+                                                                                                   \
+        lrc::Array<SCALAR> result = lrc::transpose(a, axes);                                       \
+        lrc::Array<SCALAR> scaled = lrc::transpose(a, axes) * SCALAR(2);                           \
+                                                                                                   \
+        auto expected       = referenceTranspose(values, shapeVec, axesVec, SCALAR(1));            \
+        auto expectedScaled = referenceTranspose(values, shapeVec, axesVec, SCALAR(2));            \
+        for (size_t i = 0; i < values.size(); ++i) {                                               \
+            REQUIRE(result.storage()[i] == expected[i]);                                           \
+            REQUIRE(scaled.storage()[i] == expectedScaled[i]);                                     \
+        }                                                                                          \
+    }
+
+TRANSPOSE_TEST_IMPL(int32_t)
+TRANSPOSE_TEST_IMPL(float)
+TRANSPOSE_TEST_IMPL(double)
+
+TEST_CASE("Test Default Transpose Axes", "[array-lib]") {
+    lrc::Array<float> a(lrc::Shape({2, 3, 4}));
+    for (int64_t i = 0; i < 24; ++i) a.storage()[i] = float(i);
+
+    lrc::Array<float> result = lrc::transpose(a);
+    REQUIRE(result.shape() == lrc::Shape({4, 3, 2}));
+    for (int64_t i = 0; i < 2; ++i) {
+        for (int64_t j = 0; j < 3; ++j) {
+            for (int64_t k = 0; k < 4; ++k) {
+                REQUIRE(result.storage()[k * 6 + j * 2 + i] == a.storage()[i * 12 + j * 4 + k]);
+            }
+        }
+    }
+}
+
+#define TRANSPOSE_IN_PLACE_TEST_IMPL(SCALAR)                                                       \
+    TEST_CASE(fmt::format("Test In-Place Transpose -- {}", STRINGIFY(SCALAR)), "[array-lib]") {    \
+        auto dims    = GENERATE(std::array<int64_t, 2> {1, 1},                                     \
+                                std::array<int64_t, 2> {64, 64},                                   \
+                                std::array<int64_t, 2> {130, 130},                                 \
+                                std::array<int64_t, 2> {1, 17},                                    \
+                                std::array<int64_t, 2> {7, 13},                                    \
+                                std::array<int64_t, 2> {12, 18},                                   \
+                                std::array<int64_t, 2> {64, 32},                                   \
+                                std::array<int64_t, 2> {130, 257});                                \
+        auto threads = GENERATE(1, 4);                                                             \
+                                                                                                   \
+        int64_t rows = dims[0], cols = dims[1];                                                    \
+        lrc::Array<SCALAR> a(lrc::Shape({rows, cols}));                                            \
+        for (int64_t i = 0; i < rows * cols; ++i) a.storage()[i] = SCALAR(i % 97);                 \
+        lrc::Array<SCALAR> expected = lrc::transpose(a);                                           \
+                                                                                                   \
+        ThreadingGuard threading(threads, 100);                                                    \
+        lrc::transposeInPlace(a);                                                                  \
+                                                                                                   \
+        REQUIRE(a.shape() == lrc::Shape({cols, rows}));                                            \
+        for (int64_t i = 0; i < rows * cols; ++i) {                                                \
+            REQUIRE(a.storage()[i] == expected.storage()[i]);                                      \
+        }                                                                                          \
+    }
+
+TRANSPOSE_IN_PLACE_TEST_IMPL(int32_t)
+TRANSPOSE_IN_PLACE_TEST_IMPL(float)
+TRANSPOSE_IN_PLACE_TEST_IMPL(double)
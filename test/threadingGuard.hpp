@@ -0,0 +1,38 @@
+#ifndef LIBRAPID_TEST_THREADING_GUARD_HPP
+#define LIBRAPID_TEST_THREADING_GUARD_HPP
+
+#include <librapid>
+
+/// \brief Set the number of threads and the multithreading threshold for the rest of a scope
+///
+/// Both are restored when the guard is destroyed, so a failing ``REQUIRE`` cannot leak them
+/// into later tests.
+class ThreadingGuard {
+public:
+    /// \param numThreads Number of threads to use
+    explicit ThreadingGuard(size_t numThreads) :
+            ThreadingGuard(numThreads, librapid::global::multithreadThreshold) {}
+
+    /// \param numThreads Number of threads to use
+    /// \param multithreadThreshold Number of elements above which to use multiple threads
+    ThreadingGuard(size_t numThreads, size_t multithreadThreshold) :
+            m_numThreads(librapid::getNumThreads()),
+            m_multithreadThreshold(librapid::global::multithreadThreshold) {
+        librapid::setNumThreads(numThreads);
+        librapid::global::multithreadThreshold = multithreadThreshold;
+    }
+
+    ThreadingGuard(const ThreadingGuard &)            = delete;
+    ThreadingGuard &operator=(const ThreadingGuard &) = delete;
+
+    ~ThreadingGuard() {
+        librapid::setNumThreads(m_numThreads);
+        librapid::global::multithreadThreshold = m_multithreadThreshold;
+    }
+
+private:
+    size_t m_numThreads;
+    size_t m_multithreadThreshold;
+};
+
+#endif // LIBRAPID_TEST_THREADING_GUARD_HPP